@@ -0,0 +1,248 @@
+// Benchmark the kernels of the time loop which access the wavefield storage.
+//
+// The assembly is generated from a regular specfem configuration file. For
+// every medium present in the mesh, the following kernels are timed on the
+// forward wavefield:
+//
+// - the Newmark predictor and corrector sweeps over the global points
+// - the stiffness interaction, which gathers the displacement and atomically
+//   scatters the acceleration of every quadrature point
+// - the division of the acceleration by the mass matrix
+// - a host/device synchronization of the wavefield
+//
+// The wavefield is stored either as four LayoutLeft arrays (default) or as a
+// single record per global point. The layout is chosen when configuring the
+// build. Compare both layouts by running the benchmark from two builds:
+//
+//   cmake -S . -B build-separate -DBUILD_BENCHMARKS=ON
+//   cmake -S . -B build-interleaved -DBUILD_BENCHMARKS=ON \
+//       -DENABLE_INTERLEAVED_FIELDS=ON
+
+#include "compute/assembly/assembly.hpp"
+#include "constants.hpp"
+#include "enumerations/material_definitions.hpp"
+#include "kokkos_kernels/impl/compute_stiffness_interaction.hpp"
+#include "kokkos_kernels/impl/divide_mass_matrix.hpp"
+#include "program/simulation.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "timescheme/newmark.hpp"
+#include "yaml-cpp/yaml.h"
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace {
+
+constexpr auto dimension = specfem::dimension::type::dim2;
+constexpr auto wavefield = specfem::wavefield::simulation_field::forward;
+constexpr int ngll = 5;
+
+#ifdef ENABLE_INTERLEAVED_FIELDS
+const std::string layout = "interleaved";
+#else
+const std::string layout = "separate";
+#endif
+
+boost::program_options::options_description define_args() {
+  namespace po = boost::program_options;
+
+  po::options_description desc{ "======================================\n"
+                                "------Wavefield storage benchmark-----\n"
+                                "======================================" };
+
+  desc.add_options()("help,h", "Print this help message")(
+      "parameters_file,p", po::value<std::string>(),
+      "Location to parameters file")(
+      "default_file,d",
+      po::value<std::string>()->default_value(__default_file__),
+      "Location of default parameters file.")(
+      "repeat,n", po::value<int>()->default_value(100),
+      "Number of times each kernel is executed");
+
+  return desc;
+}
+
+int parse_args(int argc, char **argv,
+               boost::program_options::variables_map &vm) {
+
+  const auto desc = define_args();
+  boost::program_options::store(
+      boost::program_options::parse_command_line(argc, argv, desc), vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+
+  if (!vm.count("parameters_file")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+
+  return 1;
+}
+
+template <specfem::element::medium_tag MediumTag>
+specfem::compute::impl::field_impl<dimension, MediumTag> &
+get_field(specfem::compute::assembly &assembly) {
+  if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
+    return assembly.fields.forward.elastic;
+  } else {
+    return assembly.fields.forward.acoustic;
+  }
+}
+
+template <specfem::element::medium_tag MediumTag>
+void compute_stiffness_interaction(const specfem::compute::assembly &assembly) {
+
+#define CALL_STIFFNESS_INTERACTION(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG,    \
+                                   BOUNDARY_TAG)                               \
+  if constexpr (MediumTag == GET_TAG(MEDIUM_TAG)) {                            \
+    specfem::kokkos_kernels::impl::compute_stiffness_interaction<              \
+        dimension, wavefield, ngll, GET_TAG(MEDIUM_TAG),                       \
+        GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(assembly, 0);            \
+  }
+
+  CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+      CALL_STIFFNESS_INTERACTION,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+              WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef CALL_STIFFNESS_INTERACTION
+}
+
+// Returns the average time per call in seconds
+template <typename FunctionType>
+double time_kernel(const FunctionType &function, const int nrepeat) {
+  // warm-up
+  function();
+  Kokkos::fence();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nrepeat; ++i) {
+    function();
+  }
+  Kokkos::fence();
+  const auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double>(end - start).count() / nrepeat;
+}
+
+template <specfem::element::medium_tag MediumTag>
+void benchmark(specfem::compute::assembly &assembly,
+               specfem::time_scheme::time_scheme &time_scheme,
+               const int nrepeat) {
+  auto &field = get_field<MediumTag>(assembly);
+  const int nglob = field.nglob;
+  const int nelements =
+      assembly.element_types.get_elements_on_host(MediumTag).extent(0);
+
+  if (nelements == 0)
+    return;
+
+  const int npoints = nelements * ngll * ngll;
+
+  // Random wavefield and a positive inverse mass, such that the kernels do
+  // not operate on zeros
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultExecutionSpace> pool(2024);
+  Kokkos::fill_random(field.field, pool, -1.0, 1.0);
+  Kokkos::fill_random(field.field_dot, pool, -1.0, 1.0);
+  Kokkos::fill_random(field.field_dot_dot, pool, -1.0, 1.0);
+  Kokkos::fill_random(field.mass_inverse, pool, 0.5, 1.0);
+  Kokkos::fence();
+
+  const double newmark_time = time_kernel(
+      [&]() {
+        time_scheme.apply_predictor_phase_forward(MediumTag);
+        time_scheme.apply_corrector_phase_forward(MediumTag);
+      },
+      nrepeat);
+
+  const double stiffness_time = time_kernel(
+      [&]() { compute_stiffness_interaction<MediumTag>(assembly); }, nrepeat);
+
+  const double mass_time = time_kernel(
+      [&]() {
+        specfem::kokkos_kernels::impl::divide_mass_matrix<dimension, wavefield,
+                                                          MediumTag>(
+            assembly);
+      },
+      nrepeat);
+
+  const double sync_time = time_kernel(
+      [&]() {
+        field.template sync_fields<specfem::sync::kind::DeviceToHost>();
+        field.template sync_fields<specfem::sync::kind::HostToDevice>();
+      },
+      nrepeat);
+
+  Kokkos::deep_copy(field.field, 0.0);
+  Kokkos::deep_copy(field.field_dot, 0.0);
+  Kokkos::deep_copy(field.field_dot_dot, 0.0);
+  Kokkos::deep_copy(field.mass_inverse, 0.0);
+
+  const auto print = [&](const std::string &name, const double time,
+                         const int n) {
+    std::cout << std::left << std::setw(12)
+              << specfem::element::to_string(MediumTag) << std::setw(16)
+              << name << std::right << std::setw(10) << n << std::setw(16)
+              << std::scientific << std::setprecision(3) << time / n
+              << std::endl;
+  };
+
+  print("newmark", newmark_time, nglob);
+  print("stiffness", stiffness_time, npoints);
+  print("mass matrix", mass_time, nglob);
+  print("sync", sync_time, nglob);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  // Initialize MPI
+  specfem::MPI::MPI *mpi = new specfem::MPI::MPI(&argc, &argv);
+  // Initialize Kokkos
+  Kokkos::initialize(argc, argv);
+  {
+    boost::program_options::variables_map vm;
+    if (parse_args(argc, argv, vm)) {
+      const std::string parameters_file =
+          vm["parameters_file"].as<std::string>();
+      const std::string default_file = vm["default_file"].as<std::string>();
+      const int nrepeat = vm["repeat"].as<int>();
+
+      specfem::program::simulation simulation(
+          YAML::LoadFile(parameters_file), YAML::LoadFile(default_file), mpi);
+      auto &assembly = simulation.get_assembly();
+
+      // The time step does not change the cost of the kernels
+      specfem::time_scheme::newmark<specfem::simulation::type::forward>
+          time_scheme(1, 1, 1e-3, 0.0);
+      time_scheme.link_assembly(assembly);
+
+      std::cout << "Wavefield layout: " << layout << std::endl;
+      std::cout << std::left << std::setw(12) << "Medium" << std::setw(16)
+                << "Kernel" << std::right << std::setw(10) << "npoints"
+                << std::setw(16) << "time [s/pt]" << std::endl;
+
+#define BENCHMARK_MEDIUM(DIMENSION_TAG, MEDIUM_TAG)                            \
+  benchmark<GET_TAG(MEDIUM_TAG)>(assembly, time_scheme, nrepeat);
+
+      CALL_MACRO_FOR_ALL_MEDIUM_TAGS(
+          BENCHMARK_MEDIUM, WHERE(DIMENSION_TAG_DIM2)
+                                WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC))
+
+#undef BENCHMARK_MEDIUM
+    }
+  }
+  // Finalize Kokkos
+  Kokkos::finalize();
+  // Finalize MPI
+  delete mpi;
+  return 0;
+}
@@ -0,0 +1,241 @@
+// Benchmark the stiffness kernels with and without precomputed fused stiffness
+// coefficients.
+//
+// The assembly is generated from a regular specfem configuration file. For
+// every medium/property combination present in the mesh, the stiffness
+// interaction of the forward wavefield is timed using the partial derivatives
+// and material properties (default mode) and using fused stiffness
+// coefficients. The maximum difference in the computed acceleration between
+// the two modes is reported as a sanity check.
+
+#include "compute/assembly/assembly.hpp"
+#include "constants.hpp"
+#include "enumerations/material_definitions.hpp"
+#include "kokkos_kernels/impl/compute_stiffness_interaction.hpp"
+#include "program/simulation.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "yaml-cpp/yaml.h"
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace {
+
+constexpr auto dimension = specfem::dimension::type::dim2;
+constexpr auto wavefield = specfem::wavefield::simulation_field::forward;
+constexpr int ngll = 5;
+
+boost::program_options::options_description define_args() {
+  namespace po = boost::program_options;
+
+  po::options_description desc{ "======================================\n"
+                                "---Stiffness coefficients benchmark---\n"
+                                "======================================" };
+
+  desc.add_options()("help,h", "Print this help message")(
+      "parameters_file,p", po::value<std::string>(),
+      "Location to parameters file")(
+      "default_file,d",
+      po::value<std::string>()->default_value(__default_file__),
+      "Location of default parameters file.")(
+      "repeat,n", po::value<int>()->default_value(100),
+      "Number of times each kernel is executed");
+
+  return desc;
+}
+
+int parse_args(int argc, char **argv,
+               boost::program_options::variables_map &vm) {
+
+  const auto desc = define_args();
+  boost::program_options::store(
+      boost::program_options::parse_command_line(argc, argv, desc), vm);
+
+  if (vm.count("help")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+
+  if (!vm.count("parameters_file")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+
+  return 1;
+}
+
+template <specfem::element::medium_tag MediumTag>
+specfem::compute::impl::field_impl<dimension, MediumTag> &
+get_field(specfem::compute::assembly &assembly) {
+  if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
+    return assembly.fields.forward.elastic;
+  } else {
+    return assembly.fields.forward.acoustic;
+  }
+}
+
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+void compute_stiffness_interaction(const specfem::compute::assembly &assembly) {
+
+#define CALL_STIFFNESS_INTERACTION(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG,    \
+                                   BOUNDARY_TAG)                               \
+  if constexpr (MediumTag == GET_TAG(MEDIUM_TAG) &&                            \
+                PropertyTag == GET_TAG(PROPERTY_TAG)) {                        \
+    specfem::kokkos_kernels::impl::compute_stiffness_interaction<              \
+        dimension, wavefield, ngll, GET_TAG(MEDIUM_TAG),                       \
+        GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(assembly, 0);            \
+  }
+
+  CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+      CALL_STIFFNESS_INTERACTION,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+              WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef CALL_STIFFNESS_INTERACTION
+}
+
+// Returns the average time per call in seconds
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+double time_stiffness_interaction(const specfem::compute::assembly &assembly,
+                                  const int nrepeat) {
+  // warm-up
+  compute_stiffness_interaction<MediumTag, PropertyTag>(assembly);
+  Kokkos::fence();
+
+  const auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < nrepeat; ++i) {
+    compute_stiffness_interaction<MediumTag, PropertyTag>(assembly);
+  }
+  Kokkos::fence();
+  const auto end = std::chrono::steady_clock::now();
+
+  return std::chrono::duration<double>(end - start).count() / nrepeat;
+}
+
+// Acceleration computed from a single stiffness interaction
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+specfem::kokkos::HostView2d<type_real, Kokkos::LayoutLeft>
+single_stiffness_interaction(specfem::compute::assembly &assembly) {
+  auto &field = get_field<MediumTag>(assembly);
+  Kokkos::deep_copy(field.field_dot_dot, 0.0);
+  compute_stiffness_interaction<MediumTag, PropertyTag>(assembly);
+  Kokkos::fence();
+
+  field.template sync_fields<specfem::sync::kind::DeviceToHost>();
+  specfem::kokkos::HostView2d<type_real, Kokkos::LayoutLeft> result(
+      "result", field.field_dot_dot.extent(0), field.field_dot_dot.extent(1));
+  Kokkos::deep_copy(result, field.h_field_dot_dot);
+  return result;
+}
+
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+void benchmark(specfem::compute::assembly &assembly, const int nrepeat) {
+  const int nelements =
+      assembly.element_types.get_elements_on_host(MediumTag, PropertyTag)
+          .extent(0);
+
+  if (nelements == 0)
+    return;
+
+  // Random displacement field
+  auto &field = get_field<MediumTag>(assembly);
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultExecutionSpace> pool(2024);
+  Kokkos::fill_random(field.field, pool, -1.0, 1.0);
+  Kokkos::fence();
+
+  const int npoints = nelements * ngll * ngll;
+
+  // Default mode
+  assembly.stiffness_coefficients = {};
+  const auto reference =
+      single_stiffness_interaction<MediumTag, PropertyTag>(assembly);
+  const double default_time =
+      time_stiffness_interaction<MediumTag, PropertyTag>(assembly, nrepeat);
+
+  // Fused mode
+  assembly.compute_stiffness_coefficients();
+  const auto fused =
+      single_stiffness_interaction<MediumTag, PropertyTag>(assembly);
+  const double fused_time =
+      time_stiffness_interaction<MediumTag, PropertyTag>(assembly, nrepeat);
+
+  type_real max_value = 0.0;
+  type_real max_error = 0.0;
+  for (std::size_t iglob = 0; iglob < reference.extent(0); ++iglob) {
+    for (std::size_t icomp = 0; icomp < reference.extent(1); ++icomp) {
+      max_value = std::max(max_value, std::abs(reference(iglob, icomp)));
+      max_error = std::max(max_error, std::abs(reference(iglob, icomp) -
+                                               fused(iglob, icomp)));
+    }
+  }
+
+  assembly.stiffness_coefficients = {};
+  Kokkos::deep_copy(field.field, 0.0);
+  Kokkos::deep_copy(field.field_dot_dot, 0.0);
+
+  std::cout << std::left << std::setw(24)
+            << specfem::element::to_string(MediumTag, PropertyTag)
+            << std::right << std::setw(10) << nelements << std::setw(16)
+            << std::scientific << std::setprecision(3)
+            << default_time / npoints << std::setw(16)
+            << fused_time / npoints << std::setw(10) << std::fixed
+            << std::setprecision(2) << default_time / fused_time
+            << std::setw(16) << std::scientific << std::setprecision(3)
+            << ((max_value > 0.0) ? max_error / max_value : max_error)
+            << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  // Initialize MPI
+  specfem::MPI::MPI *mpi = new specfem::MPI::MPI(&argc, &argv);
+  // Initialize Kokkos
+  Kokkos::initialize(argc, argv);
+  {
+    boost::program_options::variables_map vm;
+    if (parse_args(argc, argv, vm)) {
+      const std::string parameters_file =
+          vm["parameters_file"].as<std::string>();
+      const std::string default_file = vm["default_file"].as<std::string>();
+      const int nrepeat = vm["repeat"].as<int>();
+
+      specfem::program::simulation simulation(
+          YAML::LoadFile(parameters_file), YAML::LoadFile(default_file), mpi);
+      auto &assembly = simulation.get_assembly();
+
+      std::cout << std::left << std::setw(24) << "Element type" << std::right
+                << std::setw(10) << "nspec" << std::setw(16)
+                << "default [s/pt]" << std::setw(16) << "fused [s/pt]"
+                << std::setw(10) << "speedup" << std::setw(16) << "rel. error"
+                << std::endl;
+
+#define BENCHMARK_MATERIAL_SYSTEM(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG)     \
+  benchmark<GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG)>(assembly, nrepeat);
+
+      CALL_MACRO_FOR_ALL_MATERIAL_SYSTEMS(
+          BENCHMARK_MATERIAL_SYSTEM,
+          WHERE(DIMENSION_TAG_DIM2)
+              WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+                  WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
+
+#undef BENCHMARK_MATERIAL_SYSTEM
+    }
+  }
+  // Finalize Kokkos
+  Kokkos::finalize();
+  // Finalize MPI
+  delete mpi;
+  return 0;
+}
@@ -1,6 +1,7 @@
 #ifndef _SPECFEM_IO_ASCII_IMPL_FILE_HPP
 #define _SPECFEM_IO_ASCII_IMPL_FILE_HPP
 
+#include "IO/dataset_options.hpp"
 #include "group.hpp"
 #include <boost/filesystem.hpp>
 #include <iostream>
@@ -68,6 +69,16 @@ public:
    * @param name Name of the folder
    */
   File(const char *name) : File(std::string(name)) {}
+
+  /**
+   * @brief Construct a new ASCII File object with the given name. Storage
+   * options are ignored for ASCII files
+   *
+   * @param name Name of the folder
+   * @param options Chunking and compression options (ignored)
+   */
+  File(const std::string &name, const specfem::IO::dataset_options &options)
+      : File(name) {}
   ///@}
 
   /**
@@ -85,6 +96,23 @@ public:
                                                                name, data);
   }
 
+  /**
+   * @brief Create a new dataset within the file. Storage options are ignored
+   * for ASCII files
+   *
+   * @tparam ViewType Kokkos view type of the data
+   * @param name Name of the dataset
+   * @param data Data to write
+   * @param options Chunking and compression options (ignored)
+   * @return specfem::IO::impl::ASCII::Dataset<ViewType, OpType> Dataset object
+   */
+  template <typename ViewType>
+  specfem::IO::impl::ASCII::Dataset<ViewType, OpType>
+  createDataset(const std::string &name, const ViewType data,
+                const specfem::IO::dataset_options &options) {
+    return createDataset(name, data);
+  }
+
   /**
    * @brief Create a new group within the file
    *
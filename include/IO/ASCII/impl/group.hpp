@@ -1,6 +1,7 @@
 #ifndef _SPECFEM_IO_ASCII_IMPL_GROUP_HPP
 #define _SPECFEM_IO_ASCII_IMPL_GROUP_HPP
 
+#include "IO/dataset_options.hpp"
 #include <boost/filesystem.hpp>
 #include <iostream>
 #include <sstream>
@@ -86,6 +87,23 @@ public:
                                                                name, data);
   }
 
+  /**
+   * @brief Create a new dataset within the group. Storage options are ignored
+   * for ASCII files
+   *
+   * @tparam ViewType Kokkos view type of the data
+   * @param name Name of the dataset
+   * @param data Data to write
+   * @param options Chunking and compression options (ignored)
+   * @return specfem::IO::impl::ASCII::Dataset<ViewType, OpType> Dataset object
+   */
+  template <typename ViewType>
+  specfem::IO::impl::ASCII::Dataset<ViewType, OpType>
+  createDataset(const std::string &name, const ViewType data,
+                const specfem::IO::dataset_options &options) {
+    return createDataset(name, data);
+  }
+
   /**
    * @brief Create a new group within the group
    *
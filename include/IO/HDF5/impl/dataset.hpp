@@ -5,6 +5,7 @@
 #include "H5Cpp.h"
 #endif
 
+#include "IO/dataset_options.hpp"
 #include "datasetbase.hpp"
 #include <memory>
 #include <string>
@@ -93,6 +94,34 @@ public:
   Dataset(std::unique_ptr<H5::Group> &group, const std::string &name,
           const ViewType data);
 
+  /**
+   * @brief Construct a new HDF5 Dataset object within an HDF5 file with the
+   * given name and storage options
+   *
+   * Only available for write operations.
+   *
+   * @param file HDF5 file object to create the dataset in
+   * @param name Name of the dataset
+   * @param data Data to write
+   * @param options Chunking and compression options
+   */
+  Dataset(std::unique_ptr<H5::H5File> &file, const std::string &name,
+          const ViewType data, const specfem::IO::dataset_options &options);
+
+  /**
+   * @brief Construct a new HDF5 Dataset object within an HDF5 group with the
+   * given name and storage options
+   *
+   * Only available for write operations.
+   *
+   * @param group HDF5 group object to create the dataset in
+   * @param name Name of the dataset
+   * @param data Data to write
+   * @param options Chunking and compression options
+   */
+  Dataset(std::unique_ptr<H5::Group> &group, const std::string &name,
+          const ViewType data, const specfem::IO::dataset_options &options);
+
   ///@}
 
   /**
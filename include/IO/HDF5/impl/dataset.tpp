@@ -45,6 +45,36 @@ specfem::IO::impl::HDF5::Dataset<ViewType, OpType>::Dataset(
                       }(),
                       native_type::type()) {}
 
+template <typename ViewType, typename OpType>
+specfem::IO::impl::HDF5::Dataset<ViewType, OpType>::Dataset(
+    std::unique_ptr<H5::H5File> &file, const std::string &name,
+    const ViewType data, const specfem::IO::dataset_options &options)
+    : data(data), DatasetBase<OpType>(
+                      file, name, rank,
+                      [&data]() -> hsize_t * {
+                        hsize_t *dims = new hsize_t[rank];
+                        for (int i = 0; i < rank; i++) {
+                          dims[i] = data.extent(i);
+                        }
+                        return dims;
+                      }(),
+                      native_type::type(), options) {}
+
+template <typename ViewType, typename OpType>
+specfem::IO::impl::HDF5::Dataset<ViewType, OpType>::Dataset(
+    std::unique_ptr<H5::Group> &group, const std::string &name,
+    const ViewType data, const specfem::IO::dataset_options &options)
+    : data(data), DatasetBase<OpType>(
+                      group, name, rank,
+                      [&data]() -> hsize_t * {
+                        hsize_t *dims = new hsize_t[rank];
+                        for (int i = 0; i < rank; i++) {
+                          dims[i] = data.extent(i);
+                        }
+                        return dims;
+                      }(),
+                      native_type::type(), options) {}
+
 template <typename ViewType, typename OpType>
 void specfem::IO::impl::HDF5::Dataset<ViewType, OpType>::write() {
   if (std::is_same_v<MemSpace, specfem::kokkos::HostMemSpace>) {
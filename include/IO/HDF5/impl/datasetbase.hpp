@@ -5,10 +5,14 @@
 #include "H5Cpp.h"
 #endif
 
+#include "IO/dataset_options.hpp"
 #include "IO/operators.hpp"
 #include "native_type.hpp"
+#include <algorithm>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace specfem {
 namespace IO {
@@ -22,18 +26,20 @@ template <> class DatasetBase<specfem::IO::write> {
 protected:
   template <typename AtomType>
   DatasetBase(std::unique_ptr<H5::H5File> &file, const std::string &name,
-              const int rank, const hsize_t *dims, const AtomType &type)
+              const int rank, const hsize_t *dims, const AtomType &type,
+              const specfem::IO::dataset_options &options = {})
       : dataspace(std::make_unique<H5::DataSpace>(rank, dims)) {
-    dataset = std::make_unique<H5::DataSet>(
-        file->createDataSet(name, type, *dataspace));
+    dataset = std::make_unique<H5::DataSet>(file->createDataSet(
+        name, type, *dataspace, create_properties(rank, dims, type, options)));
   }
 
   template <typename AtomType>
   DatasetBase(std::unique_ptr<H5::Group> &group, const std::string &name,
-              const int rank, const hsize_t *dims, const AtomType &type)
+              const int rank, const hsize_t *dims, const AtomType &type,
+              const specfem::IO::dataset_options &options = {})
       : dataspace(std::make_unique<H5::DataSpace>(rank, dims)) {
-    dataset = std::make_unique<H5::DataSet>(
-        group->createDataSet(name, type, *dataspace));
+    dataset = std::make_unique<H5::DataSet>(group->createDataSet(
+        name, type, *dataspace, create_properties(rank, dims, type, options)));
   }
 
   template <typename value_type> void write(const value_type *data) {
@@ -51,6 +57,51 @@ protected:
 private:
   std::unique_ptr<H5::DataSet> dataset;
   std::unique_ptr<H5::DataSpace> dataspace;
+
+  // Dataset creation properties. Chunks span the fastest varying dimensions
+  // entirely and are split along the slowest varying ones to stay close to
+  // options.chunk_bytes
+  template <typename AtomType>
+  static H5::DSetCreatPropList
+  create_properties(const int rank, const hsize_t *dims, const AtomType &type,
+                    const specfem::IO::dataset_options &options) {
+    H5::DSetCreatPropList properties;
+
+    // Empty datasets cannot be chunked
+    if (!options.is_chunked() || rank == 0 ||
+        std::any_of(dims, dims + rank, [](hsize_t n) { return n == 0; })) {
+      return properties;
+    }
+
+    std::vector<hsize_t> chunk(dims, dims + rank);
+    const hsize_t size = type.getSize();
+    hsize_t elements = 1;
+    for (int i = 0; i < rank; ++i) {
+      elements *= chunk[i];
+    }
+
+    for (int i = 0; i < rank && elements * size > options.chunk_bytes; ++i) {
+      const hsize_t rest = elements / chunk[i];
+      chunk[i] = std::max<hsize_t>(1, options.chunk_bytes / (size * rest));
+      elements = rest * chunk[i];
+    }
+
+    properties.setChunk(rank, chunk.data());
+
+    using filter = specfem::IO::dataset_options::filter;
+    if (options.compression != filter::none) {
+      if (!H5Zfilter_avail(H5Z_FILTER_DEFLATE)) {
+        throw std::runtime_error(
+            "HDF5 library was built without the deflate filter");
+      }
+      if (options.compression == filter::shuffle_deflate) {
+        properties.setShuffle();
+      }
+      properties.setDeflate(options.level);
+    }
+
+    return properties;
+  }
 };
 
 template <> class DatasetBase<specfem::IO::read> {
@@ -5,6 +5,7 @@
 #include "H5Cpp.h"
 #endif
 
+#include "IO/dataset_options.hpp"
 #include "IO/operators.hpp"
 #include "dataset.hpp"
 #include "group.hpp"
@@ -25,6 +26,9 @@ public:
   File(const char *name) {
     throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
   }
+  File(const std::string &name, const specfem::IO::dataset_options &options) {
+    throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
+  }
 
   template <typename ViewType>
   specfem::IO::impl::HDF5::Dataset<ViewType, OpType>
@@ -32,6 +36,13 @@ public:
     throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
   }
 
+  template <typename ViewType>
+  specfem::IO::impl::HDF5::Dataset<ViewType, OpType>
+  createDataset(const std::string &name, const ViewType data,
+                const specfem::IO::dataset_options &options) {
+    throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
+  }
+
   specfem::IO::impl::HDF5::Group<OpType> createGroup(const std::string &name) {
     throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
   }
@@ -87,10 +98,21 @@ public:
   File(const char *name)
       : file(std::make_unique<H5::H5File>(std::string(name) + ".h5",
                                           H5F_ACC_TRUNC)) {}
+  /**
+   * @brief Construct a new HDF5 File object with the given name and default
+   * storage options for the datasets created within the file
+   *
+   * @param name Name of the file
+   * @param options Chunking and compression options
+   */
+  File(const std::string &name, const specfem::IO::dataset_options &options)
+      : file(std::make_unique<H5::H5File>(name + ".h5", H5F_ACC_TRUNC)),
+        options(options) {}
   ///@}
 
   /**
-   * @brief Create a new dataset within the file
+   * @brief Create a new dataset within the file using the default storage
+   * options of the file
    *
    * @tparam ViewType Kokkos view type of the data
    * @param name Name of the dataset
@@ -100,23 +122,43 @@ public:
   template <typename ViewType>
   specfem::IO::impl::HDF5::Dataset<ViewType, OpType>
   createDataset(const std::string &name, const ViewType data) {
-    return specfem::IO::impl::HDF5::Dataset<ViewType, OpType>(file, name, data);
+    return specfem::IO::impl::HDF5::Dataset<ViewType, OpType>(file, name, data,
+                                                              options);
   }
 
   /**
-   * @brief Create a new group within the file
+   * @brief Create a new dataset within the file
+   *
+   * @tparam ViewType Kokkos view type of the data
+   * @param name Name of the dataset
+   * @param data Data to be written
+   * @param options Chunking and compression options of the dataset
+   * @return specfem::IO::impl::HDF5::Dataset<ViewType, OpType> Dataset object
+   */
+  template <typename ViewType>
+  specfem::IO::impl::HDF5::Dataset<ViewType, OpType>
+  createDataset(const std::string &name, const ViewType data,
+                const specfem::IO::dataset_options &options) {
+    return specfem::IO::impl::HDF5::Dataset<ViewType, OpType>(file, name, data,
+                                                              options);
+  }
+
+  /**
+   * @brief Create a new group within the file. The group inherits the storage
+   * options of the file
    *
    * @param name Name of the group
    * @return specfem::IO::impl::HDF5::Group<OpType> Group object
    */
   specfem::IO::impl::HDF5::Group<OpType> createGroup(const std::string &name) {
-    return specfem::IO::impl::HDF5::Group<OpType>(file, name);
+    return specfem::IO::impl::HDF5::Group<OpType>(file, name, options);
   }
 
   ~File() { file->close(); }
 
 private:
-  std::unique_ptr<H5::H5File> file; ///< pointer to HDF5 file object
+  std::unique_ptr<H5::H5File> file;     ///< pointer to HDF5 file object
+  specfem::IO::dataset_options options; ///< Default dataset storage options
 };
 
 /**
@@ -5,6 +5,7 @@
 #include "H5Cpp.h"
 #endif
 
+#include "IO/dataset_options.hpp"
 #include "IO/operators.hpp"
 #include "dataset.hpp"
 #include <memory>
@@ -28,6 +29,13 @@ public:
     throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
   }
 
+  template <typename ViewType>
+  specfem::IO::impl::HDF5::Dataset<ViewType, OpType>
+  createDataset(const std::string &name, const ViewType data,
+                const specfem::IO::dataset_options &options) {
+    throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
+  }
+
   specfem::IO::impl::HDF5::Group<OpType> createGroup(const std::string &name) {
     throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
   }
@@ -74,9 +82,12 @@ public:
    *
    * @param file HDF5 file object to create the group in
    * @param name Name of the group
+   * @param options Default storage options of the datasets in the group
    */
-  Group(std::unique_ptr<H5::H5File> &file, const std::string &name)
-      : group(std::make_unique<H5::Group>(file->createGroup(name))){};
+  Group(std::unique_ptr<H5::H5File> &file, const std::string &name,
+        const specfem::IO::dataset_options &options = {})
+      : group(std::make_unique<H5::Group>(file->createGroup(name))),
+        options(options){};
 
   /**
    * @brief Construct a new HDF5 Group object within an HDF5 group with the
@@ -84,13 +95,17 @@ public:
    *
    * @param group HDF5 group object to create the group in
    * @param name Name of the group
+   * @param options Default storage options of the datasets in the group
    */
-  Group(std::unique_ptr<H5::Group> &group, const std::string &name)
-      : group(std::make_unique<H5::Group>(group->createGroup(name))){};
+  Group(std::unique_ptr<H5::Group> &group, const std::string &name,
+        const specfem::IO::dataset_options &options = {})
+      : group(std::make_unique<H5::Group>(group->createGroup(name))),
+        options(options){};
   ///@}
 
   /**
-   * @brief Create a new dataset within the group
+   * @brief Create a new dataset within the group using the default storage
+   * options of the group
    *
    * @tparam ViewType Kokkos view type of the data
    * @param name Name of the dataset
@@ -101,23 +116,42 @@ public:
   specfem::IO::impl::HDF5::Dataset<ViewType, OpType>
   createDataset(const std::string &name, const ViewType data) {
     return specfem::IO::impl::HDF5::Dataset<ViewType, OpType>(group, name,
-                                                              data);
+                                                              data, options);
+  }
+
+  /**
+   * @brief Create a new dataset within the group
+   *
+   * @tparam ViewType Kokkos view type of the data
+   * @param name Name of the dataset
+   * @param data Data to be written
+   * @param options Chunking and compression options of the dataset
+   * @return specfem::IO::impl::HDF5::Dataset<ViewType, OpType> Dataset object
+   */
+  template <typename ViewType>
+  specfem::IO::impl::HDF5::Dataset<ViewType, OpType>
+  createDataset(const std::string &name, const ViewType data,
+                const specfem::IO::dataset_options &options) {
+    return specfem::IO::impl::HDF5::Dataset<ViewType, OpType>(group, name,
+                                                              data, options);
   }
 
   /**
-   * @brief Create a new group within the group
+   * @brief Create a new group within the group. The new group inherits the
+   * storage options of this group
    *
    * @param name Name of the group
    * @return specfem::IO::impl::HDF5::Group<OpType> Group object
    */
   specfem::IO::impl::HDF5::Group<OpType> createGroup(const std::string &name) {
-    return specfem::IO::impl::HDF5::Group<OpType>(group, name);
+    return specfem::IO::impl::HDF5::Group<OpType>(group, name, options);
   }
 
   ~Group() { group->close(); }
 
 private:
-  std::unique_ptr<H5::Group> group; ///< pointer to HDF5 group object
+  std::unique_ptr<H5::Group> group;     ///< pointer to HDF5 group object
+  specfem::IO::dataset_options options; ///< Default dataset storage options
 };
 
 /**
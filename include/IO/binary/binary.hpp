@@ -0,0 +1,42 @@
+#ifndef _SPECFEM_IO_BINARY_HPP
+#define _SPECFEM_IO_BINARY_HPP
+
+#include "impl/dataset.hpp"
+#include "impl/dataset.tpp"
+#include "impl/file.hpp"
+#include "impl/group.hpp"
+
+namespace specfem {
+namespace IO {
+
+/**
+ * @brief
+ *
+ *
+ * Binary I/O writes the raw little endian bytes of every view. The heirarchy
+ * of the format is the same as ASCII I/O - files and groups are directories.
+ * Every dataset is stored as a .bin file holding the data in the layout of the
+ * view, and a .yaml header holding the type and dimensions of the data. Reads
+ * map the .bin file into memory and copy it directly into the destination
+ * view, which avoids parsing and staging buffers when reloading properties,
+ * kernels or wavefields.
+ *
+ * @tparam OpType Operation type (read/write)
+ */
+template <typename OpType> class binary {
+public:
+  using File =
+      specfem::IO::impl::binary::File<OpType>; ///< Binary file implementation
+  using Group =
+      specfem::IO::impl::binary::Group<OpType>; ///< Binary group
+                                                ///< implementation
+  template <typename ViewType>
+  using Dataset =
+      specfem::IO::impl::binary::Dataset<ViewType, OpType>; ///< Binary dataset
+                                                            ///< implementation
+};
+
+} // namespace IO
+} // namespace specfem
+
+#endif /* _SPECFEM_IO_BINARY_HPP */
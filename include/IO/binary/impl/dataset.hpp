@@ -0,0 +1,91 @@
+#ifndef _SPECFEM_IO_BINARY_IMPL_DATASET_HPP
+#define _SPECFEM_IO_BINARY_IMPL_DATASET_HPP
+
+#include "datasetbase.hpp"
+#include "native_type.hpp"
+#include <array>
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <string>
+
+namespace specfem {
+namespace IO {
+namespace impl {
+namespace binary {
+
+// Forward declaration
+template <typename OpType> class Group;
+template <typename OpType> class File;
+/**
+ * @brief Dataset class for binary IO
+ *
+ * The view is stored as raw bytes in the order of its layout. Only views with
+ * a contiguous span can be stored.
+ *
+ * @tparam ViewType Kokkos view type of the data
+ * @tparam OpType Operation type (read/write)
+ */
+template <typename ViewType, typename OpType>
+class Dataset : public DatasetBase<OpType> {
+public:
+#if KOKKOS_VERSION < 40100
+  constexpr static int rank = ViewType::rank; ///< Rank of the View
+#else
+  constexpr static int rank = ViewType::rank(); ///< Rank of the View
+#endif
+
+  using value_type =
+      typename ViewType::non_const_value_type; ///< Underlying type
+  using native_type =
+      typename specfem::IO::impl::binary::native_type<value_type>; ///< Type
+                                                                   ///< name
+                                                                   ///< stored
+                                                                   ///< in the
+                                                                   ///< header
+  using MemSpace = typename ViewType::memory_space; ///< Memory space
+
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Construct a new binary Dataset object within a folder with the
+   * given name
+   *
+   * @param folder_name Folder to create the dataset in
+   * @param name Name of the dataset
+   * @param data Data to write or read
+   * @throws std::runtime_error if the view is not contiguous
+   */
+  Dataset(boost::filesystem::path &folder_name, const std::string &name,
+          const ViewType data);
+  ///@}
+
+  /**
+   * @brief Write the data to the dataset
+   *
+   */
+  void write();
+
+  /**
+   * @brief Read the data from the dataset
+   *
+   * The file is mapped into memory and copied into the view in a single
+   * Kokkos::deep_copy. Device views are filled directly from the mapping.
+   */
+  void read();
+
+  ~Dataset() { DatasetBase<OpType>::close(); }
+
+private:
+  ViewType data; ///< Data to write or read
+
+  static std::array<std::size_t, rank> extents(const ViewType &data);
+};
+} // namespace binary
+} // namespace impl
+} // namespace IO
+} // namespace specfem
+
+#endif /* _SPECFEM_IO_BINARY_IMPL_DATASET_HPP */
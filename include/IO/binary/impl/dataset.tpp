@@ -0,0 +1,66 @@
+#ifndef _SPECFEM_IO_BINARY_IMPL_DATASET_TPP
+#define _SPECFEM_IO_BINARY_IMPL_DATASET_TPP
+
+#include "dataset.hpp"
+#include "datasetbase.hpp"
+#include "kokkos_abstractions.h"
+#include <Kokkos_Core.hpp>
+#include <sstream>
+#include <stdexcept>
+
+template <typename ViewType, typename OpType>
+std::array<std::size_t,
+           specfem::IO::impl::binary::Dataset<ViewType, OpType>::rank>
+specfem::IO::impl::binary::Dataset<ViewType, OpType>::extents(
+    const ViewType &data) {
+  if (!data.span_is_contiguous()) {
+    std::ostringstream oss;
+    oss << "ERROR : View " << data.label()
+        << " is not contiguous and cannot be stored as a binary dataset";
+    throw std::runtime_error(oss.str());
+  }
+
+  std::array<std::size_t, rank> dims;
+  for (int i = 0; i < rank; i++) {
+    dims[i] = data.extent(i);
+  }
+  return dims;
+}
+
+template <typename ViewType, typename OpType>
+specfem::IO::impl::binary::Dataset<ViewType, OpType>::Dataset(
+    boost::filesystem::path &folder_name, const std::string &name,
+    const ViewType data)
+    : data(data), DatasetBase<OpType>(folder_name, name, rank,
+                                      extents(data).data(),
+                                      native_type::name()) {}
+
+template <typename ViewType, typename OpType>
+void specfem::IO::impl::binary::Dataset<ViewType, OpType>::write() {
+  if constexpr (Kokkos::SpaceAccessibility<Kokkos::HostSpace,
+                                           MemSpace>::accessible) {
+    DatasetBase<OpType>::write(data.data());
+  } else {
+    auto host_data = Kokkos::create_mirror_view(data);
+    Kokkos::deep_copy(host_data, data);
+    DatasetBase<OpType>::write(host_data.data());
+  }
+}
+
+template <typename ViewType, typename OpType>
+void specfem::IO::impl::binary::Dataset<ViewType, OpType>::read() {
+  const auto mapping = DatasetBase<OpType>::template map<value_type>();
+
+  // Unmanaged host view over the mapping with the layout of the destination
+  using MappedView =
+      Kokkos::View<typename ViewType::const_data_type,
+                   typename ViewType::array_layout, Kokkos::HostSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  const MappedView mapped(static_cast<const value_type *>(mapping->data()),
+                          data.layout());
+
+  Kokkos::deep_copy(data, mapped);
+}
+
+#endif /* _SPECFEM_IO_BINARY_IMPL_DATASET_TPP */
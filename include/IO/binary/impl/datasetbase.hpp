@@ -0,0 +1,192 @@
+#ifndef _SPECFEM_IO_BINARY_IMPL_DATASETBASE_HPP
+#define _SPECFEM_IO_BINARY_IMPL_DATASETBASE_HPP
+
+#include "IO/operators.hpp"
+#include "mapped_file.hpp"
+#include "yaml-cpp/yaml.h"
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace specfem {
+namespace IO {
+namespace impl {
+namespace binary {
+
+// Datasets are stored in little endian byte order, which is the byte order of
+// every architecture we support. Refuse to read or write anything else.
+inline void check_byte_order() {
+  const std::uint16_t value = 1;
+  if (*reinterpret_cast<const std::uint8_t *>(&value) != 1) {
+    throw std::runtime_error(
+        "ERROR : Binary IO is only supported on little endian hosts");
+  }
+}
+
+template <typename OpType> class DatasetBase;
+
+template <> class DatasetBase<specfem::IO::write> {
+protected:
+  DatasetBase(const boost::filesystem::path &folder_path,
+              const std::string &name, const int rank,
+              const std::size_t *dims, const std::string &type)
+      : file_path(folder_path / boost::filesystem::path(name + ".bin")),
+        dims(dims, dims + rank) {
+
+    check_byte_order();
+
+    boost::filesystem::path header_path =
+        folder_path / boost::filesystem::path(name + ".yaml");
+    // Files are created empty. An existing dataset was created earlier
+    // through the same file or group
+    if (boost::filesystem::exists(file_path) ||
+        boost::filesystem::exists(header_path)) {
+      std::ostringstream oss;
+      oss << "ERROR : Dataset " << name << " already exists in "
+          << folder_path;
+      throw std::runtime_error(oss.str());
+    }
+
+    std::ofstream header(header_path.string());
+    if (!header.is_open()) {
+      std::ostringstream oss;
+      oss << "ERROR : Could not open file " << header_path;
+      throw std::runtime_error(oss.str());
+    }
+
+    header << "type: " << type << "\n";
+    header << "rank: " << rank << "\n";
+    header << "dims: [";
+    for (int i = 0; i < rank; ++i) {
+      header << (i ? ", " : "") << dims[i];
+    }
+    header << "]\n";
+
+    header.close();
+  }
+
+  template <typename value_type> void write(const value_type *data) const {
+
+    std::ofstream file(file_path.string(), std::ios::binary);
+    if (!file.is_open()) {
+      std::ostringstream oss;
+      oss << "ERROR : Could not open file " << file_path;
+      throw std::runtime_error(oss.str());
+    }
+
+    file.write(reinterpret_cast<const char *>(data),
+               this->size() * sizeof(value_type));
+
+    if (!file) {
+      std::ostringstream oss;
+      oss << "ERROR : Could not write file " << file_path;
+      throw std::runtime_error(oss.str());
+    }
+
+    file.close();
+  }
+
+  void close() const {};
+
+private:
+  boost::filesystem::path file_path;
+  std::vector<std::size_t> dims;
+
+  std::size_t size() const {
+    std::size_t total_elements = 1;
+    for (const auto dim : dims) {
+      total_elements *= dim;
+    }
+    return total_elements;
+  }
+};
+
+template <> class DatasetBase<specfem::IO::read> {
+protected:
+  DatasetBase(const boost::filesystem::path &folder_path,
+              const std::string &name, const int rank,
+              const std::size_t *dims, const std::string &type)
+      : file_path(folder_path / boost::filesystem::path(name + ".bin")),
+        dims(dims, dims + rank) {
+
+    check_byte_order();
+
+    // Read the header and check if the type and dimensions match
+    boost::filesystem::path header_path =
+        folder_path / boost::filesystem::path(name + ".yaml");
+    if (!boost::filesystem::exists(header_path)) {
+      std::ostringstream oss;
+      oss << "ERROR : Header file " << header_path << " does not exist";
+      throw std::runtime_error(oss.str());
+    }
+
+    const YAML::Node header = YAML::LoadFile(header_path.string());
+    if (!header["type"] || !header["rank"] || !header["dims"]) {
+      std::ostringstream oss;
+      oss << "ERROR : Header file " << header_path << " is corrupted";
+      throw std::runtime_error(oss.str());
+    }
+
+    if (header["type"].as<std::string>() != type) {
+      std::ostringstream oss;
+      oss << "Type of the dataset (" << header["type"].as<std::string>()
+          << ") does not match the view (" << type << ")";
+      throw std::runtime_error(oss.str());
+    }
+
+    const auto read_dims = header["dims"].as<std::vector<std::size_t> >();
+    if (header["rank"].as<int>() != rank || read_dims != this->dims) {
+      std::ostringstream oss;
+      oss << "Dimension of the dataset do not match the view";
+      throw std::runtime_error(oss.str());
+    }
+  }
+
+  /**
+   * @brief Map the dataset into memory
+   *
+   * @tparam value_type Type of the dataset
+   * @return std::unique_ptr<mapped_file> Mapping of the dataset
+   * @throws std::runtime_error if the size of the file does not match the
+   * dimensions of the dataset
+   */
+  template <typename value_type> std::unique_ptr<mapped_file> map() const {
+    auto mapping = std::make_unique<mapped_file>(file_path.string());
+
+    if (mapping->size() != this->size() * sizeof(value_type)) {
+      std::ostringstream oss;
+      oss << "ERROR : File " << file_path << " has " << mapping->size()
+          << " bytes. Expected " << this->size() * sizeof(value_type);
+      throw std::runtime_error(oss.str());
+    }
+
+    return mapping;
+  }
+
+  void close() const {};
+
+private:
+  boost::filesystem::path file_path;
+  std::vector<std::size_t> dims;
+
+  std::size_t size() const {
+    std::size_t total_elements = 1;
+    for (const auto dim : dims) {
+      total_elements *= dim;
+    }
+    return total_elements;
+  }
+};
+
+} // namespace binary
+} // namespace impl
+} // namespace IO
+} // namespace specfem
+
+#endif /* _SPECFEM_IO_BINARY_IMPL_DATASETBASE_HPP */
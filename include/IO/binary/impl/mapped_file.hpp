@@ -0,0 +1,91 @@
+#ifndef _SPECFEM_IO_BINARY_IMPL_MAPPED_FILE_HPP
+#define _SPECFEM_IO_BINARY_IMPL_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <fcntl.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace specfem {
+namespace IO {
+namespace impl {
+namespace binary {
+
+/**
+ * @brief Read-only memory mapping of a file
+ *
+ * The mapping is released when the object is destroyed.
+ */
+class mapped_file {
+public:
+  /**
+   * @brief Map a file into memory
+   *
+   * @param path Path to the file
+   * @throws std::runtime_error if the file cannot be opened or mapped
+   */
+  mapped_file(const std::string &path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      std::ostringstream oss;
+      oss << "ERROR : Could not open file " << path;
+      throw std::runtime_error(oss.str());
+    }
+
+    struct stat status;
+    if (::fstat(fd, &status) != 0) {
+      ::close(fd);
+      std::ostringstream oss;
+      oss << "ERROR : Could not read the size of file " << path;
+      throw std::runtime_error(oss.str());
+    }
+
+    this->bytes = status.st_size;
+
+    // Empty files cannot be mapped
+    if (this->bytes > 0) {
+      void *address =
+          ::mmap(nullptr, this->bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (address == MAP_FAILED) {
+        ::close(fd);
+        std::ostringstream oss;
+        oss << "ERROR : Could not map file " << path;
+        throw std::runtime_error(oss.str());
+      }
+      // Datasets are read front to back in a single pass
+      ::madvise(address, this->bytes, MADV_SEQUENTIAL);
+      ::madvise(address, this->bytes, MADV_WILLNEED);
+      this->address = address;
+    }
+
+    // The mapping remains valid after the file is closed
+    ::close(fd);
+  }
+
+  mapped_file(const mapped_file &) = delete;
+  mapped_file &operator=(const mapped_file &) = delete;
+
+  ~mapped_file() {
+    if (this->address) {
+      ::munmap(this->address, this->bytes);
+    }
+  }
+
+  const void *data() const { return address; } ///< Start of the mapping
+  std::size_t size() const { return bytes; }   ///< Size of the file in bytes
+
+private:
+  void *address = nullptr; ///< Start of the mapping
+  std::size_t bytes = 0;   ///< Size of the mapping in bytes
+};
+
+} // namespace binary
+} // namespace impl
+} // namespace IO
+} // namespace specfem
+
+#endif /* _SPECFEM_IO_BINARY_IMPL_MAPPED_FILE_HPP */
@@ -0,0 +1,39 @@
+#ifndef _SPECFEM_IO_BINARY_IMPL_NATIVE_TYPE_HPP
+#define _SPECFEM_IO_BINARY_IMPL_NATIVE_TYPE_HPP
+
+#include <string>
+#include <type_traits>
+
+namespace specfem {
+namespace IO {
+namespace impl {
+namespace binary {
+
+/**
+ * @brief Name of the type stored in the header of a binary dataset
+ *
+ * @tparam T Arithmetic type of the dataset
+ */
+template <typename T> struct native_type {
+  static_assert(std::is_arithmetic_v<T>,
+                "Binary datasets only store arithmetic types");
+
+  static std::string name() {
+    if constexpr (std::is_same_v<T, bool>) {
+      return "bool";
+    } else if constexpr (std::is_floating_point_v<T>) {
+      return "float" + std::to_string(8 * sizeof(T));
+    } else if constexpr (std::is_signed_v<T>) {
+      return "int" + std::to_string(8 * sizeof(T));
+    } else {
+      return "uint" + std::to_string(8 * sizeof(T));
+    }
+  }
+};
+
+} // namespace binary
+} // namespace impl
+} // namespace IO
+} // namespace specfem
+
+#endif /* _SPECFEM_IO_BINARY_IMPL_NATIVE_TYPE_HPP */
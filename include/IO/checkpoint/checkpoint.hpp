@@ -0,0 +1,125 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/simulation.hpp"
+#include "kokkos_abstractions.h"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace specfem {
+namespace IO {
+/**
+ * @brief Checkpoint files used to restart a simulation
+ *
+ * A checkpoint file stores the state of the time loop after a given number of
+ * completed timesteps:
+ *  - every simulation field (forward, adjoint, backward and buffer)
+ *  - the accumulated misfit kernels
+ *  - the seismograms computed so far
+ *  - the boundary values stored so far (forward simulations)
+ *  - the state accumulated by periodic tasks (e.g. ground motion maps)
+ *
+ * The file is a native-endian binary file with the layout
+ *
+ * @code
+ * char[16]   magic
+ * int32      version, sizeof(type_real), simulation type, nstep,
+ *            nstep_completed, seismogram_step
+ * uint64     number of entries
+ * // for every entry
+ * uint64     length of name
+ * char[]     name
+ * uint64     number of values
+ * type_real[] values
+ * @endcode
+ *
+ * Restarting requires the same mesh, simulation type and number of timesteps.
+ */
+namespace checkpoint {
+
+constexpr int version = 1; ///< Version of the checkpoint file layout
+
+/**
+ * @brief Progress of the time loop stored in a checkpoint
+ *
+ */
+struct header {
+  specfem::simulation::type simulation; ///< Simulation type
+  int nstep;                            ///< Total number of timesteps
+  int nstep_completed; ///< Number of timesteps completed at the checkpoint
+  int seismogram_step; ///< Number of seismogram samples computed
+};
+
+/**
+ * @brief View of a piece of simulation state stored on the device
+ *
+ */
+struct entry {
+  using ViewType = Kokkos::View<type_real *, specfem::kokkos::DevMemSpace,
+                                Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+
+  std::string name; ///< Name of the entry within the checkpoint
+  ViewType view;    ///< Flattened view of the state
+};
+
+/**
+ * @brief Host copy of an entry
+ *
+ */
+struct buffer {
+  std::string name;      ///< Name of the entry within the checkpoint
+  const type_real *data; ///< Pointer to host data
+  std::size_t size;      ///< Number of values
+};
+
+/**
+ * @brief Get the simulation state that is stored in a checkpoint
+ *
+ * @param assembly SPECFEM++ assembly
+ * @param simulation Simulation type
+ * @param task_state State accumulated by periodic tasks, stored after the
+ * simulation state
+ * @return std::vector<entry> Entries in the order they are stored
+ */
+std::vector<entry> get_state(const specfem::compute::assembly &assembly,
+                             const specfem::simulation::type simulation,
+                             const std::vector<entry> &task_state = {});
+
+/**
+ * @brief Write a checkpoint file
+ *
+ * The file is first written to a temporary file and then renamed, so an
+ * interrupted write never corrupts the previous checkpoint.
+ *
+ * @param filename Path to the checkpoint file
+ * @param progress Progress of the time loop
+ * @param buffers Host copies of the entries returned by @ref get_state
+ * @throws std::runtime_error if the file cannot be written
+ */
+void write(const std::string &filename, const header &progress,
+           const std::vector<buffer> &buffers);
+
+/**
+ * @brief Restore the simulation state from a checkpoint file
+ *
+ * @param filename Path to the checkpoint file
+ * @param assembly SPECFEM++ assembly. The state is restored on the device
+ * @param simulation Simulation type
+ * @param nstep Total number of timesteps of the simulation
+ * @param task_state State accumulated by periodic tasks. Restored on the
+ * device
+ * @return header Progress of the time loop stored in the checkpoint
+ * @throws std::runtime_error if the checkpoint is invalid or does not match
+ * the simulation
+ */
+header read(const std::string &filename,
+            const specfem::compute::assembly &assembly,
+            const specfem::simulation::type simulation, const int nstep,
+            const std::vector<entry> &task_state = {});
+
+} // namespace checkpoint
+} // namespace IO
+} // namespace specfem
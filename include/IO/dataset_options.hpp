@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+
+namespace specfem {
+namespace IO {
+
+/**
+ * @brief Storage options for datasets created by a writer
+ *
+ * Libraries that do not support chunked or compressed storage (ASCII) ignore
+ * these options.
+ */
+struct dataset_options {
+  /**
+   * @brief Compression filter applied to every chunk
+   *
+   */
+  enum class filter { none, deflate, shuffle_deflate };
+
+  bool chunked = false;              ///< Store the dataset in chunks.
+                                     ///< Implied by a compression filter
+  std::size_t chunk_bytes = 1 << 20; ///< Target size of a chunk in bytes
+  filter compression = filter::none; ///< Compression filter
+  int level = 4;                     ///< Deflate compression level (1-9)
+
+  /**
+   * @brief Check if the dataset is stored in chunks
+   *
+   */
+  bool is_chunked() const { return chunked || compression != filter::none; }
+};
+
+} // namespace IO
+} // namespace specfem
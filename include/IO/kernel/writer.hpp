@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IO/dataset_options.hpp"
 #include "IO/writer.hpp"
 #include "compute/interface.hpp"
 #include "enumerations/interface.hpp"
@@ -24,8 +25,11 @@ public:
    * @param assembly SPECFEM++ assembly
    * @param output_folder Path to output location (will be an .h5 file if using
    * HDF5, and a folder if using ASCII)
+   * @param options Chunking and compression options of the datasets (HDF5
+   * only)
    */
-  kernel_writer(const std::string output_folder);
+  kernel_writer(const std::string output_folder,
+                const specfem::IO::dataset_options &options = {});
 
   /**
    * @brief write the kernel data to disk
@@ -34,7 +38,8 @@ public:
   void write(specfem::compute::assembly &assembly) override;
 
 private:
-  std::string output_folder; ///< Path to output folder
+  std::string output_folder;            ///< Path to output folder
+  specfem::IO::dataset_options options; ///< Dataset storage options
 };
 } // namespace IO
 } // namespace specfem
@@ -9,8 +9,10 @@
 #include <Kokkos_Core.hpp>
 
 template <typename OutputLibrary>
-specfem::IO::kernel_writer<OutputLibrary>::kernel_writer(const std::string output_folder)
-    : output_folder(output_folder) {}
+specfem::IO::kernel_writer<OutputLibrary>::kernel_writer(
+    const std::string output_folder,
+    const specfem::IO::dataset_options &options)
+    : output_folder(output_folder), options(options) {}
 
 template <typename OutputLibrary>
 void specfem::IO::kernel_writer<OutputLibrary>::write(specfem::compute::assembly &assembly) {
@@ -23,7 +25,7 @@ void specfem::IO::kernel_writer<OutputLibrary>::write(specfem::compute::assembly
 
   kernels.copy_to_host();
 
-  typename OutputLibrary::File file(output_folder + "/Kernels");
+  typename OutputLibrary::File file(output_folder + "/Kernels", options);
 
   const int nspec = mesh.points.nspec;
   const int ngllz = mesh.points.ngllz;
@@ -51,10 +53,12 @@ void specfem::IO::kernel_writer<OutputLibrary>::write(specfem::compute::assembly
     DomainView alpha("alpha", n_elastic_isotropic, ngllz, ngllx);
     DomainView beta("beta", n_elastic_isotropic, ngllz, ngllx);
 
-    for (int i = 0; i < n_elastic_isotropic; i++) {
-      const int ispec = element_indices(i);
-      for (int iz = 0; iz < ngllz; iz++) {
-        for (int ix = 0; ix < ngllx; ix++) {
+    Kokkos::parallel_for(
+        "specfem::IO::kernel_writer::elastic_isotropic",
+        specfem::kokkos::HostMDrange<3, Kokkos::Iterate::Left>(
+            { 0, 0, 0 }, { n_elastic_isotropic, ngllz, ngllx }),
+        [&](const int i, const int iz, const int ix) {
+          const int ispec = element_indices(i);
           x(i, iz, ix) = mesh.points.h_coord(0, ispec, iz, ix);
           z(i, iz, ix) = mesh.points.h_coord(1, ispec, iz, ix);
           const specfem::point::index<specfem::dimension::type::dim2> index(
@@ -73,9 +77,9 @@ void specfem::IO::kernel_writer<OutputLibrary>::write(specfem::compute::assembly
           rhop(i, iz, ix) = point_kernels.rhop;
           alpha(i, iz, ix) = point_kernels.alpha;
           beta(i, iz, ix) = point_kernels.beta;
-        }
-      }
-    }
+        });
+
+    Kokkos::fence();
 
     elastic.createDataset("X", x).write();
     elastic.createDataset("Z", z).write();
@@ -106,10 +110,12 @@ void specfem::IO::kernel_writer<OutputLibrary>::write(specfem::compute::assembly
     DomainView c35("c35", n_elastic_anisotropic, ngllz, ngllx);
     DomainView c55("c55", n_elastic_anisotropic, ngllz, ngllx);
 
-    for (int i = 0; i < n_elastic_anisotropic; i++) {
-      const int ispec = element_indices(i);
-      for (int iz = 0; iz < ngllz; iz++) {
-        for (int ix = 0; ix < ngllx; ix++) {
+    Kokkos::parallel_for(
+        "specfem::IO::kernel_writer::elastic_anisotropic",
+        specfem::kokkos::HostMDrange<3, Kokkos::Iterate::Left>(
+            { 0, 0, 0 }, { n_elastic_anisotropic, ngllz, ngllx }),
+        [&](const int i, const int iz, const int ix) {
+          const int ispec = element_indices(i);
           x(i, iz, ix) = mesh.points.h_coord(0, ispec, iz, ix);
           z(i, iz, ix) = mesh.points.h_coord(1, ispec, iz, ix);
           const specfem::point::index<specfem::dimension::type::dim2> index(
@@ -129,9 +135,9 @@ void specfem::IO::kernel_writer<OutputLibrary>::write(specfem::compute::assembly
           c33(i, iz, ix) = point_kernels.c33;
           c35(i, iz, ix) = point_kernels.c35;
           c55(i, iz, ix) = point_kernels.c55;
-        }
-      }
-    }
+        });
+
+    Kokkos::fence();
 
     elastic.createDataset("X", x).write();
     elastic.createDataset("Z", z).write();
@@ -158,10 +164,12 @@ void specfem::IO::kernel_writer<OutputLibrary>::write(specfem::compute::assembly
     DomainView rho_prime("rho_prime", n_acoustic, ngllz, ngllx);
     DomainView alpha("alpha", n_acoustic, ngllz, ngllx);
 
-    for (int i = 0; i < n_acoustic; i++) {
-      const int ispec = element_indices(i);
-      for (int iz = 0; iz < ngllz; iz++) {
-        for (int ix = 0; ix < ngllx; ix++) {
+    Kokkos::parallel_for(
+        "specfem::IO::kernel_writer::acoustic",
+        specfem::kokkos::HostMDrange<3, Kokkos::Iterate::Left>(
+            { 0, 0, 0 }, { n_acoustic, ngllz, ngllx }),
+        [&](const int i, const int iz, const int ix) {
+          const int ispec = element_indices(i);
           x(i, iz, ix) = mesh.points.h_coord(0, ispec, iz, ix);
           z(i, iz, ix) = mesh.points.h_coord(1, ispec, iz, ix);
           const specfem::point::index<specfem::dimension::type::dim2> index(
@@ -178,9 +186,9 @@ void specfem::IO::kernel_writer<OutputLibrary>::write(specfem::compute::assembly
           kappa(i, iz, ix) = point_kernels.kappa;
           rho_prime(i, iz, ix) = point_kernels.rhop;
           alpha(i, iz, ix) = point_kernels.alpha;
-        }
-      }
-    }
+        });
+
+    Kokkos::fence();
 
     acoustic.createDataset("X", x).write();
     acoustic.createDataset("Z", z).write();
@@ -7,6 +7,7 @@
 #include "point/properties.hpp"
 #include "IO/property/reader.hpp"
 #include <Kokkos_Core.hpp>
+#include <type_traits>
 
 template <typename InputLibrary>
 specfem::IO::property_reader<InputLibrary>::property_reader(const std::string input_folder): input_folder(input_folder) {}
@@ -20,38 +21,57 @@ void specfem::IO::property_reader<InputLibrary>::read(specfem::compute::assembly
 
   typename InputLibrary::File file(input_folder + "/Properties");
 
+  // Files are always stored in LayoutLeft, independent of the layout used to
+  // store the properties. Read directly into the properties when the layouts
+  // match.
+  const auto read_dataset = [](auto &group, const std::string &name,
+                               const auto &view) {
+    using ViewType = std::remove_cv_t<std::remove_reference_t<decltype(view)> >;
+    if constexpr (std::is_same_v<typename ViewType::array_layout,
+                                 Kokkos::LayoutLeft>) {
+      group.openDataset(name, view).read();
+    } else {
+      DomainView domain_view(view.label(), view.extent(0), view.extent(1),
+                             view.extent(2));
+      group.openDataset(name, domain_view).read();
+      Kokkos::deep_copy(view, domain_view);
+    }
+  };
+
   {
     typename InputLibrary::Group elastic = file.openGroup("/ElasticIsotropic");
 
-    elastic.openDataset("rho", properties.elastic_isotropic.h_rho).read();
-    elastic.openDataset("mu", properties.elastic_isotropic.h_mu).read();
-    elastic.openDataset("lambdaplus2mu", properties.elastic_isotropic.h_lambdaplus2mu).read();
+    read_dataset(elastic, "rho", properties.elastic_isotropic.h_rho);
+    read_dataset(elastic, "mu", properties.elastic_isotropic.h_mu);
+    read_dataset(elastic, "lambdaplus2mu", properties.elastic_isotropic.h_lambdaplus2mu);
   }
 
   {
     typename InputLibrary::Group elastic = file.openGroup("/ElasticAnisotropic");
 
-    elastic.openDataset("rho", properties.elastic_anisotropic.h_rho).read();
-    elastic.openDataset("c11", properties.elastic_anisotropic.h_c11).read();
-    elastic.openDataset("c13", properties.elastic_anisotropic.h_c13).read();
-    elastic.openDataset("c15", properties.elastic_anisotropic.h_c15).read();
-    elastic.openDataset("c33", properties.elastic_anisotropic.h_c33).read();
-    elastic.openDataset("c35", properties.elastic_anisotropic.h_c35).read();
-    elastic.openDataset("c55", properties.elastic_anisotropic.h_c55).read();
-    elastic.openDataset("c12", properties.elastic_anisotropic.h_c12).read();
-    elastic.openDataset("c23", properties.elastic_anisotropic.h_c23).read();
-    elastic.openDataset("c25", properties.elastic_anisotropic.h_c25).read();
+    read_dataset(elastic, "rho", properties.elastic_anisotropic.h_rho);
+    read_dataset(elastic, "c11", properties.elastic_anisotropic.h_c11);
+    read_dataset(elastic, "c13", properties.elastic_anisotropic.h_c13);
+    read_dataset(elastic, "c15", properties.elastic_anisotropic.h_c15);
+    read_dataset(elastic, "c33", properties.elastic_anisotropic.h_c33);
+    read_dataset(elastic, "c35", properties.elastic_anisotropic.h_c35);
+    read_dataset(elastic, "c55", properties.elastic_anisotropic.h_c55);
+    read_dataset(elastic, "c12", properties.elastic_anisotropic.h_c12);
+    read_dataset(elastic, "c23", properties.elastic_anisotropic.h_c23);
+    read_dataset(elastic, "c25", properties.elastic_anisotropic.h_c25);
   }
 
   {
     typename InputLibrary::Group acoustic = file.openGroup("/Acoustic");
 
-    acoustic.openDataset("rho_inverse", properties.acoustic_isotropic.h_rho_inverse).read();
-    acoustic.openDataset("kappa", properties.acoustic_isotropic.h_kappa).read();
+    read_dataset(acoustic, "rho_inverse", properties.acoustic_isotropic.h_rho_inverse);
+    read_dataset(acoustic, "kappa", properties.acoustic_isotropic.h_kappa);
   }
 
   std::cout << "Properties read from " << input_folder << "/Properties"
             << std::endl;
 
+  // The model read from disk may vary within elements
+  properties.set_gll_model();
   properties.copy_to_device();
 }
@@ -2,6 +2,7 @@
 
 #include "compute/interface.hpp"
 #include "enumerations/interface.hpp"
+#include "IO/dataset_options.hpp"
 #include "IO/writer.hpp"
 
 namespace specfem {
@@ -23,8 +24,11 @@ public:
    *
    * @param output_folder Path to output location (will be an .h5 file if using
    * HDF5, and a folder if using ASCII)
+   * @param options Chunking and compression options of the datasets (HDF5
+   * only)
    */
-  property_writer(const std::string output_folder);
+  property_writer(const std::string output_folder,
+                  const specfem::IO::dataset_options &options = {});
 
   /**
    * @brief write the property data to disk
@@ -35,7 +39,8 @@ public:
   void write(specfem::compute::assembly &assembly) override;
 
 private:
-  std::string output_folder; ///< Path to output folder
+  std::string output_folder;            ///< Path to output folder
+  specfem::IO::dataset_options options; ///< Dataset storage options
 };
 } // namespace writer
 } // namespace specfem
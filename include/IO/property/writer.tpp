@@ -7,10 +7,13 @@
 #include "point/properties.hpp"
 #include "IO/property/writer.hpp"
 #include <Kokkos_Core.hpp>
+#include <type_traits>
 
 template <typename OutputLibrary>
-specfem::IO::property_writer<OutputLibrary>::property_writer(const std::string output_folder)
-    : output_folder(output_folder) {}
+specfem::IO::property_writer<OutputLibrary>::property_writer(
+    const std::string output_folder,
+    const specfem::IO::dataset_options &options)
+    : output_folder(output_folder), options(options) {}
 
 template <typename OutputLibrary>
 void specfem::IO::property_writer<OutputLibrary>::write(specfem::compute::assembly &assembly) {
@@ -23,7 +26,23 @@ void specfem::IO::property_writer<OutputLibrary>::write(specfem::compute::assemb
 
   properties.copy_to_host();
 
-  typename OutputLibrary::File file(output_folder + "/Properties");
+  // Files are always written in LayoutLeft, independent of the layout used
+  // to store the properties. LayoutLeft views are written without a copy,
+  // other layouts are remapped by a (host parallel) deep copy
+  const auto to_domain_view = [](const auto &view) {
+    using ViewType = std::decay_t<decltype(view)>;
+    if constexpr (std::is_same_v<typename ViewType::array_layout,
+                                 Kokkos::LayoutLeft>) {
+      return view;
+    } else {
+      DomainView domain_view(view.label(), view.extent(0), view.extent(1),
+                             view.extent(2));
+      Kokkos::deep_copy(domain_view, view);
+      return domain_view;
+    }
+  };
+
+  typename OutputLibrary::File file(output_folder + "/Properties", options);
 
   const int nspec = mesh.points.nspec;
   const int ngllz = mesh.points.ngllz;
@@ -44,22 +63,24 @@ void specfem::IO::property_writer<OutputLibrary>::write(specfem::compute::assemb
     DomainView x("xcoordinates_elastic_isotropic", n_elastic_isotropic, ngllz, ngllx);
     DomainView z("zcoordinates_elastic_isotropic", n_elastic_isotropic, ngllz, ngllx);
 
-    for (int i = 0; i < n_elastic_isotropic; i++) {
-      const int ispec = element_indices(i);
-      for (int iz = 0; iz < ngllz; iz++) {
-        for (int ix = 0; ix < ngllx; ix++) {
+    Kokkos::parallel_for(
+        "specfem::IO::property_writer::elastic_isotropic",
+        specfem::kokkos::HostMDrange<3, Kokkos::Iterate::Left>(
+            { 0, 0, 0 }, { n_elastic_isotropic, ngllz, ngllx }),
+        [&](const int i, const int iz, const int ix) {
+          const int ispec = element_indices(i);
           x(i, iz, ix) = mesh.points.h_coord(0, ispec, iz, ix);
           z(i, iz, ix) = mesh.points.h_coord(1, ispec, iz, ix);
-        }
-      }
-    }
+        });
+
+    Kokkos::fence();
 
     elastic.createDataset("X", x).write();
     elastic.createDataset("Z", z).write();
 
-    elastic.createDataset("rho", properties.elastic_isotropic.h_rho).write();
-    elastic.createDataset("mu", properties.elastic_isotropic.h_mu).write();
-    elastic.createDataset("lambdaplus2mu", properties.elastic_isotropic.h_lambdaplus2mu).write();
+    elastic.createDataset("rho", to_domain_view(properties.elastic_isotropic.h_rho)).write();
+    elastic.createDataset("mu", to_domain_view(properties.elastic_isotropic.h_mu)).write();
+    elastic.createDataset("lambdaplus2mu", to_domain_view(properties.elastic_isotropic.h_lambdaplus2mu)).write();
   }
 
   {
@@ -73,29 +94,31 @@ void specfem::IO::property_writer<OutputLibrary>::write(specfem::compute::assemb
     DomainView x("xcoordinates_elastic_anisotropic", n_elastic_anisotropic, ngllz, ngllx);
     DomainView z("zcoordinates_elastic_anisotropic", n_elastic_anisotropic, ngllz, ngllx);
 
-    for (int i = 0; i < n_elastic_anisotropic; i++) {
-      const int ispec = element_indices(i);
-      for (int iz = 0; iz < ngllz; iz++) {
-        for (int ix = 0; ix < ngllx; ix++) {
+    Kokkos::parallel_for(
+        "specfem::IO::property_writer::elastic_anisotropic",
+        specfem::kokkos::HostMDrange<3, Kokkos::Iterate::Left>(
+            { 0, 0, 0 }, { n_elastic_anisotropic, ngllz, ngllx }),
+        [&](const int i, const int iz, const int ix) {
+          const int ispec = element_indices(i);
           x(i, iz, ix) = mesh.points.h_coord(0, ispec, iz, ix);
           z(i, iz, ix) = mesh.points.h_coord(1, ispec, iz, ix);
-        }
-      }
-    }
+        });
+
+    Kokkos::fence();
 
     elastic.createDataset("X", x).write();
     elastic.createDataset("Z", z).write();
 
-    elastic.createDataset("rho", properties.elastic_anisotropic.h_rho).write();
-    elastic.createDataset("c11", properties.elastic_anisotropic.h_c11).write();
-    elastic.createDataset("c13", properties.elastic_anisotropic.h_c13).write();
-    elastic.createDataset("c15", properties.elastic_anisotropic.h_c15).write();
-    elastic.createDataset("c33", properties.elastic_anisotropic.h_c33).write();
-    elastic.createDataset("c35", properties.elastic_anisotropic.h_c35).write();
-    elastic.createDataset("c55", properties.elastic_anisotropic.h_c55).write();
-    elastic.createDataset("c12", properties.elastic_anisotropic.h_c12).write();
-    elastic.createDataset("c23", properties.elastic_anisotropic.h_c23).write();
-    elastic.createDataset("c25", properties.elastic_anisotropic.h_c25).write();
+    elastic.createDataset("rho", to_domain_view(properties.elastic_anisotropic.h_rho)).write();
+    elastic.createDataset("c11", to_domain_view(properties.elastic_anisotropic.h_c11)).write();
+    elastic.createDataset("c13", to_domain_view(properties.elastic_anisotropic.h_c13)).write();
+    elastic.createDataset("c15", to_domain_view(properties.elastic_anisotropic.h_c15)).write();
+    elastic.createDataset("c33", to_domain_view(properties.elastic_anisotropic.h_c33)).write();
+    elastic.createDataset("c35", to_domain_view(properties.elastic_anisotropic.h_c35)).write();
+    elastic.createDataset("c55", to_domain_view(properties.elastic_anisotropic.h_c55)).write();
+    elastic.createDataset("c12", to_domain_view(properties.elastic_anisotropic.h_c12)).write();
+    elastic.createDataset("c23", to_domain_view(properties.elastic_anisotropic.h_c23)).write();
+    elastic.createDataset("c25", to_domain_view(properties.elastic_anisotropic.h_c25)).write();
   }
 
   {
@@ -107,21 +130,23 @@ void specfem::IO::property_writer<OutputLibrary>::write(specfem::compute::assemb
     DomainView x("xcoordinates_acoustic", n_acoustic, ngllz, ngllx);
     DomainView z("zcoordinates_acoustic", n_acoustic, ngllz, ngllx);
 
-    for (int i = 0; i < n_acoustic; i++) {
-      const int ispec = element_indices(i);
-      for (int iz = 0; iz < ngllz; iz++) {
-        for (int ix = 0; ix < ngllx; ix++) {
+    Kokkos::parallel_for(
+        "specfem::IO::property_writer::acoustic",
+        specfem::kokkos::HostMDrange<3, Kokkos::Iterate::Left>(
+            { 0, 0, 0 }, { n_acoustic, ngllz, ngllx }),
+        [&](const int i, const int iz, const int ix) {
+          const int ispec = element_indices(i);
           x(i, iz, ix) = mesh.points.h_coord(0, ispec, iz, ix);
           z(i, iz, ix) = mesh.points.h_coord(1, ispec, iz, ix);
-        }
-      }
-    }
+        });
+
+    Kokkos::fence();
 
     acoustic.createDataset("X", x).write();
     acoustic.createDataset("Z", z).write();
 
-    acoustic.createDataset("rho_inverse", properties.acoustic_isotropic.h_rho_inverse).write();
-    acoustic.createDataset("kappa", properties.acoustic_isotropic.h_kappa).write();
+    acoustic.createDataset("rho_inverse", to_domain_view(properties.acoustic_isotropic.h_rho_inverse)).write();
+    acoustic.createDataset("kappa", to_domain_view(properties.acoustic_isotropic.h_kappa)).write();
   }
 
   assert(n_elastic_isotropic + n_elastic_anisotropic + n_acoustic == nspec);
@@ -0,0 +1,54 @@
+#ifndef SPECFEM_IO_SEISMOGRAM_IMPL_SAC_HPP
+#define SPECFEM_IO_SEISMOGRAM_IMPL_SAC_HPP
+
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+#include "specfem_setup.hpp"
+#include <string>
+
+namespace specfem {
+namespace IO {
+namespace impl {
+
+/**
+ * @brief Write a trace as a binary SAC file
+ *
+ * The file contains the 632 byte SAC header (version 6) followed by the
+ * samples as float32, in native byte order. The header stores the sampling
+ * (delta, b, e, npts), the amplitude range (depmin, depmax, depmen), the
+ * station, network and component names and the type of the trace (idep).
+ * Every other header field is left undefined.
+ *
+ * @param filename Path to the SAC file
+ * @param station_name Name of the station
+ * @param network_name Name of the network
+ * @param component Name of the component (e.g. BXX)
+ * @param type Type of the seismogram
+ * @param t0 Time of the first sample
+ * @param dt Sampling interval
+ * @param values Samples of the trace (nsteps)
+ */
+void write_sac(const std::string &filename, const std::string &station_name,
+               const std::string &network_name, const std::string &component,
+               const specfem::wavefield::type type, const type_real t0,
+               const type_real dt,
+               const specfem::kokkos::HostView1d<type_real> values);
+
+/**
+ * @brief Read a trace from a binary SAC file
+ *
+ * @param filename Path to the SAC file
+ * @param t0 Time of the first sample
+ * @param dt Sampling interval
+ * @param values View to store the samples of the trace (nsteps)
+ * @throws std::runtime_error if the file is not a SAC file or does not
+ * contain nsteps samples
+ */
+void read_sac(const std::string &filename, type_real &t0, type_real &dt,
+              specfem::kokkos::HostView1d<type_real> values);
+
+} // namespace impl
+} // namespace IO
+} // namespace specfem
+
+#endif /* SPECFEM_IO_SEISMOGRAM_IMPL_SAC_HPP */
@@ -0,0 +1,51 @@
+#ifndef SPECFEM_IO_SEISMOGRAM_IMPL_SEISMIC_UNIX_HPP
+#define SPECFEM_IO_SEISMOGRAM_IMPL_SEISMIC_UNIX_HPP
+
+#include "kokkos_abstractions.h"
+#include "specfem_setup.hpp"
+#include <string>
+
+namespace specfem {
+namespace IO {
+namespace impl {
+
+/**
+ * @brief Write a Seismic Unix (SU) gather
+ *
+ * Every trace is written as a 240 byte SEG-Y trace header followed by the
+ * samples as float32, in native byte order. Only the trace sequence numbers
+ * (tracl, tracr), trace identification code (trid), delay recording time
+ * (delrt, milliseconds), number of samples (ns) and sample interval (dt,
+ * microseconds) are set in the header.
+ *
+ * @param filename Path to the SU file
+ * @param t0 Time of the first sample
+ * @param dt Sampling interval
+ * @param traces Samples of every trace in the gather (ntraces, nsteps)
+ * @throws std::runtime_error if nsteps, dt or t0 cannot be represented in
+ * the SU trace header
+ */
+void write_seismic_unix(const std::string &filename, const type_real t0,
+                        const type_real dt,
+                        const specfem::kokkos::HostView2d<type_real> traces);
+
+/**
+ * @brief Read a trace from a Seismic Unix (SU) gather
+ *
+ * @param filename Path to the SU file
+ * @param itrace Index of the trace within the gather
+ * @param t0 Time of the first sample
+ * @param dt Sampling interval
+ * @param values View to store the samples of the trace (nsteps)
+ * @throws std::runtime_error if the trace does not exist or does not contain
+ * nsteps samples
+ */
+void read_seismic_unix(const std::string &filename, const int itrace,
+                       type_real &t0, type_real &dt,
+                       specfem::kokkos::HostView1d<type_real> values);
+
+} // namespace impl
+} // namespace IO
+} // namespace specfem
+
+#endif /* SPECFEM_IO_SEISMOGRAM_IMPL_SEISMIC_UNIX_HPP */
@@ -3,6 +3,9 @@
 
 #include "enumerations/specfem_enums.hpp"
 #include "IO/reader.hpp"
+#include "kokkos_abstractions.h"
+#include <string>
+#include <vector>
 
 namespace specfem {
 namespace forcing_function {
@@ -13,19 +16,29 @@ class external;
 namespace specfem {
 namespace IO {
 
+/**
+ * @brief Read a single trace from a seismogram file
+ *
+ * The trace is stored as (time, value) pairs in a view of dimensions
+ * (nsteps, 2). ASCII and SAC files contain a single trace. Seismic Unix
+ * gathers and binary trace containers contain many traces, the trace to read
+ * is selected by its index within the file.
+ */
 class seismogram_reader {
 public:
   seismogram_reader(){};
   seismogram_reader(const char *filename,
              const specfem::enums::seismogram::format type,
-             specfem::kokkos::HostView2d<type_real> source_time_function)
+             specfem::kokkos::HostView2d<type_real> source_time_function,
+             const int trace = 0)
       : filename(filename), type(type),
-        source_time_function(source_time_function) {}
+        source_time_function(source_time_function), trace(trace) {}
   seismogram_reader(const std::string &filename,
              const specfem::enums::seismogram::format type,
-             specfem::kokkos::HostView2d<type_real> source_time_function)
+             specfem::kokkos::HostView2d<type_real> source_time_function,
+             const int trace = 0)
       : filename(filename), type(type),
-        source_time_function(source_time_function) {}
+        source_time_function(source_time_function), trace(trace) {}
   void read();
 
 private:
@@ -33,7 +46,25 @@ private:
   type_real dt;
   specfem::enums::seismogram::format type;
   specfem::kokkos::HostView2d<type_real> source_time_function;
+  int trace = 0; ///< Index of the trace within multi-trace files
 };
+
+/**
+ * @brief Read a set of ASCII traces in parallel
+ *
+ * Every file contains one line per time step with two columns (time,
+ * value). Files are read in a single pass and parsed concurrently on the
+ * host execution space. Only the values are stored.
+ *
+ * @param filenames Paths to the trace files
+ * @param traces View to store the values of the traces (filenames.size(),
+ * nsteps)
+ * @throws std::runtime_error if a file cannot be read, is not formatted
+ * correctly or does not contain nsteps lines
+ */
+void read_ascii_traces(const std::vector<std::string> &filenames,
+                       specfem::kokkos::HostView2d<type_real> traces);
+
 } // namespace IO
 } // namespace specfem
 
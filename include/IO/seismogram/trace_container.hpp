@@ -0,0 +1,130 @@
+#ifndef SPECFEM_IO_SEISMOGRAM_TRACE_CONTAINER_HPP
+#define SPECFEM_IO_SEISMOGRAM_TRACE_CONTAINER_HPP
+
+#include "kokkos_abstractions.h"
+#include "specfem_setup.hpp"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace specfem {
+namespace IO {
+
+/**
+ * @brief Binary container storing many traces sampled on the same time axis
+ *
+ * Used to store the source time functions of many (adjoint) sources and the
+ * seismograms of many stations in a single file. The file layout (little
+ * endian) is:
+ *
+ * - Header: magic "SPECSTF\0" (8 bytes), version (int32), number of traces
+ *   (int32), number of samples per trace (int32), size of a sample in bytes
+ *   (int32, 4 or 8), start time (float64), time step (float64)
+ * - Index: one name per trace, null padded to @ref name_length bytes. Names
+ *   are typically NETWORK.STATION.COMPONENT
+ * - Data: the samples of every trace stored contiguously, in index order,
+ *   as float32 or float64
+ */
+class trace_container {
+public:
+  constexpr static int name_length = 64; ///< Maximum length of a trace name
+
+  /**
+   * @brief Precision of the stored samples
+   *
+   */
+  enum class precision { float32, float64 };
+
+  /**
+   * @brief Header of a trace container file
+   *
+   */
+  struct header {
+    int ntraces;                ///< Number of traces
+    int nsteps;                 ///< Number of samples per trace
+    type_real t0;               ///< Time of the first sample
+    type_real dt;               ///< Sampling interval
+    precision sample_precision; ///< Precision of the samples
+  };
+
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  trace_container() = default;
+  /**
+   * @brief Open a trace container and read its index
+   *
+   * @param filename Path to the container
+   * @throws std::runtime_error if the file is not a valid trace container
+   */
+  trace_container(const std::string &filename);
+  ///@}
+
+  /**
+   * @brief Read only the header of a trace container
+   *
+   * @param filename Path to the container
+   * @return header Header of the container
+   */
+  static header read_header(const std::string &filename);
+
+  /**
+   * @brief Write a trace container
+   *
+   * @param filename Path to the container
+   * @param names Name of every trace
+   * @param t0 Time of the first sample
+   * @param dt Sampling interval
+   * @param traces Samples of every trace (ntraces, nsteps)
+   * @param sample_precision Precision used to store the samples
+   */
+  static void
+  write(const std::string &filename, const std::vector<std::string> &names,
+        const type_real t0, const type_real dt,
+        const specfem::kokkos::HostView2d<type_real> traces,
+        const precision sample_precision = precision::float64);
+
+  /**
+   * @brief Check if the container holds a trace
+   *
+   * @param name Name of the trace
+   */
+  bool contains(const std::string &name) const {
+    return index.find(name) != index.end();
+  }
+
+  /**
+   * @brief Read a set of traces
+   *
+   * Traces are read in the order in which they are stored in the file.
+   *
+   * @param names Names of the traces to read
+   * @param traces View to store the samples (names.size(), nsteps)
+   * @throws std::runtime_error if a trace is not found in the container
+   */
+  void read(const std::vector<std::string> &names,
+            specfem::kokkos::HostView2d<type_real> traces) const;
+
+  int get_ntraces() const { return file_header.ntraces; }
+  int get_nsteps() const { return file_header.nsteps; }
+  type_real get_t0() const { return file_header.t0; }
+  type_real get_dt() const { return file_header.dt; }
+  precision get_precision() const { return file_header.sample_precision; }
+  /**
+   * @brief Names of the traces, in file order
+   *
+   */
+  std::vector<std::string> get_names() const;
+
+private:
+  std::string filename;                       ///< Path to the container
+  header file_header;                         ///< Header of the container
+  std::unordered_map<std::string, int> index; ///< Position of every trace
+};
+
+} // namespace IO
+} // namespace specfem
+
+#endif /* SPECFEM_IO_SEISMOGRAM_TRACE_CONTAINER_HPP */
@@ -2,7 +2,9 @@
 
 #include "IO/ASCII/ASCII.hpp"
 #include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
 #include "IO/wavefield/reader.hpp"
+#include <type_traits>
 
 template <typename IOLibrary>
 specfem::IO::wavefield_reader<IOLibrary>::wavefield_reader(
@@ -16,18 +18,33 @@ void specfem::IO::wavefield_reader<IOLibrary>::read(specfem::compute::assembly &
 
   typename IOLibrary::File file(output_folder + "/ForwardWavefield");
 
+  // Files are always stored in LayoutLeft, independent of the storage used
+  // for the wavefield. Read directly into the wavefield when the layouts match.
+  const auto read_dataset = [](auto &group, const std::string &name,
+                               const auto &view) {
+    using ViewType = std::remove_cv_t<std::remove_reference_t<decltype(view)> >;
+    if constexpr (std::is_same_v<typename ViewType::array_layout,
+                                 Kokkos::LayoutLeft>) {
+      group.openDataset(name, view).read();
+    } else {
+      Kokkos::View<type_real **, Kokkos::LayoutLeft, Kokkos::HostSpace>
+          host_view(view.label(), view.extent(0), view.extent(1));
+      group.openDataset(name, host_view).read();
+      Kokkos::deep_copy(view, host_view);
+    }
+  };
+
   typename IOLibrary::Group elastic = file.openGroup("/Elastic");
 
-  elastic.openDataset("Displacement", buffer.elastic.h_field).read();
-  elastic.openDataset("Velocity", buffer.elastic.h_field_dot).read();
-  elastic.openDataset("Acceleration", buffer.elastic.h_field_dot_dot).read();
+  read_dataset(elastic, "Displacement", buffer.elastic.h_field);
+  read_dataset(elastic, "Velocity", buffer.elastic.h_field_dot);
+  read_dataset(elastic, "Acceleration", buffer.elastic.h_field_dot_dot);
 
   typename IOLibrary::Group acoustic = file.openGroup("/Acoustic");
 
-  acoustic.openDataset("Potential", buffer.acoustic.h_field).read();
-  acoustic.openDataset("PotentialDot", buffer.acoustic.h_field_dot).read();
-  acoustic.openDataset("PotentialDotDot", buffer.acoustic.h_field_dot_dot)
-      .read();
+  read_dataset(acoustic, "Potential", buffer.acoustic.h_field);
+  read_dataset(acoustic, "PotentialDot", buffer.acoustic.h_field_dot);
+  read_dataset(acoustic, "PotentialDotDot", buffer.acoustic.h_field_dot_dot);
 
   typename IOLibrary::Group boundary = file.openGroup("/Boundary");
   typename IOLibrary::Group stacey = boundary.openGroup("/Stacey");
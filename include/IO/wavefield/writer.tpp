@@ -24,13 +24,32 @@ void specfem::IO::wavefield_writer<OutputLibrary>::write(specfem::compute::assem
   typename OutputLibrary::Group boundary = file.createGroup("/Boundary");
   typename OutputLibrary::Group stacey = boundary.createGroup("/Stacey");
 
-  elastic.createDataset("Displacement", forward.elastic.h_field).write();
-  elastic.createDataset("Velocity", forward.elastic.h_field_dot).write();
-  elastic.createDataset("Acceleration", forward.elastic.h_field_dot_dot).write();
+  // Files are always written in LayoutLeft, independent of the storage used
+  // for the wavefield
+  const auto to_host_view = [](const auto &view) {
+    Kokkos::View<type_real **, Kokkos::LayoutLeft, Kokkos::HostSpace>
+        host_view(view.label(), view.extent(0), view.extent(1));
+    Kokkos::deep_copy(host_view, view);
+    return host_view;
+  };
 
-  acoustic.createDataset("Potential", forward.acoustic.h_field).write();
-  acoustic.createDataset("PotentialDot", forward.acoustic.h_field_dot).write();
-  acoustic.createDataset("PotentialDotDot", forward.acoustic.h_field_dot_dot)
+  elastic.createDataset("Displacement", to_host_view(forward.elastic.h_field))
+      .write();
+  elastic.createDataset("Velocity", to_host_view(forward.elastic.h_field_dot))
+      .write();
+  elastic
+      .createDataset("Acceleration",
+                     to_host_view(forward.elastic.h_field_dot_dot))
+      .write();
+
+  acoustic.createDataset("Potential", to_host_view(forward.acoustic.h_field))
+      .write();
+  acoustic
+      .createDataset("PotentialDot", to_host_view(forward.acoustic.h_field_dot))
+      .write();
+  acoustic
+      .createDataset("PotentialDotDot",
+                     to_host_view(forward.acoustic.h_field_dot_dot))
       .write();
 
   stacey
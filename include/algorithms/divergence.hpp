@@ -82,9 +82,21 @@ KOKKOS_FORCEINLINE_FUNCTION void divergence(
         const int iz = iterator_index.index.iz;
         const int ix = iterator_index.index.ix;
 
-        const datatype jacobian =
-            (is_host_space) ? partial_derivatives.h_jacobian(ispec, iz, ix)
-                            : partial_derivatives.jacobian(ispec, iz, ix);
+        specfem::point::partial_derivatives<
+            specfem::dimension::type::dim2, true, using_simd>
+            point_partial_derivatives;
+
+        if constexpr (is_host_space) {
+          specfem::compute::load_on_host(iterator_index.index,
+                                         partial_derivatives,
+                                         point_partial_derivatives);
+        } else {
+          specfem::compute::load_on_device(iterator_index.index,
+                                           partial_derivatives,
+                                           point_partial_derivatives);
+        }
+
+        const datatype jacobian = point_partial_derivatives.jacobian;
 
         datatype temp1l[components] = { 0.0 };
         datatype temp2l[components] = { 0.0 };
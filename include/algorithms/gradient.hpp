@@ -260,6 +260,93 @@ gradient(const MemberType &team, const IteratorType &iterator,
 
   return;
 }
+
+/**
+ * @brief Compute the gradient of a field f with respect to the reference
+ * coordinates \f$ (\xi, \gamma) \f$ of the element
+ *
+ * Used when the partial derivatives of the basis functions are folded into
+ * the fused stiffness coefficients (@ref
+ * specfem::point::stiffness_coefficients)
+ *
+ * @ingroup AlgorithmsGradient
+ *
+ * @tparam MemberType Kokkos team member type
+ * @tparam IteratorType Iterator type (Chunk iterator)
+ * @tparam ViewType Field view type (Chunk view)
+ * @tparam QuadratureType Quadrature view type
+ * @tparam CallbackFunctor Callback functor type
+ * @param team Kokkos team member
+ * @param iterator Chunk iterator
+ * @param quadrature Integration quadrature
+ * @param f Field to compute the gradient of
+ * @param callback Callback functor. Callback signature must be:
+ * @code void(const typename IteratorType::index_type, const
+ * specfem::datatype::VectorPointViewType<type_real, 2, ViewType::components>)
+ * @endcode. Index 0 of the gradient is the derivative w.r.t. \f$ \xi \f$
+ * and index 1 is the derivative w.r.t. \f$ \gamma \f$
+ */
+template <typename MemberType, typename IteratorType, typename ViewType,
+          typename QuadratureType, typename CallbackFunctor,
+          std::enable_if_t<ViewType::isChunkViewType, int> = 0>
+KOKKOS_FORCEINLINE_FUNCTION void
+reference_gradient(const MemberType &team, const IteratorType &iterator,
+                   const QuadratureType &quadrature, const ViewType &f,
+                   CallbackFunctor callback) {
+  constexpr int components = ViewType::components;
+  constexpr bool using_simd = ViewType::simd::using_simd;
+
+  constexpr int NGLL = ViewType::ngll;
+
+  using VectorPointViewType =
+      specfem::datatype::VectorPointViewType<type_real, 2, components,
+                                             using_simd>;
+
+  static_assert(ViewType::isScalarViewType,
+                "ViewType must be a scalar field view type");
+
+  static_assert(
+      std::is_same_v<typename IteratorType::simd, typename ViewType::simd>,
+      "IteratorType and ViewType must have the same simd type");
+
+  static_assert(
+      std::is_invocable_v<CallbackFunctor, typename IteratorType::index_type,
+                          VectorPointViewType>,
+      "CallbackFunctor must be invocable with the following signature: "
+      "void(const typename IteratorType::index_type, const "
+      "VectorPointViewType)");
+
+  static_assert(
+      Kokkos::SpaceAccessibility<typename MemberType::execution_space,
+                                 typename ViewType::memory_space>::accessible,
+      "ViewType memory space is not accessible from the member execution "
+      "space");
+
+  Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(team, iterator.chunk_size()), [&](const int &i) {
+        const auto iterator_index = iterator(i);
+        const auto &index = iterator_index.index;
+        const int &ielement = iterator_index.ielement;
+        const int &ix = index.ix;
+        const int &iz = index.iz;
+
+        VectorPointViewType dg(
+            static_cast<typename VectorPointViewType::value_type>(0.0));
+
+        for (int l = 0; l < NGLL; ++l) {
+          for (int icomponent = 0; icomponent < components; ++icomponent) {
+            dg(0, icomponent) +=
+                quadrature(ix, l) * f(ielement, iz, l, icomponent);
+            dg(1, icomponent) +=
+                quadrature(iz, l) * f(ielement, l, ix, icomponent);
+          }
+        }
+
+        callback(iterator_index, dg);
+      });
+
+  return;
+}
 } // namespace algorithms
 } // namespace specfem
 
@@ -172,6 +172,83 @@ KOKKOS_FUNCTION void interpolate_function(const MemberType &team_member,
       });
 }
 
+/**
+ * @brief Interpolate a function at a point within every element of a chunk
+ * using separable 1D Lagrange factors
+ *
+ * The interpolant is the tensor product of the factors along xi and gamma.
+ * Along a direction in which the point lies on a GLL node only that node is
+ * visited, so points on nodes and edges need 1 and ngll operations instead of
+ * ngll^2.
+ *
+ * @param team_member Kokkos team member
+ * @param iterator Chunk iterator
+ * @param factors 1D Lagrange factors (element, GLL point, xi/gamma)
+ * @param nodes GLL node on which the point lies (element, xi/gamma), -1 if
+ * it lies between nodes
+ * @param function Function values (element, iz, ix, component)
+ * @param result Interpolated values (element, component)
+ */
+template <typename MemberType, typename IteratorType, typename FactorViewType,
+          typename NodeViewType, typename FunctionViewType,
+          typename ResultType>
+KOKKOS_FUNCTION void
+interpolate_function(const MemberType &team_member,
+                     const IteratorType &iterator,
+                     const FactorViewType &factors, const NodeViewType &nodes,
+                     const FunctionViewType &function, ResultType &result) {
+
+  static_assert(FactorViewType::rank() == 3, "Factors must be a 3D view");
+  static_assert(NodeViewType::rank() == 2, "Nodes must be a 2D view");
+  static_assert(FunctionViewType::rank() == 4, "Function must be a 4D view");
+
+  static_assert(ResultType::rank() == 2, "Result must be 2D views");
+
+#ifndef NDEBUG
+
+  if (factors.extent(0) != function.extent(0) ||
+      factors.extent(1) != function.extent(1)) {
+    Kokkos::abort("Factors and function must have the same size");
+  }
+
+  if (function.extent(3) != result.extent(1)) {
+    Kokkos::abort(
+        "Function and result must have the same number of components");
+  }
+#endif
+
+  const int ngll = factors.extent(1);
+  const int ncomponents = function.extent(3);
+
+  Kokkos::parallel_for(
+      Kokkos::TeamThreadRange(team_member,
+                              iterator.number_of_elements() * ncomponents),
+      [&](const int i) {
+        const int ielement = i / ncomponents;
+        const int icomponent = i % ncomponents;
+
+        const int ixnode = nodes(ielement, 0);
+        const int iznode = nodes(ielement, 1);
+
+        const int ix_begin = (ixnode < 0) ? 0 : ixnode;
+        const int ix_end = (ixnode < 0) ? ngll : ixnode + 1;
+        const int iz_begin = (iznode < 0) ? 0 : iznode;
+        const int iz_end = (iznode < 0) ? ngll : iznode + 1;
+
+        type_real value = 0.0;
+        for (int iz = iz_begin; iz < iz_end; ++iz) {
+          type_real line = 0.0;
+          for (int ix = ix_begin; ix < ix_end; ++ix) {
+            line += factors(ielement, ix, 0) *
+                    function(ielement, iz, ix, icomponent);
+          }
+          value += factors(ielement, iz, 1) * line;
+        }
+
+        result(ielement, icomponent) = value;
+      });
+}
+
 } // namespace algorithms
 } // namespace specfem
 
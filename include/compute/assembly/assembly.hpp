@@ -12,6 +12,7 @@
 #include "compute/properties/interface.hpp"
 #include "compute/receivers/receivers.hpp"
 #include "compute/sources/sources.hpp"
+#include "compute/stiffness_coefficients/stiffness_coefficients.hpp"
 #include "enumerations/display.hpp"
 #include "enumerations/interface.hpp"
 #include "mesh/mesh.hpp"
@@ -53,6 +54,15 @@ struct assembly {
                                    ///< fields
   specfem::compute::boundary_values boundary_values; ///< Field values at the
                                                      ///< boundaries
+  specfem::compute::stiffness_coefficients
+      stiffness_coefficients; ///< Fused stiffness coefficients (empty unless
+                              ///< enabled)
+
+  /**
+   * @brief Default constructor
+   *
+   */
+  assembly() = default;
 
   /**
    * @brief Generate a finite element assembly
@@ -71,6 +81,9 @@ struct assembly {
    * @param simulation Type of simulation (forward, adjoint, etc.)
    * @param property_reader Reader for GLL model (skip material property
    * assignment if exists)
+   * @param cache Cache for the assembled mesh geometry. If the cache is valid
+   * the geometry is read from it, otherwise it is computed and written to the
+   * cache. Pass nullptr to disable caching.
    */
   assembly(
       const specfem::mesh::mesh<specfem::dimension::type::dim2> &mesh,
@@ -82,7 +95,19 @@ struct assembly {
       const type_real t0, const type_real dt, const int max_timesteps,
       const int max_sig_step, const int nsteps_between_samples,
       const specfem::simulation::type simulation,
-      const std::shared_ptr<specfem::IO::reader> &property_reader);
+      const std::shared_ptr<specfem::IO::reader> &property_reader,
+      const std::shared_ptr<specfem::compute::assembly_cache> &cache =
+          nullptr);
+
+  /**
+   * @brief Precompute fused stiffness coefficients from the partial
+   * derivatives and material properties
+   *
+   * Once computed, the stiffness kernels read the fused coefficients instead
+   * of the partial derivatives and material properties. Needs to be called
+   * again if the material properties are updated.
+   */
+  void compute_stiffness_coefficients();
 
   /**
    * @brief Maps the component of wavefield on the entire spectral element grid
@@ -0,0 +1,95 @@
+#ifndef _COMPUTE_ASSEMBLY_CACHE_HPP
+#define _COMPUTE_ASSEMBLY_CACHE_HPP
+
+#include "compute/compute_mesh.hpp"
+#include "compute/compute_partial_derivatives.hpp"
+#include "quadrature/interface.hpp"
+#include <cstdint>
+#include <string>
+
+namespace specfem {
+namespace compute {
+
+/**
+ * @brief Binary cache of the assembled mesh geometry
+ *
+ * Stores the global numbering of quadrature points and the partial derivatives
+ * of the basis functions, which dominate the cost of generating the assembly.
+ * The cache is keyed by a hash of the mesh database contents and the
+ * quadrature, a cache file generated from a different mesh or quadrature is
+ * ignored (and overwritten).
+ *
+ * File layout (native endianness):
+ * @code
+ * char[8]   magic
+ * int32     version
+ * uint64    key
+ * int32     sizeof(type_real)
+ * int32     nspec, ngllz, ngllx
+ * type_real xmin, xmax, zmin, zmax
+ * int       index_mapping[nspec * ngllz * ngllx]
+ * type_real coord[ndim * nspec * ngllz * ngllx]
+ * type_real xix, xiz, gammax, gammaz, jacobian [nspec * ngllz * ngllx]
+ * @endcode
+ */
+class assembly_cache {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Construct a cache object
+   *
+   * @param filename Path to the cache file
+   * @param database Path to the mesh database used to generate the key
+   * @param quadratures Quadrature used to generate the key
+   */
+  assembly_cache(const std::string &filename, const std::string &database,
+                 const specfem::quadrature::quadratures &quadratures);
+  ///@}
+
+  /**
+   * @brief Check if the cache file exists and matches the current key
+   *
+   * @return true if the cache can be read
+   */
+  bool is_valid() const;
+
+  /**
+   * @brief Read the cached geometry in a single pass
+   *
+   * @param points Quadrature points (output, allocated by this function)
+   * @param partial_derivatives Partial derivatives (output, allocated by this
+   * function)
+   */
+  void read(specfem::compute::points &points,
+            specfem::compute::partial_derivatives &partial_derivatives) const;
+
+  /**
+   * @brief Write the assembled geometry to the cache file
+   *
+   * @param points Quadrature points
+   * @param partial_derivatives Partial derivatives
+   */
+  void
+  write(const specfem::compute::points &points,
+        const specfem::compute::partial_derivatives &partial_derivatives) const;
+
+  /**
+   * @brief Get the path to the cache file
+   *
+   * @return std::string Path to the cache file
+   */
+  std::string get_filename() const { return this->filename; }
+
+private:
+  std::string filename; ///< Path to the cache file
+  std::uint64_t key;    ///< Hash of the database and quadrature
+};
+
+} // namespace compute
+} // namespace specfem
+
+#endif /* _COMPUTE_ASSEMBLY_CACHE_HPP */
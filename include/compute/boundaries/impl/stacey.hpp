@@ -22,29 +22,32 @@ private:
       specfem::dimension::type::dim2; ///< Dimension
 
 public:
-  using BoundaryTagView =
-      Kokkos::View<specfem::element::boundary_tag_container ***,
-                   Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace>;
-  using EdgeNormalView = Kokkos::View<type_real ****, Kokkos::LayoutLeft,
+  using IndexView =
+      Kokkos::View<int *, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace>;
+  using EdgeNormalView = Kokkos::View<type_real * [2], Kokkos::LayoutLeft,
                                       Kokkos::DefaultExecutionSpace>;
-  using EdgeWeightView = Kokkos::View<type_real ***, Kokkos::LayoutLeft,
+  using EdgeWeightView = Kokkos::View<type_real *, Kokkos::LayoutLeft,
                                       Kokkos::DefaultExecutionSpace>;
 
-  BoundaryTagView quadrature_point_boundary_tag; ///< Boundary tag for every
-  ///< quadrature point within an
-  ///< element with Stacey boundary
+  int npoints = 0; ///< Total number of quadrature points on absorbing edges
 
-  BoundaryTagView::HostMirror h_quadrature_point_boundary_tag; ///< Host mirror
-                                                               ///< of boundary
-                                                               ///< types
+  IndexView element_offset; ///< Offset of the first boundary point of every
+                            ///< element with Stacey boundary. Points of
+                            ///< element i are stored within
+                            ///< [element_offset(i), element_offset(i + 1))
+  IndexView::HostMirror h_element_offset; ///< Host mirror of element offset
+
+  IndexView point_ispec; ///< Spectral element index of every boundary point
+  IndexView point_iz;    ///< Z index of every boundary point
+  IndexView point_ix;    ///< X index of every boundary point
+  IndexView::HostMirror h_point_ispec; ///< Host mirror of point ispec
+  IndexView::HostMirror h_point_iz;    ///< Host mirror of point iz
+  IndexView::HostMirror h_point_ix;    ///< Host mirror of point ix
 
   EdgeNormalView edge_normal; ///< Normal vector to the edge for every
-                              ///< quadrature point within an element with
-                              ///< Stacey boundary
+                              ///< boundary point
   EdgeWeightView edge_weight; ///< Edge weight used to compute integrals on the
-                              ///< edge for every quadrature point within an
-                              ///< element with Stacey boundary. Evaluates to 0
-                              ///< for points not on the edge
+                              ///< edge for every boundary point
 
   EdgeNormalView::HostMirror h_edge_normal; ///< Host mirror of edge normal
 
@@ -61,191 +64,175 @@ public:
          const Kokkos::View<int *, Kokkos::HostSpace> &boundary_index_mapping,
          std::vector<specfem::element::boundary_tag_container> &boundary_tag);
 
-  KOKKOS_FORCEINLINE_FUNCTION void
-  load_on_device(const specfem::point::index<dimension> &index,
-                 specfem::point::boundary<boundary_tag, dimension, false>
-                     &boundary) const {
-
-    boundary.tag +=
-        quadrature_point_boundary_tag(index.ispec, index.iz, index.ix);
-
-    boundary.edge_normal(0) = edge_normal(index.ispec, index.iz, index.ix, 0);
-    boundary.edge_normal(1) = edge_normal(index.ispec, index.iz, index.ix, 1);
-    boundary.edge_weight = edge_weight(index.ispec, index.iz, index.ix);
+  /**
+   * @brief Index of a quadrature point within the list of absorbing boundary
+   * points
+   *
+   * @param ielement Index of the element within the elements with Stacey
+   * boundary
+   * @param iz Z index of the quadrature point
+   * @param ix X index of the quadrature point
+   * @return int Index of the point. -1 if the point is not on an absorbing
+   * edge
+   */
+  KOKKOS_FORCEINLINE_FUNCTION int find_point(const int ielement, const int iz,
+                                             const int ix) const {
+    const int end = element_offset(ielement + 1);
+    for (int ipoint = element_offset(ielement); ipoint < end; ++ipoint) {
+      if (point_iz(ipoint) == iz && point_ix(ipoint) == ix) {
+        return ipoint;
+      }
+    }
+    return -1;
+  }
 
-    return;
+  /**
+   * @brief Host version of @ref find_point
+   *
+   */
+  int h_find_point(const int ielement, const int iz, const int ix) const {
+    const int end = h_element_offset(ielement + 1);
+    for (int ipoint = h_element_offset(ielement); ipoint < end; ++ipoint) {
+      if (h_point_iz(ipoint) == iz && h_point_ix(ipoint) == ix) {
+        return ipoint;
+      }
+    }
+    return -1;
   }
 
+  template <typename PointBoundaryType,
+            typename std::enable_if_t<!PointBoundaryType::simd::using_simd,
+                                      int> = 0>
   KOKKOS_FORCEINLINE_FUNCTION void
   load_on_device(const specfem::point::index<dimension> &index,
-                 specfem::point::boundary<
-                     specfem::element::boundary_tag::composite_stacey_dirichlet,
-                     dimension, false> &boundary) const {
+                 PointBoundaryType &boundary) const {
 
-    boundary.tag +=
-        quadrature_point_boundary_tag(index.ispec, index.iz, index.ix);
+    static_assert(
+        (PointBoundaryType::boundary_tag == boundary_tag) ||
+            (PointBoundaryType::boundary_tag ==
+             specfem::element::boundary_tag::composite_stacey_dirichlet),
+        "Boundary tag must be stacey or composite_stacey_dirichlet");
 
-    boundary.edge_normal(0) = edge_normal(index.ispec, index.iz, index.ix, 0);
-    boundary.edge_normal(1) = edge_normal(index.ispec, index.iz, index.ix, 1);
-    boundary.edge_weight = edge_weight(index.ispec, index.iz, index.ix);
+    const int ipoint = find_point(index.ispec, index.iz, index.ix);
 
-    return;
-  }
-
-  KOKKOS_FORCEINLINE_FUNCTION void load_on_device(
-      const specfem::point::simd_index<dimension> &index,
-      specfem::point::boundary<boundary_tag, dimension, true> &boundary) const {
-
-    using simd = typename specfem::datatype::simd<type_real, true>;
-
-    using mask_type = typename simd::mask_type;
-    using tag_type = typename simd::tag_type;
-
-    mask_type mask([&](std::size_t lane) { return index.mask(lane); });
-
-    for (int lane = 0; lane < mask_type::size(); ++lane) {
-      if (index.mask(lane)) {
-        boundary.tag[lane] += quadrature_point_boundary_tag(index.ispec + lane,
-                                                            index.iz, index.ix);
-      }
+    if (ipoint < 0) {
+      boundary.edge_normal(0) = 0.0;
+      boundary.edge_normal(1) = 0.0;
+      boundary.edge_weight = 0.0;
+      return;
     }
 
-    Kokkos::Experimental::where(mask, boundary.edge_normal(0))
-        .copy_from(&edge_normal(index.ispec, index.iz, index.ix, 0),
-                   tag_type());
+    boundary.tag += boundary_tag;
 
-    Kokkos::Experimental::where(mask, boundary.edge_normal(1))
-        .copy_from(&edge_normal(index.ispec, index.iz, index.ix, 1),
-                   tag_type());
+    boundary.edge_normal(0) = edge_normal(ipoint, 0);
+    boundary.edge_normal(1) = edge_normal(ipoint, 1);
+    boundary.edge_weight = edge_weight(ipoint);
 
-    Kokkos::Experimental::where(mask, boundary.edge_weight)
-        .copy_from(&edge_weight(index.ispec, index.iz, index.ix), tag_type());
+    return;
   }
 
+  template <
+      typename PointBoundaryType,
+      typename std::enable_if_t<PointBoundaryType::simd::using_simd, int> = 0>
   KOKKOS_FORCEINLINE_FUNCTION void
   load_on_device(const specfem::point::simd_index<dimension> &index,
-                 specfem::point::boundary<
-                     specfem::element::boundary_tag::composite_stacey_dirichlet,
-                     dimension, true> &boundary) const {
+                 PointBoundaryType &boundary) const {
 
-    using simd = typename specfem::datatype::simd<type_real, true>;
+    static_assert(
+        (PointBoundaryType::boundary_tag == boundary_tag) ||
+            (PointBoundaryType::boundary_tag ==
+             specfem::element::boundary_tag::composite_stacey_dirichlet),
+        "Boundary tag must be stacey or composite_stacey_dirichlet");
 
-    using mask_type = typename simd::mask_type;
-    using tag_type = typename simd::tag_type;
+    using simd = typename PointBoundaryType::simd;
 
-    mask_type mask([&](std::size_t lane) { return index.mask(lane); });
+    boundary.edge_normal(0) = static_cast<type_real>(0.0);
+    boundary.edge_normal(1) = static_cast<type_real>(0.0);
+    boundary.edge_weight = static_cast<type_real>(0.0);
 
-    for (int lane = 0; lane < mask_type::size(); ++lane) {
-      if (index.mask(lane)) {
-        boundary.tag[lane] += quadrature_point_boundary_tag(index.ispec + lane,
-                                                            index.iz, index.ix);
-      }
-    }
-
-    Kokkos::Experimental::where(mask, boundary.edge_normal(0))
-        .copy_from(&edge_normal(index.ispec, index.iz, index.ix, 0),
-                   tag_type());
-
-    Kokkos::Experimental::where(mask, boundary.edge_normal(1))
-        .copy_from(&edge_normal(index.ispec, index.iz, index.ix, 1),
-                   tag_type());
-
-    Kokkos::Experimental::where(mask, boundary.edge_weight)
-        .copy_from(&edge_weight(index.ispec, index.iz, index.ix), tag_type());
-  }
+    for (int lane = 0; lane < simd::size(); ++lane) {
+      if (!index.mask(lane))
+        continue;
 
-  inline void load_on_host(const specfem::point::index<dimension> &index,
-                           specfem::point::boundary<boundary_tag, dimension,
-                                                    false> &boundary) const {
-    boundary.tag +=
-        h_quadrature_point_boundary_tag(index.ispec, index.iz, index.ix);
-
-    boundary.edge_normal(0) = h_edge_normal(index.ispec, index.iz, index.ix, 0);
-    boundary.edge_normal(1) = h_edge_normal(index.ispec, index.iz, index.ix, 1);
-
-    boundary.edge_weight = h_edge_weight(index.ispec, index.iz, index.ix);
-
-    return;
-  }
+      const int ipoint = find_point(index.ispec + lane, index.iz, index.ix);
 
-  inline void
-  load_on_host(const specfem::point::index<dimension> &index,
-               specfem::point::boundary<
-                   specfem::element::boundary_tag::composite_stacey_dirichlet,
-                   dimension, false> &boundary) const {
-    boundary.tag +=
-        h_quadrature_point_boundary_tag(index.ispec, index.iz, index.ix);
+      if (ipoint < 0)
+        continue;
 
-    boundary.edge_normal(0) = h_edge_normal(index.ispec, index.iz, index.ix, 0);
-    boundary.edge_normal(1) = h_edge_normal(index.ispec, index.iz, index.ix, 1);
+      boundary.tag[lane] += boundary_tag;
 
-    boundary.edge_weight = h_edge_weight(index.ispec, index.iz, index.ix);
+      boundary.edge_normal(0)[lane] = edge_normal(ipoint, 0);
+      boundary.edge_normal(1)[lane] = edge_normal(ipoint, 1);
+      boundary.edge_weight[lane] = edge_weight(ipoint);
+    }
 
     return;
   }
 
-  inline void load_on_host(
-      const specfem::point::simd_index<dimension> &index,
-      specfem::point::boundary<boundary_tag, dimension, true> &boundary) const {
-
-    using simd = typename specfem::datatype::simd<type_real, true>;
+  template <typename PointBoundaryType,
+            typename std::enable_if_t<!PointBoundaryType::simd::using_simd,
+                                      int> = 0>
+  inline void load_on_host(const specfem::point::index<dimension> &index,
+                           PointBoundaryType &boundary) const {
 
-    using mask_type = typename simd::mask_type;
-    using tag_type = typename simd::tag_type;
+    static_assert(
+        (PointBoundaryType::boundary_tag == boundary_tag) ||
+            (PointBoundaryType::boundary_tag ==
+             specfem::element::boundary_tag::composite_stacey_dirichlet),
+        "Boundary tag must be stacey or composite_stacey_dirichlet");
 
-    mask_type mask([&](std::size_t lane) { return index.mask(lane); });
+    const int ipoint = h_find_point(index.ispec, index.iz, index.ix);
 
-    for (int lane = 0; lane < mask_type::size(); ++lane) {
-      if (index.mask(lane)) {
-        boundary.tag[lane] += h_quadrature_point_boundary_tag(
-            index.ispec + lane, index.iz, index.ix);
-      }
+    if (ipoint < 0) {
+      boundary.edge_normal(0) = 0.0;
+      boundary.edge_normal(1) = 0.0;
+      boundary.edge_weight = 0.0;
+      return;
     }
 
-    Kokkos::Experimental::where(mask, boundary.edge_normal(0))
-        .copy_from(&h_edge_normal(index.ispec, index.iz, index.ix, 0),
-                   tag_type());
+    boundary.tag += boundary_tag;
 
-    Kokkos::Experimental::where(mask, boundary.edge_normal(1))
-        .copy_from(&h_edge_normal(index.ispec, index.iz, index.ix, 1),
-                   tag_type());
-
-    Kokkos::Experimental::where(mask, boundary.edge_weight)
-        .copy_from(&h_edge_weight(index.ispec, index.iz, index.ix), tag_type());
+    boundary.edge_normal(0) = h_edge_normal(ipoint, 0);
+    boundary.edge_normal(1) = h_edge_normal(ipoint, 1);
+    boundary.edge_weight = h_edge_weight(ipoint);
 
     return;
   }
 
-  inline void
-  load_on_host(const specfem::point::simd_index<dimension> &index,
-               specfem::point::boundary<
-                   specfem::element::boundary_tag::composite_stacey_dirichlet,
-                   dimension, true> &boundary) const {
+  template <
+      typename PointBoundaryType,
+      typename std::enable_if_t<PointBoundaryType::simd::using_simd, int> = 0>
+  inline void load_on_host(const specfem::point::simd_index<dimension> &index,
+                           PointBoundaryType &boundary) const {
 
-    using simd = typename specfem::datatype::simd<type_real, true>;
+    static_assert(
+        (PointBoundaryType::boundary_tag == boundary_tag) ||
+            (PointBoundaryType::boundary_tag ==
+             specfem::element::boundary_tag::composite_stacey_dirichlet),
+        "Boundary tag must be stacey or composite_stacey_dirichlet");
 
-    using mask_type = typename simd::mask_type;
-    using tag_type = typename simd::tag_type;
+    using simd = typename PointBoundaryType::simd;
 
-    mask_type mask([&](std::size_t lane) { return index.mask(lane); });
+    boundary.edge_normal(0) = static_cast<type_real>(0.0);
+    boundary.edge_normal(1) = static_cast<type_real>(0.0);
+    boundary.edge_weight = static_cast<type_real>(0.0);
 
-    for (int lane = 0; lane < mask_type::size(); ++lane) {
-      if (index.mask(lane)) {
-        boundary.tag[lane] += quadrature_point_boundary_tag(index.ispec + lane,
-                                                            index.iz, index.ix);
-      }
-    }
+    for (int lane = 0; lane < simd::size(); ++lane) {
+      if (!index.mask(lane))
+        continue;
 
-    Kokkos::Experimental::where(mask, boundary.edge_normal(0))
-        .copy_from(&h_edge_normal(index.ispec, index.iz, index.ix, 0),
-                   tag_type());
+      const int ipoint =
+          h_find_point(index.ispec + lane, index.iz, index.ix);
 
-    Kokkos::Experimental::where(mask, boundary.edge_normal(1))
-        .copy_from(&h_edge_normal(index.ispec, index.iz, index.ix, 1),
-                   tag_type());
+      if (ipoint < 0)
+        continue;
 
-    Kokkos::Experimental::where(mask, boundary.edge_weight)
-        .copy_from(&h_edge_weight(index.ispec, index.iz, index.ix), tag_type());
+      boundary.tag[lane] += boundary_tag;
+
+      boundary.edge_normal(0)[lane] = h_edge_normal(ipoint, 0);
+      boundary.edge_normal(1)[lane] = h_edge_normal(ipoint, 1);
+      boundary.edge_weight[lane] = h_edge_weight(ipoint);
+    }
 
     return;
   }
@@ -20,8 +20,13 @@ public:
   constexpr static auto dimension = DimensionType;
   constexpr static auto boundary_tag = BoundaryTag;
 
-  specfem::kokkos::DeviceView1d<int> property_index_mapping;
-  specfem::kokkos::HostMirror1d<int> h_property_index_mapping;
+  specfem::kokkos::DeviceView1d<int>
+      property_index_mapping; ///< Index of every absorbing boundary point
+                              ///< within the medium container. -1 if the point
+                              ///< is not stored in this container
+  specfem::kokkos::HostMirror1d<int> h_property_index_mapping; ///< Host mirror
+                                                               ///< of index
+                                                               ///< mapping
 
   specfem::compute::impl::boundary_medium_container<
       DimensionType, specfem::element::medium_tag::acoustic, BoundaryTag>
@@ -49,23 +54,17 @@ public:
   }
 };
 
-template <typename IndexType, typename AccelerationType,
-          typename BoundaryValueContainerType,
-          typename std::enable_if_t<
-              ((BoundaryValueContainerType::boundary_tag ==
-                specfem::element::boundary_tag::none) ||
-               (BoundaryValueContainerType::boundary_tag ==
-                specfem::element::boundary_tag::acoustic_free_surface)),
-              int> = 0>
-KOKKOS_INLINE_FUNCTION void
-store_on_device(const int istep, const IndexType index,
-                const AccelerationType &acceleration,
-                const BoundaryValueContainerType &boundary_value_container) {
-  return;
-}
-
-template <typename IndexType, typename AccelerationType,
-          typename BoundaryValueContainerType,
+/**
+ * @brief Store the boundary values at an absorbing boundary point on the
+ * device
+ *
+ * @param istep Time step
+ * @param ipoint Index of the point within the list of absorbing boundary points
+ * (see @ref specfem::compute::impl::boundaries::stacey)
+ * @param acceleration Boundary values at the point
+ * @param boundary_value_container Boundary value container
+ */
+template <typename AccelerationType, typename BoundaryValueContainerType,
           typename std::enable_if_t<
               ((BoundaryValueContainerType::boundary_tag ==
                 specfem::element::boundary_tag::stacey) ||
@@ -73,7 +72,7 @@ template <typename IndexType, typename AccelerationType,
                 specfem::element::boundary_tag::composite_stacey_dirichlet)),
               int> = 0>
 KOKKOS_FUNCTION void
-store_on_device(const int istep, const IndexType index,
+store_on_device(const int istep, const int ipoint,
                 const AccelerationType &acceleration,
                 const BoundaryValueContainerType &boundary_value_container) {
 
@@ -83,22 +82,29 @@ store_on_device(const int istep, const IndexType index,
       (BoundaryValueContainerType::dimension == AccelerationType::dimension),
       "DimensionType must match AccelerationType::dimension_type");
 
-  IndexType l_index = index;
-  l_index.ispec = boundary_value_container.property_index_mapping(index.ispec);
+  const int l_ipoint = boundary_value_container.property_index_mapping(ipoint);
 
   if constexpr (MediumTag == specfem::element::medium_tag::acoustic) {
-    boundary_value_container.acoustic.store_on_device(istep, l_index,
+    boundary_value_container.acoustic.store_on_device(istep, l_ipoint,
                                                       acceleration);
   } else if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
-    boundary_value_container.elastic.store_on_device(istep, l_index,
+    boundary_value_container.elastic.store_on_device(istep, l_ipoint,
                                                      acceleration);
   }
 
   return;
 }
 
-template <typename IndexType, typename AccelerationType,
-          typename BoundaryValueContainerType,
+/**
+ * @brief Load the boundary values at an absorbing boundary point on the device
+ *
+ * @param istep Time step
+ * @param ipoint Index of the point within the list of absorbing boundary points
+ * (see @ref specfem::compute::impl::boundaries::stacey)
+ * @param boundary_value_container Boundary value container
+ * @param acceleration Boundary values at the point (output)
+ */
+template <typename AccelerationType, typename BoundaryValueContainerType,
           typename std::enable_if_t<
               ((BoundaryValueContainerType::boundary_tag ==
                 specfem::element::boundary_tag::stacey) ||
@@ -106,25 +112,23 @@ template <typename IndexType, typename AccelerationType,
                 specfem::element::boundary_tag::composite_stacey_dirichlet)),
               int> = 0>
 KOKKOS_FUNCTION void
-load_on_device(const int istep, const IndexType index,
+load_on_device(const int istep, const int ipoint,
                const BoundaryValueContainerType &boundary_value_container,
                AccelerationType &acceleration) {
 
   constexpr static auto MediumType = AccelerationType::medium_tag;
 
-  IndexType l_index = index;
-
   static_assert(
       (BoundaryValueContainerType::dimension == AccelerationType::dimension),
       "Number of dimensions must match");
 
-  l_index.ispec = boundary_value_container.property_index_mapping(index.ispec);
+  const int l_ipoint = boundary_value_container.property_index_mapping(ipoint);
 
   if constexpr (MediumType == specfem::element::medium_tag::acoustic) {
-    boundary_value_container.acoustic.load_on_device(istep, l_index,
+    boundary_value_container.acoustic.load_on_device(istep, l_ipoint,
                                                      acceleration);
   } else if constexpr (MediumType == specfem::element::medium_tag::elastic) {
-    boundary_value_container.elastic.load_on_device(istep, l_index,
+    boundary_value_container.elastic.load_on_device(istep, l_ipoint,
                                                     acceleration);
   }
 
@@ -12,23 +12,23 @@ specfem::compute::boundary_value_container<DimensionType, BoundaryTag>::
                              const specfem::compute::boundaries boundaries)
     : property_index_mapping(
           "specfem::compute::boundary_value_container::property_index_mapping",
-          mesh.nspec),
+          boundaries.stacey.npoints),
       h_property_index_mapping(
           Kokkos::create_mirror_view(property_index_mapping)) {
 
-  for (int ispec = 0; ispec < mesh.nspec; ++ispec) {
-    h_property_index_mapping(ispec) = -1;
+  for (int ipoint = 0; ipoint < boundaries.stacey.npoints; ++ipoint) {
+    h_property_index_mapping(ipoint) = -1;
   }
 
   Kokkos::fence();
 
   acoustic = specfem::compute::impl::boundary_medium_container<
       DimensionType, specfem::element::medium_tag::acoustic, BoundaryTag>(
-      nstep, mesh, element_types, boundaries, h_property_index_mapping);
+      nstep, element_types, boundaries, h_property_index_mapping);
 
   elastic = specfem::compute::impl::boundary_medium_container<
       DimensionType, specfem::element::medium_tag::elastic, BoundaryTag>(
-      nstep, mesh, element_types, boundaries, h_property_index_mapping);
+      nstep, element_types, boundaries, h_property_index_mapping);
 
   Kokkos::deep_copy(property_index_mapping, h_property_index_mapping);
 }
@@ -9,26 +9,26 @@ template <specfem::dimension::type DimensionType,
 specfem::compute::impl::boundary_medium_container<DimensionType, MediumType,
                                             BoundaryTag>::
     boundary_medium_container(
-        const int nstep, const specfem::compute::mesh mesh,
-        const specfem::compute::element_types element_types,
+        const int nstep, const specfem::compute::element_types element_types,
         const specfem::compute::boundaries boundaries,
         specfem::kokkos::HostView1d<int> property_index_mapping) {
 
-  int nelements = 0;
-  const int nspec = mesh.nspec;
-  const int nz = mesh.ngllz;
-  const int nx = mesh.ngllx;
+  // Only points on absorbing edges of elements of this medium and boundary
+  // type are stored
+  int npoints = 0;
+  const auto &stacey = boundaries.stacey;
 
-  for (int ispec = 0; ispec < nspec; ispec++) {
+  for (int ipoint = 0; ipoint < stacey.npoints; ++ipoint) {
+    const int ispec = stacey.h_point_ispec(ipoint);
     if (element_types.get_medium_tag(ispec) == MediumType &&
         element_types.get_boundary_tag(ispec) == BoundaryTag) {
-      property_index_mapping(ispec) = nelements;
-      nelements++;
+      property_index_mapping(ipoint) = npoints;
+      npoints++;
     }
   }
 
   values = value_type("specfem::compute::boundary_medium_container::values",
-                      nelements, nz, nx, nstep);
+                      npoints, nstep);
 
   h_values = Kokkos::create_mirror_view(values);
 
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "compute/compute_mesh.hpp"
+#include "compute/element_types/element_types.hpp"
+#include "compute/properties/interface.hpp"
+#include "specfem_setup.hpp"
+#include <string>
+#include <vector>
+
+namespace specfem {
+namespace compute {
+/**
+ * @brief Courant-Friedrichs-Lewy (CFL) stability analysis of the mesh
+ *
+ * For every spectral element the minimum distance between neighbouring GLL
+ * points \f$ \Delta x_{min} \f$ and the maximum wave speed \f$ v_{max} \f$ are
+ * computed on the device. The Courant number of an element is
+ * \f$ C = v_{max} \Delta t / \Delta x_{min} \f$. The recommended time step
+ * is the largest time step for which the Courant number of every element does
+ * not exceed the target Courant number.
+ */
+struct cfl {
+  /**
+   * @brief Stability of a single spectral element
+   *
+   */
+  struct element {
+    int ispec;                  ///< Index of the element in the mesh database
+    type_real courant;          ///< Courant number of the element
+    type_real min_gll_distance; ///< Minimum distance between GLL points
+    type_real max_velocity;     ///< Maximum wave speed within the element
+    type_real x;                ///< X coordinate of the element center
+    type_real z;                ///< Z coordinate of the element center
+  };
+
+  type_real dt;             ///< Time step used for the analysis
+  type_real target_courant; ///< Target Courant number
+  type_real courant;        ///< Maximum Courant number over all elements
+  type_real recommended_dt; ///< Largest stable time step for the target
+                            ///< Courant number
+  std::vector<element> worst_elements; ///< Elements with the largest Courant
+                                       ///< number, sorted in decreasing order
+  std::vector<type_real> element_courant; ///< Courant number of every
+                                          ///< element in assembly ordering
+
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Default constructor
+   *
+   */
+  cfl() = default;
+
+  /**
+   * @brief Run the CFL analysis on an assembled mesh
+   *
+   * @param mesh Assembled mesh
+   * @param element_types Element types
+   * @param properties Material properties
+   * @param dt Time step
+   * @param target_courant Target Courant number
+   * @param nworst Number of elements with the largest Courant number to report
+   */
+  cfl(const specfem::compute::mesh &mesh,
+      const specfem::compute::element_types &element_types,
+      const specfem::compute::properties &properties, const type_real dt,
+      const type_real target_courant, const int nworst = 10);
+
+  ///@}
+
+  /**
+   * @brief Print the CFL report
+   *
+   * @return std::string CFL report
+   */
+  std::string print() const;
+};
+
+} // namespace compute
+} // namespace specfem
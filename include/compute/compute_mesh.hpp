@@ -142,8 +142,8 @@ struct points {
   int ngllz; ///< Number of quadrature points in z dimension
   int ngllx; ///< Number of quadrature points in x dimension
 
-  using ViewType =
-      Kokkos::View<int ***, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace>;
+  using ViewType = Kokkos::View<int ***, specfem::kokkos::ElementLayout,
+                                Kokkos::DefaultExecutionSpace>;
 
   ViewType index_mapping;                         ///< Global index
                                                   ///< number for every
@@ -196,6 +196,22 @@ struct mesh {
            &control_nodes,
        const specfem::quadrature::quadratures &quadratures);
 
+  /**
+   * @brief Construct the mesh using previously assembled quadrature points
+   *
+   * Skips the global numbering of quadrature points.
+   *
+   * @param tags Element tags
+   * @param control_nodes Control nodes
+   * @param quadratures Quadrature object
+   * @param points Assembled quadrature points (e.g. read from a cache)
+   */
+  mesh(const specfem::mesh::tags<specfem::dimension::type::dim2> &tags,
+       const specfem::mesh::control_nodes<specfem::dimension::type::dim2>
+           &control_nodes,
+       const specfem::quadrature::quadratures &quadratures,
+       const specfem::compute::points &points);
+
   specfem::compute::points assemble();
 
   /**
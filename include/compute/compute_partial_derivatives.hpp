@@ -14,31 +14,57 @@ namespace compute {
 /**
  * @brief Partial derivatives of the basis functions at every quadrature point
  *
+ * For affine elements (straight-sided parallelograms) the partial derivatives
+ * are constant within the element. On the device these elements store a
+ * single record per element, only curved elements store values at every
+ * quadrature point. Host views always store values at every quadrature point.
  */
 struct partial_derivatives {
 
 private:
   using ViewType =
-      typename Kokkos::View<type_real ***, Kokkos::LayoutLeft,
+      typename Kokkos::View<type_real ***, specfem::kokkos::ElementLayout,
                             Kokkos::DefaultExecutionSpace>; ///< Underlying view
                                                             ///< type used to
                                                             ///< store data
+  using ElementViewType =
+      Kokkos::View<type_real *, Kokkos::DefaultExecutionSpace>; ///< View type
+                                                                ///< used to
+                                                                ///< store
+                                                                ///< per-element
+                                                                ///< data
+  using IndexViewType =
+      Kokkos::View<int *, Kokkos::DefaultExecutionSpace>; ///< View type used
+                                                          ///< to store element
+                                                          ///< indices
 
 public:
-  int nspec; ///< Number of spectral elements
-  int ngllz; ///< Number of quadrature points in z direction
-  int ngllx; ///< Number of quadrature points in x direction
-
-  ViewType xix;                    ///< @xix
-  ViewType::HostMirror h_xix;      ///< Host mirror of @xix
-  ViewType xiz;                    ///< @xiz
-  ViewType::HostMirror h_xiz;      ///< Host mirror of @xiz
-  ViewType gammax;                 ///< @gammax
-  ViewType::HostMirror h_gammax;   ///< Host mirror of @gammax
-  ViewType gammaz;                 ///< @gammaz
-  ViewType::HostMirror h_gammaz;   ///< Host mirror of @gammaz
-  ViewType jacobian;               ///< Jacobian
-  ViewType::HostMirror h_jacobian; ///< Host mirror of Jacobian
+  int nspec;   ///< Number of spectral elements
+  int ngllz;   ///< Number of quadrature points in z direction
+  int ngllx;   ///< Number of quadrature points in x direction
+  int ncurved; ///< Number of elements stored at every quadrature point
+
+  IndexViewType element_index; ///< Index of the element within the device
+                               ///< quadrature point storage. -1 for affine
+                               ///< elements
+  IndexViewType::HostMirror h_element_index; ///< Host mirror of element_index
+
+  ViewType xix;                    ///< @xix for curved elements
+  ViewType::HostMirror h_xix;      ///< @xix
+  ViewType xiz;                    ///< @xiz for curved elements
+  ViewType::HostMirror h_xiz;      ///< @xiz
+  ViewType gammax;                 ///< @gammax for curved elements
+  ViewType::HostMirror h_gammax;   ///< @gammax
+  ViewType gammaz;                 ///< @gammaz for curved elements
+  ViewType::HostMirror h_gammaz;   ///< @gammaz
+  ViewType jacobian;               ///< Jacobian for curved elements
+  ViewType::HostMirror h_jacobian; ///< Jacobian
+
+  ElementViewType element_xix;      ///< @xix for affine elements
+  ElementViewType element_xiz;      ///< @xiz for affine elements
+  ElementViewType element_gammax;   ///< @gammax for affine elements
+  ElementViewType element_gammaz;   ///< @gammaz for affine elements
+  ElementViewType element_jacobian; ///< Jacobian for affine elements
 
   /**
    * @name Constructors
@@ -60,6 +86,11 @@ public:
   partial_derivatives(const specfem::compute::mesh &mesh);
   ///@}
 
+  /**
+   * @brief Classify elements as affine or curved from the values stored on
+   * the host and copy them to the device
+   *
+   */
   void sync_views();
 };
 
@@ -81,11 +112,11 @@ KOKKOS_FORCEINLINE_FUNCTION void impl_load_on_device(
     PointPartialDerivativesType &partial_derivatives) {
 
   const int ispec = index.ispec;
-  const int nspec = derivatives.nspec;
   const int iz = index.iz;
   const int ix = index.ix;
 
   using simd = typename PointPartialDerivativesType::simd;
+  using datatype = typename simd::datatype;
   using mask_type = typename simd::mask_type;
   using tag_type = typename simd::tag_type;
 
@@ -94,17 +125,68 @@ KOKKOS_FORCEINLINE_FUNCTION void impl_load_on_device(
 
   mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
-  Kokkos::Experimental::where(mask, partial_derivatives.xix)
-      .copy_from(&derivatives.xix(ispec, iz, ix), tag_type());
-  Kokkos::Experimental::where(mask, partial_derivatives.gammax)
-      .copy_from(&derivatives.gammax(ispec, iz, ix), tag_type());
-  Kokkos::Experimental::where(mask, partial_derivatives.xiz)
-      .copy_from(&derivatives.xiz(ispec, iz, ix), tag_type());
-  Kokkos::Experimental::where(mask, partial_derivatives.gammaz)
-      .copy_from(&derivatives.gammaz(ispec, iz, ix), tag_type());
-  if constexpr (StoreJacobian) {
-    Kokkos::Experimental::where(mask, partial_derivatives.jacobian)
-        .copy_from(&derivatives.jacobian(ispec, iz, ix), tag_type());
+  // Lanes map to consecutive elements. Use vector loads when all lanes are
+  // affine or all lanes are curved and stored contiguously.
+  const int icurved = derivatives.element_index(ispec);
+  bool all_affine = true;
+  bool all_contiguous = (icurved >= 0);
+  for (std::size_t lane = 0; lane < simd::size(); ++lane) {
+    if (!index.mask(lane))
+      continue;
+    const int index_lane = derivatives.element_index(ispec + lane);
+    all_affine = all_affine && (index_lane < 0);
+    all_contiguous =
+        all_contiguous && (index_lane == icurved + static_cast<int>(lane));
+  }
+
+  if (all_affine) {
+    Kokkos::Experimental::where(mask, partial_derivatives.xix)
+        .copy_from(&derivatives.element_xix(ispec), tag_type());
+    Kokkos::Experimental::where(mask, partial_derivatives.gammax)
+        .copy_from(&derivatives.element_gammax(ispec), tag_type());
+    Kokkos::Experimental::where(mask, partial_derivatives.xiz)
+        .copy_from(&derivatives.element_xiz(ispec), tag_type());
+    Kokkos::Experimental::where(mask, partial_derivatives.gammaz)
+        .copy_from(&derivatives.element_gammaz(ispec), tag_type());
+    if constexpr (StoreJacobian) {
+      Kokkos::Experimental::where(mask, partial_derivatives.jacobian)
+          .copy_from(&derivatives.element_jacobian(ispec), tag_type());
+    }
+  } else if (all_contiguous) {
+    Kokkos::Experimental::where(mask, partial_derivatives.xix)
+        .copy_from(&derivatives.xix(icurved, iz, ix), tag_type());
+    Kokkos::Experimental::where(mask, partial_derivatives.gammax)
+        .copy_from(&derivatives.gammax(icurved, iz, ix), tag_type());
+    Kokkos::Experimental::where(mask, partial_derivatives.xiz)
+        .copy_from(&derivatives.xiz(icurved, iz, ix), tag_type());
+    Kokkos::Experimental::where(mask, partial_derivatives.gammaz)
+        .copy_from(&derivatives.gammaz(icurved, iz, ix), tag_type());
+    if constexpr (StoreJacobian) {
+      Kokkos::Experimental::where(mask, partial_derivatives.jacobian)
+          .copy_from(&derivatives.jacobian(icurved, iz, ix), tag_type());
+    }
+  } else {
+    const auto gather = [&](const auto &curved, const auto &affine) {
+      return datatype([&](std::size_t lane) -> type_real {
+        if (!index.mask(lane))
+          return 0.0;
+        const int index_lane = derivatives.element_index(ispec + lane);
+        return (index_lane < 0) ? affine(ispec + lane)
+                                : curved(index_lane, iz, ix);
+      });
+    };
+    partial_derivatives.xix =
+        gather(derivatives.xix, derivatives.element_xix);
+    partial_derivatives.gammax =
+        gather(derivatives.gammax, derivatives.element_gammax);
+    partial_derivatives.xiz =
+        gather(derivatives.xiz, derivatives.element_xiz);
+    partial_derivatives.gammaz =
+        gather(derivatives.gammaz, derivatives.element_gammaz);
+    if constexpr (StoreJacobian) {
+      partial_derivatives.jacobian =
+          gather(derivatives.jacobian, derivatives.element_jacobian);
+    }
   }
 }
 
@@ -123,12 +205,25 @@ KOKKOS_FORCEINLINE_FUNCTION void impl_load_on_device(
   constexpr static bool StoreJacobian =
       PointPartialDerivativesType::store_jacobian;
 
-  partial_derivatives.xix = derivatives.xix(ispec, iz, ix);
-  partial_derivatives.gammax = derivatives.gammax(ispec, iz, ix);
-  partial_derivatives.xiz = derivatives.xiz(ispec, iz, ix);
-  partial_derivatives.gammaz = derivatives.gammaz(ispec, iz, ix);
+  const int icurved = derivatives.element_index(ispec);
+
+  if (icurved < 0) {
+    partial_derivatives.xix = derivatives.element_xix(ispec);
+    partial_derivatives.gammax = derivatives.element_gammax(ispec);
+    partial_derivatives.xiz = derivatives.element_xiz(ispec);
+    partial_derivatives.gammaz = derivatives.element_gammaz(ispec);
+    if constexpr (StoreJacobian) {
+      partial_derivatives.jacobian = derivatives.element_jacobian(ispec);
+    }
+    return;
+  }
+
+  partial_derivatives.xix = derivatives.xix(icurved, iz, ix);
+  partial_derivatives.gammax = derivatives.gammax(icurved, iz, ix);
+  partial_derivatives.xiz = derivatives.xiz(icurved, iz, ix);
+  partial_derivatives.gammaz = derivatives.gammaz(icurved, iz, ix);
   if constexpr (StoreJacobian) {
-    partial_derivatives.jacobian = derivatives.jacobian(ispec, iz, ix);
+    partial_derivatives.jacobian = derivatives.jacobian(icurved, iz, ix);
   }
 }
 
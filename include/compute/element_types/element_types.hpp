@@ -90,6 +90,40 @@ public:
                          const specfem::element::property_tag property,
                          const specfem::element::boundary_tag boundary) const;
 
+  /**
+   * @brief Get the elements that share the volume (stiffness) kernel of a
+   * given boundary type on the host
+   *
+   * Absorbing boundaries are handled by a separate kernel over the absorbing
+   * boundary points. Elements with Stacey boundaries are therefore returned
+   * together with elements of boundary type none, and elements with composite
+   * Stacey-Dirichlet boundaries together with elements of boundary type
+   * acoustic free surface.
+   *
+   * @param tag Medium tag
+   * @param property Property tag
+   * @param boundary Boundary tag. Needs to be none or acoustic free surface
+   * @return Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> Spectral
+   * element indices
+   */
+  Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace>
+  get_volume_elements_on_host(
+      const specfem::element::medium_tag tag,
+      const specfem::element::property_tag property,
+      const specfem::element::boundary_tag boundary) const;
+
+  /**
+   * @brief Get the elements that share the volume (stiffness) kernel of a
+   * given boundary type on the device
+   *
+   * @copydetails get_volume_elements_on_host
+   */
+  Kokkos::View<int *, Kokkos::DefaultExecutionSpace>
+  get_volume_elements_on_device(
+      const specfem::element::medium_tag tag,
+      const specfem::element::property_tag property,
+      const specfem::element::boundary_tag boundary) const;
+
   specfem::element::medium_tag get_medium_tag(const int ispec) const {
     return medium_tags(ispec);
   }
@@ -150,6 +184,23 @@ private:
                     BOUNDARY_TAG_COMPOSITE_STACEY_DIRICHLET))
 
 #undef ELEMENT_TYPES_VARIABLE_NAMES
+
+#define VOLUME_ELEMENTS_VARIABLE_NAMES(DIMENSION_TAG, MEDIUM_TAG,              \
+                                       PROPERTY_TAG, BOUNDARY_TAG)             \
+  IndexViewType CREATE_VARIABLE_NAME(                                          \
+      volume_elements, GET_NAME(DIMENSION_TAG), GET_NAME(MEDIUM_TAG),          \
+      GET_NAME(PROPERTY_TAG), GET_NAME(BOUNDARY_TAG));                         \
+  IndexViewType::HostMirror CREATE_VARIABLE_NAME(                              \
+      h_volume_elements, GET_NAME(DIMENSION_TAG), GET_NAME(MEDIUM_TAG),        \
+      GET_NAME(PROPERTY_TAG), GET_NAME(BOUNDARY_TAG));
+
+  CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+      VOLUME_ELEMENTS_VARIABLE_NAMES,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+              WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef VOLUME_ELEMENTS_VARIABLE_NAMES
 };
 
 } // namespace compute
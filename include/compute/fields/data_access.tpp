@@ -389,9 +389,8 @@ KOKKOS_FORCEINLINE_FUNCTION void
 impl_load_on_device(const specfem::point::index<ViewType::dimension> &index,
                     const WavefieldType &field, ViewType &point_field) {
   constexpr static auto MediumType = ViewType::medium_tag;
-  const int iglob_l = field.index_mapping(index.ispec, index.iz, index.ix);
-  const int iglob =
-      field.assembly_index_mapping(iglob_l, static_cast<int>(MediumType));
+  const int iglob = field.medium_index_mapping(
+      static_cast<int>(MediumType), index.ispec, index.iz, index.ix);
   impl_load_on_device(iglob, field, point_field);
 }
 
@@ -424,9 +423,8 @@ KOKKOS_FORCEINLINE_FUNCTION void impl_load_on_device(
   for (int lane = 0; lane < ViewType::simd::size(); ++lane) {
     iglob[lane] =
         (index.mask(std::size_t(lane)))
-            ? field.assembly_index_mapping(
-                  field.index_mapping(index.ispec + lane, index.iz, index.ix),
-                  static_cast<int>(MediumType))
+            ? field.medium_index_mapping(static_cast<int>(MediumType),
+                                         index.ispec + lane, index.iz, index.ix)
             : field.nglob + 1;
   }
 
@@ -441,9 +439,8 @@ inline void impl_load_on_host(const specfem::point::index<ViewType::dimension> &
                        const WavefieldType &field, ViewType &point_field) {
 
   constexpr static auto MediumType = ViewType::medium_tag;
-  const int iglob = field.h_assembly_index_mapping(
-      field.h_index_mapping(index.ispec, index.iz, index.ix),
-      static_cast<int>(MediumType));
+  const int iglob = field.h_medium_index_mapping(
+      static_cast<int>(MediumType), index.ispec, index.iz, index.ix);
 
   impl_load_on_host(iglob, field, point_field);
 }
@@ -478,9 +475,9 @@ inline void impl_load_on_host(
   for (int lane = 0; lane < ViewType::simd::size(); ++lane) {
     iglob[lane] =
         (index.mask(std::size_t(lane)))
-            ? field.h_assembly_index_mapping(
-                  field.h_index_mapping(index.ispec + lane, index.iz, index.ix),
-                  static_cast<int>(MediumType))
+            ? field.h_medium_index_mapping(static_cast<int>(MediumType),
+                                           index.ispec + lane, index.iz,
+                                           index.ix)
             : field.nglob + 1;
   }
 
@@ -848,9 +845,8 @@ impl_store_on_device(const specfem::point::index<ViewType::dimension> &index,
 
   constexpr static auto MediumType = ViewType::medium_tag;
 
-  const int iglob = field.assembly_index_mapping(
-      field.index_mapping(index.ispec, index.iz, index.ix),
-      static_cast<int>(MediumType));
+  const int iglob = field.medium_index_mapping(
+      static_cast<int>(MediumType), index.ispec, index.iz, index.ix);
 
   impl_store_on_device(iglob, point_field, field);
 }
@@ -888,9 +884,8 @@ KOKKOS_FORCEINLINE_FUNCTION void impl_store_on_device(
   for (int lane = 0; lane < ViewType::simd::size(); ++lane) {
     iglob[lane] =
         (index.mask(std::size_t(lane)))
-            ? field.assembly_index_mapping(
-                  field.index_mapping(index.ispec + lane, index.iz, index.ix),
-                  static_cast<int>(MediumType))
+            ? field.medium_index_mapping(static_cast<int>(MediumType),
+                                         index.ispec + lane, index.iz, index.ix)
             : field.nglob + 1;
   }
 
@@ -907,9 +902,8 @@ inline void impl_store_on_host(const specfem::point::index<ViewType::dimension>
 
   constexpr static auto MediumType = ViewType::medium_tag;
 
-  const int iglob = field.h_assembly_index_mapping(
-      field.h_index_mapping(index.ispec, index.iz, index.ix),
-      static_cast<int>(MediumType));
+  const int iglob = field.h_medium_index_mapping(
+      static_cast<int>(MediumType), index.ispec, index.iz, index.ix);
 
   impl_store_on_host(iglob, point_field, field);
 }
@@ -947,7 +941,9 @@ inline void impl_store_on_host(
   for (int lane = 0; lane < ViewType::simd::size(); ++lane) {
     iglob[lane] =
         (index.mask(std::size_t(lane)))
-            ? field.h_index_mapping(index.ispec + lane, index.iz, index.ix)
+            ? field.h_medium_index_mapping(static_cast<int>(MediumType),
+                                           index.ispec + lane, index.iz,
+                                           index.ix)
             : field.nglob + 1;
   }
 
@@ -1354,9 +1350,8 @@ impl_add_on_device(const specfem::point::index<ViewType::dimension> &index,
 
   constexpr static auto MediumType = ViewType::medium_tag;
 
-  const int iglob = field.assembly_index_mapping(
-      field.index_mapping(index.ispec, index.iz, index.ix),
-      static_cast<int>(MediumType));
+  const int iglob = field.medium_index_mapping(
+      static_cast<int>(MediumType), index.ispec, index.iz, index.ix);
 
   impl_add_on_device(iglob, point_field, field);
 }
@@ -1394,9 +1389,8 @@ impl_add_on_device(const specfem::point::simd_index<ViewType::dimension> &index,
   for (int lane = 0; lane < ViewType::simd::size(); ++lane) {
     iglob[lane] =
         (index.mask(std::size_t(lane)))
-            ? field.assembly_index_mapping(
-                  field.index_mapping(index.ispec + lane, index.iz, index.ix),
-                  static_cast<int>(MediumType))
+            ? field.medium_index_mapping(static_cast<int>(MediumType),
+                                         index.ispec + lane, index.iz, index.ix)
             : field.nglob + 1;
   }
 
@@ -1412,9 +1406,8 @@ inline void impl_add_on_host(const specfem::point::index<ViewType::dimension> &i
 
   constexpr static auto MediumType = ViewType::medium_tag;
 
-  const int iglob = field.h_assembly_index_mapping(
-      field.h_index_mapping(index.ispec, index.iz, index.ix),
-      static_cast<int>(MediumType));
+  const int iglob = field.h_medium_index_mapping(
+      static_cast<int>(MediumType), index.ispec, index.iz, index.ix);
 
   impl_add_on_host(iglob, point_field, field);
 }
@@ -1451,7 +1444,9 @@ inline void impl_add_on_host(
   for (int lane = 0; lane < ViewType::simd::size(); ++lane) {
     iglob[lane] =
         (index.mask(std::size_t(lane)))
-            ? field.h_index_mapping(index.ispec + lane, index.iz, index.ix)
+            ? field.h_medium_index_mapping(static_cast<int>(MediumType),
+                                           index.ispec + lane, index.iz,
+                                           index.ix)
             : field.nglob + 1;
   }
 
@@ -1696,9 +1691,8 @@ KOKKOS_FORCEINLINE_FUNCTION void impl_atomic_add_on_device(
 
   constexpr static auto MediumType = ViewType::medium_tag;
 
-  const int iglob = field.assembly_index_mapping(
-      field.index_mapping(index.ispec, index.iz, index.ix),
-      static_cast<int>(MediumType));
+  const int iglob = field.medium_index_mapping(
+      static_cast<int>(MediumType), index.ispec, index.iz, index.ix);
 
   impl_atomic_add_on_device(iglob, point_field, field);
 }
@@ -1721,9 +1715,8 @@ KOKKOS_FORCEINLINE_FUNCTION void impl_atomic_add_on_device(
   for (int lane = 0; lane < ViewType::simd::size(); ++lane) {
     iglob[lane] =
         (index.mask(std::size_t(lane)))
-            ? field.assembly_index_mapping(
-                  field.index_mapping(index.ispec + lane, index.iz, index.ix),
-                  static_cast<int>(MediumType))
+            ? field.medium_index_mapping(static_cast<int>(MediumType),
+                                         index.ispec + lane, index.iz, index.ix)
             : field.nglob + 1;
   }
 
@@ -1740,9 +1733,8 @@ inline void impl_atomic_add_on_host(
 
   constexpr static auto MediumType = ViewType::medium_tag;
 
-  const int iglob = field.h_assembly_index_mapping(
-      field.h_index_mapping(index.ispec, index.iz, index.ix),
-      static_cast<int>(MediumType));
+  const int iglob = field.h_medium_index_mapping(
+      static_cast<int>(MediumType), index.ispec, index.iz, index.ix);
 
   impl_atomic_add_on_host(iglob, point_field, field);
 }
@@ -1765,7 +1757,9 @@ inline void impl_atomic_add_on_host(
   for (int lane = 0; lane < ViewType::simd::size(); ++lane) {
     iglob[lane] =
         (index.mask(std::size_t(lane)))
-            ? field.h_index_mapping(index.ispec + lane, index.iz, index.ix)
+            ? field.h_medium_index_mapping(static_cast<int>(MediumType),
+                                           index.ispec + lane, index.iz,
+                                           index.ix)
             : field.nglob + 1;
   }
 
@@ -1809,8 +1803,8 @@ impl_load_on_device(const MemberType &team, const int ispec,
       Kokkos::TeamThreadRange(team, NGLL * NGLL), [&](const int &xz) {
         int iz, ix;
         sub2ind(xz, NGLL, iz, ix);
-        const int iglob = field.assembly_index_mapping(
-            field.index_mapping(ispec, iz, ix), static_cast<int>(MediumType));
+        const int iglob = field.medium_index_mapping(
+            static_cast<int>(MediumType), ispec, iz, ix);
 
         for (int icomp = 0; icomp < components; ++icomp) {
           if constexpr (StoreDisplacement) {
@@ -1871,8 +1865,8 @@ inline void impl_load_on_host(const MemberType &team, const int ispec,
       Kokkos::TeamThreadRange(team, NGLL * NGLL), [&](const int &xz) {
         int iz, ix;
         sub2ind(xz, NGLL, iz, ix);
-        const int iglob = field.h_assembly_index_mapping(
-            field.h_index_mapping(ispec, iz, ix), static_cast<int>(MediumType));
+        const int iglob = field.h_medium_index_mapping(
+            static_cast<int>(MediumType), ispec, iz, ix);
 
         for (int icomp = 0; icomp < components; ++icomp) {
           if constexpr (StoreDisplacement) {
@@ -1949,8 +1943,8 @@ impl_load_on_device(const MemberType &team, const IteratorType &iterator,
         const int iz = iterator_index.index.iz;
         const int ix = iterator_index.index.ix;
 
-        const int iglob = field.assembly_index_mapping(
-            field.index_mapping(ispec, iz, ix), static_cast<int>(MediumType));
+        const int iglob = field.medium_index_mapping(
+            static_cast<int>(MediumType), ispec, iz, ix);
 
         for (int icomp = 0; icomp < components; ++icomp) {
           if constexpr (StoreDisplacement) {
@@ -2031,9 +2025,8 @@ impl_load_on_device(const MemberType &team, const IteratorType &iterator,
             continue;
           }
 
-          const int iglob = field.assembly_index_mapping(
-              field.index_mapping(ispec + lane, iz, ix),
-              static_cast<int>(MediumType));
+          const int iglob = field.medium_index_mapping(
+              static_cast<int>(MediumType), ispec + lane, iz, ix);
 
           for (int icomp = 0; icomp < components; ++icomp) {
             if constexpr (StoreDisplacement) {
@@ -2109,8 +2102,8 @@ inline void impl_load_on_host(const MemberType &team, const IteratorType &iterat
         const int iz = iterator_index.index.iz;
         const int ix = iterator_index.index.ix;
 
-        const int iglob = field.h_assembly_index_mapping(
-            field.h_index_mapping(ispec, iz, ix), static_cast<int>(MediumType));
+        const int iglob = field.h_medium_index_mapping(
+            static_cast<int>(MediumType), ispec, iz, ix);
 
         for (int icomp = 0; icomp < components; ++icomp) {
           if constexpr (StoreDisplacement) {
@@ -2189,9 +2182,8 @@ inline void impl_load_on_host(const MemberType &team, const IteratorType &iterat
             continue;
           }
 
-          const int iglob = field.h_assembly_index_mapping(
-              field.h_index_mapping(ispec + lane, iz, ix),
-              static_cast<int>(MediumType));
+          const int iglob = field.h_medium_index_mapping(
+              static_cast<int>(MediumType), ispec + lane, iz, ix);
 
           for (int icomp = 0; icomp < components; ++icomp) {
             if constexpr (StoreDisplacement) {
@@ -85,6 +85,19 @@ struct fields {
     backward.copy_to_host();
   }
 
+  /**
+   * @brief Zero out all fields
+   *
+   * Fields are reset in place, i.e. no memory is reallocated. Views that were
+   * copied from this object (e.g. within time schemes) remain valid.
+   */
+  void reset() {
+    buffer.reset();
+    forward.reset();
+    adjoint.reset();
+    backward.reset();
+  }
+
   specfem::compute::simulation_field<
       specfem::wavefield::simulation_field::buffer>
       buffer; ///< Buffer field. Generally used for temporary storage for
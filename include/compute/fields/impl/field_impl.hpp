@@ -9,6 +9,23 @@
 namespace specfem {
 namespace compute {
 namespace impl {
+
+/**
+ * @brief View type used to store a wavefield quantity (nglob, components)
+ *
+ * By default every quantity is stored in a separate LayoutLeft array. When
+ * compiled with ENABLE_INTERLEAVED_FIELDS the displacement, velocity,
+ * acceleration and inverse mass of a global point are packed into a single
+ * record, and the quantities are strided views into the records.
+ */
+#ifdef ENABLE_INTERLEAVED_FIELDS
+using FieldViewType = Kokkos::View<type_real **, Kokkos::LayoutStride,
+                                   specfem::kokkos::DevMemSpace>;
+#else
+using FieldViewType =
+    specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>;
+#endif
+
 template <specfem::dimension::type DimensionType,
           specfem::element::medium_tag MediumTag>
 class field_impl {
@@ -16,6 +33,8 @@ public:
   constexpr static int components =
       specfem::element::attributes<DimensionType, MediumTag>::components();
 
+  using ViewType = FieldViewType; ///< View type of a wavefield quantity
+
   field_impl() = default;
 
   field_impl(
@@ -28,15 +47,33 @@ public:
 
   template <specfem::sync::kind sync> void sync_fields() const;
 
+  void reset() const;
+
   int nglob;
-  specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft> field;
-  specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft> h_field;
-  specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft> field_dot;
-  specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft> h_field_dot;
-  specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft> field_dot_dot;
-  specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft> h_field_dot_dot;
-  specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft> mass_inverse;
-  specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft> h_mass_inverse;
+#ifdef ENABLE_INTERLEAVED_FIELDS
+  /// Record of every global point, indexed as (iglob, quantity, component)
+  /// with quantities ordered as field, field_dot, field_dot_dot and
+  /// mass_inverse
+  using RecordViewType = Kokkos::View<type_real ***, Kokkos::LayoutRight,
+                                      specfem::kokkos::DevMemSpace>;
+  RecordViewType records;
+  RecordViewType::HostMirror h_records;
+  /// Device copy of the host records, used to update the wavefield without
+  /// overwriting the inverse mass. Aliases h_records when the device memory
+  /// space is accessible from the host
+  RecordViewType staging_records;
+#endif
+  ViewType field;
+  ViewType::HostMirror h_field;
+  ViewType field_dot;
+  ViewType::HostMirror h_field_dot;
+  ViewType field_dot_dot;
+  ViewType::HostMirror h_field_dot_dot;
+  ViewType mass_inverse;
+  ViewType::HostMirror h_mass_inverse;
+
+private:
+  void allocate();
 };
 } // namespace impl
 
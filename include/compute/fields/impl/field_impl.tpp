@@ -6,19 +6,46 @@
 #include "kokkos_abstractions.h"
 #include <Kokkos_Core.hpp>
 
+template <specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag>
+void specfem::compute::impl::field_impl<DimensionType, MediumTag>::allocate() {
+#ifdef ENABLE_INTERLEAVED_FIELDS
+  records = RecordViewType("specfem::compute::fields::records", nglob, 4,
+                           components);
+  h_records = Kokkos::create_mirror_view(records);
+  staging_records =
+      Kokkos::create_mirror_view(specfem::kokkos::DevMemSpace(), h_records);
+
+  field = Kokkos::subview(records, Kokkos::ALL, 0, Kokkos::ALL);
+  h_field = Kokkos::subview(h_records, Kokkos::ALL, 0, Kokkos::ALL);
+  field_dot = Kokkos::subview(records, Kokkos::ALL, 1, Kokkos::ALL);
+  h_field_dot = Kokkos::subview(h_records, Kokkos::ALL, 1, Kokkos::ALL);
+  field_dot_dot = Kokkos::subview(records, Kokkos::ALL, 2, Kokkos::ALL);
+  h_field_dot_dot = Kokkos::subview(h_records, Kokkos::ALL, 2, Kokkos::ALL);
+  mass_inverse = Kokkos::subview(records, Kokkos::ALL, 3, Kokkos::ALL);
+  h_mass_inverse = Kokkos::subview(h_records, Kokkos::ALL, 3, Kokkos::ALL);
+#else
+  field = ViewType("specfem::compute::fields::field", nglob, components);
+  h_field = Kokkos::create_mirror_view(field);
+  field_dot =
+      ViewType("specfem::compute::fields::field_dot", nglob, components);
+  h_field_dot = Kokkos::create_mirror_view(field_dot);
+  field_dot_dot =
+      ViewType("specfem::compute::fields::field_dot_dot", nglob, components);
+  h_field_dot_dot = Kokkos::create_mirror_view(field_dot_dot);
+  mass_inverse =
+      ViewType("specfem::compute::fields::mass_inverse", nglob, components);
+  h_mass_inverse = Kokkos::create_mirror_view(mass_inverse);
+#endif
+}
+
 template <specfem::dimension::type DimensionType,
           specfem::element::medium_tag MediumTag>
 specfem::compute::impl::field_impl<DimensionType, MediumTag>::field_impl(
     const int nglob)
-    : nglob(nglob), field("specfem::compute::fields::field", nglob, components),
-      h_field(Kokkos::create_mirror_view(field)),
-      field_dot("specfem::compute::fields::field_dot", nglob, components),
-      h_field_dot(Kokkos::create_mirror_view(field_dot)),
-      field_dot_dot("specfem::compute::fields::field_dot_dot", nglob,
-                    components),
-      h_field_dot_dot(Kokkos::create_mirror_view(field_dot_dot)),
-      mass_inverse("specfem::compute::fields::mass_inverse", nglob, components),
-      h_mass_inverse(Kokkos::create_mirror_view(mass_inverse)) {}
+    : nglob(nglob) {
+  this->allocate();
+}
 
 template <specfem::dimension::type DimensionType,
           specfem::element::medium_tag MediumTag>
@@ -56,23 +83,7 @@ specfem::compute::impl::field_impl<DimensionType, MediumTag>::field_impl(
 
   nglob = count;
 
-  field = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>(
-      "specfem::compute::fields::field", nglob, components);
-  h_field = specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft>(
-      Kokkos::create_mirror_view(field));
-  field_dot = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>(
-      "specfem::compute::fields::field_dot", nglob, components);
-  h_field_dot = specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft>(
-      Kokkos::create_mirror_view(field_dot));
-  field_dot_dot = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>(
-      "specfem::compute::fields::field_dot_dot", nglob, components);
-  h_field_dot_dot =
-      specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft>(
-          Kokkos::create_mirror_view(field_dot_dot));
-  mass_inverse = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>(
-      "specfem::compute::fields::mass_inverse", nglob, components);
-  h_mass_inverse = specfem::kokkos::HostMirror2d<type_real, Kokkos::LayoutLeft>(
-      Kokkos::create_mirror_view(mass_inverse));
+  this->allocate();
 
   Kokkos::parallel_for("specfem::compute::fields::field_impl::initialize_field",
                        specfem::kokkos::HostRange(0, nglob),
@@ -87,10 +98,14 @@ specfem::compute::impl::field_impl<DimensionType, MediumTag>::field_impl(
 
   Kokkos::fence();
 
+#ifdef ENABLE_INTERLEAVED_FIELDS
+  Kokkos::deep_copy(records, h_records);
+#else
   Kokkos::deep_copy(field, h_field);
   Kokkos::deep_copy(field_dot, h_field_dot);
   Kokkos::deep_copy(field_dot_dot, h_field_dot_dot);
   Kokkos::deep_copy(mass_inverse, h_mass_inverse);
+#endif
 
   return;
 }
@@ -100,6 +115,25 @@ template <specfem::dimension::type DimensionType,
 template <specfem::sync::kind sync>
 void specfem::compute::impl::field_impl<DimensionType, MediumTag>::sync_fields()
     const {
+#ifdef ENABLE_INTERLEAVED_FIELDS
+  // Strided views cannot be copied between memory spaces. Copy the records
+  // instead
+  if constexpr (sync == specfem::sync::kind::DeviceToHost) {
+    Kokkos::deep_copy(h_records, records);
+  } else if constexpr (sync == specfem::sync::kind::HostToDevice) {
+    // The inverse mass is computed on the device and is not kept up to date
+    // on the host. Stage the records on the device and only update the
+    // wavefield
+    Kokkos::deep_copy(staging_records, h_records);
+    Kokkos::deep_copy(field, Kokkos::subview(staging_records, Kokkos::ALL, 0,
+                                             Kokkos::ALL));
+    Kokkos::deep_copy(field_dot, Kokkos::subview(staging_records, Kokkos::ALL,
+                                                 1, Kokkos::ALL));
+    Kokkos::deep_copy(field_dot_dot, Kokkos::subview(staging_records,
+                                                     Kokkos::ALL, 2,
+                                                     Kokkos::ALL));
+  }
+#else
   if constexpr (sync == specfem::sync::kind::DeviceToHost) {
     Kokkos::deep_copy(h_field, field);
     Kokkos::deep_copy(h_field_dot, field_dot);
@@ -109,6 +143,22 @@ void specfem::compute::impl::field_impl<DimensionType, MediumTag>::sync_fields()
     Kokkos::deep_copy(field_dot, h_field_dot);
     Kokkos::deep_copy(field_dot_dot, h_field_dot_dot);
   }
+#endif
+}
+
+template <specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag>
+void specfem::compute::impl::field_impl<DimensionType, MediumTag>::reset()
+    const {
+  Kokkos::deep_copy(field, 0.0);
+  Kokkos::deep_copy(h_field, 0.0);
+  Kokkos::deep_copy(field_dot, 0.0);
+  Kokkos::deep_copy(h_field_dot, 0.0);
+  Kokkos::deep_copy(field_dot_dot, 0.0);
+  Kokkos::deep_copy(h_field_dot_dot, 0.0);
+  // Mass matrix is accumulated atomically when the kernels are initialized
+  Kokkos::deep_copy(mass_inverse, 0.0);
+  Kokkos::deep_copy(h_mass_inverse, 0.0);
 }
 
 #endif /* _COMPUTE_FIELDS_IMPL_FIELD_IMPL_TPP_ */
@@ -24,10 +24,17 @@ template <specfem::wavefield::simulation_field WavefieldType>
 struct simulation_field {
 private:
   using ViewType =
-      Kokkos::View<int ***, Kokkos::LayoutLeft,
+      Kokkos::View<int ***, specfem::kokkos::ElementLayout,
                    Kokkos::DefaultExecutionSpace>; ///< Underlying view type to
                                                    ///< store field values
 
+  using MediumIndexViewType =
+      Kokkos::View<int ****, Kokkos::LayoutStride,
+                   specfem::kokkos::DevMemSpace>; ///< Underlying view type to
+                                                  ///< store the medium local
+                                                  ///< index of every
+                                                  ///< quadrature point
+
 public:
   /**
    * @name Constructors
@@ -62,6 +69,16 @@ public:
    */
   void copy_to_device() { sync_fields<specfem::sync::kind::HostToDevice>(); }
 
+  /**
+   * @brief Zero out the wavefield and the inverse of the mass matrix on both
+   * the host and the device
+   *
+   */
+  void reset() {
+    elastic.reset();
+    acoustic.reset();
+  }
+
   /**
    * @brief Copy fields from another simulation field
    *
@@ -73,6 +90,8 @@ public:
     this->nglob = rhs.nglob;
     this->assembly_index_mapping = rhs.assembly_index_mapping;
     this->h_assembly_index_mapping = rhs.h_assembly_index_mapping;
+    this->medium_index_mapping = rhs.medium_index_mapping;
+    this->h_medium_index_mapping = rhs.h_medium_index_mapping;
     this->elastic = rhs.elastic;
     this->acoustic = rhs.acoustic;
   }
@@ -106,6 +125,14 @@ public:
   Kokkos::View<int * [specfem::element::ntypes], Kokkos::LayoutLeft,
                specfem::kokkos::HostMemSpace>
       h_assembly_index_mapping;
+  /// Medium local global index of every quadrature point, indexed as
+  /// (medium, ispec, iz, ix). The medium is the slowest index; the map of
+  /// each medium is stored with the same layout as the per-point element
+  /// data (@ref specfem::kokkos::ElementLayout). Set to -1 for points outside
+  /// the medium.
+  MediumIndexViewType medium_index_mapping;
+  /// Host mirror of @ref medium_index_mapping
+  MediumIndexViewType::HostMirror h_medium_index_mapping;
   specfem::compute::impl::field_impl<specfem::dimension::type::dim2,
                                      specfem::element::medium_tag::elastic>
       elastic; ///< Elastic field
@@ -127,6 +154,8 @@ void deep_copy(simulation_field<WavefieldType1> &dst,
   dst.nglob = src.nglob;
   Kokkos::deep_copy(dst.assembly_index_mapping, src.assembly_index_mapping);
   Kokkos::deep_copy(dst.h_assembly_index_mapping, src.h_assembly_index_mapping);
+  Kokkos::deep_copy(dst.medium_index_mapping, src.medium_index_mapping);
+  Kokkos::deep_copy(dst.h_medium_index_mapping, src.h_medium_index_mapping);
   specfem::compute::deep_copy(dst.elastic, src.elastic);
   specfem::compute::deep_copy(dst.acoustic, src.acoustic);
 }
@@ -7,6 +7,7 @@
 #include "kokkos_abstractions.h"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
+#include <type_traits>
 
 namespace {
 template <typename ViewType> int compute_nglob(const ViewType index_mapping) {
@@ -26,6 +27,21 @@ template <typename ViewType> int compute_nglob(const ViewType index_mapping) {
 
   return nglob + 1;
 }
+
+// Strides of the (medium, ispec, iz, ix) index map. The medium is the slowest
+// index and the (ispec, iz, ix) block of every medium follows ElementLayout
+Kokkos::LayoutStride medium_index_layout(const int nspec, const int ngllz,
+                                         const int ngllx) {
+  const int npoints = nspec * ngllz * ngllx;
+  if constexpr (std::is_same_v<specfem::kokkos::ElementLayout,
+                               Kokkos::LayoutRight>) {
+    return Kokkos::LayoutStride(specfem::element::ntypes, npoints, nspec,
+                                ngllz * ngllx, ngllz, ngllx, ngllx, 1);
+  } else {
+    return Kokkos::LayoutStride(specfem::element::ntypes, npoints, nspec, 1,
+                                ngllz, nspec, ngllx, nspec * ngllz);
+  }
+}
 } // namespace
 
 template <specfem::wavefield::simulation_field WavefieldType>
@@ -76,5 +92,27 @@ specfem::compute::simulation_field<WavefieldType>::simulation_field(
 
   Kokkos::deep_copy(assembly_index_mapping, h_assembly_index_mapping);
 
+  // Resolve both levels of indirection once, such that field accesses need a
+  // single lookup per quadrature point. The map of every medium is a
+  // contiguous block, laid out like the per-point element data.
+  medium_index_mapping = MediumIndexViewType(
+      "specfem::compute::simulation_field::medium_index_mapping",
+      medium_index_layout(nspec, ngllz, ngllx));
+
+  h_medium_index_mapping = Kokkos::create_mirror_view(medium_index_mapping);
+
+  for (int itype = 0; itype < specfem::element::ntypes; itype++) {
+    for (int ispec = 0; ispec < nspec; ispec++) {
+      for (int iz = 0; iz < ngllz; iz++) {
+        for (int ix = 0; ix < ngllx; ix++) {
+          h_medium_index_mapping(itype, ispec, iz, ix) =
+              h_assembly_index_mapping(h_index_mapping(ispec, iz, ix), itype);
+        }
+      }
+    }
+  }
+
+  Kokkos::deep_copy(medium_index_mapping, h_medium_index_mapping);
+
   return;
 }
@@ -5,6 +5,7 @@
 #include "assembly/assembly.hpp"
 #include "boundaries/boundaries.hpp"
 #include "boundary_values/boundary_values.hpp"
+#include "cfl/cfl.hpp"
 #include "compute_mesh.hpp"
 #include "compute_partial_derivatives.hpp"
 #include "coupled_interfaces/coupled_interfaces.hpp"
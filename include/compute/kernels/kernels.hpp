@@ -55,6 +55,17 @@ public:
   void copy_to_device() {
     impl::value_containers<specfem::medium::material_kernels>::copy_to_device();
   }
+
+  /**
+   * @brief Zero out the misfit kernels on the device in place
+   *
+   */
+  void reset() {
+    elastic_isotropic.initialize();
+    elastic_anisotropic.initialize();
+    acoustic_isotropic.initialize();
+    Kokkos::fence();
+  }
 };
 
 /**
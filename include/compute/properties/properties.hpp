@@ -66,6 +66,19 @@ struct properties
     impl::value_containers<
         specfem::medium::material_properties>::copy_to_device();
   }
+
+  /**
+   * @brief Store the properties at every quadrature point on the device
+   *
+   * Properties assigned from mesh::materials are stored once per element on
+   * the device. Call this function when a GLL model replaces them. The
+   * storage changes at the next call to copy_to_device.
+   */
+  void set_gll_model() {
+    elastic_isotropic.per_element = false;
+    elastic_anisotropic.per_element = false;
+    acoustic_isotropic.per_element = false;
+  }
 };
 
 /**
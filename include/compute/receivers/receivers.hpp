@@ -243,6 +243,26 @@ public:
     Kokkos::deep_copy(h_seismogram_components, seismogram_components);
   }
 
+  /**
+   * @brief Get the seismogram components stored on the device
+   *
+   * @return SeismogramType View of dimensions (max_sig_step, nseismograms,
+   * nreceivers, 2)
+   */
+  SeismogramType get_seismogram_components() const {
+    return seismogram_components;
+  }
+
+  /**
+   * @brief Zero out the seismograms on the host and the device
+   *
+   */
+  void reset_seismograms() {
+    Kokkos::deep_copy(seismogram_components, 0.0);
+    Kokkos::deep_copy(h_seismogram_components, 0.0);
+    this->seis_step = 0;
+  }
+
 private:
   int nreceivers;
   int nsiesmograms;
@@ -278,13 +298,33 @@ private:
                                                           ///< elements
                                                           ///< associated with
                                                           ///< the receivers
-  using LagrangeInterpolantType =
-      Kokkos::View<type_real ***[2], Kokkos::LayoutLeft,
-                   Kokkos::DefaultExecutionSpace>; ///< View to store the
-                                                   ///< Lagrange interpolant for
-                                                   ///< every receiver
+  using LagrangeFactorType =
+      Kokkos::View<type_real **[2], Kokkos::LayoutLeft,
+                   Kokkos::DefaultExecutionSpace>; ///< View to store the 1D
+                                                   ///< Lagrange factors along
+                                                   ///< xi and gamma for every
+                                                   ///< receiver
+  using NodeIndexType =
+      Kokkos::View<int *[2], Kokkos::LayoutLeft,
+                   Kokkos::DefaultExecutionSpace>; ///< View to store the GLL
+                                                   ///< node on which every
+                                                   ///< receiver lies along xi
+                                                   ///< and gamma
 
 public:
+  /**
+   * @brief Location of a receiver within its spectral element
+   *
+   * The Lagrange interpolant of a receiver is the tensor product of 1D
+   * interpolants along xi and gamma. Along a direction in which the receiver
+   * lies on a GLL node, the 1D interpolant has a single non-zero value.
+   */
+  enum class location {
+    node,    ///< Receiver lies on a GLL node
+    edge,    ///< Receiver lies on a GLL line along either xi or gamma
+    interior ///< Receiver lies between GLL lines along xi and gamma
+  };
+
   /**
    * @brief Construct a new receivers object
    *
@@ -359,6 +399,20 @@ public:
     return seismogram_types;
   }
 
+  /**
+   * @brief Get the location of a receiver within its spectral element
+   *
+   * @param irec Index of the receiver
+   * @return location Node, edge or interior
+   */
+  location get_location(const int irec) const {
+    const int nnodes =
+        (h_node_index(irec, 0) >= 0) + (h_node_index(irec, 1) >= 0);
+    return (nnodes == 2)   ? location::node
+           : (nnodes == 1) ? location::edge
+                           : location::interior;
+  }
+
 private:
   int nspec;              ///< Total number of spectral elements
   IndexViewType elements; ///< View to store the elements associated with the
@@ -366,11 +420,15 @@ private:
   IndexViewType::HostMirror h_elements; ///< Host view to store the
                                         ///< elements associated with the
                                         ///< receivers
-  LagrangeInterpolantType lagrange_interpolant; ///< Lagrange interpolant for
-                                                ///< every receiver
-  LagrangeInterpolantType::HostMirror
-      h_lagrange_interpolant; ///< Lagrange interpolant for every receiver
-                              ///< stored on the host
+  LagrangeFactorType lagrange_factors; ///< 1D Lagrange factors for every
+                                       ///< receiver
+  LagrangeFactorType::HostMirror
+      h_lagrange_factors;   ///< 1D Lagrange factors for every receiver
+                            ///< stored on the host
+  NodeIndexType node_index; ///< GLL node of every receiver along xi and
+                            ///< gamma, -1 if it lies between nodes
+  NodeIndexType::HostMirror h_node_index; ///< GLL node of every receiver
+                                          ///< stored on the host
   specfem::compute::element_types element_types; ///< Element types
 
 #define RECEIVER_INDICES_VARIABLE_NAME(DIMENSION_TAG, MEDIUM_TAG,              \
@@ -395,10 +453,12 @@ private:
 
 #undef RECEIVER_INDICES_VARIABLE_NAME
 
-  template <typename MemberType, typename IteratorType, typename ViewType>
+  template <typename MemberType, typename IteratorType, typename FactorViewType,
+            typename NodeViewType>
   friend KOKKOS_FUNCTION void
   load_on_device(const MemberType &team_member, const IteratorType &iterator,
-                 const receivers &receivers, ViewType &lagrange_interpolant);
+                 const receivers &receivers, FactorViewType &lagrange_factors,
+                 NodeViewType &node_index);
 
   template <typename MemberType, typename IteratorType,
             typename SiesmogramViewType>
@@ -413,7 +473,7 @@ private:
  */
 
 /**
- * @brief Load the Lagrange interpolant for receivers associated with the
+ * @brief Load the 1D Lagrange factors for receivers associated with the
  * iterator on the device
  *
  * @ingroup ComputeReceiversDataAccess
@@ -421,14 +481,18 @@ private:
  * @tparam MemberType Kokkos team member type
  * @tparam IteratorType Chunk policy iterator type @ref
  * specfem::policy::element_chunk
+ * @tparam FactorViewType View of the Lagrange factors (element, GLL point,
+ * xi/gamma) associated with the receivers in the iterator
+ * @tparam NodeViewType View of the GLL node (element, xi/gamma) on which the
+ * receivers in the iterator lie, -1 if they lie between nodes
  * @param receivers Receivers object containing the receiver information
- * @tparam ViewType Lagrange interpolant associated with the receivers in the
- * iterator
  */
-template <typename MemberType, typename IteratorType, typename ViewType>
+template <typename MemberType, typename IteratorType, typename FactorViewType,
+          typename NodeViewType>
 KOKKOS_FUNCTION void
 load_on_device(const MemberType &team_member, const IteratorType &iterator,
-               const receivers &receivers, ViewType &lagrange_interpolant) {
+               const receivers &receivers, FactorViewType &lagrange_factors,
+               NodeViewType &node_index) {
 
   Kokkos::parallel_for(
       Kokkos::TeamThreadRange(team_member, iterator.chunk_size()),
@@ -448,11 +512,24 @@ load_on_device(const MemberType &team_member, const IteratorType &iterator,
 #endif
 
         const int irec = iterator_index.imap;
+        const int ielement = iterator_index.ielement;
+
+        // Only the points on the first GLL line of every direction are
+        // needed to load the 1D factors
+        if (index.iz == 0) {
+          lagrange_factors(ielement, index.ix, 0) =
+              receivers.lagrange_factors(irec, index.ix, 0);
+        }
 
-        lagrange_interpolant(iterator_index.ielement, index.iz, index.ix, 0) =
-            receivers.lagrange_interpolant(irec, index.iz, index.ix, 0);
-        lagrange_interpolant(iterator_index.ielement, index.iz, index.ix, 1) =
-            receivers.lagrange_interpolant(irec, index.iz, index.ix, 1);
+        if (index.ix == 0) {
+          lagrange_factors(ielement, index.iz, 1) =
+              receivers.lagrange_factors(irec, index.iz, 1);
+        }
+
+        if (index.iz == 0 && index.ix == 0) {
+          node_index(ielement, 0) = receivers.node_index(irec, 0);
+          node_index(ielement, 1) = receivers.node_index(irec, 1);
+        }
       });
 
   return;
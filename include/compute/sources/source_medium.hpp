@@ -97,7 +97,8 @@ public:
 
   template <typename IteratorIndexType, typename PointSourceType>
   KOKKOS_INLINE_FUNCTION void
-  load_on_device(const int timestep, const IteratorIndexType &iterator_index,
+  load_on_device(const int timestep, const type_real time_offset,
+                 const IteratorIndexType &iterator_index,
                  PointSourceType &point_source) const {
     /* For the source it is important to remember that we are using the
      * mapped index to access the element and source indices
@@ -107,9 +108,34 @@ public:
      */
     const auto index = iterator_index.index;
     const auto isource = iterator_index.imap;
+
+    if (time_offset == 0.0) {
+      for (int component = 0; component < components; component++) {
+        point_source.stf(component) =
+            source_time_function(timestep, isource, component);
+        point_source.lagrange_interpolant(component) =
+            source_array(isource, component, index.iz, index.ix);
+      }
+      return;
+    }
+
+    // Cubic Lagrange interpolation through timesteps - 1 to timestep + 2
+    const type_real s = time_offset;
+    const type_real weights[4] = { -s * (s - 1) * (s - 2) / 6,
+                                   (s + 1) * (s - 1) * (s - 2) / 2,
+                                   -(s + 1) * s * (s - 2) / 2,
+                                   (s + 1) * s * (s - 1) / 6 };
+    const int nsteps = source_time_function.extent(0);
+
     for (int component = 0; component < components; component++) {
-      point_source.stf(component) =
-          source_time_function(timestep, isource, component);
+      type_real stf = 0.0;
+      for (int i = 0; i < 4; ++i) {
+        int istep = timestep - 1 + i;
+        istep = (istep < 0) ? 0 : istep;
+        istep = (istep > nsteps - 1) ? nsteps - 1 : istep;
+        stf += weights[i] * source_time_function(istep, isource, component);
+      }
+      point_source.stf(component) = stf;
       point_source.lagrange_interpolant(component) =
           source_array(isource, component, index.iz, index.ix);
     }
@@ -118,6 +118,20 @@ public:
    */
   void update_timestep(const int timestep) { this->timestep = timestep; }
 
+  /**
+   * @brief Update the time offset of the current stage
+   *
+   * Multi-stage time schemes evaluate the sources between time steps. The
+   * source time function is then interpolated with a cubic Lagrange
+   * polynomial through the neighbouring time steps.
+   *
+   * @param time_offset Offset from the current time step as a fraction of the
+   * time step
+   */
+  void update_time_offset(const type_real time_offset) {
+    this->time_offset = time_offset;
+  }
+
 private:
   int nspec;                                 ///< Number of spectral elements
   IndexViewType source_domain_index_mapping; ///< Mapping for every spectral
@@ -164,7 +178,9 @@ private:
 
 #undef SOURCE_MEDIUM_DECLARATION
 
-  int timestep; ///< Current time step
+  int timestep;                ///< Current time step
+  type_real time_offset = 0.0; ///< Offset of the current stage as a fraction
+                               ///< of the time step
 
 #define SOURCE_INDICES_VARIABLES_NAME(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG, \
                                       BOUNDARY_TAG)                            \
@@ -303,7 +319,8 @@ load_on_device(const IteratorIndexType iterator_index,
       sources                                                                  \
           .CREATE_VARIABLE_NAME(source, GET_NAME(DIMENSION_TAG),               \
                                 GET_NAME(MEDIUM_TAG))                          \
-          .load_on_device(sources.timestep, iterator_index, point_source);     \
+          .load_on_device(sources.timestep, sources.time_offset,               \
+                          iterator_index, point_source);                       \
     }                                                                          \
   }
 
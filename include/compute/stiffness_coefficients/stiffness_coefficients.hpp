@@ -0,0 +1,159 @@
+#pragma once
+
+#include "compute/compute_partial_derivatives.hpp"
+#include "compute/element_types/element_types.hpp"
+#include "compute/impl/value_containers.hpp"
+#include "compute/properties/interface.hpp"
+#include "enumerations/medium.hpp"
+#include "medium/stiffness_coefficients_container.hpp"
+#include "point/coordinates.hpp"
+#include "point/stiffness_coefficients.hpp"
+#include <Kokkos_Core.hpp>
+
+namespace specfem {
+namespace compute {
+/**
+ * @brief Fused stiffness coefficients for every quadrature point in the finite
+ * element mesh
+ *
+ * The coefficients combine the partial derivatives of the basis functions and
+ * the material properties into a single symmetric matrix per quadrature point
+ * (see @ref specfem::point::stiffness_coefficients). When enabled, the
+ * stiffness kernel reads one contiguous set of coefficients per quadrature
+ * point instead of the partial derivatives and the material properties.
+ *
+ * The coefficients are computed once at assembly time and need to be
+ * recomputed if the material properties change.
+ */
+struct stiffness_coefficients
+    : public impl::value_containers<
+          specfem::medium::stiffness_coefficients_container> {
+public:
+  bool enabled = false; ///< True if the coefficients have been computed
+
+  /**
+   * @name Constructors
+   *
+   */
+
+  ///@{
+  /**
+   * @brief Default constructor
+   *
+   */
+  stiffness_coefficients() = default;
+
+  /**
+   * @brief Compute the fused stiffness coefficients
+   *
+   * @param nspec Total number of spectral elements
+   * @param ngllz Number of quadrature points in z dimension
+   * @param ngllx Number of quadrature points in x dimension
+   * @param element_types Element types for every spectral element
+   * @param partial_derivatives Partial derivatives of the basis functions
+   * @param properties Material properties
+   * @throws std::runtime_error if the coefficient matrix at any quadrature
+   * point is not symmetric
+   */
+  stiffness_coefficients(
+      const int nspec, const int ngllz, const int ngllx,
+      const specfem::compute::element_types &element_types,
+      const specfem::compute::partial_derivatives &partial_derivatives,
+      const specfem::compute::properties &properties);
+  ///@}
+
+  /**
+   * @brief Copy coefficients to host
+   *
+   */
+  void copy_to_host() {
+    impl::value_containers<
+        specfem::medium::stiffness_coefficients_container>::copy_to_host();
+  }
+
+  /**
+   * @brief Copy coefficients to device
+   *
+   */
+  void copy_to_device() {
+    impl::value_containers<
+        specfem::medium::stiffness_coefficients_container>::copy_to_device();
+  }
+};
+
+/**
+ * @defgroup ComputeStiffnessCoefficientsDataAccess
+ */
+
+/**
+ * @brief Load fused stiffness coefficients for a given quadrature point on the
+ * device
+ *
+ * @ingroup ComputeStiffnessCoefficientsDataAccess
+ *
+ * @tparam PointCoefficientsType Point coefficients type. Needs to be of @ref
+ * specfem::point::stiffness_coefficients
+ * @tparam IndexType Index type. Needs to be of @ref specfem::point::index or
+ * @ref specfem::point::simd_index
+ * @param index Index of the quadrature point
+ * @param coefficients Fused stiffness coefficients container
+ * @param point_coefficients Coefficients at a given quadrature point (output)
+ */
+template <typename PointCoefficientsType, typename IndexType,
+          typename std::enable_if<IndexType::using_simd ==
+                                      PointCoefficientsType::simd::using_simd,
+                                  int>::type = 0>
+KOKKOS_FUNCTION void
+load_on_device(const IndexType &index,
+               const stiffness_coefficients &coefficients,
+               PointCoefficientsType &point_coefficients) {
+  const int ispec = coefficients.property_index_mapping(index.ispec);
+
+  constexpr auto MediumTag = PointCoefficientsType::medium_tag;
+  constexpr auto PropertyTag = PointCoefficientsType::property_tag;
+
+  IndexType l_index = index;
+  l_index.ispec = ispec;
+
+  coefficients.get_container<MediumTag, PropertyTag>()
+      .load_device_coefficients(l_index, point_coefficients);
+
+  return;
+}
+
+/**
+ * @brief Load fused stiffness coefficients for a given quadrature point on the
+ * host
+ *
+ * @ingroup ComputeStiffnessCoefficientsDataAccess
+ *
+ * @tparam PointCoefficientsType Point coefficients type. Needs to be of @ref
+ * specfem::point::stiffness_coefficients
+ * @tparam IndexType Index type. Needs to be of @ref specfem::point::index
+ * @param index Index of the quadrature point
+ * @param coefficients Fused stiffness coefficients container
+ * @param point_coefficients Coefficients at a given quadrature point (output)
+ */
+template <typename PointCoefficientsType, typename IndexType,
+          typename std::enable_if<IndexType::using_simd ==
+                                      PointCoefficientsType::simd::using_simd,
+                                  int>::type = 0>
+void load_on_host(const IndexType &index,
+                  const stiffness_coefficients &coefficients,
+                  PointCoefficientsType &point_coefficients) {
+  const int ispec = coefficients.h_property_index_mapping(index.ispec);
+
+  constexpr auto MediumTag = PointCoefficientsType::medium_tag;
+  constexpr auto PropertyTag = PointCoefficientsType::property_tag;
+
+  IndexType l_index = index;
+  l_index.ispec = ispec;
+
+  coefficients.get_container<MediumTag, PropertyTag>().load_host_coefficients(
+      l_index, point_coefficients);
+
+  return;
+}
+
+} // namespace compute
+} // namespace specfem
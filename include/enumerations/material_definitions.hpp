@@ -121,6 +121,10 @@ constexpr auto material_systems() {
 /**
  * @brief Macro to generate a list of element types
  *
+ * Element types with absorbing boundaries are listed directly after the
+ * corresponding element type without absorbing boundaries. This keeps them
+ * contiguous in the compute ordering of spectral elements (see @ref
+ * specfem::compute::element_types::get_volume_elements_on_device).
  */
 #define ELEMENT_TYPES                                                          \
   ((DIMENSION_TAG_DIM2, MEDIUM_TAG_ELASTIC, PROPERTY_TAG_ISOTROPIC,            \
@@ -128,12 +132,11 @@ constexpr auto material_systems() {
                          PROPERTY_TAG_ISOTROPIC, BOUNDARY_TAG_STACEY))(        \
       (DIMENSION_TAG_DIM2, MEDIUM_TAG_ACOUSTIC, PROPERTY_TAG_ISOTROPIC,        \
        BOUNDARY_TAG_NONE))((DIMENSION_TAG_DIM2, MEDIUM_TAG_ACOUSTIC,           \
-                            PROPERTY_TAG_ISOTROPIC,                            \
-                            BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))(              \
+                            PROPERTY_TAG_ISOTROPIC, BOUNDARY_TAG_STACEY))(     \
       (DIMENSION_TAG_DIM2, MEDIUM_TAG_ACOUSTIC, PROPERTY_TAG_ISOTROPIC,        \
-       BOUNDARY_TAG_STACEY))((DIMENSION_TAG_DIM2, MEDIUM_TAG_ACOUSTIC,         \
-                              PROPERTY_TAG_ISOTROPIC,                          \
-                              BOUNDARY_TAG_COMPOSITE_STACEY_DIRICHLET))(       \
+       BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))(                                   \
+      (DIMENSION_TAG_DIM2, MEDIUM_TAG_ACOUSTIC, PROPERTY_TAG_ISOTROPIC,        \
+       BOUNDARY_TAG_COMPOSITE_STACEY_DIRICHLET))(                              \
       (DIMENSION_TAG_DIM2, MEDIUM_TAG_ELASTIC, PROPERTY_TAG_ANISOTROPIC,       \
        BOUNDARY_TAG_NONE))((DIMENSION_TAG_DIM2, MEDIUM_TAG_ELASTIC,            \
                             PROPERTY_TAG_ANISOTROPIC, BOUNDARY_TAG_STACEY))
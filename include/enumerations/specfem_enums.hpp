@@ -26,8 +26,9 @@ enum class type { displacement, velocity, acceleration, pressure };
 /**
  * @brief Output format of seismogram enumeration
  *
+ * binary refers to the trace container @ref specfem::IO::trace_container
  */
-enum format { seismic_unix, ascii };
+enum format { seismic_unix, ascii, binary, sac };
 
 } // namespace seismogram
 
@@ -79,7 +80,10 @@ namespace time_scheme {
  *
  */
 enum class type {
-  newmark, ///< Newmark time scheme
+  newmark,     ///< Newmark time scheme
+  lts_newmark, ///< Newmark time scheme with local time stepping
+  lddrk,       ///< Low-storage LDDRK4-6 Runge-Kutta time scheme
+  pefrl,       ///< Fourth order symplectic PEFRL time scheme
 };
 
 } // namespace time_scheme
@@ -2,6 +2,7 @@
 #define KOKKOS_ABSTRACTION_H
 
 #include "../include/specfem_setup.hpp"
+#include "parallel_configuration/layout_config.hpp"
 #include <Kokkos_Core.hpp>
 #include <Kokkos_SIMD.hpp>
 #include <Kokkos_ScatterView.hpp>
@@ -44,6 +45,11 @@ using DevMemSpace = Kokkos::DefaultExecutionSpace::memory_space;
 ///@{
 using LayoutWrapper = Kokkos::LayoutRight;
 using LayoutStride = Kokkos::LayoutStride;
+/// Layout of arrays stored at every quadrature point, (nspec, ngllz, ngllx,
+/// ...). Chosen based on the default execution space, see @ref
+/// specfem::parallel_config::default_layout_config
+using ElementLayout = specfem::parallel_config::default_layout_config<
+    Kokkos::DefaultExecutionSpace>::array_layout;
 ///@}
 
 /** @name Scratch Memory Spaces
@@ -9,6 +9,7 @@
 #include "impl/compute_mass_matrix.hpp"
 #include "impl/compute_seismogram.hpp"
 #include "impl/compute_source_interaction.hpp"
+#include "impl/compute_stacey_interaction.hpp"
 #include "impl/compute_stiffness_interaction.hpp"
 #include "impl/divide_mass_matrix.hpp"
 #include "impl/interface_kernels.hpp"
@@ -28,8 +29,24 @@ public:
       : assembly(assembly), coupling_interfaces_elastic(assembly),
         coupling_interfaces_acoustic(assembly) {}
 
+  /**
+   * @brief Compute the acceleration of the wavefield within a medium
+   *
+   * @tparam medium Medium tag
+   * @param istep Current time step
+   * @param time_offset Offset of the stage within the time step, as a fraction
+   * of the time step. Used by multi-stage time schemes to evaluate the sources
+   * between time steps
+   * @param include_stiffness If false, the stiffness interaction is assumed to
+   * have been added to the acceleration beforehand (see @ref
+   * specfem::kokkos_kernels::frechet_kernels::compute_combined_interaction)
+   */
   template <specfem::element::medium_tag medium>
-  inline void update_wavefields(const int istep) {
+  inline void update_wavefields(const int istep,
+                                const type_real time_offset = 0.0,
+                                const bool include_stiffness = true) {
+
+    assembly.sources.update_time_offset(time_offset);
 
 #define CALL_COUPLING_INTERFACES_FUNCTION(DIMENSION_TAG, MEDIUM_TAG)           \
   if constexpr (dimension == GET_TAG(DIMENSION_TAG) &&                         \
@@ -72,15 +89,36 @@ public:
         GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(assembly, istep);        \
   }
 
+    if (include_stiffness) {
+      CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+          CALL_STIFFNESS_FORCE_UPDATE,
+          WHERE(DIMENSION_TAG_DIM2)
+              WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+                  WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+                      WHERE(BOUNDARY_TAG_NONE,
+                            BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+    }
+
+#undef CALL_STIFFNESS_FORCE_UPDATE
+
+#define CALL_STACEY_FORCE_UPDATE(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG,      \
+                                 BOUNDARY_TAG)                                 \
+  if constexpr (dimension == GET_TAG(DIMENSION_TAG) &&                         \
+                medium == GET_TAG(MEDIUM_TAG)) {                               \
+    impl::compute_stacey_interaction<dimension, wavefield,                     \
+                                     GET_TAG(MEDIUM_TAG),                      \
+                                     GET_TAG(PROPERTY_TAG),                    \
+                                     GET_TAG(BOUNDARY_TAG)>(assembly, istep);  \
+  }
+
     CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
-        CALL_STIFFNESS_FORCE_UPDATE,
+        CALL_STACEY_FORCE_UPDATE,
         WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
             WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
-                WHERE(BOUNDARY_TAG_STACEY, BOUNDARY_TAG_NONE,
-                      BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE,
+                WHERE(BOUNDARY_TAG_STACEY,
                       BOUNDARY_TAG_COMPOSITE_STACEY_DIRICHLET))
 
-#undef CALL_STIFFNESS_FORCE_UPDATE
+#undef CALL_STACEY_FORCE_UPDATE
 
 #define CALL_DIVIDE_MASS_MATRIX_FUNCTION(DIMENSION_TAG, MEDIUM_TAG)            \
   if constexpr (dimension == GET_TAG(DIMENSION_TAG) &&                         \
@@ -98,6 +136,12 @@ public:
 
   void initialize(const type_real &dt) {
 
+    // The mass matrix is accumulated atomically. Clear the inverse left by a
+    // previous run or restored from a checkpoint
+    const auto field = assembly.fields.get_simulation_field<wavefield>();
+    Kokkos::deep_copy(field.elastic.mass_inverse, 0.0);
+    Kokkos::deep_copy(field.acoustic.mass_inverse, 0.0);
+
 #define CALL_COMPUTE_MASS_MATRIX_FUNCTION(DIMENSION_TAG, MEDIUM_TAG,           \
                                           PROPERTY_TAG, BOUNDARY_TAG)          \
   if constexpr (dimension == GET_TAG(DIMENSION_TAG)) {                         \
@@ -5,6 +5,7 @@
 #include "enumerations/dimension.hpp"
 #include "enumerations/material_definitions.hpp"
 #include "enumerations/medium.hpp"
+#include "impl/compute_combined_interaction.hpp"
 #include "impl/compute_material_derivatives.hpp"
 
 namespace specfem {
@@ -33,7 +34,8 @@ public:
   /**
    * @brief Compute the frechet derivatives at the current time step.
    *
-   * @param dt Time interval.
+   * @param dt Time interval covered by the update. When the kernels are
+   * updated every k time steps this is k times the time step.
    */
   inline void compute_derivatives(const type_real &dt) {
 #define CALL_COMPUTE_MATERIAL_DERIVATIVES(DIMENSION_TAG, MEDIUM_TAG,           \
@@ -52,6 +54,58 @@ public:
 #undef CALL_COMPUTE_MATERIAL_DERIVATIVES
   }
 
+  /**
+   * @brief Compute the stiffness interaction of the adjoint and backward
+   * wavefields and the strain terms of the frechet derivatives in a single
+   * pass over the elements.
+   *
+   * Must be called after the predictor phase of both wavefields, in place of
+   * the stiffness interaction within the domain kernels. The frechet
+   * derivatives are completed by @ref compute_inertial_derivatives.
+   *
+   * @param dt Time interval.
+   */
+  inline void compute_combined_interaction(const type_real &dt) {
+#define CALL_COMPUTE_COMBINED_INTERACTION(DIMENSION_TAG, MEDIUM_TAG,           \
+                                          PROPERTY_TAG, BOUNDARY_TAG)          \
+  if constexpr (dimension == GET_TAG(DIMENSION_TAG)) {                         \
+    impl::compute_combined_stiffness_interaction<                              \
+        DimensionType, NGLL, GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG),       \
+        GET_TAG(BOUNDARY_TAG)>(this->assembly, dt);                            \
+  }
+
+    CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+        CALL_COMPUTE_COMBINED_INTERACTION,
+        WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+            WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+                WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef CALL_COMPUTE_COMBINED_INTERACTION
+  }
+
+  /**
+   * @brief Add the terms of the frechet derivatives that depend on the adjoint
+   * acceleration at the current time step.
+   *
+   * @param dt Time interval.
+   */
+  inline void compute_inertial_derivatives(const type_real &dt) {
+#define CALL_COMPUTE_INERTIAL_DERIVATIVES(DIMENSION_TAG, MEDIUM_TAG,           \
+                                          PROPERTY_TAG)                        \
+  if constexpr (dimension == GET_TAG(DIMENSION_TAG)) {                         \
+    impl::compute_inertial_derivatives<                                        \
+        DimensionType, NGLL, GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG)>(      \
+        this->assembly, dt);                                                   \
+  }
+
+    CALL_MACRO_FOR_ALL_MATERIAL_SYSTEMS(
+        CALL_COMPUTE_INERTIAL_DERIVATIVES,
+        WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+            WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
+
+#undef CALL_COMPUTE_INERTIAL_DERIVATIVES
+  }
+
 private:
   specfem::compute::assembly assembly; ///< Assembly object.
 };
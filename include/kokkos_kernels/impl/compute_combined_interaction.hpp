@@ -0,0 +1,52 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/dimension.hpp"
+#include "enumerations/medium.hpp"
+
+namespace specfem {
+namespace kokkos_kernels {
+namespace impl {
+
+/**
+ * @brief Compute the stiffness interaction of the adjoint and backward
+ * wavefields together with the gradient terms of the Frechet derivatives
+ *
+ * Every element is gathered once. The gradients of the adjoint and backward
+ * displacements are used to compute the stiffness contribution to both
+ * accelerations and the terms of the Frechet derivatives that depend on the
+ * strain. The displacements must be final for the current time step, i.e. the
+ * predictor phase of both wavefields must have been applied.
+ *
+ * @tparam BoundaryTag Volume boundary tag of the elements (none or
+ * acoustic_free_surface)
+ * @param assembly SPECFEM++ assembly object
+ * @param dt Time interval
+ */
+template <specfem::dimension::type DimensionType, int NGLL,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag>
+void compute_combined_stiffness_interaction(
+    const specfem::compute::assembly &assembly, const type_real &dt);
+
+/**
+ * @brief Compute the terms of the Frechet derivatives that depend on the
+ * adjoint acceleration
+ *
+ * Completes the Frechet derivatives computed by @ref
+ * compute_combined_stiffness_interaction once the adjoint acceleration of the
+ * current time step is known. Only point-wise quantities are loaded.
+ *
+ * @param assembly SPECFEM++ assembly object
+ * @param dt Time interval
+ */
+template <specfem::dimension::type DimensionType, int NGLL,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+void compute_inertial_derivatives(const specfem::compute::assembly &assembly,
+                                  const type_real &dt);
+
+} // namespace impl
+} // namespace kokkos_kernels
+} // namespace specfem
@@ -0,0 +1,338 @@
+#pragma once
+
+#include "algorithms/divergence.hpp"
+#include "algorithms/gradient.hpp"
+#include "boundary_conditions/boundary_conditions.hpp"
+#include "chunk_element/field.hpp"
+#include "chunk_element/stress_integrand.hpp"
+#include "compute/assembly/assembly.hpp"
+#include "compute_combined_interaction.hpp"
+#include "datatypes/simd.hpp"
+#include "element/quadrature.hpp"
+#include "enumerations/dimension.hpp"
+#include "enumerations/medium.hpp"
+#include "enumerations/wavefield.hpp"
+#include "medium/compute_frechet_derivatives.hpp"
+#include "medium/compute_stress.hpp"
+#include "parallel_configuration/chunk_config.hpp"
+#include "point/boundary.hpp"
+#include "point/field.hpp"
+#include "point/field_derivatives.hpp"
+#include "point/partial_derivatives.hpp"
+#include "point/properties.hpp"
+#include "policies/chunk.hpp"
+#include <Kokkos_Core.hpp>
+
+template <specfem::dimension::type DimensionType, int NGLL,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag>
+void specfem::kokkos_kernels::impl::compute_combined_stiffness_interaction(
+    const specfem::compute::assembly &assembly, const type_real &dt) {
+
+  constexpr auto medium_tag = MediumTag;
+  constexpr auto property_tag = PropertyTag;
+  constexpr auto boundary_tag = BoundaryTag;
+  constexpr int ngll = NGLL;
+  constexpr auto dimension = DimensionType;
+
+  static_assert(
+      (boundary_tag == specfem::element::boundary_tag::none ||
+       boundary_tag == specfem::element::boundary_tag::acoustic_free_surface),
+      "Boundary tag must be none or acoustic_free_surface");
+
+  const auto elements = assembly.element_types.get_volume_elements_on_device(
+      medium_tag, property_tag, boundary_tag);
+
+  const int nelements = elements.extent(0);
+
+  if (nelements == 0)
+    return;
+
+  const auto &quadrature = assembly.mesh.quadratures;
+  const auto &partial_derivatives = assembly.partial_derivatives;
+  const auto &properties = assembly.properties;
+  const auto &kernels = assembly.kernels;
+  const auto &boundaries = assembly.boundaries;
+  const auto adjoint_field = assembly.fields.adjoint;
+  const auto backward_field = assembly.fields.backward;
+
+  constexpr bool using_simd = true;
+  using simd = specfem::datatype::simd<type_real, using_simd>;
+  using parallel_config = specfem::parallel_config::default_chunk_config<
+      dimension, simd, Kokkos::DefaultExecutionSpace>;
+
+  constexpr int components =
+      specfem::element::attributes<dimension, medium_tag>::components();
+  constexpr int num_dimensions =
+      specfem::element::attributes<dimension, medium_tag>::dimension();
+
+  using ChunkPolicyType = specfem::policy::element_chunk<parallel_config>;
+  using ChunkElementFieldType = specfem::chunk_element::field<
+      parallel_config::chunk_size, ngll, dimension, medium_tag,
+      specfem::kokkos::DevScratchSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>,
+      true, false, false, false, using_simd>;
+  using ChunkStressIntegrandType = specfem::chunk_element::stress_integrand<
+      parallel_config::chunk_size, ngll, dimension, medium_tag,
+      specfem::kokkos::DevScratchSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>,
+      using_simd>;
+  using ElementQuadratureType = specfem::element::quadrature<
+      ngll, dimension, specfem::kokkos::DevScratchSpace,
+      Kokkos::MemoryTraits<Kokkos::Unmanaged>, true, true>;
+
+  using PointBoundaryType =
+      specfem::point::boundary<boundary_tag, dimension, using_simd>;
+  using PointVelocityType =
+      specfem::point::field<dimension, medium_tag, false, true, false, false,
+                            using_simd>;
+  using PointAccelerationType =
+      specfem::point::field<dimension, medium_tag, false, false, true, false,
+                            using_simd>;
+  using PointDisplacementType =
+      specfem::point::field<dimension, medium_tag, true, false, false, false,
+                            using_simd>;
+  using PointPartialDerivativesType =
+      specfem::point::partial_derivatives<dimension, true, using_simd>;
+  using PointPropertyType =
+      specfem::point::properties<dimension, medium_tag, property_tag,
+                                 using_simd>;
+  using PointFieldDerivativesType =
+      specfem::point::field_derivatives<dimension, medium_tag, using_simd>;
+
+  const auto wgll = assembly.mesh.quadratures.gll.weights;
+
+  int scratch_size = 2 * ChunkElementFieldType::shmem_size() +
+                     2 * ChunkStressIntegrandType::shmem_size() +
+                     ElementQuadratureType::shmem_size();
+
+  ChunkPolicyType chunk_policy(elements, ngll, ngll);
+
+  constexpr int simd_size = simd::size();
+
+  Kokkos::parallel_for(
+      "specfem::kokkos_kernels::impl::compute_combined_stiffness_interaction",
+      chunk_policy.set_scratch_size(0, Kokkos::PerTeam(scratch_size)),
+      KOKKOS_LAMBDA(const typename ChunkPolicyType::member_type &team) {
+        ChunkElementFieldType adjoint_element_field(team);
+        ChunkElementFieldType backward_element_field(team);
+        ElementQuadratureType element_quadrature(team);
+        ChunkStressIntegrandType adjoint_stress_integrand(team);
+        ChunkStressIntegrandType backward_stress_integrand(team);
+
+        specfem::compute::load_on_device(team, quadrature, element_quadrature);
+        for (int tile = 0; tile < ChunkPolicyType::tile_size * simd_size;
+             tile += ChunkPolicyType::chunk_size * simd_size) {
+          const int starting_element_index =
+              team.league_rank() * ChunkPolicyType::tile_size * simd_size +
+              tile;
+
+          if (starting_element_index >= nelements) {
+            break;
+          }
+
+          const auto iterator =
+              chunk_policy.league_iterator(starting_element_index);
+          specfem::compute::load_on_device(team, iterator, adjoint_field,
+                                           adjoint_element_field);
+          specfem::compute::load_on_device(team, iterator, backward_field,
+                                           backward_element_field);
+
+          team.team_barrier();
+
+          specfem::algorithms::gradient(
+              team, iterator, partial_derivatives,
+              element_quadrature.hprime_gll,
+              adjoint_element_field.displacement,
+              backward_element_field.displacement,
+              [&](const typename ChunkPolicyType::iterator_type::index_type
+                      &iterator_index,
+                  const typename PointFieldDerivativesType::ViewType &df,
+                  const typename PointFieldDerivativesType::ViewType &dg) {
+                const auto &index = iterator_index.index;
+
+                PointPartialDerivativesType point_partial_derivatives;
+                specfem::compute::load_on_device(index, partial_derivatives,
+                                                 point_partial_derivatives);
+
+                PointPropertyType point_property;
+                specfem::compute::load_on_device(index, properties,
+                                                 point_property);
+
+                const PointFieldDerivativesType adjoint_derivatives(df);
+                const PointFieldDerivativesType backward_derivatives(dg);
+
+                const auto F_adjoint =
+                    specfem::medium::compute_stress(point_property,
+                                                    adjoint_derivatives) *
+                    point_partial_derivatives;
+                const auto F_backward =
+                    specfem::medium::compute_stress(point_property,
+                                                    backward_derivatives) *
+                    point_partial_derivatives;
+
+                const int &ielement = iterator_index.ielement;
+
+                for (int icomponent = 0; icomponent < components;
+                     ++icomponent) {
+                  for (int idim = 0; idim < num_dimensions; ++idim) {
+                    adjoint_stress_integrand.F(ielement, index.iz, index.ix,
+                                               idim, icomponent) =
+                        F_adjoint(idim, icomponent);
+                    backward_stress_integrand.F(ielement, index.iz, index.ix,
+                                                idim, icomponent) =
+                        F_backward(idim, icomponent);
+                  }
+                }
+
+                // The Frechet derivatives are linear in the adjoint
+                // acceleration. Its contribution is added by
+                // compute_inertial_derivatives once the adjoint acceleration
+                // of the time step is known.
+                PointAccelerationType adjoint_point_field;
+                PointDisplacementType backward_point_field;
+                for (int icomponent = 0; icomponent < components;
+                     ++icomponent) {
+                  adjoint_point_field.acceleration(icomponent) = 0.0;
+                  backward_point_field.displacement(icomponent) = 0.0;
+                }
+
+                const auto point_kernel =
+                    specfem::medium::compute_frechet_derivatives(
+                        point_property, adjoint_point_field,
+                        backward_point_field, adjoint_derivatives,
+                        backward_derivatives, dt);
+
+                specfem::compute::add_on_device(index, point_kernel, kernels);
+              });
+
+          team.team_barrier();
+
+          const auto update_acceleration = [&](const auto &stress_integrand,
+                                               const auto &field) {
+            specfem::algorithms::divergence(
+                team, iterator, partial_derivatives, wgll,
+                element_quadrature.hprime_wgll, stress_integrand.F,
+                [&](const typename ChunkPolicyType::iterator_type::index_type
+                        &iterator_index,
+                    const typename PointAccelerationType::ViewType &result) {
+                  const auto &index = iterator_index.index;
+                  PointAccelerationType acceleration(result);
+
+                  for (int icomponent = 0; icomponent < components;
+                       ++icomponent) {
+                    acceleration.acceleration(icomponent) *=
+                        static_cast<type_real>(-1.0);
+                  }
+
+                  if constexpr (boundary_tag !=
+                                specfem::element::boundary_tag::none) {
+                    PointPropertyType point_property;
+                    specfem::compute::load_on_device(index, properties,
+                                                     point_property);
+
+                    PointVelocityType velocity;
+                    specfem::compute::load_on_device(index, field, velocity);
+
+                    PointBoundaryType point_boundary;
+                    specfem::compute::load_on_device(index, boundaries,
+                                                     point_boundary);
+
+                    specfem::boundary_conditions::apply_boundary_conditions(
+                        point_boundary, point_property, velocity,
+                        acceleration);
+                  }
+
+                  specfem::compute::atomic_add_on_device(index, acceleration,
+                                                         field);
+                });
+          };
+
+          update_acceleration(adjoint_stress_integrand, adjoint_field);
+          update_acceleration(backward_stress_integrand, backward_field);
+        }
+      });
+
+  Kokkos::fence();
+
+  return;
+}
+
+template <specfem::dimension::type DimensionType, int NGLL,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+void specfem::kokkos_kernels::impl::compute_inertial_derivatives(
+    const specfem::compute::assembly &assembly, const type_real &dt) {
+
+  const auto elements =
+      assembly.element_types.get_elements_on_device(MediumTag, PropertyTag);
+
+  const int nelements = elements.extent(0);
+
+  if (nelements == 0)
+    return;
+
+  const auto &properties = assembly.properties;
+  const auto &kernels = assembly.kernels;
+  const auto adjoint_field = assembly.fields.adjoint;
+  const auto backward_field = assembly.fields.backward;
+
+  constexpr int components =
+      specfem::element::attributes<DimensionType, MediumTag>::components();
+  constexpr int num_dimensions =
+      specfem::element::attributes<DimensionType, MediumTag>::dimension();
+
+  constexpr bool using_simd = false;
+
+  using AdjointPointFieldType =
+      specfem::point::field<DimensionType, MediumTag, false, false, true, false,
+                            using_simd>;
+  using BackwardPointFieldType =
+      specfem::point::field<DimensionType, MediumTag, true, false, false, false,
+                            using_simd>;
+  using PointFieldDerivativesType =
+      specfem::point::field_derivatives<DimensionType, MediumTag, using_simd>;
+  using PointPropertiesType =
+      specfem::point::properties<DimensionType, MediumTag, PropertyTag,
+                                 using_simd>;
+
+  Kokkos::parallel_for(
+      "specfem::kokkos_kernels::impl::compute_inertial_derivatives",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(
+          0, nelements * NGLL * NGLL),
+      KOKKOS_LAMBDA(const int ipoint) {
+        const int ispec = elements(ipoint / (NGLL * NGLL));
+        const int iz = (ipoint % (NGLL * NGLL)) / NGLL;
+        const int ix = ipoint % NGLL;
+
+        const specfem::point::index<DimensionType> index(ispec, iz, ix);
+
+        PointPropertiesType point_properties;
+        specfem::compute::load_on_device(index, properties, point_properties);
+
+        AdjointPointFieldType adjoint_point_field;
+        specfem::compute::load_on_device(index, adjoint_field,
+                                         adjoint_point_field);
+
+        BackwardPointFieldType backward_point_field;
+        specfem::compute::load_on_device(index, backward_field,
+                                         backward_point_field);
+
+        // The strain terms were added by compute_combined_stiffness_interaction
+        PointFieldDerivativesType zero_derivatives;
+        for (int idim = 0; idim < num_dimensions; ++idim) {
+          for (int icomponent = 0; icomponent < components; ++icomponent) {
+            zero_derivatives.du(idim, icomponent) = 0.0;
+          }
+        }
+
+        const auto point_kernel = specfem::medium::compute_frechet_derivatives(
+            point_properties, adjoint_point_field, backward_point_field,
+            zero_derivatives, zero_derivatives, dt);
+
+        specfem::compute::add_on_device(index, point_kernel, kernels);
+      });
+
+  Kokkos::fence();
+
+  return;
+}
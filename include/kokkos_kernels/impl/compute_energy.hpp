@@ -0,0 +1,64 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/dimension.hpp"
+#include "enumerations/medium.hpp"
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+
+namespace specfem {
+namespace kokkos_kernels {
+
+namespace impl {
+/**
+ * @brief Reduce the global degrees of freedom of a medium to compute the
+ * maximum magnitude of the field and the number of non-finite values.
+ *
+ * @tparam DimensionType Dimension of the problem
+ * @tparam WavefieldType Wavefield type
+ * @tparam MediumTag Medium tag
+ * @param assembly Assembly object
+ * @param max_field Maximum magnitude of the field
+ * @param nonfinite Number of degrees of freedom with non-finite (NaN or Inf)
+ * field or time derivative
+ */
+template <specfem::dimension::type DimensionType,
+          specfem::wavefield::simulation_field WavefieldType,
+          specfem::element::medium_tag MediumTag>
+void compute_field_statistics(const specfem::compute::assembly &assembly,
+                              type_real &max_field, int &nonfinite);
+
+/**
+ * @brief Integrate the energy of the wavefield over the elements of a
+ * particular material system
+ *
+ * The energy is integrated with the GLL quadrature of every element:
+ *  - the mass energy is \f$ \frac{1}{2} \dot{u}^T M \dot{u} \f$, i.e. the
+ *    kinetic energy within elastic media and the compressional energy
+ *    \f$ \frac{1}{2\kappa} \dot{\chi}^2 \f$ within acoustic media. \f$ M \f$
+ *    is the mass matrix of the medium, without the terms added by absorbing
+ *    boundaries.
+ *  - the stiffness energy is \f$ \frac{1}{2} \int \sigma : \nabla u \f$,
+ *    i.e. the strain energy within elastic media and the kinetic energy
+ *    \f$ \frac{1}{2\rho} | \nabla \chi |^2 \f$ within acoustic media.
+ *
+ * The number of quadrature points is read from the assembly.
+ *
+ * @tparam DimensionType Dimension of the problem
+ * @tparam WavefieldType Wavefield type
+ * @tparam MediumTag Medium tag
+ * @tparam PropertyTag Property tag
+ * @param assembly Assembly object
+ * @param mass_energy Mass energy
+ * @param stiffness_energy Stiffness energy
+ */
+template <specfem::dimension::type DimensionType,
+          specfem::wavefield::simulation_field WavefieldType,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+void compute_energy(const specfem::compute::assembly &assembly,
+                    type_real &mass_energy, type_real &stiffness_energy);
+} // namespace impl
+
+} // namespace kokkos_kernels
+} // namespace specfem
@@ -0,0 +1,220 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "compute_energy.hpp"
+#include "medium/compute_mass_matrix.hpp"
+#include "medium/compute_stress.hpp"
+#include "parallel_configuration/range_config.hpp"
+#include "point/field.hpp"
+#include "point/field_derivatives.hpp"
+#include "point/partial_derivatives.hpp"
+#include "point/properties.hpp"
+#include "policies/range.hpp"
+#include <Kokkos_Core.hpp>
+
+template <specfem::dimension::type DimensionType,
+          specfem::wavefield::simulation_field WavefieldType,
+          specfem::element::medium_tag MediumTag>
+void specfem::kokkos_kernels::impl::compute_field_statistics(
+    const specfem::compute::assembly &assembly, type_real &max_field,
+    int &nonfinite) {
+
+  constexpr auto wavefield = WavefieldType;
+  const auto field = assembly.fields.get_simulation_field<wavefield>();
+
+  const int nglob = field.template get_nglob<MediumTag>();
+
+  max_field = 0.0;
+  nonfinite = 0;
+
+  if (nglob == 0) {
+    return;
+  }
+
+  // Reductions are performed on scalars
+  constexpr bool using_simd = false;
+  using PointFieldType = specfem::point::field<DimensionType, MediumTag, true,
+                                               true, false, false, using_simd>;
+
+  constexpr int components = PointFieldType::components;
+
+  using ParallelConfig = specfem::parallel_config::default_range_config<
+      specfem::datatype::simd<type_real, using_simd>,
+      Kokkos::DefaultExecutionSpace>;
+
+  using RangePolicy = specfem::policy::range<ParallelConfig>;
+
+  RangePolicy range(nglob);
+
+  Kokkos::parallel_reduce(
+      "specfem::kokkos_kernels::impl::compute_field_statistics",
+      static_cast<typename RangePolicy::policy_type &>(range),
+      KOKKOS_LAMBDA(const int iglob, type_real &l_max, int &l_nonfinite) {
+        const auto iterator = range.range_iterator(iglob);
+        const auto index = iterator(0);
+
+        PointFieldType point_field;
+        specfem::compute::load_on_device(index.index, field, point_field);
+
+        type_real norm = 0.0;
+        bool finite = true;
+        for (int icomponent = 0; icomponent < components; ++icomponent) {
+          const type_real u = point_field.displacement(icomponent);
+          const type_real v = point_field.velocity(icomponent);
+
+          finite = finite && Kokkos::isfinite(u) && Kokkos::isfinite(v);
+          norm += u * u;
+        }
+
+        l_max = (Kokkos::sqrt(norm) > l_max) ? Kokkos::sqrt(norm) : l_max;
+        if (!finite) {
+          l_nonfinite += 1;
+        }
+      },
+      Kokkos::Max<type_real>(max_field), nonfinite);
+
+  return;
+}
+
+template <specfem::dimension::type DimensionType,
+          specfem::wavefield::simulation_field WavefieldType,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+void specfem::kokkos_kernels::impl::compute_energy(
+    const specfem::compute::assembly &assembly, type_real &mass_energy,
+    type_real &stiffness_energy) {
+
+  constexpr auto wavefield = WavefieldType;
+  constexpr auto dimension = DimensionType;
+
+  const auto elements =
+      assembly.element_types.get_elements_on_device(MediumTag, PropertyTag);
+
+  const int nelements = elements.extent(0);
+
+  mass_energy = 0.0;
+  stiffness_energy = 0.0;
+
+  if (nelements == 0) {
+    return;
+  }
+
+  const int ngllz = assembly.mesh.ngllz;
+  const int ngllx = assembly.mesh.ngllx;
+  const int npoints = ngllz * ngllx;
+
+  const auto &partial_derivatives = assembly.partial_derivatives;
+  const auto &properties = assembly.properties;
+  const auto field = assembly.fields.get_simulation_field<wavefield>();
+  const auto hprime = assembly.mesh.quadratures.gll.hprime;
+  const auto wgll = assembly.mesh.quadratures.gll.weights;
+
+  // Reductions are performed on scalars
+  constexpr bool using_simd = false;
+
+  constexpr int components =
+      specfem::element::attributes<dimension, MediumTag>::components();
+  constexpr int num_dimensions =
+      specfem::element::attributes<dimension, MediumTag>::dimension();
+
+  using PointFieldType = specfem::point::field<dimension, MediumTag, true,
+                                               true, false, false, using_simd>;
+  using PointDisplacementType =
+      specfem::point::field<dimension, MediumTag, true, false, false, false,
+                            using_simd>;
+  using PointPartialDerivativesType =
+      specfem::point::partial_derivatives<dimension, true, using_simd>;
+  using PointPropertyType =
+      specfem::point::properties<dimension, MediumTag, PropertyTag,
+                                 using_simd>;
+  using PointFieldDerivativesType =
+      specfem::point::field_derivatives<dimension, MediumTag, using_simd>;
+
+  // Every quadrature point computes its own derivatives, such that neither
+  // scratch memory nor the number of quadrature points at compile time is
+  // needed
+  Kokkos::parallel_reduce(
+      "specfem::kokkos_kernels::impl::compute_energy",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0,
+                                                         nelements * npoints),
+      KOKKOS_LAMBDA(const int i, type_real &l_mass, type_real &l_stiffness) {
+        const int ispec = elements(i / npoints);
+        const int iz = (i % npoints) / ngllx;
+        const int ix = i % ngllx;
+        const specfem::point::index<dimension> index(ispec, iz, ix);
+
+        PointPartialDerivativesType point_partial_derivatives;
+        specfem::compute::load_on_device(index, partial_derivatives,
+                                         point_partial_derivatives);
+
+        PointPropertyType point_property;
+        specfem::compute::load_on_device(index, properties, point_property);
+
+        PointFieldType point_field;
+        specfem::compute::load_on_device(index, field, point_field);
+
+        const type_real weight = wgll(ix) * wgll(iz);
+
+        const auto mass = specfem::medium::mass_matrix_component(
+            point_property, point_partial_derivatives);
+
+        for (int icomponent = 0; icomponent < components; ++icomponent) {
+          const type_real v = point_field.velocity(icomponent);
+          l_mass += static_cast<type_real>(0.5) *
+                    mass.mass_matrix(icomponent) * weight * v * v;
+        }
+
+        type_real df_dxi[components] = { 0.0 };
+        type_real df_dgamma[components] = { 0.0 };
+
+        for (int l = 0; l < ngllx; ++l) {
+          PointDisplacementType point_displacement;
+          specfem::compute::load_on_device(
+              specfem::point::index<dimension>(ispec, iz, l), field,
+              point_displacement);
+          for (int icomponent = 0; icomponent < components; ++icomponent) {
+            df_dxi[icomponent] +=
+                hprime(ix, l) * point_displacement.displacement(icomponent);
+          }
+        }
+
+        for (int l = 0; l < ngllz; ++l) {
+          PointDisplacementType point_displacement;
+          specfem::compute::load_on_device(
+              specfem::point::index<dimension>(ispec, l, ix), field,
+              point_displacement);
+          for (int icomponent = 0; icomponent < components; ++icomponent) {
+            df_dgamma[icomponent] +=
+                hprime(iz, l) * point_displacement.displacement(icomponent);
+          }
+        }
+
+        typename PointFieldDerivativesType::ViewType du;
+        for (int icomponent = 0; icomponent < components; ++icomponent) {
+          du(0, icomponent) =
+              point_partial_derivatives.xix * df_dxi[icomponent] +
+              point_partial_derivatives.gammax * df_dgamma[icomponent];
+          du(1, icomponent) =
+              point_partial_derivatives.xiz * df_dxi[icomponent] +
+              point_partial_derivatives.gammaz * df_dgamma[icomponent];
+        }
+
+        const PointFieldDerivativesType field_derivatives(du);
+
+        const auto point_stress =
+            specfem::medium::compute_stress(point_property, field_derivatives);
+
+        type_real density = 0.0;
+        for (int icomponent = 0; icomponent < components; ++icomponent) {
+          for (int idim = 0; idim < num_dimensions; ++idim) {
+            density += point_stress.T(idim, icomponent) * du(idim, icomponent);
+          }
+        }
+
+        l_stiffness += static_cast<type_real>(0.5) * density *
+                       point_partial_derivatives.jacobian * weight;
+      },
+      mass_energy, stiffness_energy);
+
+  return;
+}
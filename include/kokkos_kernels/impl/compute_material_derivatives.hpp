@@ -15,7 +15,8 @@ namespace impl {
  *
  * @tparam MediumTag Medium tag.
  * @tparam PropertyTag Property tag.
- * @param dt Time interval.
+ * @param dt Time interval covered by the update. When the kernels are updated
+ * every k time steps this is k times the time step.
  */
 template <specfem::dimension::type DimensionType, int NGLL,
           specfem::element::medium_tag MediumTag,
@@ -73,14 +73,24 @@ void specfem::kokkos_kernels::impl::compute_seismograms(
       type_real, ParallelConfig::chunk_size, ngll, 2,
       specfem::kokkos::DevScratchSpace, Kokkos::MemoryTraits<Kokkos::Unmanaged>,
       false>;
+  using LagrangeFactorViewType =
+      Kokkos::View<type_real[ParallelConfig::chunk_size][ngll][2],
+                   Kokkos::LayoutLeft, specfem::kokkos::DevScratchSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
+  using NodeIndexViewType =
+      Kokkos::View<int[ParallelConfig::chunk_size][2], Kokkos::LayoutLeft,
+                   specfem::kokkos::DevScratchSpace,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
   using ResultsViewType =
       Kokkos::View<type_real[ParallelConfig::chunk_size][2], Kokkos::LayoutLeft,
                    specfem::kokkos::DevScratchSpace,
                    Kokkos::MemoryTraits<Kokkos::Unmanaged> >;
 
-  int scratch_size = ChunkElementFieldType::shmem_size() +
-                     ElementQuadratureType::shmem_size() +
-                     2 * ViewType::shmem_size() + ResultsViewType::shmem_size();
+  int scratch_size =
+      ChunkElementFieldType::shmem_size() +
+      ElementQuadratureType::shmem_size() + ViewType::shmem_size() +
+      LagrangeFactorViewType::shmem_size() + NodeIndexViewType::shmem_size() +
+      ResultsViewType::shmem_size();
 
   receivers.set_seismogram_step(isig_step);
 
@@ -100,7 +110,8 @@ void specfem::kokkos_kernels::impl::compute_seismograms(
           ChunkElementFieldType element_field(team_member);
           ElementQuadratureType element_quadrature(team_member);
           ViewType wavefield(team_member.team_scratch(0));
-          ViewType lagrange_interpolant(team_member.team_scratch(0));
+          LagrangeFactorViewType lagrange_factors(team_member.team_scratch(0));
+          NodeIndexViewType node_index(team_member.team_scratch(0));
           ResultsViewType seismogram_components(team_member.team_scratch(0));
 
           specfem::compute::load_on_device(team_member, quadrature,
@@ -129,12 +140,12 @@ void specfem::kokkos_kernels::impl::compute_seismograms(
                 element_field, wavefield_component, wavefield);
 
             specfem::compute::load_on_device(team_member, iterator, receivers,
-                                             lagrange_interpolant);
+                                             lagrange_factors, node_index);
 
             team_member.team_barrier();
 
             specfem::algorithms::interpolate_function(
-                team_member, iterator, lagrange_interpolant, wavefield,
+                team_member, iterator, lagrange_factors, node_index, wavefield,
                 seismogram_components);
 
             team_member.team_barrier();
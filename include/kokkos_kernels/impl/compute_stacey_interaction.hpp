@@ -0,0 +1,30 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/dimension.hpp"
+#include "enumerations/medium.hpp"
+#include "enumerations/wavefield.hpp"
+
+namespace specfem {
+namespace kokkos_kernels {
+namespace impl {
+
+/**
+ * @brief Add the Stacey traction at every absorbing boundary point of elements
+ * of a given medium, property and boundary type to the acceleration.
+ *
+ * The kernel iterates over the list of absorbing boundary points (see @ref
+ * specfem::compute::impl::boundaries::stacey). For the forward wavefield the
+ * traction is stored for reconstruction of the backward wavefield, for the
+ * backward wavefield the stored traction is added instead of computing it.
+ */
+template <specfem::dimension::type DimensionType,
+          specfem::wavefield::simulation_field WavefieldType,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag>
+void compute_stacey_interaction(const specfem::compute::assembly &assembly,
+                                const int &istep);
+} // namespace impl
+} // namespace kokkos_kernels
+} // namespace specfem
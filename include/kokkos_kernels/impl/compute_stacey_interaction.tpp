@@ -0,0 +1,120 @@
+#pragma once
+
+#include "boundary_conditions/boundary_conditions.hpp"
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/dimension.hpp"
+#include "enumerations/medium.hpp"
+#include "enumerations/wavefield.hpp"
+#include "point/boundary.hpp"
+#include "point/coordinates.hpp"
+#include "point/field.hpp"
+#include "point/properties.hpp"
+#include <Kokkos_Core.hpp>
+
+template <specfem::dimension::type DimensionType,
+          specfem::wavefield::simulation_field WavefieldType,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag>
+void specfem::kokkos_kernels::impl::compute_stacey_interaction(
+    const specfem::compute::assembly &assembly, const int &istep) {
+
+  constexpr auto medium_tag = MediumTag;
+  constexpr auto property_tag = PropertyTag;
+  constexpr auto boundary_tag = BoundaryTag;
+  constexpr auto wavefield = WavefieldType;
+  constexpr auto dimension = DimensionType;
+
+  static_assert(
+      (boundary_tag == specfem::element::boundary_tag::stacey ||
+       boundary_tag ==
+           specfem::element::boundary_tag::composite_stacey_dirichlet),
+      "Boundary tag must be stacey or composite_stacey_dirichlet");
+
+  const auto elements = assembly.element_types.get_elements_on_device(
+      MediumTag, PropertyTag, BoundaryTag);
+
+  const int nelements = elements.extent(0);
+
+  if (nelements == 0)
+    return;
+
+  const auto &properties = assembly.properties;
+  const auto &boundaries = assembly.boundaries;
+  const auto &stacey = assembly.boundaries.stacey;
+  const auto field = assembly.fields.get_simulation_field<wavefield>();
+  const auto boundary_values =
+      assembly.boundary_values.get_container<boundary_tag>();
+
+  using PointBoundaryType =
+      specfem::point::boundary<boundary_tag, dimension, false>;
+  using PointVelocityType = specfem::point::field<dimension, medium_tag, false,
+                                                  true, false, false, false>;
+  using PointAccelerationType =
+      specfem::point::field<dimension, medium_tag, false, false, true, false,
+                            false>;
+  using PointPropertyType =
+      specfem::point::properties<dimension, medium_tag, property_tag, false>;
+
+  using PolicyType = Kokkos::TeamPolicy<Kokkos::DefaultExecutionSpace>;
+
+  Kokkos::parallel_for(
+      "specfem::kernels::impl::domain_kernels::compute_stacey_interaction",
+      PolicyType(nelements, Kokkos::AUTO),
+      KOKKOS_LAMBDA(const typename PolicyType::member_type &team) {
+        const int ispec = elements(team.league_rank());
+        const int ielement = boundaries.stacey_index_mapping(ispec);
+
+        // Points of this element within the list of absorbing boundary points
+        const int start = stacey.element_offset(ielement);
+        const int end = stacey.element_offset(ielement + 1);
+
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(team, start, end), [&](const int ipoint) {
+              const specfem::point::index<dimension> index(
+                  stacey.point_ispec(ipoint), stacey.point_iz(ipoint),
+                  stacey.point_ix(ipoint));
+
+              PointAccelerationType acceleration(static_cast<type_real>(0.0));
+
+              if constexpr (wavefield ==
+                            specfem::wavefield::simulation_field::backward) {
+                // Reinject the traction stored during the forward simulation
+                specfem::compute::load_on_device(istep, ipoint,
+                                                 boundary_values, acceleration);
+              } else {
+                PointPropertyType point_property;
+                specfem::compute::load_on_device(index, properties,
+                                                 point_property);
+
+                PointVelocityType velocity;
+                specfem::compute::load_on_device(index, field, velocity);
+
+                PointBoundaryType point_boundary;
+                specfem::compute::load_on_device(index, boundaries,
+                                                 point_boundary);
+
+                // Applying the boundary conditions to a zero acceleration
+                // gives the Stacey traction at the point. Dirichlet points
+                // within composite elements evaluate to zero.
+                specfem::boundary_conditions::apply_boundary_conditions(
+                    point_boundary, point_property, velocity, acceleration);
+
+                // Store forward boundary values for reconstruction during
+                // adjoint simulations
+                if constexpr (wavefield ==
+                              specfem::wavefield::simulation_field::forward) {
+                  specfem::compute::store_on_device(istep, ipoint, acceleration,
+                                                    boundary_values);
+                }
+              }
+
+              specfem::compute::atomic_add_on_device(index, acceleration,
+                                                     field);
+            });
+      });
+
+  Kokkos::fence();
+
+  return;
+}
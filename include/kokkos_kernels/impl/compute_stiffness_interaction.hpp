@@ -4,6 +4,7 @@
 #include "enumerations/dimension.hpp"
 #include "enumerations/medium.hpp"
 #include "enumerations/wavefield.hpp"
+#include <Kokkos_Core.hpp>
 
 namespace specfem {
 namespace kokkos_kernels {
@@ -16,6 +17,26 @@ template <specfem::dimension::type DimensionType,
           specfem::element::boundary_tag BoundaryTag>
 void compute_stiffness_interaction(const specfem::compute::assembly &assembly,
                                    const int &istep);
-}
+
+/**
+ * @brief Compute the stiffness interaction within a subset of elements
+ *
+ * The elements need not be contiguous. Fields are loaded one element at a
+ * time, without SIMD vectorization across elements.
+ *
+ * @param assembly SPECFEM++ assembly object
+ * @param istep Current timestep
+ * @param elements Indices of the elements on the device. Every element needs
+ * to be of the medium, property and (volume) boundary type of the kernel
+ */
+template <specfem::dimension::type DimensionType,
+          specfem::wavefield::simulation_field WavefieldType, int NGLL,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag>
+void compute_stiffness_interaction(
+    const specfem::compute::assembly &assembly, const int &istep,
+    const Kokkos::View<int *, Kokkos::DefaultExecutionSpace> &elements);
+} // namespace impl
 } // namespace kokkos_kernels
 } // namespace specfem
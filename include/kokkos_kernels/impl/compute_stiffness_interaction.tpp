@@ -19,16 +19,21 @@
 #include "point/partial_derivatives.hpp"
 #include "point/properties.hpp"
 #include "point/sources.hpp"
+#include "point/stiffness_coefficients.hpp"
 #include "policies/chunk.hpp"
 #include <Kokkos_Core.hpp>
 
+namespace {
+// Loads within SIMD kernels span consecutive elements. The SIMD variant is
+// therefore only valid for contiguous element lists.
 template <specfem::dimension::type DimensionType,
           specfem::wavefield::simulation_field WavefieldType, int NGLL,
           specfem::element::medium_tag MediumTag,
           specfem::element::property_tag PropertyTag,
-          specfem::element::boundary_tag BoundaryTag>
-void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
-    const specfem::compute::assembly &assembly, const int &istep) {
+          specfem::element::boundary_tag BoundaryTag, bool UseSIMD>
+void stiffness_interaction_impl(
+    const specfem::compute::assembly &assembly,
+    const Kokkos::View<int *, Kokkos::DefaultExecutionSpace> &elements) {
 
   constexpr auto medium_tag = MediumTag;
   constexpr auto property_tag = PropertyTag;
@@ -37,8 +42,13 @@ void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
   constexpr auto wavefield = WavefieldType;
   constexpr auto dimension = DimensionType;
 
-  const auto elements = assembly.element_types.get_elements_on_device(
-      MediumTag, PropertyTag, BoundaryTag);
+  // Stacey traction is computed by compute_stacey_interaction on the
+  // absorbing boundary points. Elements with absorbing boundaries share the
+  // volume kernel of the remaining boundary type.
+  static_assert(
+      (boundary_tag == specfem::element::boundary_tag::none ||
+       boundary_tag == specfem::element::boundary_tag::acoustic_free_surface),
+      "Boundary tag must be none or acoustic_free_surface");
 
   const int nelements = elements.extent(0);
 
@@ -48,12 +58,12 @@ void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
   const auto &quadrature = assembly.mesh.quadratures;
   const auto &partial_derivatives = assembly.partial_derivatives;
   const auto &properties = assembly.properties;
+  const auto &stiffness_coefficients = assembly.stiffness_coefficients;
+  const bool use_stiffness_coefficients = stiffness_coefficients.enabled;
   const auto field = assembly.fields.get_simulation_field<wavefield>();
   const auto &boundaries = assembly.boundaries;
-  const auto boundary_values =
-      assembly.boundary_values.get_container<boundary_tag>();
 
-  constexpr bool using_simd = true;
+  constexpr bool using_simd = UseSIMD;
   using simd = specfem::datatype::simd<type_real, using_simd>;
   using parallel_config = specfem::parallel_config::default_chunk_config<
       dimension, simd, Kokkos::DefaultExecutionSpace>;
@@ -93,6 +103,9 @@ void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
                                  using_simd>;
   using PointFieldDerivativesType =
       specfem::point::field_derivatives<dimension, medium_tag, using_simd>;
+  using PointStiffnessCoefficientsType =
+      specfem::point::stiffness_coefficients<dimension, medium_tag,
+                                             property_tag, using_simd>;
 
   const auto wgll = assembly.mesh.quadratures.gll.weights;
 
@@ -104,45 +117,6 @@ void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
 
   constexpr int simd_size = simd::size();
 
-  if constexpr (BoundaryTag == specfem::element::boundary_tag::stacey &&
-    WavefieldType == specfem::wavefield::simulation_field::backward) {
-
-  Kokkos::parallel_for(
-      "specfem::domain::impl::kernels::elements::compute_stiffness_"
-      "interaction",
-      static_cast<const typename ChunkPolicyType::policy_type &>(chunk_policy),
-      KOKKOS_LAMBDA(const typename ChunkPolicyType::member_type &team) {
-        for (int tile = 0; tile < ChunkPolicyType::tile_size * simd_size;
-             tile += ChunkPolicyType::chunk_size * simd_size) {
-          const int starting_element_index =
-              team.league_rank() * ChunkPolicyType::tile_size * simd_size +
-              tile;
-
-          if (starting_element_index >= nelements) {
-            break;
-          }
-
-          const auto iterator =
-              chunk_policy.league_iterator(starting_element_index);
-
-          Kokkos::parallel_for(
-              Kokkos::TeamThreadRange(team, iterator.chunk_size()),
-              [&](const int i) {
-                const auto iterator_index = iterator(i);
-                const auto index = iterator_index.index;
-
-                PointAccelerationType acceleration;
-                specfem::compute::load_on_device(
-                    istep, index, boundary_values, acceleration);
-
-                specfem::compute::atomic_add_on_device(index, acceleration,
-                         field);
-              });
-        }
-      });
-  }
-  else {
-
   Kokkos::parallel_for(
       "specfem::kernels::impl::domain_kernels::compute_stiffness_interaction",
       chunk_policy.set_scratch_size(0, Kokkos::PerTeam(scratch_size)),
@@ -169,48 +143,76 @@ void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
 
           team.team_barrier();
 
-          specfem::algorithms::gradient(
-              team, iterator, partial_derivatives,
-              element_quadrature.hprime_gll, element_field.displacement,
-              // Compute stresses using the gradients
-              [&](const typename ChunkPolicyType::iterator_type::index_type
-                      &iterator_index,
-                  const typename PointFieldDerivativesType::ViewType &du) {
-                const auto &index = iterator_index.index;
-
-                PointPartialDerivativesType point_partial_derivatives;
-                specfem::compute::load_on_device(index, partial_derivatives,
-                                                 point_partial_derivatives);
-
-                PointPropertyType point_property;
-                specfem::compute::load_on_device(index, properties,
-                                                 point_property);
-
-                PointFieldDerivativesType field_derivatives(du);
-
-                const auto point_stress = specfem::medium::compute_stress(
-                    point_property, field_derivatives);
-
-                const auto F = point_stress * point_partial_derivatives;
-
-                const int &ielement = iterator_index.ielement;
-
-                for (int icomponent = 0; icomponent < components;
-                     ++icomponent) {
-                  for (int idim = 0; idim < num_dimensions; ++idim) {
-                    stress_integrand.F(ielement, index.iz, index.ix, idim,
-                                       icomponent) = F(idim, icomponent);
+          if (use_stiffness_coefficients) {
+            // Fused mode: the partial derivatives and material properties are
+            // folded into a single set of coefficients per quadrature point
+            specfem::algorithms::reference_gradient(
+                team, iterator, element_quadrature.hprime_gll,
+                element_field.displacement,
+                [&](const typename ChunkPolicyType::iterator_type::index_type
+                        &iterator_index,
+                    const typename PointFieldDerivativesType::ViewType &dg) {
+                  const auto &index = iterator_index.index;
+
+                  PointStiffnessCoefficientsType point_coefficients;
+                  specfem::compute::load_on_device(
+                      index, stiffness_coefficients, point_coefficients);
+
+                  const auto F = point_coefficients * dg;
+
+                  const int &ielement = iterator_index.ielement;
+
+                  for (int icomponent = 0; icomponent < components;
+                       ++icomponent) {
+                    for (int idim = 0; idim < num_dimensions; ++idim) {
+                      stress_integrand.F(ielement, index.iz, index.ix, idim,
+                                         icomponent) = F(idim, icomponent);
+                    }
                   }
-                }
-              });
+                });
+          } else {
+            specfem::algorithms::gradient(
+                team, iterator, partial_derivatives,
+                element_quadrature.hprime_gll, element_field.displacement,
+                // Compute stresses using the gradients
+                [&](const typename ChunkPolicyType::iterator_type::index_type
+                        &iterator_index,
+                    const typename PointFieldDerivativesType::ViewType &du) {
+                  const auto &index = iterator_index.index;
+
+                  PointPartialDerivativesType point_partial_derivatives;
+                  specfem::compute::load_on_device(index, partial_derivatives,
+                                                   point_partial_derivatives);
+
+                  PointPropertyType point_property;
+                  specfem::compute::load_on_device(index, properties,
+                                                   point_property);
+
+                  PointFieldDerivativesType field_derivatives(du);
+
+                  const auto point_stress = specfem::medium::compute_stress(
+                      point_property, field_derivatives);
+
+                  const auto F = point_stress * point_partial_derivatives;
+
+                  const int &ielement = iterator_index.ielement;
+
+                  for (int icomponent = 0; icomponent < components;
+                       ++icomponent) {
+                    for (int idim = 0; idim < num_dimensions; ++idim) {
+                      stress_integrand.F(ielement, index.iz, index.ix, idim,
+                                         icomponent) = F(idim, icomponent);
+                    }
+                  }
+                });
+          }
 
           team.team_barrier();
 
           specfem::algorithms::divergence(
               team, iterator, partial_derivatives, wgll,
               element_quadrature.hprime_wgll, stress_integrand.F,
-              [&, istep = istep](
-                  const typename ChunkPolicyType::iterator_type::index_type
+              [&](const typename ChunkPolicyType::iterator_type::index_type
                       &iterator_index,
                   const typename PointAccelerationType::ViewType &result) {
                 const auto &index = iterator_index.index;
@@ -222,27 +224,21 @@ void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
                       static_cast<type_real>(-1.0);
                 }
 
-                PointPropertyType point_property;
-                specfem::compute::load_on_device(index, properties,
-                                                 point_property);
+                if constexpr (boundary_tag !=
+                              specfem::element::boundary_tag::none) {
+                  PointPropertyType point_property;
+                  specfem::compute::load_on_device(index, properties,
+                                                   point_property);
 
-                PointVelocityType velocity;
-                specfem::compute::load_on_device(index, field, velocity);
+                  PointVelocityType velocity;
+                  specfem::compute::load_on_device(index, field, velocity);
 
-                PointBoundaryType point_boundary;
-                specfem::compute::load_on_device(index, boundaries,
-                                                 point_boundary);
+                  PointBoundaryType point_boundary;
+                  specfem::compute::load_on_device(index, boundaries,
+                                                   point_boundary);
 
-                specfem::boundary_conditions::apply_boundary_conditions(
-                    point_boundary, point_property, velocity, acceleration);
-
-                // Store forward boundary values for reconstruction during
-                // adjoint simulations. The function does nothing if the
-                // boundary tag is not stacey
-                if (wavefield ==
-                    specfem::wavefield::simulation_field::forward) {
-                  specfem::compute::store_on_device(istep, index, acceleration,
-                                                    boundary_values);
+                  specfem::boundary_conditions::apply_boundary_conditions(
+                      point_boundary, point_property, velocity, acceleration);
                 }
 
                 specfem::compute::atomic_add_on_device(index, acceleration,
@@ -250,9 +246,43 @@ void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
               });
         }
       });
-  }
 
   Kokkos::fence();
 
   return;
 }
+} // namespace
+
+template <specfem::dimension::type DimensionType,
+          specfem::wavefield::simulation_field WavefieldType, int NGLL,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag>
+void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
+    const specfem::compute::assembly &assembly, const int &istep) {
+
+  const auto elements = assembly.element_types.get_volume_elements_on_device(
+      MediumTag, PropertyTag, BoundaryTag);
+
+  stiffness_interaction_impl<DimensionType, WavefieldType, NGLL, MediumTag,
+                             PropertyTag, BoundaryTag, true>(assembly,
+                                                             elements);
+
+  return;
+}
+
+template <specfem::dimension::type DimensionType,
+          specfem::wavefield::simulation_field WavefieldType, int NGLL,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag,
+          specfem::element::boundary_tag BoundaryTag>
+void specfem::kokkos_kernels::impl::compute_stiffness_interaction(
+    const specfem::compute::assembly &assembly, const int &istep,
+    const Kokkos::View<int *, Kokkos::DefaultExecutionSpace> &elements) {
+
+  stiffness_interaction_impl<DimensionType, WavefieldType, NGLL, MediumTag,
+                             PropertyTag, BoundaryTag, false>(assembly,
+                                                              elements);
+
+  return;
+}
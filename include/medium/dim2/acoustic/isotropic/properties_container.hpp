@@ -1,5 +1,7 @@
 #pragma once
 
+#include "kokkos_abstractions.h"
+#include "medium/impl/properties_storage.hpp"
 #include "medium/properties_container.hpp"
 #include "point/interface.hpp"
 #include <Kokkos_SIMD.hpp>
@@ -16,12 +18,15 @@ struct properties_container<specfem::element::medium_tag::acoustic,
   constexpr static auto property_type =
       specfem::element::property_tag::isotropic;
 
-  using ViewType = typename Kokkos::View<type_real ***, Kokkos::LayoutLeft,
-                                         Kokkos::DefaultExecutionSpace>;
+  using ViewType =
+      typename Kokkos::View<type_real ***, specfem::kokkos::ElementLayout,
+                            Kokkos::DefaultExecutionSpace>;
 
   int nspec; ///< total number of acoustic spectral elements
   int ngllz; ///< number of quadrature points in z dimension
   int ngllx; ///< number of quadrature points in x dimension
+  bool per_element = true; ///< Device views store a single value per element
+                           ///< (no GLL model)
   ViewType rho_inverse;
   ViewType::HostMirror h_rho_inverse;
   ViewType kappa;
@@ -29,13 +34,18 @@ struct properties_container<specfem::element::medium_tag::acoustic,
 
   properties_container() = default;
 
-  properties_container(const int nspec, const int ngllz, const int ngllx)
-      : nspec(nspec), ngllz(ngllz), ngllx(ngllx),
-        rho_inverse("specfem::compute::properties::rho_inverse", nspec, ngllz,
-                    ngllx),
-        h_rho_inverse(Kokkos::create_mirror_view(rho_inverse)),
-        kappa("specfem::compute::properties::kappa", nspec, ngllz, ngllx),
-        h_kappa(Kokkos::create_mirror_view(kappa)) {}
+  properties_container(const int nspec, const int ngllz, const int ngllx,
+                       const bool per_element)
+      : nspec(nspec), ngllz(ngllz), ngllx(ngllx), per_element(per_element),
+        rho_inverse("specfem::compute::properties::rho_inverse", nspec,
+                    impl::device_extent(per_element, ngllz),
+                    impl::device_extent(per_element, ngllx)),
+        h_rho_inverse("specfem::compute::properties::h_rho_inverse", nspec,
+                      ngllz, ngllx),
+        kappa("specfem::compute::properties::kappa", nspec,
+              impl::device_extent(per_element, ngllz),
+              impl::device_extent(per_element, ngllx)),
+        h_kappa("specfem::compute::properties::h_kappa", nspec, ngllz, ngllx) {}
 
   template <
       typename PointProperties,
@@ -52,8 +62,8 @@ struct properties_container<specfem::element::medium_tag::acoustic,
                   "Property tag mismatch");
 
     const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
+    const int iz = per_element ? 0 : index.iz;
+    const int ix = per_element ? 0 : index.ix;
 
     property.rho_inverse = rho_inverse(ispec, iz, ix);
     property.kappa = kappa(ispec, iz, ix);
@@ -81,8 +91,8 @@ struct properties_container<specfem::element::medium_tag::acoustic,
     using tag_type = typename simd::tag_type;
 
     const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
+    const int iz = per_element ? 0 : index.iz;
+    const int ix = per_element ? 0 : index.ix;
 
     mask_type mask([&, this](std::size_t lane) { return index.mask(lane); });
 
@@ -156,13 +166,13 @@ struct properties_container<specfem::element::medium_tag::acoustic,
   }
 
   void copy_to_device() {
-    Kokkos::deep_copy(rho_inverse, h_rho_inverse);
-    Kokkos::deep_copy(kappa, h_kappa);
+    impl::copy_to_device(per_element, rho_inverse, h_rho_inverse);
+    impl::copy_to_device(per_element, kappa, h_kappa);
   }
 
   void copy_to_host() {
-    Kokkos::deep_copy(h_rho_inverse, rho_inverse);
-    Kokkos::deep_copy(h_kappa, kappa);
+    impl::copy_to_host(per_element, h_rho_inverse, rho_inverse);
+    impl::copy_to_host(per_element, h_kappa, kappa);
   }
 
   template <
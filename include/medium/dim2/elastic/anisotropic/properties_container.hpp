@@ -1,5 +1,7 @@
 #pragma once
 
+#include "kokkos_abstractions.h"
+#include "medium/impl/properties_storage.hpp"
 #include "medium/properties_container.hpp"
 #include "point/interface.hpp"
 #include <Kokkos_SIMD.hpp>
@@ -16,12 +18,15 @@ struct properties_container<specfem::element::medium_tag::elastic,
   constexpr static auto property_type =
       specfem::element::property_tag::anisotropic;
 
-  using ViewType = typename Kokkos::View<type_real ***, Kokkos::LayoutLeft,
-                                         Kokkos::DefaultExecutionSpace>;
+  using ViewType =
+      typename Kokkos::View<type_real ***, specfem::kokkos::ElementLayout,
+                            Kokkos::DefaultExecutionSpace>;
 
   int nspec; ///< total number of acoustic spectral elements
   int ngllz; ///< number of quadrature points in z dimension
   int ngllx; ///< number of quadrature points in x dimension
+  bool per_element = true; ///< Device views store a single value per element
+                           ///< (no GLL model)
 
   ViewType rho;
   ViewType::HostMirror h_rho;
@@ -46,28 +51,49 @@ struct properties_container<specfem::element::medium_tag::elastic,
 
   properties_container() = default;
 
-  properties_container(const int nspec, const int ngllz, const int ngllx)
-      : nspec(nspec), ngllz(ngllz), ngllx(ngllx),
-        rho("specfem::compute::properties::rho", nspec, ngllz, ngllx),
-        h_rho(Kokkos::create_mirror_view(rho)),
-        c11("specfem::compute::properties::c11", nspec, ngllz, ngllx),
-        h_c11(Kokkos::create_mirror_view(c11)),
-        c12("specfem::compute::properties::c12", nspec, ngllz, ngllx),
-        h_c12(Kokkos::create_mirror_view(c12)),
-        c13("specfem::compute::properties::c13", nspec, ngllz, ngllx),
-        h_c13(Kokkos::create_mirror_view(c13)),
-        c15("specfem::compute::properties::c15", nspec, ngllz, ngllx),
-        h_c15(Kokkos::create_mirror_view(c15)),
-        c33("specfem::compute::properties::c33", nspec, ngllz, ngllx),
-        h_c33(Kokkos::create_mirror_view(c33)),
-        c35("specfem::compute::properties::c35", nspec, ngllz, ngllx),
-        h_c35(Kokkos::create_mirror_view(c35)),
-        c55("specfem::compute::properties::c55", nspec, ngllz, ngllx),
-        h_c55(Kokkos::create_mirror_view(c55)),
-        c23("specfem::compute::properties::c23", nspec, ngllz, ngllx),
-        h_c23(Kokkos::create_mirror_view(c23)),
-        c25("specfem::compute::properties::c25", nspec, ngllz, ngllx),
-        h_c25(Kokkos::create_mirror_view(c25)) {}
+  properties_container(const int nspec, const int ngllz, const int ngllx,
+                       const bool per_element)
+      : nspec(nspec), ngllz(ngllz), ngllx(ngllx), per_element(per_element),
+        rho("specfem::compute::properties::rho", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_rho("specfem::compute::properties::h_rho", nspec, ngllz, ngllx),
+        c11("specfem::compute::properties::c11", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_c11("specfem::compute::properties::h_c11", nspec, ngllz, ngllx),
+        c12("specfem::compute::properties::c12", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_c12("specfem::compute::properties::h_c12", nspec, ngllz, ngllx),
+        c13("specfem::compute::properties::c13", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_c13("specfem::compute::properties::h_c13", nspec, ngllz, ngllx),
+        c15("specfem::compute::properties::c15", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_c15("specfem::compute::properties::h_c15", nspec, ngllz, ngllx),
+        c33("specfem::compute::properties::c33", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_c33("specfem::compute::properties::h_c33", nspec, ngllz, ngllx),
+        c35("specfem::compute::properties::c35", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_c35("specfem::compute::properties::h_c35", nspec, ngllz, ngllx),
+        c55("specfem::compute::properties::c55", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_c55("specfem::compute::properties::h_c55", nspec, ngllz, ngllx),
+        c23("specfem::compute::properties::c23", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_c23("specfem::compute::properties::h_c23", nspec, ngllz, ngllx),
+        c25("specfem::compute::properties::c25", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_c25("specfem::compute::properties::h_c25", nspec, ngllz, ngllx) {}
 
   template <
       typename PointProperties,
@@ -84,8 +110,8 @@ struct properties_container<specfem::element::medium_tag::elastic,
                   "Property tag mismatch");
 
     const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
+    const int iz = per_element ? 0 : index.iz;
+    const int ix = per_element ? 0 : index.ix;
 
     property.rho = rho(ispec, iz, ix);
     property.c11 = c11(ispec, iz, ix);
@@ -121,8 +147,8 @@ struct properties_container<specfem::element::medium_tag::elastic,
     using tag_type = typename simd::tag_type;
 
     const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
+    const int iz = per_element ? 0 : index.iz;
+    const int ix = per_element ? 0 : index.ix;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -232,29 +258,29 @@ struct properties_container<specfem::element::medium_tag::elastic,
   }
 
   void copy_to_device() {
-    Kokkos::deep_copy(rho, h_rho);
-    Kokkos::deep_copy(c11, h_c11);
-    Kokkos::deep_copy(c13, h_c13);
-    Kokkos::deep_copy(c15, h_c15);
-    Kokkos::deep_copy(c12, h_c12);
-    Kokkos::deep_copy(c33, h_c33);
-    Kokkos::deep_copy(c35, h_c35);
-    Kokkos::deep_copy(c55, h_c55);
-    Kokkos::deep_copy(c23, h_c23);
-    Kokkos::deep_copy(c25, h_c25);
+    impl::copy_to_device(per_element, rho, h_rho);
+    impl::copy_to_device(per_element, c11, h_c11);
+    impl::copy_to_device(per_element, c13, h_c13);
+    impl::copy_to_device(per_element, c15, h_c15);
+    impl::copy_to_device(per_element, c33, h_c33);
+    impl::copy_to_device(per_element, c35, h_c35);
+    impl::copy_to_device(per_element, c55, h_c55);
+    impl::copy_to_device(per_element, c12, h_c12);
+    impl::copy_to_device(per_element, c23, h_c23);
+    impl::copy_to_device(per_element, c25, h_c25);
   }
 
   void copy_to_host() {
-    Kokkos::deep_copy(h_rho, rho);
-    Kokkos::deep_copy(h_c11, c11);
-    Kokkos::deep_copy(h_c13, c13);
-    Kokkos::deep_copy(h_c15, c15);
-    Kokkos::deep_copy(h_c12, c12);
-    Kokkos::deep_copy(h_c33, c33);
-    Kokkos::deep_copy(h_c35, c35);
-    Kokkos::deep_copy(h_c55, c55);
-    Kokkos::deep_copy(h_c23, c23);
-    Kokkos::deep_copy(h_c25, c25);
+    impl::copy_to_host(per_element, h_rho, rho);
+    impl::copy_to_host(per_element, h_c11, c11);
+    impl::copy_to_host(per_element, h_c13, c13);
+    impl::copy_to_host(per_element, h_c15, c15);
+    impl::copy_to_host(per_element, h_c33, c33);
+    impl::copy_to_host(per_element, h_c35, c35);
+    impl::copy_to_host(per_element, h_c55, c55);
+    impl::copy_to_host(per_element, h_c12, c12);
+    impl::copy_to_host(per_element, h_c23, c23);
+    impl::copy_to_host(per_element, h_c25, c25);
   }
 
   template <
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "kokkos_abstractions.h"
+#include "medium/impl/properties_storage.hpp"
 #include "medium/properties_container.hpp"
 #include "point/interface.hpp"
 #include <Kokkos_SIMD.hpp>
@@ -16,12 +18,15 @@ struct properties_container<specfem::element::medium_tag::elastic,
   constexpr static auto property_type =
       specfem::element::property_tag::isotropic;
 
-  using ViewType = typename Kokkos::View<type_real ***, Kokkos::LayoutLeft,
-                                         Kokkos::DefaultExecutionSpace>;
+  using ViewType =
+      typename Kokkos::View<type_real ***, specfem::kokkos::ElementLayout,
+                            Kokkos::DefaultExecutionSpace>;
 
   int nspec; ///< total number of acoustic spectral elements
   int ngllz; ///< number of quadrature points in z dimension
   int ngllx; ///< number of quadrature points in x dimension
+  bool per_element = true; ///< Device views store a single value per element
+                           ///< (no GLL model)
   ViewType rho;
   ViewType::HostMirror h_rho;
   ViewType mu;
@@ -31,15 +36,22 @@ struct properties_container<specfem::element::medium_tag::elastic,
 
   properties_container() = default;
 
-  properties_container(const int nspec, const int ngllz, const int ngllx)
-      : nspec(nspec), ngllz(ngllz), ngllx(ngllx),
-        rho("specfem::compute::properties::rho", nspec, ngllz, ngllx),
-        h_rho(Kokkos::create_mirror_view(rho)),
-        mu("specfem::compute::properties::mu", nspec, ngllz, ngllx),
-        h_mu(Kokkos::create_mirror_view(mu)),
+  properties_container(const int nspec, const int ngllz, const int ngllx,
+                       const bool per_element)
+      : nspec(nspec), ngllz(ngllz), ngllx(ngllx), per_element(per_element),
+        rho("specfem::compute::properties::rho", nspec,
+            impl::device_extent(per_element, ngllz),
+            impl::device_extent(per_element, ngllx)),
+        h_rho("specfem::compute::properties::h_rho", nspec, ngllz, ngllx),
+        mu("specfem::compute::properties::mu", nspec,
+           impl::device_extent(per_element, ngllz),
+           impl::device_extent(per_element, ngllx)),
+        h_mu("specfem::compute::properties::h_mu", nspec, ngllz, ngllx),
         lambdaplus2mu("specfem::compute::properties::lambdaplus2mu", nspec,
-                      ngllz, ngllx),
-        h_lambdaplus2mu(Kokkos::create_mirror_view(lambdaplus2mu)) {}
+                      impl::device_extent(per_element, ngllz),
+                      impl::device_extent(per_element, ngllx)),
+        h_lambdaplus2mu("specfem::compute::properties::h_lambdaplus2mu", nspec,
+                        ngllz, ngllx) {}
 
   template <
       typename PointProperties,
@@ -56,8 +68,8 @@ struct properties_container<specfem::element::medium_tag::elastic,
                   "Property tag mismatch");
 
     const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
+    const int iz = per_element ? 0 : index.iz;
+    const int ix = per_element ? 0 : index.ix;
 
     property.rho = rho(ispec, iz, ix);
     property.mu = mu(ispec, iz, ix);
@@ -86,8 +98,8 @@ struct properties_container<specfem::element::medium_tag::elastic,
     using tag_type = typename simd::tag_type;
 
     const int ispec = index.ispec;
-    const int iz = index.iz;
-    const int ix = index.ix;
+    const int iz = per_element ? 0 : index.iz;
+    const int ix = per_element ? 0 : index.ix;
 
     mask_type mask([&](std::size_t lane) { return index.mask(lane); });
 
@@ -166,15 +178,15 @@ struct properties_container<specfem::element::medium_tag::elastic,
   }
 
   void copy_to_device() {
-    Kokkos::deep_copy(rho, h_rho);
-    Kokkos::deep_copy(mu, h_mu);
-    Kokkos::deep_copy(lambdaplus2mu, h_lambdaplus2mu);
+    impl::copy_to_device(per_element, rho, h_rho);
+    impl::copy_to_device(per_element, mu, h_mu);
+    impl::copy_to_device(per_element, lambdaplus2mu, h_lambdaplus2mu);
   }
 
   void copy_to_host() {
-    Kokkos::deep_copy(h_rho, rho);
-    Kokkos::deep_copy(h_mu, mu);
-    Kokkos::deep_copy(h_lambdaplus2mu, lambdaplus2mu);
+    impl::copy_to_host(per_element, h_rho, rho);
+    impl::copy_to_host(per_element, h_mu, mu);
+    impl::copy_to_host(per_element, h_lambdaplus2mu, lambdaplus2mu);
   }
 
   template <
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <Kokkos_Core.hpp>
+
+namespace specfem {
+namespace medium {
+namespace impl {
+
+/**
+ * @brief Storage helpers for material property containers
+ *
+ * Host views always store values at every quadrature point. When the
+ * properties are assigned from mesh::materials (no GLL model) the values are
+ * constant within every element and device views store a single value per
+ * element, i.e. they are allocated with extents (nspec, 1, 1). In that case
+ * only the value at the first quadrature point of every element is copied to
+ * the device.
+ */
+
+/**
+ * @brief Extent of a device view along a GLL dimension
+ *
+ * @param per_element Store a single value per element
+ * @param ngll Number of quadrature points along the dimension
+ * @return int 1 if per_element, ngll otherwise
+ */
+inline int device_extent(const bool per_element, const int ngll) {
+  return per_element ? 1 : ngll;
+}
+
+/**
+ * @brief Copy host view to the device, (re)allocating the device view to
+ * match the storage mode
+ *
+ * @param per_element Store a single value per element
+ * @param view Device view (output)
+ * @param h_view Host view with values at every quadrature point
+ */
+template <typename ViewType>
+void copy_to_device(const bool per_element, ViewType &view,
+                    const typename ViewType::HostMirror &h_view) {
+  const int nspec = h_view.extent(0);
+  const int ngllz = per_element ? 1 : h_view.extent(1);
+  const int ngllx = per_element ? 1 : h_view.extent(2);
+
+  if ((view.extent(0) != nspec) || (view.extent(1) != ngllz) ||
+      (view.extent(2) != ngllx)) {
+    view = ViewType(view.label(), nspec, ngllz, ngllx);
+  }
+
+  if (!per_element) {
+    Kokkos::deep_copy(view, h_view);
+    return;
+  }
+
+  const auto h_element = Kokkos::create_mirror_view(view);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    h_element(ispec, 0, 0) = h_view(ispec, 0, 0);
+  }
+  Kokkos::deep_copy(view, h_element);
+}
+
+/**
+ * @brief Copy device view to the host, expanding per-element values to every
+ * quadrature point
+ *
+ * @param per_element Device view stores a single value per element
+ * @param h_view Host view (output)
+ * @param view Device view
+ */
+template <typename ViewType>
+void copy_to_host(const bool per_element,
+                  const typename ViewType::HostMirror &h_view,
+                  const ViewType &view) {
+  if (!per_element) {
+    Kokkos::deep_copy(h_view, view);
+    return;
+  }
+
+  const auto h_element =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+  const int nspec = h_view.extent(0);
+  const int ngllz = h_view.extent(1);
+  const int ngllx = h_view.extent(2);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        h_view(ispec, iz, ix) = h_element(ispec, 0, 0);
+      }
+    }
+  }
+}
+
+} // namespace impl
+} // namespace medium
+} // namespace specfem
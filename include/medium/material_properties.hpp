@@ -25,7 +25,7 @@ struct material_properties
       const specfem::mesh::materials &materials, const bool has_gll_model,
       const specfem::kokkos::HostView1d<int> property_index_mapping)
       : specfem::medium::properties_container<type, property>(
-            elements.extent(0), ngllz, ngllx) {
+            elements.extent(0), ngllz, ngllx, !has_gll_model) {
 
     const int nelement = elements.extent(0);
     int count = 0;
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "enumerations/dimension.hpp"
+#include "enumerations/medium.hpp"
+#include "kokkos_abstractions.h"
+#include "point/coordinates.hpp"
+#include "point/stiffness_coefficients.hpp"
+#include <Kokkos_Core.hpp>
+#include <type_traits>
+
+namespace specfem {
+namespace medium {
+
+/**
+ * @brief Container to store fused stiffness coefficients for every quadrature
+ * point of elements of a given medium and property
+ *
+ * The coefficients are stored in a single view of dimensions (nspec, ngllz,
+ * ngllx, ncoefficients). The coefficients of a quadrature point are
+ * contiguous in memory, and the quadrature points follow @ref
+ * specfem::kokkos::ElementLayout. On GPUs a thread then reads all the
+ * coefficients of its point from consecutive addresses, and neighbouring
+ * threads read neighbouring points.
+ *
+ * With SIMD the lanes of a vector map to consecutive elements. Vector loads
+ * need the same coefficient of consecutive elements to be contiguous, so the
+ * coefficient index is the slowest index instead.
+ *
+ * @tparam type Medium tag
+ * @tparam property Property tag
+ */
+template <specfem::element::medium_tag type,
+          specfem::element::property_tag property>
+class stiffness_coefficients_container {
+public:
+  constexpr static auto value_type = type;
+  constexpr static auto property_type = property;
+  constexpr static int ncoefficients = specfem::point::stiffness_coefficients<
+      specfem::dimension::type::dim2, type, property,
+      false>::ncoefficients; ///< Number of coefficients per quadrature point
+
+  int nspec; ///< Number of elements in this container
+  int ngllz; ///< Number of quadrature points in z dimension
+  int ngllx; ///< Number of quadrature points in x dimension
+
+  using ViewType = Kokkos::View<type_real ****, Kokkos::LayoutStride,
+                                Kokkos::DefaultExecutionSpace>;
+  ViewType coefficients; ///< Fused stiffness coefficients
+  ViewType::HostMirror h_coefficients; ///< Host mirror of coefficients
+
+  stiffness_coefficients_container() = default;
+
+  stiffness_coefficients_container(const int nspec, const int ngllz,
+                                   const int ngllx)
+      : nspec(nspec), ngllz(ngllz), ngllx(ngllx),
+        coefficients("specfem::medium::stiffness_coefficients",
+                     layout(nspec, ngllz, ngllx)),
+        h_coefficients(Kokkos::create_mirror_view(coefficients)) {}
+
+  /**
+   * @brief Strides of the (ispec, iz, ix, icoefficient) coefficient view
+   *
+   */
+  static Kokkos::LayoutStride layout(const int nspec, const int ngllz,
+                                     const int ngllx) {
+#ifdef ENABLE_SIMD
+    const int npoints = nspec * ngllz * ngllx;
+    return Kokkos::LayoutStride(nspec, 1, ngllz, nspec, ngllx, nspec * ngllz,
+                                ncoefficients, npoints);
+#else
+    constexpr int nc = ncoefficients;
+    if constexpr (std::is_same_v<specfem::kokkos::ElementLayout,
+                                 Kokkos::LayoutRight>) {
+      return Kokkos::LayoutStride(nspec, ngllz * ngllx * nc, ngllz,
+                                  ngllx * nc, ngllx, nc, nc, 1);
+    } else {
+      return Kokkos::LayoutStride(nspec, nc, ngllz, nspec * nc, ngllx,
+                                  nspec * ngllz * nc, nc, 1);
+    }
+#endif
+  }
+
+  template <typename PointCoefficientsType,
+            typename std::enable_if_t<
+                !PointCoefficientsType::simd::using_simd, int> = 0>
+  KOKKOS_INLINE_FUNCTION void load_device_coefficients(
+      const specfem::point::index<PointCoefficientsType::dimension> &index,
+      PointCoefficientsType &point_coefficients) const {
+
+    static_assert(PointCoefficientsType::medium_tag == value_type);
+    static_assert(PointCoefficientsType::property_tag == property_type);
+
+    const int ispec = index.ispec;
+    const int iz = index.iz;
+    const int ix = index.ix;
+
+    for (int i = 0; i < ncoefficients; ++i) {
+      point_coefficients.coefficients[i] = coefficients(ispec, iz, ix, i);
+    }
+  }
+
+  template <typename PointCoefficientsType,
+            typename std::enable_if_t<PointCoefficientsType::simd::using_simd,
+                                      int> = 0>
+  KOKKOS_INLINE_FUNCTION void load_device_coefficients(
+      const specfem::point::simd_index<PointCoefficientsType::dimension>
+          &index,
+      PointCoefficientsType &point_coefficients) const {
+
+    static_assert(PointCoefficientsType::medium_tag == value_type);
+    static_assert(PointCoefficientsType::property_tag == property_type);
+
+    using mask_type = typename PointCoefficientsType::simd::mask_type;
+    using tag_type = typename PointCoefficientsType::simd::tag_type;
+
+    mask_type mask([&](std::size_t lane) { return index.mask(lane); });
+
+    const int ispec = index.ispec;
+    const int iz = index.iz;
+    const int ix = index.ix;
+
+    for (int i = 0; i < ncoefficients; ++i) {
+      Kokkos::Experimental::where(mask, point_coefficients.coefficients[i])
+          .copy_from(&coefficients(ispec, iz, ix, i), tag_type());
+    }
+  }
+
+  template <typename PointCoefficientsType,
+            typename std::enable_if_t<
+                !PointCoefficientsType::simd::using_simd, int> = 0>
+  void load_host_coefficients(
+      const specfem::point::index<PointCoefficientsType::dimension> &index,
+      PointCoefficientsType &point_coefficients) const {
+
+    static_assert(PointCoefficientsType::medium_tag == value_type);
+    static_assert(PointCoefficientsType::property_tag == property_type);
+
+    const int ispec = index.ispec;
+    const int iz = index.iz;
+    const int ix = index.ix;
+
+    for (int i = 0; i < ncoefficients; ++i) {
+      point_coefficients.coefficients[i] = h_coefficients(ispec, iz, ix, i);
+    }
+  }
+
+  template <typename PointCoefficientsType,
+            typename std::enable_if_t<
+                !PointCoefficientsType::simd::using_simd, int> = 0>
+  void assign(
+      const specfem::point::index<PointCoefficientsType::dimension> &index,
+      const PointCoefficientsType &point_coefficients) const {
+
+    static_assert(PointCoefficientsType::medium_tag == value_type);
+    static_assert(PointCoefficientsType::property_tag == property_type);
+
+    const int ispec = index.ispec;
+    const int iz = index.iz;
+    const int ix = index.ix;
+
+    for (int i = 0; i < ncoefficients; ++i) {
+      h_coefficients(ispec, iz, ix, i) = point_coefficients.coefficients[i];
+    }
+  }
+
+  void copy_to_host() { Kokkos::deep_copy(h_coefficients, coefficients); }
+
+  void copy_to_device() { Kokkos::deep_copy(coefficients, h_coefficients); }
+};
+
+} // namespace medium
+} // namespace specfem
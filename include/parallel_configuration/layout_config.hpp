@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Kokkos_Core.hpp>
+#include <type_traits>
+
+namespace specfem {
+namespace parallel_config {
+
+/**
+ * @brief Memory layout of arrays stored at every quadrature point.
+ *
+ * Applies to views with the spectral element index as the leading extent,
+ * i.e. (nspec, ngllz, ngllx, ...).
+ *
+ * @tparam ArrayLayout Kokkos layout used for the views.
+ */
+template <typename ArrayLayout> struct layout_config {
+  using array_layout = ArrayLayout; ///< Kokkos layout
+  constexpr static bool element_contiguous =
+      std::is_same_v<ArrayLayout, Kokkos::LayoutRight>; ///< True if the
+                                                        ///< values of an
+                                                        ///< element are
+                                                        ///< contiguous
+};
+
+/**
+ * @brief Default layout configuration based on the execution space.
+ *
+ * On GPUs, neighbouring threads of a chunk policy work on neighbouring
+ * elements. The values of consecutive elements are stored contiguously
+ * (element interleaved) such that loads are coalesced.
+ *
+ * On CPUs, a team works on a single element. The values of an element are
+ * stored contiguously (element contiguous) such that loads are unit-stride.
+ * When SIMD is enabled the lanes of a vector map to consecutive elements,
+ * which requires element interleaved storage for vector loads.
+ *
+ * @tparam ExecutionSpace Execution space for the policy.
+ */
+template <typename ExecutionSpace> struct default_layout_config;
+
+#ifdef KOKKOS_ENABLE_CUDA
+template <>
+struct default_layout_config<Kokkos::Cuda>
+    : layout_config<Kokkos::LayoutLeft> {};
+#endif
+
+#ifdef ENABLE_SIMD
+#ifdef KOKKOS_ENABLE_OPENMP
+template <>
+struct default_layout_config<Kokkos::OpenMP>
+    : layout_config<Kokkos::LayoutLeft> {};
+#endif
+
+#ifdef KOKKOS_ENABLE_SERIAL
+template <>
+struct default_layout_config<Kokkos::Serial>
+    : layout_config<Kokkos::LayoutLeft> {};
+#endif
+#else
+#ifdef KOKKOS_ENABLE_OPENMP
+template <>
+struct default_layout_config<Kokkos::OpenMP>
+    : layout_config<Kokkos::LayoutRight> {};
+#endif
+
+#ifdef KOKKOS_ENABLE_SERIAL
+template <>
+struct default_layout_config<Kokkos::Serial>
+    : layout_config<Kokkos::LayoutRight> {};
+#endif
+#endif
+
+} // namespace parallel_config
+} // namespace specfem
@@ -0,0 +1,94 @@
+#ifndef _PARAMETER_CHECKPOINT_HPP
+#define _PARAMETER_CHECKPOINT_HPP
+
+#include "IO/checkpoint/checkpoint.hpp"
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/simulation.hpp"
+#include "periodic_tasks/periodic_task.hpp"
+#include "timescheme/timescheme.hpp"
+#include "yaml-cpp/yaml.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace specfem {
+namespace runtime_configuration {
+/**
+ * @brief Runtime configuration class for checkpointing and restarting the
+ * time loop
+ *
+ */
+class checkpoint {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Construct a new checkpoint configuration object
+   *
+   * @param directory Folder where the checkpoint file is stored
+   * @param time_interval Time interval between subsequent checkpoints
+   * @param restart Restart from the checkpoint file if it exists
+   */
+  checkpoint(const std::string directory, const int time_interval,
+             const bool restart)
+      : directory(directory), time_interval(time_interval), restart(restart) {}
+
+  /**
+   * @brief Construct a new checkpoint configuration object from YAML node
+   *
+   * @param Node YAML node describing the checkpoint configuration
+   */
+  checkpoint(const YAML::Node &Node);
+  ///@}
+
+  /**
+   * @brief Instantiate a periodic task that writes checkpoints
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @param time_scheme Time scheme used by the solver
+   * @param simulation Simulation type
+   * @param task_state State accumulated by other periodic tasks
+   * @return std::shared_ptr<specfem::periodic_tasks::periodic_task> Pointer to
+   * an instantiated checkpoint task
+   */
+  std::shared_ptr<specfem::periodic_tasks::periodic_task>
+  instantiate_checkpoint(
+      const specfem::compute::assembly &assembly,
+      const std::shared_ptr<specfem::time_scheme::time_scheme> &time_scheme,
+      const specfem::simulation::type simulation,
+      const std::vector<specfem::IO::checkpoint::entry> &task_state) const;
+
+  /**
+   * @brief Restore the simulation state from the checkpoint file
+   *
+   * Does nothing if restarting is disabled or if the checkpoint file does not
+   * exist.
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @param time_scheme Time scheme used by the solver. Resumed after the
+   * completed timesteps
+   * @param simulation Simulation type
+   * @param task_state State accumulated by other periodic tasks
+   * @return true if the state was restored
+   */
+  bool restore(const specfem::compute::assembly &assembly,
+               specfem::time_scheme::time_scheme &time_scheme,
+               const specfem::simulation::type simulation,
+               const std::vector<specfem::IO::checkpoint::entry> &task_state)
+      const;
+
+private:
+  std::string get_filename() const;
+
+  std::string directory; ///< Folder where the checkpoint file is stored
+  int time_interval;     ///< Time interval between checkpoints
+  bool restart;          ///< Restart from the checkpoint file if it exists
+};
+
+} // namespace runtime_configuration
+} // namespace specfem
+
+#endif
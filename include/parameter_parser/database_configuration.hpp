@@ -23,6 +23,16 @@ public:
   database_configuration(std::string fortran_database)
       : fortran_database(fortran_database){};
 
+  /**
+   * @brief Construct a new database configuration object
+   *
+   * @param fortran_database location of fortran database
+   * @param assembly_cache location of the assembly cache file
+   */
+  database_configuration(std::string fortran_database,
+                         std::string assembly_cache)
+      : fortran_database(fortran_database), assembly_cache(assembly_cache){};
+
   /**
    * @brief Construct a new run setup object
    *
@@ -32,8 +42,17 @@ public:
 
   std::string get_databases() const { return this->fortran_database; }
 
+  /**
+   * @brief Get the location of the assembly cache
+   *
+   * @return std::string Path to the assembly cache (empty if caching is
+   * disabled)
+   */
+  std::string get_assembly_cache() const { return this->assembly_cache; }
+
 private:
   std::string fortran_database; ///< location of fortran binary database
+  std::string assembly_cache;   ///< location of assembly cache file
 };
 
 } // namespace runtime_configuration
@@ -0,0 +1,77 @@
+#ifndef _PARAMETER_ENERGY_MONITOR_HPP
+#define _PARAMETER_ENERGY_MONITOR_HPP
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/simulation.hpp"
+#include "periodic_tasks/energy_monitor.hpp"
+#include "periodic_tasks/periodic_task.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "yaml-cpp/yaml.h"
+#include <memory>
+#include <string>
+
+namespace specfem {
+namespace runtime_configuration {
+/**
+ * @brief Runtime configuration class for the energy and stability monitor
+ *
+ */
+class energy_monitor {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Construct a new energy monitor configuration object
+   *
+   * @param wavefield_type Type of wavefield to monitor. Empty to monitor the
+   * wavefield that is propagated from the sources
+   * @param time_interval Time interval between subsequent checks
+   * @param filename Path to the energy log. Empty to print to standard output
+   * @param abort_limits Limits that abort the simulation
+   */
+  energy_monitor(
+      const std::string wavefield_type, const int time_interval,
+      const std::string filename,
+      const specfem::periodic_tasks::energy_monitor::limits &abort_limits)
+      : wavefield_type(wavefield_type), time_interval(time_interval),
+        filename(filename), abort_limits(abort_limits) {}
+
+  /**
+   * @brief Construct a new energy monitor configuration object from YAML node
+   *
+   * @param Node YAML node describing the energy monitor
+   */
+  energy_monitor(const YAML::Node &Node);
+  ///@}
+
+  /**
+   * @brief Instantiate the energy monitor
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @param dt Time increment
+   * @param t0 Start time of the simulation
+   * @param simulation Simulation type
+   * @param mpi Pointer to MPI object used to abort the simulation
+   * @return std::shared_ptr<specfem::periodic_tasks::periodic_task> Pointer to
+   * an instantiated energy monitor
+   */
+  std::shared_ptr<specfem::periodic_tasks::periodic_task>
+  instantiate_energy_monitor(const specfem::compute::assembly &assembly,
+                             const type_real dt, const type_real t0,
+                             const specfem::simulation::type simulation,
+                             specfem::MPI::MPI *mpi) const;
+
+private:
+  std::string wavefield_type; ///< Type of wavefield to monitor
+  int time_interval;          ///< Time interval between checks
+  std::string filename;       ///< Path to the energy log
+  specfem::periodic_tasks::energy_monitor::limits abort_limits; ///< Limits
+};
+
+} // namespace runtime_configuration
+} // namespace specfem
+
+#endif
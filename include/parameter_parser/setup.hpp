@@ -2,7 +2,10 @@
 #define _PARAMETER_SETUP_HPP
 
 #include "IO/reader.hpp"
+#include "checkpoint.hpp"
+#include "compute/assembly/cache.hpp"
 #include "database_configuration.hpp"
+#include "energy_monitor.hpp"
 #include "header.hpp"
 #include "parameter_parser/solver/interface.hpp"
 #include "quadrature.hpp"
@@ -11,11 +14,13 @@
 #include "sources.hpp"
 #include "specfem_setup.hpp"
 #include "time_scheme/interface.hpp"
+#include "writer/ground_motion.hpp"
 #include "writer/kernel.hpp"
 #include "writer/plot_wavefield.hpp"
 #include "writer/property.hpp"
 #include "writer/seismogram.hpp"
 #include "writer/wavefield.hpp"
+#include "writer/wavefield_snapshot.hpp"
 #include "yaml-cpp/yaml.h"
 #include <memory>
 #include <tuple>
@@ -68,7 +73,7 @@ public:
   std::shared_ptr<specfem::time_scheme::time_scheme>
   instantiate_timescheme() const {
     return this->time_scheme->instantiate(
-        this->receivers->get_nstep_between_samples());
+        this->receivers->get_nstep_between_samples(), this->target_courant);
   }
   // /**
   //  * @brief Update simulation start time.
@@ -96,6 +101,13 @@ public:
    */
   type_real get_dt() const { return time_scheme->get_dt(); }
 
+  /**
+   * @brief Update the time step, keeping the simulated duration
+   *
+   * @param dt New time step
+   */
+  void update_dt(const type_real dt) { this->time_scheme->update_dt(dt); }
+
   /**
    * @brief Get the path to mesh database and source yaml file
    *
@@ -104,6 +116,23 @@ public:
    */
   std::string get_databases() const { return databases->get_databases(); }
 
+  /**
+   * @brief Instantiate the assembly cache
+   *
+   * @param quadratures Quadrature used to generate the cache key
+   * @return std::shared_ptr<specfem::compute::assembly_cache> Pointer to the
+   * cache object, nullptr if caching is disabled
+   */
+  std::shared_ptr<specfem::compute::assembly_cache> instantiate_assembly_cache(
+      const specfem::quadrature::quadratures &quadratures) const {
+    const auto filename = databases->get_assembly_cache();
+    if (filename.empty()) {
+      return nullptr;
+    }
+    return std::make_shared<specfem::compute::assembly_cache>(
+        filename, databases->get_databases(), quadratures);
+  }
+
   /**
    * @brief Get the sources YAML object
    *
@@ -180,6 +209,75 @@ public:
     }
   }
 
+  std::shared_ptr<specfem::periodic_tasks::periodic_task>
+  instantiate_wavefield_snapshot(
+      const specfem::compute::assembly &assembly) const {
+    if (this->wavefield_snapshot) {
+      return this->wavefield_snapshot->instantiate_wavefield_snapshot(
+          assembly);
+    } else {
+      return nullptr;
+    }
+  }
+
+  std::shared_ptr<specfem::periodic_tasks::periodic_task>
+  instantiate_ground_motion(const specfem::compute::assembly &assembly) const {
+    if (this->ground_motion) {
+      return this->ground_motion->instantiate_ground_motion(assembly,
+                                                            this->get_dt());
+    } else {
+      return nullptr;
+    }
+  }
+
+  std::shared_ptr<specfem::periodic_tasks::periodic_task>
+  instantiate_checkpoint(
+      const specfem::compute::assembly &assembly,
+      const std::shared_ptr<specfem::time_scheme::time_scheme> &time_scheme,
+      const std::vector<specfem::IO::checkpoint::entry> &task_state = {})
+      const {
+    if (this->checkpoint) {
+      return this->checkpoint->instantiate_checkpoint(
+          assembly, time_scheme, this->get_simulation_type(), task_state);
+    } else {
+      return nullptr;
+    }
+  }
+
+  std::shared_ptr<specfem::periodic_tasks::periodic_task>
+  instantiate_energy_monitor(const specfem::compute::assembly &assembly,
+                             specfem::MPI::MPI *mpi) const {
+    if (this->energy_monitor) {
+      return this->energy_monitor->instantiate_energy_monitor(
+          assembly, this->get_dt(), this->get_t0(), this->get_simulation_type(),
+          mpi);
+    } else {
+      return nullptr;
+    }
+  }
+
+  /**
+   * @brief Restore the simulation state from the latest checkpoint if
+   * restarting is enabled
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @param time_scheme Time scheme used by the solver
+   * @param task_state State accumulated by periodic tasks
+   * @return bool true if the state was restored
+   */
+  bool restore_checkpoint(
+      const specfem::compute::assembly &assembly,
+      specfem::time_scheme::time_scheme &time_scheme,
+      const std::vector<specfem::IO::checkpoint::entry> &task_state = {})
+      const {
+    if (this->checkpoint) {
+      return this->checkpoint->restore(assembly, time_scheme,
+                                       this->get_simulation_type(), task_state);
+    } else {
+      return false;
+    }
+  }
+
   std::shared_ptr<specfem::IO::reader> instantiate_property_reader() const {
     if (this->property) {
       return this->property->instantiate_property_reader();
@@ -215,11 +313,49 @@ public:
       const std::vector<
           std::shared_ptr<specfem::periodic_tasks::periodic_task> > &tasks)
       const {
-    return this->solver->instantiate<NGLL>(dt, assembly, time_scheme, tasks);
+    return this->solver->instantiate<NGLL>(dt, assembly, time_scheme, tasks,
+                                           this->get_nstep_between_kernels());
+  }
+
+  /**
+   * @brief Number of time steps between updates of the Frechet kernels
+   *
+   * @return int Number of time steps (1 if no kernels are written)
+   */
+  int get_nstep_between_kernels() const {
+    if (this->kernel) {
+      return this->kernel->get_nstep_between_samples();
+    } else {
+      return 1;
+    }
   }
 
   int get_nsteps() const { return this->time_scheme->get_nsteps(); }
 
+  /**
+   * @brief Whether the stiffness kernels use precomputed fused stiffness
+   * coefficients
+   *
+   * @return bool true if fused stiffness coefficients are enabled
+   */
+  bool get_fused_stiffness_coefficients() const {
+    return this->fused_stiffness_coefficients;
+  }
+
+  /**
+   * @brief Get the target Courant number used to recommend a time step
+   *
+   * @return type_real Target Courant number
+   */
+  type_real get_target_courant() const { return this->target_courant; }
+
+  /**
+   * @brief Whether the time step is set automatically from the CFL analysis
+   *
+   * @return bool true if the time step is set automatically
+   */
+  bool get_automatic_dt() const { return this->automatic_dt; }
+
 private:
   std::unique_ptr<specfem::runtime_configuration::header> header; ///< Pointer
                                                                   ///< to header
@@ -249,12 +385,24 @@ private:
   std::unique_ptr<specfem::runtime_configuration::plot_wavefield>
       plot_wavefield; ///< Pointer to
                       ///< plot_wavefield object
+  std::unique_ptr<specfem::runtime_configuration::wavefield_snapshot>
+      wavefield_snapshot; ///< Pointer to wavefield_snapshot object
+  std::unique_ptr<specfem::runtime_configuration::ground_motion>
+      ground_motion; ///< Pointer to ground_motion object
   std::unique_ptr<specfem::runtime_configuration::kernel> kernel;
   std::unique_ptr<specfem::runtime_configuration::property> property;
   std::unique_ptr<specfem::runtime_configuration::database_configuration>
       databases; ///< Get database filenames
   std::unique_ptr<specfem::runtime_configuration::solver::solver>
       solver; ///< Pointer to solver object
+  std::unique_ptr<specfem::runtime_configuration::checkpoint>
+      checkpoint; ///< Pointer to checkpoint object
+  std::unique_ptr<specfem::runtime_configuration::energy_monitor>
+      energy_monitor; ///< Pointer to energy monitor object
+  bool fused_stiffness_coefficients = false; ///< Use fused stiffness
+                                             ///< coefficients
+  type_real target_courant = 0.5; ///< Target Courant number
+  bool automatic_dt = false;      ///< Set the time step from the CFL analysis
 };
 } // namespace runtime_configuration
 } // namespace specfem
@@ -40,6 +40,9 @@ public:
    * @param assembly Assembly object
    * @param time_scheme Time scheme object
    * @param quadrature Quadrature points object
+   * @param tasks Periodic tasks
+   * @param nstep_between_kernels Number of time steps between updates of the
+   * Frechet kernels (combined simulations only)
    * @return std::shared_ptr<specfem::solver::solver> Solver object
    */
   template <int NGLL>
@@ -48,7 +51,8 @@ public:
               std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
               const std::vector<
                   std::shared_ptr<specfem::periodic_tasks::periodic_task> >
-                  &tasks) const;
+                  &tasks,
+              const int nstep_between_kernels = 1) const;
 
   /**
    * @brief Get the type of the simulation (forward or combined)
@@ -13,8 +13,8 @@ std::shared_ptr<specfem::solver::solver>
 specfem::runtime_configuration::solver::solver::instantiate(
     const type_real dt, const specfem::compute::assembly &assembly,
     std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
-    const std::vector<std::shared_ptr<specfem::periodic_tasks::periodic_task> > &tasks)
-    const {
+    const std::vector<std::shared_ptr<specfem::periodic_tasks::periodic_task> > &tasks,
+    const int nstep_between_kernels) const {
 
   if (this->simulation_type == "forward") {
     std::cout << "Instantiating Kernels \n";
@@ -40,7 +40,8 @@ specfem::runtime_configuration::solver::solver::instantiate(
     return std::make_shared<
         specfem::solver::time_marching<specfem::simulation::type::combined,
                                        specfem::dimension::type::dim2, NGLL> >(
-        assembly, adjoint_kernels, backward_kernels, time_scheme, tasks);
+        assembly, adjoint_kernels, backward_kernels, time_scheme, tasks,
+        nstep_between_kernels);
   } else {
     throw std::runtime_error("Simulation type not recognized");
   }
@@ -3,6 +3,7 @@
 #include "specfem_setup.hpp"
 #include "timescheme/newmark.hpp"
 #include "yaml-cpp/yaml.h"
+#include <cmath>
 #include <tuple>
 
 namespace specfem {
@@ -46,15 +47,32 @@ public:
     if (std::abs(this->t0) < 10 * std::numeric_limits<type_real>::epsilon())
       this->t0 = t0;
   }
+  /**
+   * @brief Update the time increment
+   *
+   * The number of time steps is updated to keep the simulated duration
+   *
+   * @param dt New time increment
+   */
+  void update_dt(const type_real dt) {
+    const double nstep = static_cast<double>(this->nstep) * this->dt / dt;
+    // Tolerance avoids an extra step due to round-off
+    this->nstep = static_cast<int>(std::ceil(nstep - 1e-6 * nstep));
+    this->dt = dt;
+  }
   /**
    * @brief Instantiate the Timescheme
    *
+   * @param nstep_between_samples Number of timesteps between seismogram
+   * samples
+   * @param target_courant Target Courant number. Used to assign elements to
+   * levels when using local time stepping
    * @return specfem::TimeScheme::TimeScheme* Pointer to the TimeScheme
    object
    * used in the solver algorithm
    */
   std::shared_ptr<specfem::time_scheme::time_scheme>
-  instantiate(const int nstep_between_samples);
+  instantiate(const int nstep_between_samples, const type_real target_courant);
   /**
    * @brief Get the value of time increment
    *
@@ -71,6 +89,7 @@ private:
   type_real dt;           ///< delta time for the timescheme
   type_real t0 = 0.0;     ///< start time
   std::string timescheme; ///< Time scheme e.g. Newmark, Runge-Kutta, LDDRK
+  int max_levels = 4;     ///< Maximum number of local time stepping levels
   specfem::simulation::type type;
 };
 } // namespace time_scheme
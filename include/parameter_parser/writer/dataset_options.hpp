@@ -0,0 +1,27 @@
+#pragma once
+
+#include "IO/dataset_options.hpp"
+#include "yaml-cpp/yaml.h"
+
+namespace specfem {
+namespace runtime_configuration {
+
+/**
+ * @brief Parse the storage options of the datasets written by a writer
+ *
+ * The options are read from the optional compression node of the writer:
+ *
+ * @code{.yaml}
+ * compression:
+ *   filter: shuffle-deflate # none, deflate or shuffle-deflate
+ *   level: 4                # deflate level (1-9)
+ *   chunk-size: 1048576     # target chunk size in bytes
+ * @endcode
+ *
+ * @param Node YAML node describing the writer
+ * @return specfem::IO::dataset_options Dataset storage options
+ */
+specfem::IO::dataset_options parse_dataset_options(const YAML::Node &Node);
+
+} // namespace runtime_configuration
+} // namespace specfem
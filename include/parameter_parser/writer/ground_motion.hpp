@@ -0,0 +1,65 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "periodic_tasks/periodic_task.hpp"
+#include "yaml-cpp/yaml.h"
+#include <string>
+
+namespace specfem {
+namespace runtime_configuration {
+/**
+ * @brief Runtime configuration class for instantiating the ground motion map
+ * writer
+ *
+ */
+class ground_motion {
+
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Construct a new ground motion configuration object
+   *
+   * @param output_format output format of the maps (HDF5, ASCII, binary)
+   * @param output_folder path to the folder where the maps will be stored
+   * @param wavefield_type type of wavefield to reduce (forward, adjoint,
+   * backward)
+   * @param time_interval time interval between subsequent updates
+   */
+  ground_motion(const std::string output_format,
+                const std::string output_folder,
+                const std::string wavefield_type, const int time_interval)
+      : output_format(output_format), output_folder(output_folder),
+        wavefield_type(wavefield_type), time_interval(time_interval) {}
+
+  /**
+   * @brief Construct a new ground motion configuration object from YAML node
+   *
+   * @param Node YAML node describing the ground motion configuration
+   */
+  ground_motion(const YAML::Node &Node);
+  ///@}
+
+  /**
+   * @brief Instantiate a ground motion map writer
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @param dt Time increment
+   * @return std::shared_ptr<specfem::periodic_tasks::periodic_task> Pointer to
+   * an instantiated ground motion map writer
+   */
+  std::shared_ptr<specfem::periodic_tasks::periodic_task>
+  instantiate_ground_motion(const specfem::compute::assembly &assembly,
+                            const type_real dt) const;
+
+private:
+  std::string output_format;  ///< format of output file
+  std::string output_folder;  ///< Path to output folder
+  std::string wavefield_type; ///< Type of wavefield to reduce
+  int time_interval;          ///< Time interval between updates
+};
+} // namespace runtime_configuration
+} // namespace specfem
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "enumerations/simulation.hpp"
+#include "IO/dataset_options.hpp"
 #include "IO/reader.hpp"
 #include "IO/writer.hpp"
 #include "yaml-cpp/yaml.h"
@@ -10,9 +11,12 @@ namespace runtime_configuration {
 class kernel {
 public:
   kernel(const std::string output_format, const std::string output_folder,
-         const specfem::simulation::type type)
+         const specfem::simulation::type type,
+         const specfem::IO::dataset_options &options = {},
+         const int nstep_between_samples = 1)
       : output_format(output_format), output_folder(output_folder),
-        simulation_type(type) {}
+        simulation_type(type), options(options),
+        nstep_between_samples(nstep_between_samples) {}
 
   kernel(const YAML::Node &Node, const specfem::simulation::type type);
 
@@ -22,10 +26,21 @@ public:
     return this->simulation_type;
   }
 
+  /**
+   * @brief Number of time steps between updates of the kernels
+   *
+   */
+  inline int get_nstep_between_samples() const {
+    return this->nstep_between_samples;
+  }
+
 private:
   std::string output_format;                 ///< format of output file
   std::string output_folder;                 ///< Path to output folder
   specfem::simulation::type simulation_type; ///< Type of simulation
+  specfem::IO::dataset_options options;      ///< Dataset storage options
+  int nstep_between_samples;                 ///< Number of time steps between
+                                             ///< kernel updates
 };
 } // namespace runtime_configuration
 } // namespace specfem
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "IO/dataset_options.hpp"
 #include "IO/reader.hpp"
 #include "IO/writer.hpp"
 #include "yaml-cpp/yaml.h"
@@ -9,9 +10,10 @@ namespace runtime_configuration {
 class property {
 public:
   property(const std::string output_format, const std::string output_folder,
-           const bool write_mode)
+           const bool write_mode,
+           const specfem::IO::dataset_options &options = {})
       : output_format(output_format), output_folder(output_folder),
-        write_mode(write_mode) {}
+        write_mode(write_mode), options(options) {}
 
   property(const YAML::Node &Node, const bool write_mode);
 
@@ -20,9 +22,10 @@ public:
   std::shared_ptr<specfem::IO::reader> instantiate_property_reader() const;
 
 private:
-  bool write_mode;           ///< True if writing, false if reading
-  std::string output_format; ///< format of output file
-  std::string output_folder; ///< Path to output folder
+  bool write_mode;                      ///< True if writing, false if reading
+  std::string output_format;            ///< format of output file
+  std::string output_folder;            ///< Path to output folder
+  specfem::IO::dataset_options options; ///< Dataset storage options
 };
 } // namespace runtime_configuration
 } // namespace specfem
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "IO/dataset_options.hpp"
+#include "compute/assembly/assembly.hpp"
+#include "periodic_tasks/periodic_task.hpp"
+#include "yaml-cpp/yaml.h"
+#include <string>
+
+namespace specfem {
+namespace runtime_configuration {
+/**
+ * @brief Runtime configuration class for instantiating wavefield snapshot
+ * writer
+ *
+ */
+class wavefield_snapshot {
+
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Construct a new wavefield snapshot configuration object
+   *
+   * @param output_format output format of the snapshots (HDF5, binary)
+   * @param output_folder path to the folder where the snapshots will be stored
+   * @param wavefield_type type of wavefield to write (forward, adjoint,
+   * backward)
+   * @param time_interval time interval between subsequent snapshots
+   * @param nbuffers number of host staging buffers
+   * @param options chunking and compression options of the HDF5 datasets
+   */
+  wavefield_snapshot(const std::string output_format,
+                     const std::string output_folder,
+                     const std::string wavefield_type,
+                     const int time_interval, const int nbuffers,
+                     const specfem::IO::dataset_options &options = {})
+      : output_format(output_format), output_folder(output_folder),
+        wavefield_type(wavefield_type), time_interval(time_interval),
+        nbuffers(nbuffers), options(options) {}
+
+  /**
+   * @brief Construct a new wavefield snapshot configuration object from YAML
+   * node
+   *
+   * @param Node YAML node describing the snapshot configuration
+   */
+  wavefield_snapshot(const YAML::Node &Node);
+  ///@}
+
+  /**
+   * @brief Instantiate a wavefield snapshot writer
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @return std::shared_ptr<specfem::periodic_tasks::periodic_task> Pointer to
+   * an instantiated snapshot writer
+   */
+  std::shared_ptr<specfem::periodic_tasks::periodic_task>
+  instantiate_wavefield_snapshot(
+      const specfem::compute::assembly &assembly) const;
+
+private:
+  std::string output_format;  ///< format of output file
+  std::string output_folder;  ///< Path to output folder
+  std::string wavefield_type; ///< Type of wavefield to write
+  int time_interval;          ///< Time interval between snapshots
+  int nbuffers;               ///< Number of host staging buffers
+  specfem::IO::dataset_options options; ///< Dataset storage options
+};
+} // namespace runtime_configuration
+} // namespace specfem
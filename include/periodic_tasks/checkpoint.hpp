@@ -0,0 +1,102 @@
+#pragma once
+
+#include "IO/checkpoint/checkpoint.hpp"
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/simulation.hpp"
+#include "periodic_task.hpp"
+#include "timescheme/timescheme.hpp"
+#include <Kokkos_Core.hpp>
+#include <boost/filesystem.hpp>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace specfem {
+namespace periodic_tasks {
+/**
+ * @brief Periodically write a checkpoint of the simulation state
+ *
+ * The state (see @ref specfem::IO::checkpoint) is copied into a host staging
+ * buffer, allocated in pinned memory when the backend provides it, and
+ * written to disk by a background thread while the time loop continues. The
+ * time loop waits only if the previous checkpoint is still being written.
+ *
+ * Only the latest checkpoint is kept. Use @ref specfem::IO::checkpoint::read
+ * and @ref specfem::time_scheme::time_scheme::resume to restart from it.
+ */
+class checkpoint : public periodic_task {
+public:
+  /**
+   * @brief Construct a new checkpoint task
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @param time_scheme Time scheme used by the solver
+   * @param simulation Simulation type
+   * @param time_interval Time interval between subsequent checkpoints
+   * @param filename Path to the checkpoint file
+   * @param task_state State accumulated by other periodic tasks
+   */
+  checkpoint(const specfem::compute::assembly &assembly,
+             const std::shared_ptr<specfem::time_scheme::time_scheme>
+                 &time_scheme,
+             const specfem::simulation::type simulation,
+             const int time_interval, const boost::filesystem::path &filename,
+             const std::vector<specfem::IO::checkpoint::entry> &task_state =
+                 {});
+
+  /**
+   * @brief Waits for a pending checkpoint to be written
+   *
+   */
+  ~checkpoint() override;
+
+  /**
+   * @brief Copy the simulation state and queue it for writing
+   *
+   * @throws std::runtime_error if writing the previous checkpoint failed
+   */
+  void run() override;
+
+  /**
+   * @brief Wait for the pending checkpoint to be written
+   *
+   * @throws std::runtime_error if writing the checkpoint failed
+   */
+  void finalize() override;
+
+private:
+#ifdef KOKKOS_HAS_SHARED_HOST_PINNED_SPACE
+  using StagingMemSpace = Kokkos::SharedHostPinnedSpace;
+#else
+  using StagingMemSpace = specfem::kokkos::HostMemSpace;
+#endif
+
+  using StagingView = Kokkos::View<type_real *, StagingMemSpace>;
+
+  void write_loop();
+  void rethrow_error();
+
+  std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme; ///< Time
+                                                                  ///< scheme
+  const specfem::simulation::type simulation;  ///< Simulation type
+  const boost::filesystem::path filename;      ///< Path to checkpoint file
+  std::vector<specfem::IO::checkpoint::entry> state; ///< State on the device
+  std::vector<StagingView> staging; ///< Host copy of the state
+  specfem::IO::checkpoint::header progress; ///< Progress of the staged copy
+
+  std::mutex mutex;                      ///< Guards the flags below
+  std::condition_variable staging_free;  ///< Signalled when the staged copy
+                                         ///< has been written
+  std::condition_variable staging_ready; ///< Signalled when a copy is staged
+                                         ///< or on shutdown
+  bool pending = false;                  ///< A staged copy is being written
+  bool finished = false;                 ///< Shut down the writer thread
+  std::exception_ptr error;              ///< Error raised by the writer
+
+  std::thread writer; ///< Background writer thread
+};
+} // namespace periodic_tasks
+} // namespace specfem
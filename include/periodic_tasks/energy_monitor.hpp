@@ -0,0 +1,106 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+#include "periodic_task.hpp"
+#include "specfem_mpi/interface.hpp"
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <ostream>
+#include <string>
+
+namespace specfem {
+namespace periodic_tasks {
+/**
+ * @brief Monitor the energy of a wavefield and abort unstable simulations
+ *
+ * At every check the following quantities are computed with reductions on the
+ * device, so only a few scalars are copied to the host:
+ *  - kinetic energy: \f$ \frac{1}{2} \dot{u}^T M \dot{u} \f$ within elastic
+ *    media and \f$ \frac{1}{2\rho} | \nabla \chi |^2 \f$ within acoustic media.
+ *    \f$ M \f$ is the mass matrix of the medium, without the terms added by
+ *    absorbing boundaries
+ *  - potential energy: \f$ \frac{1}{2} \int \sigma : \nabla u \f$ within
+ *    elastic media and \f$ \frac{1}{2\kappa} \dot{\chi}^2 \f$ within acoustic
+ *    media
+ *  - maximum magnitude of the displacement (elastic) and of the potential
+ *    (acoustic)
+ *  - number of degrees of freedom with NaN or Inf values
+ *
+ * Every check appends one line to the energy log. The simulation is aborted
+ * using @ref specfem::MPI::MPI::exit if a non-finite value is found or if a
+ * limit is exceeded.
+ */
+class energy_monitor : public periodic_task {
+public:
+  /**
+   * @brief Limits that abort the simulation when exceeded. A limit is
+   * disabled when set to 0
+   *
+   */
+  struct limits {
+    type_real max_field = 0.0;     ///< Maximum magnitude of the field
+    type_real max_energy = 0.0;    ///< Maximum total energy
+    type_real energy_growth = 0.0; ///< Maximum ratio of the total energy
+                                   ///< between subsequent checks
+  };
+
+  /**
+   * @brief Construct a new energy monitor
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @param wavefield Type of wavefield to monitor (forward, adjoint, etc.)
+   * @param time_interval Time interval between subsequent checks
+   * @param dt Time increment
+   * @param t0 Start time of the simulation
+   * @param abort_limits Limits that abort the simulation
+   * @param filename Path to the energy log. The log is printed to standard
+   * output if empty
+   * @param mpi Pointer to MPI object used to abort the simulation
+   */
+  energy_monitor(const specfem::compute::assembly &assembly,
+                 const specfem::wavefield::simulation_field &wavefield,
+                 const int &time_interval, const type_real &dt,
+                 const type_real &t0, const limits &abort_limits,
+                 const boost::filesystem::path &filename,
+                 specfem::MPI::MPI *mpi);
+
+  /**
+   * @brief Compute the energy and check the limits
+   *
+   */
+  void run() override;
+
+private:
+  /**
+   * @brief Energy of the wavefield at a single timestep
+   *
+   */
+  struct sample {
+    type_real kinetic = 0.0;           ///< Kinetic energy
+    type_real potential = 0.0;         ///< Potential energy
+    type_real max_displacement = 0.0;  ///< Maximum displacement (elastic)
+    type_real max_potential = 0.0;     ///< Maximum potential (acoustic)
+    int nonfinite = 0;                 ///< Number of non-finite values
+  };
+
+  sample compute() const;
+  template <specfem::wavefield::simulation_field WavefieldType>
+  sample compute() const;
+  void abort(const std::string &reason);
+
+  const specfem::wavefield::simulation_field wavefield; ///< Type of wavefield
+                                                        ///< to monitor
+  const type_real dt;        ///< Time increment
+  const type_real t0;        ///< Start time of the simulation
+  const limits abort_limits; ///< Limits that abort the simulation
+  specfem::compute::assembly assembly; ///< Assembly object
+  specfem::MPI::MPI *mpi;              ///< MPI object
+
+  std::ofstream file;           ///< Energy log. Unused if writing to stdout
+  std::ostream *log;            ///< Stream for the energy log
+  type_real previous_energy = 0.0; ///< Total energy at the previous check
+};
+} // namespace periodic_tasks
+} // namespace specfem
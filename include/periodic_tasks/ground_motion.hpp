@@ -0,0 +1,117 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+#include "periodic_task.hpp"
+#include <Kokkos_Core.hpp>
+#include <boost/filesystem.hpp>
+#include <vector>
+
+namespace specfem {
+namespace periodic_tasks {
+/**
+ * @brief Computes peak ground motion and Arias intensity maps in-situ
+ *
+ * Running maxima and time integrals of a wavefield are kept on the device
+ * for every global point of the elastic and acoustic media, in the ordering
+ * of the fields (@ref specfem::compute::impl::field_impl). The maps are
+ * updated by a single kernel every @c time_interval steps and written once,
+ * after the last time step, through the IO library.
+ *
+ * Within elastic media:
+ *  - PGD : peak magnitude of the displacement
+ *  - PGV : peak magnitude of the velocity
+ *  - PGA : peak magnitude of the acceleration
+ *  - Arias intensity : \f$ \frac{\pi}{2g} \int |\ddot{u}|^2 dt \f$
+ *
+ * Within acoustic media the fields are a potential \f$ \chi \f$, which has
+ * no ground motion or Arias intensity. Only the peaks are stored:
+ *  - PeakPotential : peak of \f$ |\chi| \f$
+ *  - PeakPotentialDot : peak of \f$ |\dot{\chi}| \f$
+ *  - PeakPressure : peak of \f$ |p| = |\ddot{\chi}| \f$
+ *
+ * Peaks are taken over the sampled time steps and the Arias integral uses
+ * the rectangle rule with a weight of @c time_interval * dt per sample, so
+ * both are exact only when the maps are updated every time step. The maps are
+ * stored in checkpoints (see @ref get_checkpoint_state).
+ *
+ * The maps are written to the file `GroundMotion` within the output folder.
+ * The group `/Elastic` holds the datasets `Coordinates` (nglob, 2), `PGD`,
+ * `PGV`, `PGA` and `AriasIntensity` (nglob). The group `/Acoustic` holds the
+ * datasets `Coordinates`, `PeakPotential`, `PeakPotentialDot` and
+ * `PeakPressure`.
+ */
+class ground_motion : public periodic_task {
+public:
+  /**
+   * @brief Output format of the maps
+   *
+   */
+  enum class format { HDF5, ASCII, binary };
+
+  /**
+   * @brief Construct a new ground motion task
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @param wavefield Type of wavefield to reduce (forward, adjoint, etc.)
+   * @param output_format Output format of the maps
+   * @param time_interval Time interval between subsequent updates
+   * @param dt Time increment
+   * @param output_folder Path to output folder where the maps will be stored
+   */
+  ground_motion(const specfem::compute::assembly &assembly,
+                const specfem::wavefield::simulation_field &wavefield,
+                const format &output_format, const int &time_interval,
+                const type_real &dt,
+                const boost::filesystem::path &output_folder);
+
+  /**
+   * @brief Update the maps with the current wavefield
+   *
+   */
+  void run() override;
+
+  /**
+   * @brief Write the maps. Only the first call writes to disk
+   *
+   */
+  void finalize() override;
+
+  /**
+   * @brief Maps accumulated so far, stored in checkpoints
+   *
+   * @return std::vector<specfem::IO::checkpoint::entry> Elastic and acoustic
+   * maps
+   */
+  std::vector<specfem::IO::checkpoint::entry>
+  get_checkpoint_state() const override;
+
+private:
+  using FieldView = specfem::compute::impl::FieldViewType;
+  using MapView = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>;
+
+  constexpr static int nfields = 3;        ///< field, field_dot, field_dot_dot
+  constexpr static int nelastic_maps = 4;  ///< PGD, PGV, PGA, Arias intensity
+  constexpr static int nacoustic_maps = 3; ///< Peak potential, peak potential
+                                           ///< derivative, peak pressure
+
+  template <typename OutputLibrary> void write() const;
+
+  const format output_format;                  ///< Output format
+  const type_real dt;                          ///< Time increment
+  const boost::filesystem::path output_folder; ///< Path to output folder
+  specfem::compute::assembly assembly;         ///< Assembly object
+
+  FieldView elastic[nfields];  ///< Elastic fields on the device
+  FieldView acoustic[nfields]; ///< Acoustic fields on the device
+
+  MapView elastic_maps;  ///< Maps within the elastic medium
+                         ///< (nglob, nelastic_maps)
+  MapView acoustic_maps; ///< Maps within the acoustic medium
+                         ///< (nglob, nacoustic_maps)
+
+  bool written = false; ///< Maps have been written
+};
+} // namespace periodic_tasks
+} // namespace specfem
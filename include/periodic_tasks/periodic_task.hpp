@@ -1,5 +1,8 @@
 #pragma once
 
+#include "IO/checkpoint/checkpoint.hpp"
+#include <vector>
+
 namespace specfem {
 namespace periodic_tasks {
 /**
@@ -15,12 +18,32 @@ public:
    */
   periodic_task(const int time_interval) : time_interval(time_interval){};
 
+  virtual ~periodic_task() = default;
+
   /**
    * @brief Method to plot the data
    *
    */
   virtual void run(){};
 
+  /**
+   * @brief Method called once after the last timestep. Tasks that defer work
+   * (e.g. to a background thread) should complete it here
+   *
+   */
+  virtual void finalize(){};
+
+  /**
+   * @brief State accumulated by the task over the time loop. The state is
+   * stored in checkpoints along with the simulation state
+   *
+   * @return std::vector<specfem::IO::checkpoint::entry> Entries of the state
+   */
+  virtual std::vector<specfem::IO::checkpoint::entry>
+  get_checkpoint_state() const {
+    return {};
+  }
+
   /**
    * @brief Returns true if the data should be plotted at the current
    * timestep. Updates the internal timestep counter
@@ -5,14 +5,30 @@
 #include "enumerations/wavefield.hpp"
 #include "plotter.hpp"
 #include <boost/filesystem.hpp>
-#ifdef NO_VTK
-#include <sstream>
-#endif
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace specfem {
 namespace periodic_tasks {
 /**
  * @brief Writer to plot the wavefield
+ *
+ * The VTK pipeline (mesh geometry, lookup table, mapper, renderer and
+ * off-screen render window) is built once at construction. At every plot
+ * step the solver thread only copies the field used to compute the plotted
+ * component into one of a fixed number of frame buffers. A background thread
+ * computes the magnitude of the component at the plotting nodes from that
+ * copy, on the host, then renders and encodes the image. The time loop waits
+ * only when every frame buffer is still waiting to be rendered.
+ *
+ * Plots are always rendered off-screen, hence the on_screen format is not
+ * supported.
  */
 class plot_wavefield : public plotter {
 public:
@@ -20,45 +36,71 @@ public:
    * @brief Construct a new plotter object
    *
    * @param assembly SPECFFEM++ assembly object
-   * @param output_format Output format of the plot (PNG, JPG, etc.)
+   * @param output_format Output format of the plot (PNG, JPG)
    * @param component Component of the wavefield to plot (displacement,
    * velocity, etc.)
    * @param wavefield Type of wavefield to plot (forward, adjoint, etc.)
    * @param time_interval Time interval between subsequent plots
    * @param output_folder Path to output folder where plots will be stored
+   * @param nbuffers Number of frame buffers
+   * @throws std::runtime_error if SPECFEM++ was built without VTK or if the
+   * output format is on_screen
    */
   plot_wavefield(const specfem::compute::assembly &assembly,
                  const specfem::display::format &output_format,
                  const specfem::display::wavefield &component,
                  const specfem::wavefield::simulation_field &wavefield,
                  const int &time_interval,
-                 const boost::filesystem::path &output_folder)
-      : plotter(time_interval), output_format(output_format),
-        component(component), output_folder(output_folder),
-        wavefield(wavefield), assembly(assembly) {
-#ifdef NO_VTK
-    std::ostringstream message;
-    message << "Display section is not enabled, since SPECFEM++ was built "
-               "without VTK\n"
-            << "Please install VTK and rebuild SPECFEM++ with "
-               "-DVTK_DIR=/path/to/vtk";
-    throw std::runtime_error(message.str());
-#endif
-  }
+                 const boost::filesystem::path &output_folder,
+                 const int nbuffers = 2);
+
+  /**
+   * @brief Waits for pending frames to be rendered
+   *
+   */
+  ~plot_wavefield() override;
 
   /**
    * @brief Plot the wavefield
    *
+   * @throws std::runtime_error if rendering a previous frame failed
    */
   void run() override;
 
+  /**
+   * @brief Wait for all queued frames to be rendered
+   *
+   * @throws std::runtime_error if rendering a frame failed
+   */
+  void finalize() override;
+
 private:
+  struct pipeline; ///< VTK objects reused across frames
+  struct frame;    ///< Frame buffer: wavefield copy and point scalars
+
+  void render_loop();
+  void rethrow_error();
+
   const specfem::display::format output_format; ///< Output format of the plot
   const specfem::display::wavefield component;  ///< Component of the wavefield
   const specfem::wavefield::simulation_field wavefield; ///< Type of wavefield
                                                         ///< to plot
   const boost::filesystem::path output_folder; ///< Path to output folder
   specfem::compute::assembly assembly;         ///< Assembly object
+
+  std::unique_ptr<pipeline> vtk_pipeline; ///< Persistent VTK pipeline
+  std::vector<frame> frames;               ///< Frame buffers
+
+  std::mutex mutex;                       ///< Guards the queues below
+  std::condition_variable frame_free;     ///< Signalled when a frame is free
+  std::condition_variable frame_ready;    ///< Signalled when a frame is
+                                          ///< queued or on shutdown
+  std::queue<int> free_frames;            ///< Frames available for copying
+  std::queue<std::pair<int, int> > pending; ///< (istep, frame) to render
+  bool finished = false;                    ///< Shut down the render thread
+  std::exception_ptr error;                 ///< Error raised while rendering
+
+  std::thread renderer; ///< Background render thread
 };
 } // namespace periodic_tasks
 } // namespace specfem
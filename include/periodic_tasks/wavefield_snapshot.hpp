@@ -0,0 +1,137 @@
+#pragma once
+
+#include "IO/dataset_options.hpp"
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+#include "periodic_task.hpp"
+#include <Kokkos_Core.hpp>
+#include <boost/filesystem.hpp>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace specfem {
+namespace periodic_tasks {
+/**
+ * @brief Writes snapshots of a wavefield to disk without stalling the time
+ * loop
+ *
+ * At every snapshot step the fields are copied into one of a fixed number of
+ * host staging buffers (allocated in pinned memory when the backend provides
+ * it). The buffer is then handed to a background thread which writes it to
+ * disk while the solver computes the next timesteps. The time loop only
+ * blocks when every staging buffer is waiting to be written.
+ *
+ * Every snapshot is written to a separate file named
+ * `Snapshot<istep>` within the output folder:
+ *  - HDF5 : `Snapshot<istep>.h5` with the datasets
+ *    `/Elastic/{Displacement,Velocity,Acceleration}` and
+ *    `/Acoustic/{Potential,PotentialDot,PotentialDotDot}`. The datasets are
+ *    chunked and compressed according to the dataset options
+ *  - Binary : `Snapshot<istep>.bin` with the same fields as raw `type_real`
+ *    values, in the order listed above. Every field is stored column-major
+ *    with dimensions (nglob, components) of the corresponding medium.
+ */
+class wavefield_snapshot : public periodic_task {
+public:
+  /**
+   * @brief Output format of the snapshots
+   *
+   */
+  enum class format { HDF5, binary };
+
+  /**
+   * @brief Construct a new wavefield snapshot writer
+   *
+   * @param assembly SPECFEM++ assembly object
+   * @param wavefield Type of wavefield to write (forward, adjoint, etc.)
+   * @param output_format Output format of the snapshots
+   * @param time_interval Time interval between subsequent snapshots
+   * @param output_folder Path to output folder where snapshots will be stored
+   * @param nbuffers Number of staging buffers. 2 results in double buffering
+   * @param options Chunking and compression options of the HDF5 datasets
+   */
+  wavefield_snapshot(const specfem::compute::assembly &assembly,
+                     const specfem::wavefield::simulation_field &wavefield,
+                     const format &output_format, const int &time_interval,
+                     const boost::filesystem::path &output_folder,
+                     const int nbuffers = 2,
+                     const specfem::IO::dataset_options &options = {});
+
+  /**
+   * @brief Waits for pending snapshots to be written
+   *
+   */
+  ~wavefield_snapshot() override;
+
+  /**
+   * @brief Copy the wavefield into a staging buffer and queue it for writing
+   *
+   * @throws std::runtime_error if writing a previous snapshot failed
+   */
+  void run() override;
+
+  /**
+   * @brief Wait for all queued snapshots to be written
+   *
+   * @throws std::runtime_error if writing a snapshot failed
+   */
+  void finalize() override;
+
+private:
+#ifdef KOKKOS_HAS_SHARED_HOST_PINNED_SPACE
+  using StagingMemSpace = Kokkos::SharedHostPinnedSpace;
+#else
+  using StagingMemSpace = specfem::kokkos::HostMemSpace;
+#endif
+
+  using FieldView = specfem::compute::impl::FieldViewType;
+  using StagingView =
+      Kokkos::View<type_real **, Kokkos::LayoutLeft, StagingMemSpace>;
+
+  constexpr static int nfields = 3; ///< field, field_dot, field_dot_dot
+
+  /**
+   * @brief Host copy of the wavefield at a single timestep
+   *
+   */
+  struct staging_buffer {
+    StagingView elastic[nfields];  ///< Elastic fields
+    StagingView acoustic[nfields]; ///< Acoustic fields
+  };
+
+  void write_loop();
+  void write(const int istep, const staging_buffer &buffer) const;
+  void write_hdf5(const int istep, const staging_buffer &buffer) const;
+  void write_binary(const int istep, const staging_buffer &buffer) const;
+  void rethrow_error();
+
+  const specfem::wavefield::simulation_field wavefield; ///< Type of wavefield
+                                                        ///< to write
+  const format output_format;                  ///< Output format
+  const boost::filesystem::path output_folder; ///< Path to output folder
+  const specfem::IO::dataset_options options;  ///< HDF5 dataset options
+
+  FieldView elastic[nfields];  ///< Elastic fields on the device
+  FieldView acoustic[nfields]; ///< Acoustic fields on the device
+
+  std::vector<staging_buffer> buffers; ///< Staging buffers
+
+  std::mutex mutex;                       ///< Guards the queues below
+  std::condition_variable buffer_free;    ///< Signalled when a buffer is free
+  std::condition_variable snapshot_ready; ///< Signalled when a snapshot is
+                                          ///< queued or on shutdown
+  std::queue<int> free_buffers;           ///< Buffers available for copying
+  std::queue<std::pair<int, int> > pending; ///< (istep, buffer) to write
+  bool finished = false;                    ///< Shut down the writer thread
+  std::exception_ptr error;                 ///< Error raised by the writer
+
+  std::thread writer; ///< Background writer thread
+};
+} // namespace periodic_tasks
+} // namespace specfem
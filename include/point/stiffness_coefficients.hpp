@@ -0,0 +1,115 @@
+#pragma once
+
+#include "datatypes/point_view.hpp"
+#include "datatypes/simd.hpp"
+#include "enumerations/dimension.hpp"
+#include "enumerations/medium.hpp"
+#include <Kokkos_Core.hpp>
+
+namespace specfem {
+namespace point {
+
+/**
+ * @brief Fused stiffness coefficients at a quadrature point
+ *
+ * The coefficients map the gradient of the field in the reference element
+ * \f$ g_{b,j} = \partial_{\xi_b} u_j \f$ directly to the stress integrand
+ * \f$ F_{a,c} = \sum_{k} \sigma_{k,c} \partial_{x_k} \xi_a \f$ i.e. they fold
+ * the partial derivatives of the basis functions and the material properties
+ * into a single symmetric matrix \f$ K \f$ such that
+ * \f$ F_{a,c} = \sum_{b,j} K_{(a,c),(b,j)} g_{b,j} \f$. Only the upper
+ * triangle of \f$ K \f$ is stored (row-major).
+ *
+ * @tparam DimensionType Dimension of the element where the quadrature point is
+ * located
+ * @tparam MediumTag Medium of the element where the quadrature point is located
+ * @tparam PropertyTag Property of the element where the quadrature point is
+ * located
+ * @tparam UseSIMD Use SIMD instructions
+ */
+template <specfem::dimension::type DimensionType,
+          specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag, bool UseSIMD>
+struct stiffness_coefficients {
+  /**
+   * @name Compile time constants
+   *
+   */
+  ///@{
+  constexpr static auto dimension = DimensionType; ///< Dimension of the element
+  constexpr static auto medium_tag = MediumTag;    ///< Medium tag
+  constexpr static auto property_tag = PropertyTag; ///< Property tag
+  constexpr static int components =
+      specfem::element::attributes<DimensionType, MediumTag>::components();
+  constexpr static int num_dimensions =
+      specfem::element::attributes<DimensionType, MediumTag>::dimension();
+  constexpr static int size =
+      num_dimensions * components; ///< Number of rows of \f$ K \f$
+  constexpr static int ncoefficients =
+      size * (size + 1) / 2; ///< Number of stored coefficients
+  ///@}
+
+  /**
+   * @name Typedefs
+   *
+   */
+  ///@{
+  using simd = specfem::datatype::simd<type_real, UseSIMD>; ///< SIMD type
+  using value_type =
+      typename simd::datatype; ///< Underlying data type to store coefficients
+  using ViewType =
+      specfem::datatype::VectorPointViewType<type_real, num_dimensions,
+                                             components,
+                                             UseSIMD>; ///< Type of the
+                                                       ///< gradient and the
+                                                       ///< stress integrand
+  ///@}
+
+  value_type coefficients[ncoefficients]; ///< Upper triangle of \f$ K \f$
+
+  /**
+   * @brief Index within the packed storage of the element (row, col) of the
+   * upper triangle (row <= col)
+   */
+  KOKKOS_INLINE_FUNCTION constexpr static int packed_index(const int row,
+                                                           const int col) {
+    return row * size - (row * (row - 1)) / 2 + (col - row);
+  }
+
+  /**
+   * @brief Element (row, col) of the coefficient matrix
+   */
+  KOKKOS_INLINE_FUNCTION const value_type &operator()(const int row,
+                                                      const int col) const {
+    return (row <= col) ? coefficients[packed_index(row, col)]
+                        : coefficients[packed_index(col, row)];
+  }
+
+  /**
+   * @brief Compute the stress integrand from the gradient of the field in the
+   * reference element
+   *
+   * @param dg Gradient of the field in the reference element
+   * @return ViewType Stress integrand \f$ F \f$
+   */
+  KOKKOS_INLINE_FUNCTION ViewType operator*(const ViewType &dg) const {
+    ViewType F(static_cast<value_type>(0.0));
+
+    for (int a = 0; a < num_dimensions; ++a) {
+      for (int c = 0; c < components; ++c) {
+        const int row = a * components + c;
+        for (int b = 0; b < num_dimensions; ++b) {
+          for (int j = 0; j < components; ++j) {
+            const int col = b * components + j;
+            F(a, c) += (*this)(row, col) * dg(b, j);
+          }
+        }
+      }
+    }
+
+    return F;
+  }
+};
+
+} // namespace point
+} // namespace specfem
@@ -0,0 +1,136 @@
+#ifndef _SPECFEM_PROGRAM_SIMULATION_HPP
+#define _SPECFEM_PROGRAM_SIMULATION_HPP
+
+#include "IO/reader.hpp"
+#include "compute/interface.hpp"
+#include "mesh/mesh.hpp"
+#include "parameter_parser/interface.hpp"
+#include "periodic_tasks/periodic_task.hpp"
+#include "quadrature/interface.hpp"
+#include "receiver/interface.hpp"
+#include "source/interface.hpp"
+#include "specfem_mpi/interface.hpp"
+#include "timescheme/timescheme.hpp"
+#include "yaml-cpp/yaml.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace specfem {
+namespace program {
+
+/**
+ * @brief Persistent simulation
+ *
+ * Reads the mesh and generates the finite element assembly once. The assembly,
+ * including the allocated wavefields, is kept alive between subsequent calls
+ * to @ref run. This allows drivers (e.g. Python bindings) to run the same
+ * model repeatedly with different sources, receivers or material properties
+ * without paying the cost of reading the database and assembling the mesh.
+ */
+class simulation {
+public:
+  /**
+   * @name Constructors
+   *
+   */
+  ///@{
+  /**
+   * @brief Read the configuration, mesh, sources and receivers and generate
+   * the assembly
+   *
+   * @param parameter_dict Configuration YAML Node
+   * @param default_dict YAML Node used to instantiate default parameters
+   * @param mpi Pointer to MPI object
+   */
+  simulation(const YAML::Node &parameter_dict, const YAML::Node &default_dict,
+             specfem::MPI::MPI *mpi);
+  ///@}
+
+  /**
+   * @brief Run the time loop and write outputs requested in the configuration
+   *
+   * Fields are reset before the time loop if a previous run exists. A
+   * checkpoint is only restored by the first run. If a property writer is
+   * requested, the model is written instead of running the time loop.
+   *
+   * @param tasks Periodic tasks to execute during the time loop
+   */
+  void run(std::vector<std::shared_ptr<specfem::periodic_tasks::periodic_task> >
+               tasks);
+
+  /**
+   * @brief Zero out wavefields, seismograms and misfit kernels in place
+   *
+   */
+  void reset_fields();
+
+  /**
+   * @brief Replace the sources used within the simulation
+   *
+   * @param sources YAML node describing the sources (same format as the
+   * sources file)
+   */
+  void set_sources(const YAML::Node &sources);
+
+  /**
+   * @brief Replace the receivers used within the simulation
+   *
+   * @param stations YAML node describing the stations (same format as the
+   * receivers section of the configuration)
+   */
+  void set_receivers(const YAML::Node &stations);
+
+  /**
+   * @brief Update material properties in place from a model written by the
+   * property writer
+   *
+   * Boundary conditions and the time scheme (e.g. local time stepping
+   * levels), which depend on the material properties, are recomputed.
+   *
+   * @param input_folder Path to the model (.h5 file for HDF5, folder for
+   * ASCII)
+   * @param format Format of the model (HDF5 or ASCII)
+   */
+  void update_properties(const std::string &input_folder,
+                         const std::string &format);
+
+  /**
+   * @brief Get the assembly
+   *
+   * @return specfem::compute::assembly& Assembly
+   */
+  specfem::compute::assembly &get_assembly() { return assembly; }
+
+private:
+  void generate_receivers();
+
+  /**
+   * @brief Read the material properties of the assembly and recompute the
+   * absorbing boundaries
+   *
+   * @param reader Property reader
+   */
+  void load_properties(specfem::IO::reader &reader);
+
+  specfem::MPI::MPI *mpi;                        ///< Pointer to MPI object
+  /// Time at which the simulation was created
+  std::chrono::time_point<std::chrono::system_clock> start_time;
+  specfem::runtime_configuration::setup setup;   ///< Runtime configuration
+  specfem::quadrature::quadratures quadratures;  ///< Quadrature object
+  specfem::mesh::mesh<specfem::dimension::type::dim2> mesh; ///< Mesh
+  std::vector<std::shared_ptr<specfem::sources::source> > sources; ///< Sources
+  std::vector<std::shared_ptr<specfem::receivers::receiver> >
+      receivers; ///< Receivers
+  std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme; ///< Time
+                                                                  ///< scheme
+  specfem::compute::assembly assembly; ///< Assembly
+  bool dirty = false; ///< True if fields have been modified by a previous run
+  bool first_run = true; ///< True until the first call to run
+};
+
+} // namespace program
+} // namespace specfem
+
+#endif /* _SPECFEM_PROGRAM_SIMULATION_HPP */
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "specfem_setup.hpp"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace specfem {
+namespace solver {
+
+/**
+ * @brief Schedule used to accumulate Frechet kernels every few time steps
+ *
+ * Kernels are time integrals of products of the adjoint and backward
+ * wavefields. Instead of adding the integrand at every time step, the
+ * integrand is added every @c nstep_between_kernels steps of the backward
+ * time loop, weighted by the time covered by the sample. The first backward
+ * step is always sampled and the weights sum to @c nstep * dt.
+ *
+ * The integrand oscillates at up to twice the highest frequency of the
+ * wavefields. The sampling error is negligible when the sampling interval
+ * @c nstep_between_kernels * dt is shorter than a quarter of the shortest
+ * period in the wavefields, and the kernels are aliased once the interval
+ * reaches half of that period.
+ */
+class kernel_sampling {
+public:
+  /**
+   * @brief Construct a new kernel sampling schedule
+   *
+   * @param nstep Number of time steps of the backward time loop
+   * @param nstep_between_kernels Number of time steps between kernel updates
+   * @throws std::runtime_error if nstep_between_kernels is not positive
+   */
+  kernel_sampling(const int nstep, const int nstep_between_kernels = 1)
+      : nstep(nstep), nstep_between_kernels(nstep_between_kernels) {
+    if (nstep_between_kernels < 1) {
+      std::ostringstream message;
+      message << "Number of time steps between kernel updates ("
+              << nstep_between_kernels << ") must be positive";
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  /**
+   * @brief Check if the kernels are updated at a time step
+   *
+   * @param istep Time step of the backward time loop (nstep - 1 to 0)
+   */
+  bool sample(const int istep) const {
+    return (nstep - 1 - istep) % nstep_between_kernels == 0;
+  }
+
+  /**
+   * @brief Integration weight of a sampled time step
+   *
+   * @param istep Time step of the backward time loop (nstep - 1 to 0)
+   * @param dt Time step
+   * @return type_real Time covered by the sample
+   */
+  type_real weight(const int istep, const type_real dt) const {
+    return std::min(nstep_between_kernels, istep + 1) * dt;
+  }
+
+  int get_nstep_between_kernels() const { return nstep_between_kernels; }
+
+private:
+  int nstep;                 ///< Number of time steps
+  int nstep_between_kernels; ///< Number of time steps between kernel updates
+};
+
+} // namespace solver
+} // namespace specfem
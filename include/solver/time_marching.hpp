@@ -4,6 +4,7 @@
 #include "enumerations/dimension.hpp"
 #include "enumerations/simulation.hpp"
 #include "enumerations/wavefield.hpp"
+#include "kernel_sampling.hpp"
 #include "kokkos_kernels/domain_kernels.hpp"
 #include "kokkos_kernels/frechet_kernels.hpp"
 #include "periodic_tasks/periodic_task.hpp"
@@ -92,6 +93,11 @@ public:
    * @param adjoint_kernels Adjoint computational kernels
    * @param backward_kernels Backward computational kernels
    * @param time_scheme Time scheme
+   * @param tasks Periodic tasks
+   * @param nstep_between_kernels Number of time steps between updates of the
+   * Frechet kernels
+   * @param fuse_kernels Compute the stiffness interaction of both wavefields
+   * and the Frechet derivatives in a single pass over the elements
    */
   time_marching(
       const specfem::compute::assembly &assembly,
@@ -103,10 +109,13 @@ public:
           &backward_kernels,
       const std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme,
       const std::vector<
-          std::shared_ptr<specfem::periodic_tasks::periodic_task> > &tasks)
+          std::shared_ptr<specfem::periodic_tasks::periodic_task> > &tasks,
+      const int nstep_between_kernels = 1, const bool fuse_kernels = true)
       : assembly(assembly), adjoint_kernels(adjoint_kernels),
         frechet_kernels(assembly), backward_kernels(backward_kernels),
-        time_scheme(time_scheme), tasks(tasks) {}
+        time_scheme(time_scheme), tasks(tasks),
+        nstep_between_kernels(nstep_between_kernels),
+        fuse_kernels(fuse_kernels) {}
   ///@}
 
   /**
@@ -132,6 +141,9 @@ private:
   std::vector<std::shared_ptr<specfem::periodic_tasks::periodic_task> >
       tasks; ///< Periodic tasks
              ///< objects
+  int nstep_between_kernels; ///< Number of time steps between updates of the
+                             ///< Frechet kernels
+  bool fuse_kernels; ///< Fuse the stiffness and Frechet derivative sweeps
 };
 } // namespace solver
 } // namespace specfem
@@ -13,19 +13,26 @@ void specfem::solver::time_marching<specfem::simulation::type::forward,
   constexpr auto acoustic = specfem::element::medium_tag::acoustic;
   constexpr auto elastic = specfem::element::medium_tag::elastic;
 
-  kernels.initialize(time_scheme->get_timestep());
+  kernels.initialize(time_scheme->get_mass_matrix_timestep());
 
   const int nstep = time_scheme->get_max_timestep();
 
+  const int nstages = time_scheme->get_nstages();
+
   for (const auto [istep, dt] : time_scheme->iterate_forward()) {
-    time_scheme->apply_predictor_phase_forward(acoustic);
-    time_scheme->apply_predictor_phase_forward(elastic);
+    for (int istage = 0; istage < nstages; ++istage) {
+      time_scheme->set_stage(istage);
+      const type_real time_offset = time_scheme->get_stage_offset();
 
-    kernels.template update_wavefields<acoustic>(istep);
-    time_scheme->apply_corrector_phase_forward(acoustic);
+      time_scheme->apply_predictor_phase_forward(acoustic);
+      time_scheme->apply_predictor_phase_forward(elastic);
 
-    kernels.template update_wavefields<elastic>(istep);
-    time_scheme->apply_corrector_phase_forward(elastic);
+      kernels.template update_wavefields<acoustic>(istep, time_offset);
+      time_scheme->apply_corrector_phase_forward(acoustic);
+
+      kernels.template update_wavefields<elastic>(istep, time_offset);
+      time_scheme->apply_corrector_phase_forward(elastic);
+    }
 
     if (time_scheme->compute_seismogram(istep)) {
       kernels.compute_seismograms(time_scheme->get_seismogram_step());
@@ -44,6 +51,12 @@ void specfem::solver::time_marching<specfem::simulation::type::forward,
     }
   }
 
+  for (const auto &task : tasks) {
+    if (task) {
+      task->finalize();
+    }
+  }
+
   std::cout << std::endl;
 
   return;
@@ -56,30 +69,53 @@ void specfem::solver::time_marching<specfem::simulation::type::combined,
   constexpr auto acoustic = specfem::element::medium_tag::acoustic;
   constexpr auto elastic = specfem::element::medium_tag::elastic;
 
-  adjoint_kernels.initialize(time_scheme->get_timestep());
-  backward_kernels.initialize(time_scheme->get_timestep());
+  adjoint_kernels.initialize(time_scheme->get_mass_matrix_timestep());
+  backward_kernels.initialize(time_scheme->get_mass_matrix_timestep());
 
   const int nstep = time_scheme->get_max_timestep();
 
+  const kernel_sampling sampling(nstep, nstep_between_kernels);
+
   for (const auto [istep, dt] : time_scheme->iterate_backward()) {
-    // Adjoint time step
+    // Frechet derivatives are accumulated every nstep_between_kernels steps,
+    // weighted by the time covered by the sample
+    const bool kernel_step = sampling.sample(istep);
+    const type_real kernel_dt = sampling.weight(istep, dt);
+
+    // The displacements are final once the predictor phase is applied. The
+    // stiffness interaction of both wavefields and the strain terms of the
+    // Frechet derivatives are then computed in a single pass over the
+    // elements. The first backward step is excluded because the backward
+    // wavefield is replaced by the buffer after that step.
+    const bool fused_step =
+        fuse_kernels && kernel_step && (istep != nstep - 1);
+
     time_scheme->apply_predictor_phase_forward(acoustic);
     time_scheme->apply_predictor_phase_forward(elastic);
 
-    adjoint_kernels.template update_wavefields<acoustic>(istep);
+    time_scheme->apply_predictor_phase_backward(elastic);
+    time_scheme->apply_predictor_phase_backward(acoustic);
+
+    if (fused_step) {
+      frechet_kernels.compute_combined_interaction(kernel_dt);
+    }
+
+    // Adjoint time step
+    adjoint_kernels.template update_wavefields<acoustic>(istep, 0.0,
+                                                         !fused_step);
     time_scheme->apply_corrector_phase_forward(acoustic);
 
-    adjoint_kernels.template update_wavefields<elastic>(istep);
+    adjoint_kernels.template update_wavefields<elastic>(istep, 0.0,
+                                                        !fused_step);
     time_scheme->apply_corrector_phase_forward(elastic);
 
     // Backward time step
-    time_scheme->apply_predictor_phase_backward(elastic);
-    time_scheme->apply_predictor_phase_backward(acoustic);
-
-    backward_kernels.template update_wavefields<elastic>(istep);
+    backward_kernels.template update_wavefields<elastic>(istep, 0.0,
+                                                         !fused_step);
     time_scheme->apply_corrector_phase_backward(elastic);
 
-    backward_kernels.template update_wavefields<acoustic>(istep);
+    backward_kernels.template update_wavefields<acoustic>(istep, 0.0,
+                                                          !fused_step);
     time_scheme->apply_corrector_phase_backward(acoustic);
 
     // Copy read wavefield buffer to the backward wavefield
@@ -91,7 +127,11 @@ void specfem::solver::time_marching<specfem::simulation::type::combined,
                                   assembly.fields.buffer);
     }
 
-    frechet_kernels.compute_derivatives(dt);
+    if (fused_step) {
+      frechet_kernels.compute_inertial_derivatives(kernel_dt);
+    } else if (kernel_step) {
+      frechet_kernels.compute_derivatives(kernel_dt);
+    }
 
     if (time_scheme->compute_seismogram(istep)) {
       // compute seismogram for backward time step
@@ -111,6 +151,12 @@ void specfem::solver::time_marching<specfem::simulation::type::combined,
     }
   }
 
+  for (const auto &task : tasks) {
+    if (task) {
+      task->finalize();
+    }
+  }
+
   std::cout << std::endl;
 
   return;
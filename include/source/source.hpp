@@ -60,6 +60,14 @@ public:
   void update_tshift(type_real tshift) {
     forcing_function->update_tshift(tshift);
   };
+  /**
+   * @brief Get the source time function of the source
+   *
+   * @return specfem::forcing_function::stf* Source time function
+   */
+  specfem::forcing_function::stf *get_forcing_function() const {
+    return forcing_function.get();
+  }
   /**
    * @brief User output
    *
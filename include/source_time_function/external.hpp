@@ -5,6 +5,7 @@
 #include "kokkos_abstractions.h"
 #include "source_time_function/source_time_function.hpp"
 #include "yaml-cpp/yaml.h"
+#include <string>
 #include <tuple>
 #include <vector>
 
@@ -28,8 +29,11 @@ public:
   std::string print() const override {
     std::stringstream ss;
     ss << "External source time function: "
-       << "\n"
-       << "  X-component: " << this->x_component << "\n"
+       << "\n";
+    if (this->type == specfem::enums::seismogram::format::binary) {
+      ss << "  Container: " << this->container << "\n";
+    }
+    ss << "  X-component: " << this->x_component << "\n"
        << "  Y-component: " << this->y_component << "\n"
        << "  Z-component: " << this->z_component << "\n";
     return ss.str();
@@ -39,15 +43,49 @@ public:
 
   type_real get_tshift() const override { return 0.0; }
 
+  /**
+   * @brief Get the format of the traces
+   *
+   */
+  specfem::enums::seismogram::format get_format() const { return this->type; }
+
+  /**
+   * @brief Get the trace container (binary format only)
+   *
+   */
+  const std::string &get_container() const { return this->container; }
+
+  /**
+   * @brief Get the traces of every component
+   *
+   * File names (ASCII format) or trace names within the container (binary
+   * format), ordered as X, Z for 2 components or Y for a single component.
+   * Components which are not set are empty.
+   */
+  std::vector<std::string> get_components() const;
+
+  /**
+   * @brief Set the traces of every component, e.g. when the traces of many
+   * sources are read at once
+   *
+   * @param traces Traces (nsteps, ncomponents), ordered as @ref
+   * get_components
+   */
+  void set_traces(specfem::kokkos::HostView2d<type_real> traces) {
+    this->traces = traces;
+  }
+
 private:
   int __nsteps;
   type_real __t0;
   type_real __dt;
   specfem::enums::seismogram::format type;
   int ncomponents;
+  std::string container = "";
   std::string x_component = "";
   std::string y_component = "";
   std::string z_component = "";
+  specfem::kokkos::HostView2d<type_real> traces; ///< Traces read ahead
 };
 } // namespace forcing_function
 } // namespace specfem
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/medium.hpp"
+#include "enumerations/simulation.hpp"
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+#include "specfem_setup.hpp"
+#include "timescheme.hpp"
+
+namespace specfem {
+namespace time_scheme {
+
+/**
+ * @brief Low-dissipation and low-dispersion Runge-Kutta (LDDRK4-6) time
+ * scheme
+ *
+ * @tparam Simulation Simulation type on which this time scheme is applied
+ */
+template <specfem::simulation::type Simulation> class lddrk;
+
+/**
+ * @brief Template specialization for the forward simulation
+ *
+ * Six stage, fourth order Runge-Kutta scheme of Berland, Bogey & Bailly
+ * (2006) in 2N-storage form. For every stage \f$ i \f$ the wavefield
+ * \f$ U = (u, \dot{u}) \f$ is updated as
+ *
+ * \f$ \delta U = \alpha_i \delta U + \Delta t \, F(U) \f$,
+ * \f$ U = U + \beta_i \delta U \f$
+ *
+ * where \f$ F(U) = (\dot{u}, \ddot{u}) \f$. The acceleration is computed by
+ * the domain kernels at every stage. The registers \f$ \delta U \f$ are the
+ * only copies of the fields stored in addition to the wavefield.
+ */
+template <>
+class lddrk<specfem::simulation::type::forward> : public time_scheme {
+
+public:
+  constexpr static auto simulation_type =
+      specfem::wavefield::simulation_field::forward; ///< Wavefield tag
+
+  constexpr static int nstages = 6; ///< Number of stages
+
+  /**
+   * @name Constructors
+   */
+  ///@{
+
+  /**
+   * @brief Construct a LDDRK time scheme object
+   *
+   * @param nstep Maximum number of timesteps
+   * @param nstep_between_samples Number of timesteps between output seismogram
+   * samples
+   * @param dt Time increment
+   * @param t0 Initial time
+   */
+  lddrk(const int nstep, const int nstep_between_samples, const type_real dt,
+        const type_real t0)
+      : time_scheme(nstep, nstep_between_samples, dt), deltat(dt), t0(t0) {}
+
+  ///@}
+
+  /**
+   * @name Print timescheme details
+   */
+  void print(std::ostream &out) const override;
+
+  int get_nstages() const override { return nstages; }
+
+  void set_stage(const int istage) override { this->istage = istage; }
+
+  type_real get_stage_offset() const override;
+
+  /**
+   * @brief Reset the acceleration before the wavefield update of the current
+   * stage
+   *
+   * @param tag Medium tag for elements to apply the predictor phase
+   */
+  void apply_predictor_phase_forward(
+      const specfem::element::medium_tag tag) override;
+
+  /**
+   * @brief Update the registers and the wavefield with the acceleration of
+   * the current stage
+   *
+   * @param tag Medium tag for elements to apply the corrector phase
+   */
+  void apply_corrector_phase_forward(
+      const specfem::element::medium_tag tag) override;
+
+  /**
+   * @brief Backward simulations are not supported (Empty implementation)
+   *
+   * @param tag Medium tag for elements to apply the predictor phase
+   */
+  void apply_predictor_phase_backward(
+      const specfem::element::medium_tag tag) override{};
+
+  /**
+   * @brief Backward simulations are not supported (Empty implementation)
+   *
+   * @param tag Medium tag for elements to apply the corrector phase
+   */
+  void apply_corrector_phase_backward(
+      const specfem::element::medium_tag tag) override{};
+
+  /**
+   * @brief Link the assembly and allocate the registers
+   *
+   * @param assembly SPECFEM++ assembly object
+   */
+  void link_assembly(const specfem::compute::assembly &assembly) override;
+
+  /**
+   * @brief Get the timescheme type
+   *
+   * @return specfem::enums::time_scheme::type Timescheme type
+   */
+  specfem::enums::time_scheme::type timescheme() const override {
+    return specfem::enums::time_scheme::type::lddrk;
+  }
+
+  /**
+   * @brief Get the time increment
+   *
+   * @return type_real Time increment
+   */
+  type_real get_timestep() const override { return this->deltat; }
+
+  /**
+   * @brief Get the time increment used to assemble the mass matrix
+   *
+   * @return type_real 0, Stacey terms are computed explicitly at every stage
+   */
+  type_real get_mass_matrix_timestep() const override { return 0.0; }
+
+private:
+  using RegisterView =
+      specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>;
+
+  type_real t0;     ///< Initial time
+  type_real deltat; ///< Time increment
+  int istage = 0;   ///< Current stage
+  specfem::compute::simulation_field<
+      specfem::wavefield::simulation_field::forward>
+      field; ///< forward wavefield
+
+  RegisterView elastic_displacement;  ///< Displacement register (elastic)
+  RegisterView elastic_velocity;      ///< Velocity register (elastic)
+  RegisterView acoustic_displacement; ///< Potential register (acoustic)
+  RegisterView acoustic_velocity;     ///< Potential rate register (acoustic)
+};
+
+} // namespace time_scheme
+} // namespace specfem
@@ -0,0 +1,190 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/medium.hpp"
+#include "enumerations/simulation.hpp"
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+#include "newmark.hpp"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <map>
+#include <tuple>
+#include <vector>
+
+namespace specfem {
+namespace time_scheme {
+
+/**
+ * @brief Newmark time scheme with multi-rate local time stepping (LTS)
+ *
+ * @tparam Simulation Simulation type on which this time scheme is applied
+ */
+template <specfem::simulation::type Simulation> class lts_newmark;
+
+/**
+ * @brief Template specialization for the forward simulation
+ *
+ * Every element is assigned a level \f$ k \f$ such that its Courant number
+ * at the local time step \f$ \Delta t / 2^k \f$ does not exceed the target
+ * Courant number. A degree of freedom belongs to the finest level of the
+ * elements that share it.
+ *
+ * The scheme follows the LTS-Newmark method of Diaz & Grote (2009) applied
+ * recursively with a refinement ratio of 2 between levels. The stiffness
+ * interaction of level \f$ k \f$ is evaluated \f$ 2^k \f$ times per time step,
+ * and only on the elements that share degrees of freedom of that level. The
+ * coarser levels are held fixed while a finer level is sub-stepped, which
+ * couples neighbouring levels through the elements at their interface.
+ *
+ * The vector updates of level \f$ k \f$ run over the degrees of freedom of the
+ * elements of the levels \f$ k \f$ to \f$ n \f$ only. Outside of these, the
+ * increment of a sub-step is \f$ \Delta t_k^2 / 2 \f$ times the forcing, so
+ * the sub-steps store the deviation from this increment. The cost of a level
+ * scales with the size of the refined region rather than with the mesh.
+ *
+ * Sources, coupling interfaces and absorbing boundaries are evaluated once per
+ * time step by the domain kernels, as for the Newmark scheme. The result of
+ * the sub-steps is folded into an effective acceleration, so the predictor
+ * phase is shared with @ref specfem::time_scheme::newmark. Without refined
+ * elements the scheme reduces to the Newmark scheme.
+ */
+template <>
+class lts_newmark<specfem::simulation::type::forward>
+    : public newmark<specfem::simulation::type::forward> {
+
+public:
+  /**
+   * @name Constructors
+   */
+  ///@{
+
+  /**
+   * @brief Construct a local time stepping Newmark time scheme object
+   *
+   * @param nstep Maximum number of timesteps
+   * @param nstep_between_samples Number of timesteps between output seismogram
+   * samples
+   * @param dt Time increment of the coarsest level
+   * @param t0 Initial time
+   * @param target_courant Courant number used to assign elements to levels
+   * @param max_levels Maximum number of refinement levels
+   */
+  lts_newmark(const int nstep, const int nstep_between_samples,
+              const type_real dt, const type_real t0,
+              const type_real target_courant, const int max_levels)
+      : newmark(nstep, nstep_between_samples, dt, t0), t0(t0),
+        target_courant(target_courant), max_levels(max_levels) {}
+
+  ///@}
+
+  /**
+   * @name Print timescheme details
+   *
+   * Once the assembly is linked, the details include the time step and the
+   * number of elements of every level.
+   */
+  void print(std::ostream &out) const override;
+
+  /**
+   * @brief Replace the acceleration of the elements within a medium by the
+   * effective acceleration of the local time steps and apply the corrector
+   * phase.
+   *
+   * @param tag Medium tag for elements to apply the corrector phase
+   */
+  void apply_corrector_phase_forward(
+      const specfem::element::medium_tag tag) override;
+
+  /**
+   * @brief Link the assembly and assign the elements to levels
+   *
+   * @param assembly SPECFEM++ assembly object
+   */
+  void link_assembly(const specfem::compute::assembly &assembly) override;
+
+  /**
+   * @brief Get the timescheme type
+   *
+   * @return specfem::enums::time_scheme::type Timescheme type
+   */
+  specfem::enums::time_scheme::type timescheme() const override {
+    return specfem::enums::time_scheme::type::lts_newmark;
+  }
+
+  /**
+   * @brief Get the number of refinement levels
+   *
+   * @return int Number of levels finer than the coarsest level
+   */
+  int get_nlevels() const { return nlevels; }
+
+private:
+  using IndexView = Kokkos::View<int *, Kokkos::DefaultExecutionSpace>;
+  using FieldView =
+      specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>;
+
+  /**
+   * @brief Levels of the degrees of freedom within a medium
+   *
+   * Index k of the vectors refers to level k. Index 0 refers to the elements
+   * and degrees of freedom of levels 1 to nlevels, which are evaluated once
+   * per time step.
+   */
+  struct medium_levels {
+    int nglob = 0;        ///< Number of degrees of freedom
+    bool refined = false; ///< True if any degree of freedom is refined
+    /// Elements that share degrees of freedom with levels 1 to nlevels (index
+    /// 0) or with level k (index k), for every property and boundary tag
+    std::vector<std::map<std::tuple<specfem::element::property_tag,
+                                    specfem::element::boundary_tag>,
+                         IndexView> >
+        elements;
+    /// Global index of the degrees of freedom updated within level k, i.e.
+    /// the degrees of freedom of the elements of levels k to nlevels. Index 0
+    /// shares the view of level 1
+    std::vector<IndexView> active;
+    /// Position within active of the degrees of freedom of level k (index k)
+    /// or of levels 1 to nlevels (index 0)
+    std::vector<IndexView> level_dofs;
+    /// Position of active degrees of freedom of level k within the active
+    /// degrees of freedom of level k - 1 (k > 1)
+    std::vector<IndexView> parent;
+    std::vector<FieldView> displacement; ///< Displacement at the start of a
+                                         ///< sub-step
+    std::vector<FieldView> forcing;      ///< Forcing held fixed within a level
+    std::vector<FieldView> first;  ///< Deviation of the first sub-step
+    std::vector<FieldView> second; ///< Deviation of the second sub-step
+  };
+
+  template <specfem::element::medium_tag MediumTag>
+  void assign_levels(const std::vector<int> &element_level,
+                     medium_levels &levels);
+
+  template <specfem::element::medium_tag MediumTag>
+  void compute_effective_acceleration(medium_levels &levels);
+
+  template <specfem::element::medium_tag MediumTag>
+  void compute_deviation(const int level, medium_levels &levels,
+                         const FieldView &deviation);
+
+  template <specfem::element::medium_tag MediumTag>
+  void compute_stiffness(const int set, const medium_levels &levels,
+                         const FieldView &displacement);
+
+  type_real t0;             ///< Initial time
+  type_real target_courant; ///< Target Courant number
+  int max_levels;           ///< Maximum number of refinement levels
+  int nlevels = 0;          ///< Number of refinement levels
+  int ngll = 0;             ///< Number of quadrature points
+  std::vector<int> nelements_per_level; ///< Number of elements per level
+  type_real relative_cost = 1.0;        ///< Cost of the stiffness interaction
+                                        ///< relative to Newmark at the finest
+                                        ///< time step
+  specfem::compute::assembly assembly;  ///< Assembly object
+  medium_levels elastic;                ///< Levels within elastic media
+  medium_levels acoustic;               ///< Levels within acoustic media
+};
+
+} // namespace time_scheme
+} // namespace specfem
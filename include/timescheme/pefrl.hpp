@@ -0,0 +1,146 @@
+#pragma once
+
+#include "compute/assembly/assembly.hpp"
+#include "enumerations/medium.hpp"
+#include "enumerations/simulation.hpp"
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+#include "specfem_setup.hpp"
+#include "timescheme.hpp"
+
+namespace specfem {
+namespace time_scheme {
+
+/**
+ * @brief Position extended Forest-Ruth like (PEFRL) symplectic time scheme
+ *
+ * @tparam Simulation Simulation type on which this time scheme is applied
+ */
+template <specfem::simulation::type Simulation> class pefrl;
+
+/**
+ * @brief Template specialization for the forward simulation
+ *
+ * Fourth order symplectic scheme of Omelyan, Mryglod & Folk (2002). A time
+ * step alternates drifts of the displacement and kicks of the velocity
+ *
+ * \f$ u = u + c_i \Delta t \, \dot{u} \f$,
+ * \f$ \dot{u} = \dot{u} + d_i \Delta t \, \ddot{u}(u) \f$
+ *
+ * over four stages, followed by a final drift. The acceleration is computed by
+ * the domain kernels at every stage. No copies of the fields are stored in
+ * addition to the wavefield. Velocity dependent terms, such as absorbing
+ * boundaries, are evaluated with the velocity of the previous kick.
+ */
+template <>
+class pefrl<specfem::simulation::type::forward> : public time_scheme {
+
+public:
+  constexpr static auto simulation_type =
+      specfem::wavefield::simulation_field::forward; ///< Wavefield tag
+
+  constexpr static int nstages = 4; ///< Number of stages
+
+  /**
+   * @name Constructors
+   */
+  ///@{
+
+  /**
+   * @brief Construct a PEFRL time scheme object
+   *
+   * @param nstep Maximum number of timesteps
+   * @param nstep_between_samples Number of timesteps between output seismogram
+   * samples
+   * @param dt Time increment
+   * @param t0 Initial time
+   */
+  pefrl(const int nstep, const int nstep_between_samples, const type_real dt,
+        const type_real t0)
+      : time_scheme(nstep, nstep_between_samples, dt), deltat(dt), t0(t0) {}
+
+  ///@}
+
+  /**
+   * @name Print timescheme details
+   */
+  void print(std::ostream &out) const override;
+
+  int get_nstages() const override { return nstages; }
+
+  void set_stage(const int istage) override { this->istage = istage; }
+
+  type_real get_stage_offset() const override;
+
+  /**
+   * @brief Drift the displacement and reset the acceleration before the
+   * wavefield update of the current stage
+   *
+   * @param tag Medium tag for elements to apply the predictor phase
+   */
+  void apply_predictor_phase_forward(
+      const specfem::element::medium_tag tag) override;
+
+  /**
+   * @brief Kick the velocity with the acceleration of the current stage. The
+   * final drift is applied after the last stage
+   *
+   * @param tag Medium tag for elements to apply the corrector phase
+   */
+  void apply_corrector_phase_forward(
+      const specfem::element::medium_tag tag) override;
+
+  /**
+   * @brief Backward simulations are not supported (Empty implementation)
+   *
+   * @param tag Medium tag for elements to apply the predictor phase
+   */
+  void apply_predictor_phase_backward(
+      const specfem::element::medium_tag tag) override{};
+
+  /**
+   * @brief Backward simulations are not supported (Empty implementation)
+   *
+   * @param tag Medium tag for elements to apply the corrector phase
+   */
+  void apply_corrector_phase_backward(
+      const specfem::element::medium_tag tag) override{};
+
+  void link_assembly(const specfem::compute::assembly &assembly) override {
+    field = assembly.fields.forward;
+  }
+
+  /**
+   * @brief Get the timescheme type
+   *
+   * @return specfem::enums::time_scheme::type Timescheme type
+   */
+  specfem::enums::time_scheme::type timescheme() const override {
+    return specfem::enums::time_scheme::type::pefrl;
+  }
+
+  /**
+   * @brief Get the time increment
+   *
+   * @return type_real Time increment
+   */
+  type_real get_timestep() const override { return this->deltat; }
+
+  /**
+   * @brief Get the time increment used to assemble the mass matrix
+   *
+   * @return type_real 0, Stacey terms are computed explicitly at every stage
+   */
+  type_real get_mass_matrix_timestep() const override { return 0.0; }
+
+private:
+  type_real t0;     ///< Initial time
+  type_real deltat; ///< Time increment
+  int istage = 0;   ///< Current stage
+  specfem::compute::simulation_field<
+      specfem::wavefield::simulation_field::forward>
+      field; ///< forward wavefield
+};
+
+} // namespace time_scheme
+} // namespace specfem
@@ -53,8 +53,8 @@ private:
 
 class ForwardRange {
 public:
-  ForwardRange(int nsteps, const type_real dt)
-      : start_(0), end_(nsteps), dt(dt) {}
+  ForwardRange(int start, int nsteps, const type_real dt)
+      : start_(start), end_(nsteps), dt(dt) {}
   ForwardIterator begin() const { return ForwardIterator(start_, dt); }
   ForwardIterator end() const { return ForwardIterator(end_, dt); }
 
@@ -66,8 +66,8 @@ private:
 
 class BackwardRange {
 public:
-  BackwardRange(int nsteps, const type_real dt)
-      : start_(nsteps - 1), end_(-1), dt(dt) {}
+  BackwardRange(int start, const type_real dt)
+      : start_(start), end_(-1), dt(dt) {}
   BackwardIterator begin() const { return BackwardIterator(start_, dt); }
   BackwardIterator end() const { return BackwardIterator(end_, dt); }
 
@@ -121,7 +121,9 @@ public:
    * }
    * @endcode
    */
-  impl::ForwardRange iterate_forward() { return impl::ForwardRange(nstep, dt); }
+  impl::ForwardRange iterate_forward() {
+    return impl::ForwardRange(nstep_completed, nstep, dt);
+  }
 
   /**
    * @brief Backward iterator
@@ -137,7 +139,7 @@ public:
    * @endcode
    */
   impl::BackwardRange iterate_backward() {
-    return impl::BackwardRange(nstep, dt);
+    return impl::BackwardRange(nstep - 1 - nstep_completed, dt);
   }
   ///@}
 
@@ -153,6 +155,32 @@ public:
    */
   void increment_seismogram_step() { seismogram_timestep++; }
 
+  /**
+   * @brief Reset seismogram output step to the first sample
+   */
+  void reset_seismogram_step() { seismogram_timestep = 0; }
+
+  /**
+   * @brief Resume the time loop after a number of completed timesteps
+   *
+   * Subsequent iterations skip the completed timesteps. Used when restarting
+   * from a checkpoint. Call with zeros to start from the first timestep.
+   *
+   * @param nstep_completed Number of timesteps already completed
+   * @param seismogram_step Number of seismogram samples already computed
+   */
+  void resume(const int nstep_completed, const int seismogram_step) {
+    this->nstep_completed = nstep_completed;
+    this->seismogram_timestep = seismogram_step;
+  }
+
+  /**
+   * @brief Get the number of timesteps completed before the time loop starts
+   *
+   * @return int Number of timesteps skipped by the iterators
+   */
+  int get_nstep_completed() const { return nstep_completed; }
+
   /**
    * @brief Checks if seismogram should be computed at current timestep
    *
@@ -170,6 +198,40 @@ public:
    */
   int get_seismogram_step() const { return seismogram_timestep; }
 
+  /**
+   * @name Multi-stage time schemes
+   *
+   * Multi-stage time schemes update the wavefields several times within a
+   * time step. The predictor and corrector phases of every stage are applied
+   * around an update of the wavefields. Single stage time schemes use the
+   * default implementations.
+   */
+  ///@{
+
+  /**
+   * @brief Get the number of stages within a time step
+   *
+   * @return int Number of stages
+   */
+  virtual int get_nstages() const { return 1; }
+
+  /**
+   * @brief Set the current stage within the time step
+   *
+   * @param istage Index of the stage
+   */
+  virtual void set_stage(const int istage) {}
+
+  /**
+   * @brief Get the time at which the wavefields are updated within the
+   * current stage
+   *
+   * @return type_real Offset from the current time step as a fraction of the
+   * time step
+   */
+  virtual type_real get_stage_offset() const { return 0.0; }
+  ///@}
+
   virtual void
   apply_predictor_phase_forward(const specfem::element::medium_tag tag) = 0;
 
@@ -206,8 +268,23 @@ public:
 
   virtual type_real get_timestep() const = 0;
 
+  /**
+   * @brief Get the time increment used to assemble the mass matrix
+   *
+   * Newmark treats the Stacey velocity term implicitly, which adds
+   * \f$ \frac{\Delta t}{2} \f$ times the boundary traction to the mass
+   * matrix. Explicit multi-stage schemes evaluate the traction at every stage
+   * and return 0 so that the damping is not counted twice.
+   *
+   * @return type_real Time increment passed to the mass matrix kernels
+   */
+  virtual type_real get_mass_matrix_timestep() const {
+    return this->get_timestep();
+  }
+
 private:
   int nstep;                 ///< Number of timesteps
+  int nstep_completed = 0;   ///< Timesteps skipped when restarting
   int seismogram_timestep;   ///< Current seismogram timestep
   int nstep_between_samples; ///< Number of timesteps between seismogram output
                              ///< samples
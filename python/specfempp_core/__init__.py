@@ -5,6 +5,7 @@ from ._core import (
     _initialize,
     _execute,
     _finalize,
+    _Simulation,
 )
 
 __all__ = [
@@ -14,4 +15,5 @@ __all__ = [
     "_initialize",
     "_execute",
     "_finalize",
+    "_Simulation",
 ]
@@ -0,0 +1,267 @@
+#include "IO/checkpoint/checkpoint.hpp"
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+constexpr char magic[16] = "SPECFEM++ CKPT";
+
+template <typename ViewType>
+void add_entry(std::vector<specfem::IO::checkpoint::entry> &state,
+               const std::string &name, const ViewType &view) {
+  if (!view.span_is_contiguous()) {
+    std::ostringstream message;
+    message << "Checkpoint entry " << name << " is not contiguous";
+    throw std::runtime_error(message.str());
+  }
+  state.push_back({ name, specfem::IO::checkpoint::entry::ViewType(
+                              view.data(), view.span()) });
+}
+
+template <typename SimulationField>
+void add_field(std::vector<specfem::IO::checkpoint::entry> &state,
+               const std::string &name, const SimulationField &field) {
+#ifdef ENABLE_INTERLEAVED_FIELDS
+  // The quantities are strided views into the records. Store the records.
+  // The inverse mass within the records is discarded when the kernels are
+  // initialized
+  add_entry(state, name + "/Elastic/Records", field.elastic.records);
+  add_entry(state, name + "/Acoustic/Records", field.acoustic.records);
+#else
+  add_entry(state, name + "/Elastic/Displacement", field.elastic.field);
+  add_entry(state, name + "/Elastic/Velocity", field.elastic.field_dot);
+  add_entry(state, name + "/Elastic/Acceleration", field.elastic.field_dot_dot);
+  add_entry(state, name + "/Acoustic/Potential", field.acoustic.field);
+  add_entry(state, name + "/Acoustic/PotentialDot", field.acoustic.field_dot);
+  add_entry(state, name + "/Acoustic/PotentialDotDot",
+            field.acoustic.field_dot_dot);
+#endif
+}
+
+template <typename BoundaryValueContainer>
+void add_boundary_values(std::vector<specfem::IO::checkpoint::entry> &state,
+                         const std::string &name,
+                         const BoundaryValueContainer &container) {
+  add_entry(state, name + "/ElasticAcceleration", container.elastic.values);
+  add_entry(state, name + "/AcousticAcceleration", container.acoustic.values);
+}
+
+template <typename T>
+void write_value(std::ofstream &stream, const T &value) {
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T> T read_value(std::ifstream &stream) {
+  T value;
+  stream.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return value;
+}
+
+void check_stream(const std::ifstream &stream, const std::string &filename) {
+  if (!stream) {
+    std::ostringstream message;
+    message << "Error reading checkpoint file " << filename
+            << ". The file is truncated";
+    throw std::runtime_error(message.str());
+  }
+}
+
+} // namespace
+
+std::vector<specfem::IO::checkpoint::entry>
+specfem::IO::checkpoint::get_state(
+    const specfem::compute::assembly &assembly,
+    const specfem::simulation::type simulation,
+    const std::vector<entry> &task_state) {
+
+  std::vector<entry> state;
+
+  const auto &fields = assembly.fields;
+  add_field(state, "Forward", fields.forward);
+  add_field(state, "Adjoint", fields.adjoint);
+  add_field(state, "Backward", fields.backward);
+  add_field(state, "Buffer", fields.buffer);
+
+  const auto &kernels = assembly.kernels;
+  add_entry(state, "Kernels/ElasticIsotropic/rho",
+            kernels.elastic_isotropic.rho);
+  add_entry(state, "Kernels/ElasticIsotropic/mu", kernels.elastic_isotropic.mu);
+  add_entry(state, "Kernels/ElasticIsotropic/kappa",
+            kernels.elastic_isotropic.kappa);
+  add_entry(state, "Kernels/ElasticIsotropic/rhop",
+            kernels.elastic_isotropic.rhop);
+  add_entry(state, "Kernels/ElasticIsotropic/alpha",
+            kernels.elastic_isotropic.alpha);
+  add_entry(state, "Kernels/ElasticIsotropic/beta",
+            kernels.elastic_isotropic.beta);
+  add_entry(state, "Kernels/ElasticAnisotropic/rho",
+            kernels.elastic_anisotropic.rho);
+  add_entry(state, "Kernels/ElasticAnisotropic/c11",
+            kernels.elastic_anisotropic.c11);
+  add_entry(state, "Kernels/ElasticAnisotropic/c13",
+            kernels.elastic_anisotropic.c13);
+  add_entry(state, "Kernels/ElasticAnisotropic/c15",
+            kernels.elastic_anisotropic.c15);
+  add_entry(state, "Kernels/ElasticAnisotropic/c33",
+            kernels.elastic_anisotropic.c33);
+  add_entry(state, "Kernels/ElasticAnisotropic/c35",
+            kernels.elastic_anisotropic.c35);
+  add_entry(state, "Kernels/ElasticAnisotropic/c55",
+            kernels.elastic_anisotropic.c55);
+  add_entry(state, "Kernels/Acoustic/rho", kernels.acoustic_isotropic.rho);
+  add_entry(state, "Kernels/Acoustic/kappa", kernels.acoustic_isotropic.kappa);
+  add_entry(state, "Kernels/Acoustic/rho_prime",
+            kernels.acoustic_isotropic.rho_prime);
+  add_entry(state, "Kernels/Acoustic/alpha", kernels.acoustic_isotropic.alpha);
+
+  add_entry(state, "Seismograms",
+            assembly.receivers.get_seismogram_components());
+
+  // Boundary values are read from disk for combined simulations and are only
+  // accumulated during forward simulations
+  if (simulation == specfem::simulation::type::forward) {
+    add_boundary_values(state, "Boundary/Stacey",
+                        assembly.boundary_values.stacey);
+    add_boundary_values(state, "Boundary/CompositeStaceyDirichlet",
+                        assembly.boundary_values.composite_stacey_dirichlet);
+  }
+
+  state.insert(state.end(), task_state.begin(), task_state.end());
+
+  return state;
+}
+
+void specfem::IO::checkpoint::write(const std::string &filename,
+                                    const header &progress,
+                                    const std::vector<buffer> &buffers) {
+
+  const std::string temporary = filename + ".tmp";
+
+  {
+    std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+      std::ostringstream message;
+      message << "Could not open checkpoint file " << temporary;
+      throw std::runtime_error(message.str());
+    }
+
+    stream.write(magic, sizeof(magic));
+    write_value<std::int32_t>(stream, version);
+    write_value<std::int32_t>(stream, sizeof(type_real));
+    write_value<std::int32_t>(stream, static_cast<int>(progress.simulation));
+    write_value<std::int32_t>(stream, progress.nstep);
+    write_value<std::int32_t>(stream, progress.nstep_completed);
+    write_value<std::int32_t>(stream, progress.seismogram_step);
+
+    write_value<std::uint64_t>(stream, buffers.size());
+    for (const auto &buffer : buffers) {
+      write_value<std::uint64_t>(stream, buffer.name.size());
+      stream.write(buffer.name.data(), buffer.name.size());
+      write_value<std::uint64_t>(stream, buffer.size);
+      stream.write(reinterpret_cast<const char *>(buffer.data),
+                   sizeof(type_real) * buffer.size);
+    }
+
+    if (!stream) {
+      std::ostringstream message;
+      message << "Error writing checkpoint file " << temporary;
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  boost::filesystem::rename(temporary, filename);
+}
+
+specfem::IO::checkpoint::header specfem::IO::checkpoint::read(
+    const std::string &filename, const specfem::compute::assembly &assembly,
+    const specfem::simulation::type simulation, const int nstep,
+    const std::vector<entry> &task_state) {
+
+  std::ifstream stream(filename, std::ios::binary);
+  if (!stream) {
+    std::ostringstream message;
+    message << "Could not open checkpoint file " << filename;
+    throw std::runtime_error(message.str());
+  }
+
+  char file_magic[sizeof(magic)];
+  stream.read(file_magic, sizeof(file_magic));
+  if (!stream || std::memcmp(file_magic, magic, sizeof(magic)) != 0) {
+    std::ostringstream message;
+    message << filename << " is not a SPECFEM++ checkpoint file";
+    throw std::runtime_error(message.str());
+  }
+
+  const int file_version = read_value<std::int32_t>(stream);
+  const int real_size = read_value<std::int32_t>(stream);
+  const int file_simulation = read_value<std::int32_t>(stream);
+
+  header progress;
+  progress.nstep = read_value<std::int32_t>(stream);
+  progress.nstep_completed = read_value<std::int32_t>(stream);
+  progress.seismogram_step = read_value<std::int32_t>(stream);
+  progress.simulation = static_cast<specfem::simulation::type>(file_simulation);
+  check_stream(stream, filename);
+
+  if (file_version != version) {
+    std::ostringstream message;
+    message << "Checkpoint file " << filename << " has version "
+            << file_version << ". Expected version " << version;
+    throw std::runtime_error(message.str());
+  }
+
+  if (real_size != sizeof(type_real)) {
+    std::ostringstream message;
+    message << "Checkpoint file " << filename
+            << " was written with a different floating point precision";
+    throw std::runtime_error(message.str());
+  }
+
+  if (progress.simulation != simulation || progress.nstep != nstep) {
+    std::ostringstream message;
+    message << "Checkpoint file " << filename
+            << " was written for a different simulation type or number of "
+               "timesteps";
+    throw std::runtime_error(message.str());
+  }
+
+  const auto state = get_state(assembly, simulation, task_state);
+
+  const auto nentries = read_value<std::uint64_t>(stream);
+  check_stream(stream, filename);
+  if (nentries != state.size()) {
+    std::ostringstream message;
+    message << "Checkpoint file " << filename << " has " << nentries
+            << " entries. Expected " << state.size();
+    throw std::runtime_error(message.str());
+  }
+
+  for (const auto &entry : state) {
+    const auto name_size = read_value<std::uint64_t>(stream);
+    check_stream(stream, filename);
+    std::string name(name_size, '\0');
+    stream.read(&name[0], name_size);
+    const auto size = read_value<std::uint64_t>(stream);
+    check_stream(stream, filename);
+
+    if (name != entry.name || size != entry.view.size()) {
+      std::ostringstream message;
+      message << "Checkpoint entry " << name << " (" << size
+              << " values) does not match " << entry.name << " ("
+              << entry.view.size() << " values)";
+      throw std::runtime_error(message.str());
+    }
+
+    const auto h_view = Kokkos::create_mirror_view(entry.view);
+    stream.read(reinterpret_cast<char *>(h_view.data()),
+                sizeof(type_real) * size);
+    check_stream(stream, filename);
+    Kokkos::deep_copy(entry.view, h_view);
+  }
+
+  return progress;
+}
@@ -1,6 +1,7 @@
 #include "IO/kernel/writer.hpp"
 #include "IO/ASCII/ASCII.hpp"
 #include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
 #include "IO/kernel/writer.tpp"
 
 // Explicit instantiation
@@ -8,3 +9,6 @@
 template class specfem::IO::kernel_writer<specfem::IO::HDF5<specfem::IO::write> >;
 
 template class specfem::IO::kernel_writer<specfem::IO::ASCII<specfem::IO::write> >;
+
+template class specfem::IO::kernel_writer<
+    specfem::IO::binary<specfem::IO::write> >;
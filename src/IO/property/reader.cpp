@@ -1,6 +1,7 @@
 #include "IO/property/reader.hpp"
 #include "IO/ASCII/ASCII.hpp"
 #include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
 #include "IO/property/reader.tpp"
 #include "IO/reader.hpp"
 
@@ -9,3 +10,6 @@ template class specfem::IO::property_reader<specfem::IO::HDF5<specfem::IO::read>
 
 template class specfem::IO::property_reader<
     specfem::IO::ASCII<specfem::IO::read> >;
+
+template class specfem::IO::property_reader<
+    specfem::IO::binary<specfem::IO::read> >;
@@ -1,6 +1,7 @@
 #include "IO/property/writer.hpp"
 #include "IO/ASCII/ASCII.hpp"
 #include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
 #include "IO/property/writer.tpp"
 
 // Explicit instantiation
@@ -10,3 +11,6 @@ template class specfem::IO::property_writer<
 
 template class specfem::IO::property_writer<
     specfem::IO::ASCII<specfem::IO::write> >;
+
+template class specfem::IO::property_writer<
+    specfem::IO::binary<specfem::IO::write> >;
@@ -0,0 +1,176 @@
+#include "IO/seismogram/impl/sac.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// The SAC header contains 70 floats, 40 integers and 192 characters
+constexpr int nfloats = 70;
+constexpr int nints = 40;
+constexpr int nchars = 192;
+
+constexpr float undefined_float = -12345.0;
+constexpr std::int32_t undefined_int = -12345;
+constexpr char undefined_string[] = "-12345";
+
+// Indices of the header fields used here
+constexpr int delta_index = 0;   // float, sampling interval
+constexpr int depmin_index = 1;  // float, minimum amplitude
+constexpr int depmax_index = 2;  // float, maximum amplitude
+constexpr int b_index = 5;       // float, begin time
+constexpr int e_index = 6;       // float, end time
+constexpr int depmen_index = 56; // float, mean amplitude
+
+constexpr int nvhdr_index = 6;   // int, header version
+constexpr int npts_index = 9;    // int, number of samples
+constexpr int iftype_index = 15; // int, type of file
+constexpr int idep_index = 16;   // int, type of dependent variable
+constexpr int leven_index = 35;  // logical, evenly spaced samples
+
+constexpr int kstnm_offset = 0;    // char[8], station name
+constexpr int kcmpnm_offset = 160; // char[8], component name
+constexpr int knetwk_offset = 168; // char[8], network name
+
+// Enumerated header values
+constexpr std::int32_t itime = 1;
+constexpr std::int32_t iunkn = 5;
+constexpr std::int32_t idisp = 6;
+constexpr std::int32_t ivel = 7;
+constexpr std::int32_t iacc = 8;
+
+struct sac_header {
+  float floats[nfloats];
+  std::int32_t ints[nints];
+  char chars[nchars];
+};
+
+static_assert(sizeof(sac_header) == 632, "SAC header must be 632 bytes");
+
+// Character fields are blank padded
+void set_string(char *field, const int length, const std::string &value) {
+  std::memset(field, ' ', length);
+  std::memcpy(field, value.data(), std::min<int>(value.size(), length));
+}
+
+} // namespace
+
+void specfem::IO::impl::write_sac(
+    const std::string &filename, const std::string &station_name,
+    const std::string &network_name, const std::string &component,
+    const specfem::wavefield::type type, const type_real t0,
+    const type_real dt, const specfem::kokkos::HostView1d<type_real> values) {
+
+  const int nsteps = values.extent(0);
+
+  std::vector<float> buffer(nsteps);
+  float depmin = 0.0;
+  float depmax = 0.0;
+  double depmen = 0.0;
+  for (int istep = 0; istep < nsteps; ++istep) {
+    buffer[istep] = values(istep);
+    depmin = (istep == 0) ? buffer[istep] : std::min(depmin, buffer[istep]);
+    depmax = (istep == 0) ? buffer[istep] : std::max(depmax, buffer[istep]);
+    depmen += buffer[istep];
+  }
+  if (nsteps > 0) {
+    depmen /= nsteps;
+  }
+
+  sac_header header;
+  std::fill_n(header.floats, nfloats, undefined_float);
+  std::fill_n(header.ints, nints, undefined_int);
+  for (int i = 0; i < nchars; i += 8) {
+    set_string(header.chars + i, 8, undefined_string);
+  }
+
+  header.floats[delta_index] = dt;
+  header.floats[depmin_index] = depmin;
+  header.floats[depmax_index] = depmax;
+  header.floats[b_index] = t0;
+  header.floats[e_index] = t0 + (nsteps - 1) * dt;
+  header.floats[depmen_index] = depmen;
+
+  header.ints[nvhdr_index] = 6;
+  header.ints[npts_index] = nsteps;
+  header.ints[iftype_index] = itime;
+  header.ints[idep_index] = [&]() {
+    switch (type) {
+    case specfem::wavefield::type::displacement:
+      return idisp;
+    case specfem::wavefield::type::velocity:
+      return ivel;
+    case specfem::wavefield::type::acceleration:
+      return iacc;
+    default:
+      return iunkn;
+    }
+  }();
+  header.ints[leven_index] = 1;
+
+  set_string(header.chars + kstnm_offset, 8, station_name);
+  set_string(header.chars + kcmpnm_offset, 8, component);
+  set_string(header.chars + knetwk_offset, 8, network_name);
+
+  std::ofstream stream(filename, std::ios::binary);
+  if (!stream.is_open()) {
+    std::ostringstream message;
+    message << "Could not open SAC file " << filename << " for writing";
+    throw std::runtime_error(message.str());
+  }
+
+  stream.write(reinterpret_cast<const char *>(&header), sizeof(sac_header));
+  stream.write(reinterpret_cast<const char *>(buffer.data()),
+               buffer.size() * sizeof(float));
+
+  if (!stream) {
+    std::ostringstream message;
+    message << "Error writing SAC file " << filename;
+    throw std::runtime_error(message.str());
+  }
+}
+
+void specfem::IO::impl::read_sac(
+    const std::string &filename, type_real &t0, type_real &dt,
+    specfem::kokkos::HostView1d<type_real> values) {
+
+  std::ifstream stream(filename, std::ios::binary);
+  if (!stream.is_open()) {
+    throw std::runtime_error("File " + filename + " not found");
+  }
+
+  sac_header header;
+  stream.read(reinterpret_cast<char *>(&header), sizeof(sac_header));
+
+  if (!stream || header.ints[nvhdr_index] != 6 ||
+      header.ints[iftype_index] != itime || header.ints[leven_index] != 1) {
+    std::ostringstream message;
+    message << "Seismogram file " << filename
+            << " is not an evenly sampled SAC time series";
+    throw std::runtime_error(message.str());
+  }
+
+  const int nsteps = header.ints[npts_index];
+  if (nsteps != values.extent(0)) {
+    throw std::runtime_error("Error in reading seismogram file : " + filename +
+                             " traces dont match with nsteps");
+  }
+
+  std::vector<float> buffer(nsteps);
+  stream.read(reinterpret_cast<char *>(buffer.data()),
+              buffer.size() * sizeof(float));
+  if (!stream) {
+    throw std::runtime_error("Error reading seismogram file : " + filename);
+  }
+
+  t0 = header.floats[b_index];
+  dt = header.floats[delta_index];
+
+  for (int istep = 0; istep < nsteps; ++istep) {
+    values(istep) = buffer[istep];
+  }
+}
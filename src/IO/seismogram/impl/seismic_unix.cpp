@@ -0,0 +1,148 @@
+#include "IO/seismogram/impl/seismic_unix.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr int header_size = 240;
+
+// Byte offsets of the SEG-Y trace header fields used here
+constexpr int tracl_offset = 0;   // int32, trace sequence number in line
+constexpr int tracr_offset = 4;   // int32, trace sequence number in file
+constexpr int trid_offset = 28;   // int16, trace identification code
+constexpr int delrt_offset = 108; // int16, delay recording time [ms]
+constexpr int ns_offset = 114;    // uint16, number of samples
+constexpr int dt_offset = 116;    // uint16, sample interval [us]
+
+template <typename T>
+void set_field(char *header, const int offset, const T value) {
+  std::memcpy(header + offset, &value, sizeof(T));
+}
+
+template <typename T> T get_field(const char *header, const int offset) {
+  T value;
+  std::memcpy(&value, header + offset, sizeof(T));
+  return value;
+}
+
+} // namespace
+
+void specfem::IO::impl::write_seismic_unix(
+    const std::string &filename, const type_real t0, const type_real dt,
+    const specfem::kokkos::HostView2d<type_real> traces) {
+
+  const int ntraces = traces.extent(0);
+  const int nsteps = traces.extent(1);
+
+  const long dt_us = std::lround(dt * 1e6);
+  const long delrt_ms = std::lround(t0 * 1e3);
+
+  if (nsteps > std::numeric_limits<std::uint16_t>::max()) {
+    std::ostringstream message;
+    message << "Seismic Unix traces are limited to "
+            << std::numeric_limits<std::uint16_t>::max()
+            << " samples. Found " << nsteps << " samples";
+    throw std::runtime_error(message.str());
+  }
+
+  if (dt_us < 1 || dt_us > std::numeric_limits<std::uint16_t>::max()) {
+    std::ostringstream message;
+    message << "Sampling interval " << dt
+            << " cannot be stored in a Seismic Unix header";
+    throw std::runtime_error(message.str());
+  }
+
+  if (delrt_ms < std::numeric_limits<std::int16_t>::min() ||
+      delrt_ms > std::numeric_limits<std::int16_t>::max()) {
+    std::ostringstream message;
+    message << "Start time " << t0
+            << " cannot be stored in a Seismic Unix header";
+    throw std::runtime_error(message.str());
+  }
+
+  std::ofstream stream(filename, std::ios::binary);
+  if (!stream.is_open()) {
+    std::ostringstream message;
+    message << "Could not open Seismic Unix file " << filename
+            << " for writing";
+    throw std::runtime_error(message.str());
+  }
+
+  char header[header_size];
+  std::vector<float> buffer(nsteps);
+
+  for (int itrace = 0; itrace < ntraces; ++itrace) {
+    std::memset(header, 0, header_size);
+    set_field<std::int32_t>(header, tracl_offset, itrace + 1);
+    set_field<std::int32_t>(header, tracr_offset, itrace + 1);
+    set_field<std::int16_t>(header, trid_offset, 1);
+    set_field<std::int16_t>(header, delrt_offset, delrt_ms);
+    set_field<std::uint16_t>(header, ns_offset, nsteps);
+    set_field<std::uint16_t>(header, dt_offset, dt_us);
+
+    for (int istep = 0; istep < nsteps; ++istep) {
+      buffer[istep] = traces(itrace, istep);
+    }
+
+    stream.write(header, header_size);
+    stream.write(reinterpret_cast<const char *>(buffer.data()),
+                 buffer.size() * sizeof(float));
+  }
+
+  if (!stream) {
+    std::ostringstream message;
+    message << "Error writing Seismic Unix file " << filename;
+    throw std::runtime_error(message.str());
+  }
+}
+
+void specfem::IO::impl::read_seismic_unix(
+    const std::string &filename, const int itrace, type_real &t0,
+    type_real &dt, specfem::kokkos::HostView1d<type_real> values) {
+
+  std::ifstream stream(filename, std::ios::binary);
+  if (!stream.is_open()) {
+    throw std::runtime_error("File " + filename + " not found");
+  }
+
+  char header[header_size];
+  stream.read(header, header_size);
+  if (!stream) {
+    throw std::runtime_error("Error reading seismogram file : " + filename);
+  }
+
+  // Every trace of a gather has the same number of samples
+  const int nsteps = get_field<std::uint16_t>(header, ns_offset);
+  if (nsteps != values.extent(0)) {
+    throw std::runtime_error("Error in reading seismogram file : " + filename +
+                             " traces dont match with nsteps");
+  }
+
+  const std::size_t trace_size = header_size + nsteps * sizeof(float);
+  stream.seekg(static_cast<std::size_t>(itrace) * trace_size);
+  stream.read(header, header_size);
+
+  std::vector<float> buffer(nsteps);
+  stream.read(reinterpret_cast<char *>(buffer.data()),
+              buffer.size() * sizeof(float));
+
+  if (!stream) {
+    std::ostringstream message;
+    message << "Trace " << itrace << " not found in seismogram file "
+            << filename;
+    throw std::runtime_error(message.str());
+  }
+
+  t0 = get_field<std::int16_t>(header, delrt_offset) * 1e-3;
+  dt = get_field<std::uint16_t>(header, dt_offset) * 1e-6;
+
+  for (int istep = 0; istep < nsteps; ++istep) {
+    values(istep) = buffer[istep];
+  }
+}
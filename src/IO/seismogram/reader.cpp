@@ -1,53 +1,196 @@
 #include "IO/seismogram/reader.hpp"
+#include "IO/seismogram/impl/sac.hpp"
+#include "IO/seismogram/impl/seismic_unix.hpp"
+#include "IO/seismogram/trace_container.hpp"
+#include <Kokkos_Core.hpp>
+#include <cstdlib>
 #include <fstream>
-#include <tuple>
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
-void specfem::IO::seismogram_reader::read() {
-
-  if (type != specfem::enums::seismogram::format::ascii) {
-    throw std::runtime_error("Only ASCII format is supported");
-  }
+namespace {
 
-  std::ifstream file(filename);
+// Read the entire file with a single read
+std::string read_file(const std::string &filename) {
+  std::ifstream file(filename, std::ios::binary | std::ios::ate);
 
   if (!file.is_open()) {
     throw std::runtime_error("File " + filename + " not found");
   }
 
-  // Get the total number of lines in the file
-  int nlines = 0;
-  std::string line;
+  const std::streamsize size = file.tellg();
+  file.seekg(0, std::ios::beg);
 
-  while (std::getline(file, line)) {
-    nlines++;
+  std::string buffer(size, '\0');
+  if (!file.read(buffer.data(), size)) {
+    throw std::runtime_error("Error reading seismogram file : " + filename);
   }
 
-  file.clear();
-  file.seekg(0, std::ios::beg);
+  return buffer;
+}
+
+// Parse a two column (time, value) ASCII trace with nsteps lines. store(istep,
+// time, value) is called for every line
+template <typename StoreFunction>
+void parse_ascii_trace(const std::string &filename, const int nsteps,
+                       const StoreFunction &store) {
+  const std::string buffer = read_file(filename);
+
+  // Number of lines, counted the same way as std::getline
+  int nlines = 0;
+  for (const char c : buffer) {
+    nlines += (c == '\n');
+  }
+  if (!buffer.empty() && buffer.back() != '\n') {
+    nlines++;
+  }
 
-  if (nlines != source_time_function.extent(0)) {
-    file.close();
+  if (nlines != nsteps) {
     throw std::runtime_error("Error in reading seismogram file : " + filename +
                              " traces dont match with nsteps");
   }
 
-  int nsteps = 0;
+  const char *begin = buffer.c_str();
+
+  // Parse a number from the current line
+  const auto parse_number = [&](double &number) {
+    while (*begin == ' ' || *begin == '\t' || *begin == '\r') {
+      begin++;
+    }
+    if (*begin == '\n' || *begin == '\0') {
+      return false;
+    }
+    char *end;
+    number = std::strtod(begin, &end);
+    const bool read = (end != begin);
+    begin = end;
+    return read;
+  };
 
-  while (std::getline(file, line)) {
-    std::istringstream iss(line);
+  for (int istep = 0; istep < nlines; ++istep) {
     double time, value;
-    if (!(iss >> time >> value)) {
+    if (!parse_number(time) || !parse_number(value)) {
       throw std::runtime_error("Seismogram file " + filename +
                                " is not formatted correctly");
     }
 
-    source_time_function(nsteps, 0) = time;
-    source_time_function(nsteps, 1) = value;
-    nsteps++;
+    store(istep, time, value);
+
+    // Move to the next line
+    while (*begin != '\0' && *begin != '\n') {
+      begin++;
+    }
+    if (*begin == '\n') {
+      begin++;
+    }
+  }
+}
+
+} // namespace
+
+void specfem::IO::seismogram_reader::read() {
+
+  const auto stf = source_time_function;
+  const int nsteps = stf.extent(0);
+
+  if (type == specfem::enums::seismogram::format::ascii) {
+    parse_ascii_trace(filename, nsteps,
+                      [&](const int istep, const double time,
+                          const double value) {
+                        stf(istep, 0) = time;
+                        stf(istep, 1) = value;
+                      });
+    return;
+  }
+
+  // Binary formats store the values and the sampling of the trace
+  type_real t0;
+  specfem::kokkos::HostView1d<type_real> values(
+      "specfem::IO::seismogram_reader::values", nsteps);
+
+  switch (type) {
+  case specfem::enums::seismogram::format::sac:
+    specfem::IO::impl::read_sac(filename, t0, this->dt, values);
+    break;
+  case specfem::enums::seismogram::format::seismic_unix:
+    specfem::IO::impl::read_seismic_unix(filename, trace, t0, this->dt,
+                                         values);
+    break;
+  case specfem::enums::seismogram::format::binary: {
+    const specfem::IO::trace_container container(filename);
+    if (trace < 0 || trace >= container.get_ntraces()) {
+      std::ostringstream message;
+      message << "Trace " << trace << " not found in seismogram file "
+              << filename;
+      throw std::runtime_error(message.str());
+    }
+    if (container.get_nsteps() != nsteps) {
+      throw std::runtime_error("Error in reading seismogram file : " +
+                               filename + " traces dont match with nsteps");
+    }
+    specfem::kokkos::HostView2d<type_real> traces(
+        "specfem::IO::seismogram_reader::traces", 1, nsteps);
+    container.read({ container.get_names()[trace] }, traces);
+    for (int istep = 0; istep < nsteps; ++istep) {
+      values(istep) = traces(0, istep);
+    }
+    t0 = container.get_t0();
+    this->dt = container.get_dt();
+    break;
+  }
+  default:
+    throw std::runtime_error("Unknown seismogram format");
+  }
+
+  for (int istep = 0; istep < nsteps; ++istep) {
+    stf(istep, 0) = t0 + istep * this->dt;
+    stf(istep, 1) = values(istep);
   }
 
-  file.close();
+  return;
+}
+
+void specfem::IO::read_ascii_traces(
+    const std::vector<std::string> &filenames,
+    specfem::kokkos::HostView2d<type_real> traces) {
+
+  const int ntraces = filenames.size();
+  const int nsteps = traces.extent(1);
+
+  if (traces.extent(0) != ntraces) {
+    std::ostringstream message;
+    message << "Trace view holds " << traces.extent(0)
+            << " traces. Expected " << ntraces;
+    throw std::runtime_error(message.str());
+  }
+
+  // Exceptions cannot leave the parallel region. Record the errors and
+  // rethrow the first one afterwards
+  std::vector<std::string> errors(ntraces);
+
+  Kokkos::parallel_for(
+      "specfem::IO::read_ascii_traces", specfem::kokkos::HostRange(0, ntraces),
+      [&](const int itrace) {
+        try {
+          parse_ascii_trace(filenames[itrace], nsteps,
+                            [&](const int istep, const double,
+                                const double value) {
+                              traces(itrace, istep) = value;
+                            });
+        } catch (const std::exception &e) {
+          errors[itrace] = e.what();
+        }
+      });
+
+  Kokkos::fence();
+
+  for (const auto &error : errors) {
+    if (!error.empty()) {
+      throw std::runtime_error(error);
+    }
+  }
 
   return;
 }
@@ -0,0 +1,272 @@
+#include "IO/seismogram/trace_container.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+constexpr char magic[8] = { 'S', 'P', 'E', 'C', 'S', 'T', 'F', '\0' };
+constexpr std::int32_t version = 1;
+
+// magic, version, ntraces, nsteps, sample size, t0, dt
+constexpr std::size_t header_size =
+    sizeof(magic) + 4 * sizeof(std::int32_t) + 2 * sizeof(double);
+
+template <typename T> void write_value(std::ofstream &stream, const T &value) {
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T> T read_value(std::ifstream &stream) {
+  T value;
+  stream.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return value;
+}
+
+std::ifstream open_container(const std::string &filename) {
+  std::ifstream stream(filename, std::ios::binary);
+  if (!stream.is_open()) {
+    std::ostringstream message;
+    message << "Could not open trace container " << filename;
+    throw std::runtime_error(message.str());
+  }
+  return stream;
+}
+
+specfem::IO::trace_container::header
+read_file_header(std::ifstream &stream, const std::string &filename) {
+  char file_magic[sizeof(magic)];
+  stream.read(file_magic, sizeof(file_magic));
+  const auto file_version = read_value<std::int32_t>(stream);
+  const auto ntraces = read_value<std::int32_t>(stream);
+  const auto nsteps = read_value<std::int32_t>(stream);
+  const auto sample_size = read_value<std::int32_t>(stream);
+  const auto t0 = read_value<double>(stream);
+  const auto dt = read_value<double>(stream);
+
+  if (!stream || std::memcmp(file_magic, magic, sizeof(magic)) != 0) {
+    std::ostringstream message;
+    message << "File " << filename << " is not a trace container";
+    throw std::runtime_error(message.str());
+  }
+
+  if (file_version != version) {
+    std::ostringstream message;
+    message << "Trace container " << filename << " has version "
+            << file_version << ". Expected version " << version;
+    throw std::runtime_error(message.str());
+  }
+
+  if (sample_size != sizeof(float) && sample_size != sizeof(double)) {
+    std::ostringstream message;
+    message << "Trace container " << filename << " stores samples of "
+            << sample_size << " bytes. Expected 4 or 8";
+    throw std::runtime_error(message.str());
+  }
+
+  using precision = specfem::IO::trace_container::precision;
+
+  return { ntraces, nsteps, static_cast<type_real>(t0),
+           static_cast<type_real>(dt),
+           (sample_size == sizeof(float)) ? precision::float32
+                                          : precision::float64 };
+}
+
+// Write the samples of every trace using the storage type T
+template <typename T>
+void write_samples(std::ofstream &stream,
+                   const specfem::kokkos::HostView2d<type_real> traces) {
+  const int ntraces = traces.extent(0);
+  const int nsteps = traces.extent(1);
+  std::vector<T> buffer(nsteps);
+  for (int itrace = 0; itrace < ntraces; ++itrace) {
+    for (int istep = 0; istep < nsteps; ++istep) {
+      buffer[istep] = traces(itrace, istep);
+    }
+    stream.write(reinterpret_cast<const char *>(buffer.data()),
+                 buffer.size() * sizeof(T));
+  }
+}
+
+// Read the samples of the traces at the given positions in file order using
+// the storage type T
+template <typename T>
+bool read_samples(std::ifstream &stream, const std::size_t data_offset,
+                  const std::vector<int> &position,
+                  const std::vector<int> &order,
+                  specfem::kokkos::HostView2d<type_real> traces,
+                  int &failed) {
+  const int nsteps = traces.extent(1);
+  const std::size_t trace_size = static_cast<std::size_t>(nsteps) * sizeof(T);
+
+  std::vector<T> buffer(nsteps);
+  for (const int itrace : order) {
+    stream.seekg(data_offset + position[itrace] * trace_size);
+    stream.read(reinterpret_cast<char *>(buffer.data()), trace_size);
+    if (!stream) {
+      failed = itrace;
+      return false;
+    }
+    for (int istep = 0; istep < nsteps; ++istep) {
+      traces(itrace, istep) = buffer[istep];
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+specfem::IO::trace_container::header
+specfem::IO::trace_container::read_header(const std::string &filename) {
+  auto stream = open_container(filename);
+  return read_file_header(stream, filename);
+}
+
+specfem::IO::trace_container::trace_container(const std::string &filename)
+    : filename(filename) {
+  auto stream = open_container(filename);
+  this->file_header = read_file_header(stream, filename);
+
+  const int ntraces = this->file_header.ntraces;
+  std::vector<char> names(static_cast<std::size_t>(ntraces) * name_length);
+  stream.read(names.data(), names.size());
+  if (!stream) {
+    std::ostringstream message;
+    message << "Error reading the index of trace container " << filename
+            << ". The file is truncated";
+    throw std::runtime_error(message.str());
+  }
+
+  this->index.reserve(ntraces);
+  for (int itrace = 0; itrace < ntraces; ++itrace) {
+    const char *name = names.data() + itrace * name_length;
+    this->index.emplace(std::string(name, strnlen(name, name_length)),
+                        itrace);
+  }
+}
+
+std::vector<std::string> specfem::IO::trace_container::get_names() const {
+  std::vector<std::string> names(this->file_header.ntraces);
+  for (const auto &[name, itrace] : this->index) {
+    names[itrace] = name;
+  }
+  return names;
+}
+
+void specfem::IO::trace_container::write(
+    const std::string &filename, const std::vector<std::string> &names,
+    const type_real t0, const type_real dt,
+    const specfem::kokkos::HostView2d<type_real> traces,
+    const precision sample_precision) {
+
+  const int ntraces = names.size();
+  const int nsteps = traces.extent(1);
+
+  if (traces.extent(0) != ntraces) {
+    std::ostringstream message;
+    message << "Number of traces (" << traces.extent(0)
+            << ") does not match the number of names (" << ntraces << ")";
+    throw std::runtime_error(message.str());
+  }
+
+  std::ofstream stream(filename, std::ios::binary);
+  if (!stream.is_open()) {
+    std::ostringstream message;
+    message << "Could not open trace container " << filename
+            << " for writing";
+    throw std::runtime_error(message.str());
+  }
+
+  stream.write(magic, sizeof(magic));
+  write_value<std::int32_t>(stream, version);
+  write_value<std::int32_t>(stream, ntraces);
+  write_value<std::int32_t>(stream, nsteps);
+  write_value<std::int32_t>(stream, (sample_precision == precision::float32)
+                                        ? sizeof(float)
+                                        : sizeof(double));
+  write_value<double>(stream, t0);
+  write_value<double>(stream, dt);
+
+  for (const auto &name : names) {
+    if (name.size() > name_length) {
+      std::ostringstream message;
+      message << "Trace name " << name << " is longer than " << name_length
+              << " characters";
+      throw std::runtime_error(message.str());
+    }
+    char buffer[name_length] = {};
+    std::memcpy(buffer, name.data(), name.size());
+    stream.write(buffer, name_length);
+  }
+
+  if (sample_precision == precision::float32) {
+    write_samples<float>(stream, traces);
+  } else {
+    write_samples<double>(stream, traces);
+  }
+
+  if (!stream) {
+    std::ostringstream message;
+    message << "Error writing trace container " << filename;
+    throw std::runtime_error(message.str());
+  }
+}
+
+void specfem::IO::trace_container::read(
+    const std::vector<std::string> &names,
+    specfem::kokkos::HostView2d<type_real> traces) const {
+
+  const int nsteps = this->file_header.nsteps;
+  const int ntraces = names.size();
+
+  if (traces.extent(0) != ntraces || traces.extent(1) != nsteps) {
+    std::ostringstream message;
+    message << "Trace view has dimensions (" << traces.extent(0) << ", "
+            << traces.extent(1) << "). Expected (" << ntraces << ", "
+            << nsteps << ")";
+    throw std::runtime_error(message.str());
+  }
+
+  std::vector<int> position(ntraces);
+  for (int itrace = 0; itrace < ntraces; ++itrace) {
+    const auto it = this->index.find(names[itrace]);
+    if (it == this->index.end()) {
+      std::ostringstream message;
+      message << "Trace " << names[itrace] << " not found in trace container "
+              << this->filename;
+      throw std::runtime_error(message.str());
+    }
+    position[itrace] = it->second;
+  }
+
+  // Read in file order to keep the accesses sequential
+  std::vector<int> order(ntraces);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](const int a, const int b) {
+    return position[a] < position[b];
+  });
+
+  auto stream = open_container(this->filename);
+  const std::size_t data_offset =
+      header_size +
+      static_cast<std::size_t>(this->file_header.ntraces) * name_length;
+
+  int failed = 0;
+  const bool success =
+      (this->file_header.sample_precision == precision::float32)
+          ? read_samples<float>(stream, data_offset, position, order, traces,
+                                failed)
+          : read_samples<double>(stream, data_offset, position, order,
+                                 traces, failed);
+
+  if (!success) {
+    std::ostringstream message;
+    message << "Error reading trace " << names[failed]
+            << " from trace container " << this->filename
+            << ". The file is truncated";
+    throw std::runtime_error(message.str());
+  }
+}
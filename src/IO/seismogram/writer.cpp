@@ -1,6 +1,60 @@
 #include "IO/seismogram/writer.hpp"
+#include "IO/seismogram/impl/sac.hpp"
+#include "IO/seismogram/impl/seismic_unix.hpp"
+#include "IO/seismogram/trace_container.hpp"
 #include "compute/interface.hpp"
 #include <fstream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+// Component names and file extension of a seismogram type
+std::tuple<std::vector<std::string>, std::string>
+get_components(const specfem::wavefield::type seismogram_type) {
+  switch (seismogram_type) {
+  case specfem::wavefield::type::displacement:
+    return { { "BXX", "BXZ" }, "semd" };
+  case specfem::wavefield::type::velocity:
+    return { { "BXX", "BXZ" }, "semv" };
+  case specfem::wavefield::type::acceleration:
+    return { { "BXX", "BXZ" }, "sema" };
+  case specfem::wavefield::type::pressure:
+    return { { "PRE" }, "semp" };
+  default:
+    throw std::runtime_error("Unknown seismogram type");
+  }
+}
+
+// Name of the Seismic Unix gather storing a component, following the
+// SPECFEM2D convention (e.g. Ux_file_single_d.su)
+std::string get_gather_name(const std::string &component,
+                            const std::string &extension) {
+  const std::string prefix = (component == "BXX")   ? "Ux"
+                             : (component == "BXZ") ? "Uz"
+                                                    : "Up";
+  return prefix + "_file_single_" + extension.back() + ".su";
+}
+
+// Description of a single trace
+struct trace {
+  std::string station_name;
+  std::string network_name;
+  std::string component;
+  std::string extension;
+  specfem::wavefield::type seismogram_type;
+
+  // NETWORK.STATION.S2.COMPONENT.EXTENSION
+  std::string name() const {
+    return network_name + "." + station_name + ".S2." + component + "." +
+           extension;
+  }
+};
+
+} // namespace
 
 void specfem::IO::seismogram_writer::write(
     specfem::compute::assembly &assembly) {
@@ -8,53 +62,128 @@ void specfem::IO::seismogram_writer::write(
 
   receivers.sync_seismograms();
 
-  const auto seismogram_types = receivers.get_seismogram_types();
+  if (this->type == specfem::enums::seismogram::format::ascii) {
+    for (auto [station_name, network_name, seismogram_type] :
+         receivers.get_stations()) {
+
+      const auto [components, extension] = get_components(seismogram_type);
+
+      const int ncomponents = components.size();
+      std::vector<std::ofstream> seismo_file(ncomponents);
+      for (int icomp = 0; icomp < ncomponents; icomp++) {
+        seismo_file[icomp].open(this->output_folder + "/" +
+                                trace{ station_name, network_name,
+                                       components[icomp], extension,
+                                       seismogram_type }
+                                    .name());
+      }
+
+      for (auto [time, value] : receivers.get_seismogram(
+               station_name, network_name, seismogram_type)) {
+        for (int icomp = 0; icomp < ncomponents; icomp++) {
+          seismo_file[icomp] << std::scientific << time << " "
+                             << std::scientific << value[icomp] << "\n";
+        }
+      }
+
+      for (int icomp = 0; icomp < ncomponents; icomp++) {
+        seismo_file[icomp].close();
+      }
+    }
+
+    return;
+  }
+
+  // Binary formats store the samples without the time column. Gather all
+  // the traces on the host first
+  std::vector<trace> traces;
+  std::vector<std::vector<type_real> > samples;
 
   for (auto [station_name, network_name, seismogram_type] :
        receivers.get_stations()) {
 
-    std::vector<std::string> filename;
-    switch (seismogram_type) {
-    case specfem::wavefield::type::displacement:
-      filename = { this->output_folder + "/" + network_name + "." +
-                       station_name + ".S2.BXX.semd",
-                   this->output_folder + "/" + network_name + "." +
-                       station_name + ".S2.BXZ.semd" };
-      break;
-    case specfem::wavefield::type::velocity:
-      filename = { this->output_folder + "/" + network_name + "." +
-                       station_name + ".S2.BXX.semv",
-                   this->output_folder + "/" + network_name + "." +
-                       station_name + ".S2.BXZ.semv" };
-      break;
-    case specfem::wavefield::type::acceleration:
-      filename = { this->output_folder + "/" + network_name + "." +
-                       station_name + ".S2.BXX.sema",
-                   this->output_folder + "/" + network_name + "." +
-                       station_name + ".S2.BXZ.sema" };
-      break;
-    case specfem::wavefield::type::pressure:
-      filename = { this->output_folder + "/" + network_name + "." +
-                   station_name + ".S2.PRE.semp" };
-      break;
-    }
-
-    const int ncomponents = filename.size();
-    std::vector<std::ofstream> seismo_file(ncomponents);
+    const auto [components, extension] = get_components(seismogram_type);
+
+    const int first = traces.size();
+    const int ncomponents = components.size();
     for (int icomp = 0; icomp < ncomponents; icomp++) {
-      seismo_file[icomp].open(filename[icomp]);
+      traces.push_back({ station_name, network_name, components[icomp],
+                         extension, seismogram_type });
+      samples.emplace_back();
     }
 
     for (auto [time, value] : receivers.get_seismogram(
              station_name, network_name, seismogram_type)) {
       for (int icomp = 0; icomp < ncomponents; icomp++) {
-        seismo_file[icomp] << std::scientific << time << " " << std::scientific
-                           << value[icomp] << "\n";
+        samples[first + icomp].push_back(value[icomp]);
       }
     }
+  }
 
-    for (int icomp = 0; icomp < ncomponents; icomp++) {
-      seismo_file[icomp].close();
+  const int ntraces = traces.size();
+  const int nsteps = (ntraces > 0) ? samples[0].size() : 0;
+
+  // Copy the selected traces into a (ntraces, nsteps) view
+  const auto get_traces = [&](const std::vector<int> &selection) {
+    specfem::kokkos::HostView2d<type_real> view(
+        "specfem::IO::seismogram_writer::traces", selection.size(), nsteps);
+    for (int i = 0; i < selection.size(); ++i) {
+      for (int istep = 0; istep < nsteps; ++istep) {
+        view(i, istep) = samples[selection[i]][istep];
+      }
     }
+    return view;
+  };
+
+  const type_real sampling_interval = this->dt * this->nstep_between_samples;
+
+  switch (this->type) {
+  case specfem::enums::seismogram::format::binary: {
+    // Single float32 bundle indexed by trace name
+    std::vector<int> selection(ntraces);
+    std::vector<std::string> names(ntraces);
+    for (int itrace = 0; itrace < ntraces; ++itrace) {
+      selection[itrace] = itrace;
+      names[itrace] = traces[itrace].name();
+    }
+    specfem::IO::trace_container::write(
+        this->output_folder + "/seismograms.bin", names, this->t0,
+        sampling_interval, get_traces(selection),
+        specfem::IO::trace_container::precision::float32);
+    break;
+  }
+  case specfem::enums::seismogram::format::seismic_unix: {
+    // One gather per component and seismogram type, traces in receiver order
+    std::map<std::string, std::vector<int> > gathers;
+    for (int itrace = 0; itrace < ntraces; ++itrace) {
+      gathers[get_gather_name(traces[itrace].component,
+                              traces[itrace].extension)]
+          .push_back(itrace);
+    }
+    for (const auto &[gather_name, selection] : gathers) {
+      specfem::IO::impl::write_seismic_unix(
+          this->output_folder + "/" + gather_name, this->t0,
+          sampling_interval, get_traces(selection));
+    }
+    break;
+  }
+  case specfem::enums::seismogram::format::sac: {
+    // One file per trace
+    specfem::kokkos::HostView1d<type_real> values(
+        "specfem::IO::seismogram_writer::values", nsteps);
+    for (int itrace = 0; itrace < ntraces; ++itrace) {
+      for (int istep = 0; istep < nsteps; ++istep) {
+        values(istep) = samples[itrace][istep];
+      }
+      const auto &info = traces[itrace];
+      specfem::IO::impl::write_sac(
+          this->output_folder + "/" + info.name() + ".sac", info.station_name,
+          info.network_name, info.component, info.seismogram_type, this->t0,
+          sampling_interval, values);
+    }
+    break;
+  }
+  default:
+    throw std::runtime_error("Unknown seismogram format");
   }
 }
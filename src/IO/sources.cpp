@@ -1,5 +1,7 @@
 // Internal Includes
 #include "IO/interface.hpp"
+#include "IO/seismogram/reader.hpp"
+#include "IO/seismogram/trace_container.hpp"
 #include "source/interface.hpp"
 #include "specfem_setup.hpp"
 #include "utilities/interface.hpp"
@@ -8,10 +10,99 @@
 // External Includes
 #include <boost/tokenizer.hpp>
 #include <fstream>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+namespace {
+
+// Read the traces of all external source time functions at once. Adjoint
+// simulations can have thousands of sources, reading the traces of every
+// source separately is slow
+void read_external_traces(
+    const std::vector<std::shared_ptr<specfem::sources::source> > &sources,
+    const int nsteps) {
+
+  using external = specfem::forcing_function::external;
+
+  std::vector<external *> ascii_sources;
+  std::vector<std::string> ascii_files;
+  std::map<std::string, std::vector<external *> > container_sources;
+
+  for (const auto &source : sources) {
+    auto *stf = dynamic_cast<external *>(source->get_forcing_function());
+    if (stf == nullptr)
+      continue;
+
+    if (stf->get_format() == specfem::enums::seismogram::format::binary) {
+      container_sources[stf->get_container()].push_back(stf);
+    } else {
+      ascii_sources.push_back(stf);
+      for (const auto &filename : stf->get_components()) {
+        if (!filename.empty())
+          ascii_files.push_back(filename);
+      }
+    }
+  }
+
+  // Distribute the traces (ntraces, nsteps) to the sources, in the order in
+  // which the non-empty components were collected
+  const auto set_traces =
+      [nsteps](const std::vector<external *> &stfs,
+               const specfem::kokkos::HostView2d<type_real> &data) {
+        int itrace = 0;
+        for (auto *stf : stfs) {
+          const auto components = stf->get_components();
+          specfem::kokkos::HostView2d<type_real> traces(
+              "specfem::forcing_function::external::traces", nsteps,
+              components.size());
+          for (int icomp = 0; icomp < components.size(); ++icomp) {
+            if (components[icomp].empty())
+              continue;
+            for (int istep = 0; istep < nsteps; ++istep) {
+              traces(istep, icomp) = data(itrace, istep);
+            }
+            itrace++;
+          }
+          stf->set_traces(traces);
+        }
+      };
+
+  if (!ascii_files.empty()) {
+    specfem::kokkos::HostView2d<type_real> data("ascii_traces",
+                                                ascii_files.size(), nsteps);
+    specfem::IO::read_ascii_traces(ascii_files, data);
+    set_traces(ascii_sources, data);
+  }
+
+  for (const auto &[filename, stfs] : container_sources) {
+    const specfem::IO::trace_container container(filename);
+    if (container.get_nsteps() != nsteps) {
+      std::ostringstream message;
+      message << "Trace container " << filename << " has "
+              << container.get_nsteps() << " samples per trace. Expected "
+              << nsteps;
+      throw std::runtime_error(message.str());
+    }
+
+    std::vector<std::string> names;
+    for (auto *stf : stfs) {
+      for (const auto &name : stf->get_components()) {
+        if (!name.empty())
+          names.push_back(name);
+      }
+    }
+
+    specfem::kokkos::HostView2d<type_real> data("container_traces",
+                                                names.size(), nsteps);
+    container.read(names, data);
+    set_traces(stfs, data);
+  }
+}
+
+} // namespace
+
 std::tuple<std::vector<std::shared_ptr<specfem::sources::source> >, type_real>
 specfem::IO::read_sources(const std::string sources_file, const int nsteps,
                           const type_real user_t0, const type_real dt,
@@ -121,6 +212,8 @@ specfem::IO::read_sources(const YAML::Node source_node, const int nsteps,
     throw std::runtime_error(message.str());
   }
 
+  read_external_traces(sources, nsteps);
+
   type_real min_t0 = std::numeric_limits<type_real>::max();
   type_real min_tshift = std::numeric_limits<type_real>::max();
   for (auto &source : sources) {
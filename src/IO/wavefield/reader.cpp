@@ -1,6 +1,7 @@
 #include "IO/wavefield/reader.hpp"
 #include "IO/ASCII/ASCII.hpp"
 #include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
 #include "IO/reader.hpp"
 #include "IO/wavefield/reader.tpp"
 
@@ -10,3 +11,6 @@ template class specfem::IO::wavefield_reader<
 
 template class specfem::IO::wavefield_reader<
     specfem::IO::ASCII<specfem::IO::read> >;
+
+template class specfem::IO::wavefield_reader<
+    specfem::IO::binary<specfem::IO::read> >;
@@ -13,11 +13,23 @@ specfem::compute::assembly::assembly(
     const type_real t0, const type_real dt, const int max_timesteps,
     const int max_sig_step, const int nsteps_between_samples,
     const specfem::simulation::type simulation,
-    const std::shared_ptr<specfem::IO::reader> &property_reader) {
-  this->mesh = { mesh.tags, mesh.control_nodes, quadratures };
+    const std::shared_ptr<specfem::IO::reader> &property_reader,
+    const std::shared_ptr<specfem::compute::assembly_cache> &cache) {
+  if (cache && cache->is_valid()) {
+    specfem::compute::points points;
+    specfem::compute::partial_derivatives partial_derivatives;
+    cache->read(points, partial_derivatives);
+    this->mesh = { mesh.tags, mesh.control_nodes, quadratures, points };
+    this->partial_derivatives = partial_derivatives;
+  } else {
+    this->mesh = { mesh.tags, mesh.control_nodes, quadratures };
+    this->partial_derivatives = { this->mesh };
+    if (cache) {
+      cache->write(this->mesh.points, this->partial_derivatives);
+    }
+  }
   this->element_types = { this->mesh.nspec, this->mesh.ngllz, this->mesh.ngllx,
                           this->mesh.mapping, mesh.tags };
-  this->partial_derivatives = { this->mesh };
   this->properties = { this->mesh.nspec, this->mesh.ngllz,
                        this->mesh.ngllx, this->element_types,
                        mesh.materials,   property_reader != nullptr };
@@ -54,3 +66,13 @@ specfem::compute::assembly::assembly(
                             this->boundaries };
   return;
 }
+
+void specfem::compute::assembly::compute_stiffness_coefficients() {
+  this->stiffness_coefficients = { this->mesh.nspec,
+                                   this->mesh.ngllz,
+                                   this->mesh.ngllx,
+                                   this->element_types,
+                                   this->partial_derivatives,
+                                   this->properties };
+  return;
+}
@@ -0,0 +1,210 @@
+#include "compute/assembly/cache.hpp"
+#include "kokkos_abstractions.h"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+constexpr char magic[8] = { 'S', 'P', 'E', 'C', 'A', 'S', 'M', '\0' };
+constexpr std::int32_t version = 1;
+
+// 64-bit FNV-1a hash
+constexpr std::uint64_t fnv_offset = 14695981039346656037ULL;
+constexpr std::uint64_t fnv_prime = 1099511628211ULL;
+
+std::uint64_t hash_bytes(std::uint64_t hash, const char *data,
+                         const std::size_t size) {
+  for (std::size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<unsigned char>(data[i]);
+    hash *= fnv_prime;
+  }
+  return hash;
+}
+
+template <typename T>
+std::uint64_t hash_value(std::uint64_t hash, const T &value) {
+  return hash_bytes(hash, reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T> void write_value(std::ofstream &stream, const T &value) {
+  stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T> T read_value(std::ifstream &stream) {
+  T value;
+  stream.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return value;
+}
+
+template <typename ViewType>
+void write_view(std::ofstream &stream, const ViewType &view) {
+  stream.write(reinterpret_cast<const char *>(view.data()),
+               view.size() * sizeof(typename ViewType::value_type));
+}
+
+template <typename ViewType>
+void read_view(std::ifstream &stream, const ViewType &view) {
+  stream.read(reinterpret_cast<char *>(view.data()),
+              view.size() * sizeof(typename ViewType::value_type));
+}
+
+} // namespace
+
+specfem::compute::assembly_cache::assembly_cache(
+    const std::string &filename, const std::string &database,
+    const specfem::quadrature::quadratures &quadratures)
+    : filename(filename) {
+
+  std::ifstream stream(database, std::ios::binary);
+  if (!stream.is_open()) {
+    std::ostringstream message;
+    message << "Could not open mesh database " << database
+            << " to generate assembly cache key";
+    throw std::runtime_error(message.str());
+  }
+
+  std::uint64_t hash = fnv_offset;
+  std::vector<char> buffer(1 << 20);
+  while (stream) {
+    stream.read(buffer.data(), buffer.size());
+    hash = hash_bytes(hash, buffer.data(), stream.gcount());
+  }
+
+  const auto &gll = quadratures.gll;
+  const int N = gll.get_N();
+  const auto xi = gll.get_hxi();
+  hash = hash_value(hash, N);
+  for (int i = 0; i < N; ++i) {
+    hash = hash_value(hash, xi(i));
+  }
+
+  // Per-element views are written as raw memory, so the cache is only valid
+  // for the layout it was written with
+  hash = hash_value(
+      hash, static_cast<std::int32_t>(
+                specfem::parallel_config::default_layout_config<
+                    Kokkos::DefaultExecutionSpace>::element_contiguous));
+
+  this->key = hash;
+}
+
+bool specfem::compute::assembly_cache::is_valid() const {
+  std::ifstream stream(this->filename, std::ios::binary);
+  if (!stream.is_open()) {
+    return false;
+  }
+
+  char file_magic[8];
+  stream.read(file_magic, sizeof(file_magic));
+  const auto file_version = read_value<std::int32_t>(stream);
+  const auto file_key = read_value<std::uint64_t>(stream);
+  const auto file_real_size = read_value<std::int32_t>(stream);
+
+  return stream.good() &&
+         (std::memcmp(file_magic, magic, sizeof(magic)) == 0) &&
+         (file_version == version) && (file_key == this->key) &&
+         (file_real_size == static_cast<std::int32_t>(sizeof(type_real)));
+}
+
+void specfem::compute::assembly_cache::read(
+    specfem::compute::points &points,
+    specfem::compute::partial_derivatives &partial_derivatives) const {
+
+  std::ifstream stream(this->filename, std::ios::binary);
+  if (!stream.is_open()) {
+    std::ostringstream message;
+    message << "Could not open assembly cache " << this->filename;
+    throw std::runtime_error(message.str());
+  }
+
+  // Header is validated in is_valid()
+  stream.seekg(sizeof(magic) + sizeof(std::int32_t) + sizeof(std::uint64_t) +
+               sizeof(std::int32_t));
+
+  const int nspec = read_value<std::int32_t>(stream);
+  const int ngllz = read_value<std::int32_t>(stream);
+  const int ngllx = read_value<std::int32_t>(stream);
+
+  points = { nspec, ngllz, ngllx };
+  points.xmin = read_value<type_real>(stream);
+  points.xmax = read_value<type_real>(stream);
+  points.zmin = read_value<type_real>(stream);
+  points.zmax = read_value<type_real>(stream);
+
+  read_view(stream, points.h_index_mapping);
+  read_view(stream, points.h_coord);
+
+  partial_derivatives = { nspec, ngllz, ngllx };
+  read_view(stream, partial_derivatives.h_xix);
+  read_view(stream, partial_derivatives.h_xiz);
+  read_view(stream, partial_derivatives.h_gammax);
+  read_view(stream, partial_derivatives.h_gammaz);
+  read_view(stream, partial_derivatives.h_jacobian);
+
+  if (!stream) {
+    std::ostringstream message;
+    message << "Assembly cache " << this->filename << " is truncated";
+    throw std::runtime_error(message.str());
+  }
+
+  Kokkos::deep_copy(points.index_mapping, points.h_index_mapping);
+  Kokkos::deep_copy(points.coord, points.h_coord);
+  partial_derivatives.sync_views();
+}
+
+void specfem::compute::assembly_cache::write(
+    const specfem::compute::points &points,
+    const specfem::compute::partial_derivatives &partial_derivatives) const {
+
+  // Write to a temporary file first so that an interrupted write never
+  // leaves a valid header in front of incomplete data
+  const std::string tmp_filename = this->filename + ".tmp";
+  {
+    std::ofstream stream(tmp_filename, std::ios::binary | std::ios::trunc);
+    if (!stream.is_open()) {
+      std::ostringstream message;
+      message << "Could not open assembly cache " << tmp_filename
+              << " for writing";
+      throw std::runtime_error(message.str());
+    }
+
+    stream.write(magic, sizeof(magic));
+    write_value<std::int32_t>(stream, version);
+    write_value<std::uint64_t>(stream, this->key);
+    write_value<std::int32_t>(stream, sizeof(type_real));
+    write_value<std::int32_t>(stream, points.nspec);
+    write_value<std::int32_t>(stream, points.ngllz);
+    write_value<std::int32_t>(stream, points.ngllx);
+    write_value<type_real>(stream, points.xmin);
+    write_value<type_real>(stream, points.xmax);
+    write_value<type_real>(stream, points.zmin);
+    write_value<type_real>(stream, points.zmax);
+
+    write_view(stream, points.h_index_mapping);
+    write_view(stream, points.h_coord);
+
+    write_view(stream, partial_derivatives.h_xix);
+    write_view(stream, partial_derivatives.h_xiz);
+    write_view(stream, partial_derivatives.h_gammax);
+    write_view(stream, partial_derivatives.h_gammaz);
+    write_view(stream, partial_derivatives.h_jacobian);
+
+    if (!stream) {
+      std::ostringstream message;
+      message << "Error writing assembly cache " << tmp_filename;
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  if (std::rename(tmp_filename.c_str(), this->filename.c_str()) != 0) {
+    std::ostringstream message;
+    message << "Could not move assembly cache to " << this->filename;
+    throw std::runtime_error(message.str());
+  }
+}
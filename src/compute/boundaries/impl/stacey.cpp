@@ -78,8 +78,7 @@ specfem::compute::impl::boundaries::stacey::stacey(
         &element_boundary_tags) {
 
   // We need to make sure that boundary index mapping maps every spectral
-  // element index to the corresponding index within
-  // quadrature_point_boundary_tag
+  // element index to the corresponding element within element_offset
 
   // mesh.absorbing_boundary.ispec_absorbing_boundary stores the ispec for
   // every Stacey surface. At the corners of the mesh, multiple surfaces
@@ -157,32 +156,23 @@ specfem::compute::impl::boundaries::stacey::stacey(
 
   // -------------------------------------------------------------------
 
-  // -------------------------------------------------------------------
+  // Compute edge normal and edge weight for every quadrature point that lies
+  // on an absorbing edge. At the corners of an element multiple edges share
+  // a quadrature point; the last edge found in the mesh is used.
 
-  // Initialize views
+  this->element_offset = IndexView("specfem::compute::impl::boundaries::"
+                                   "stacey::element_offset",
+                                   total_stacey_elements + 1);
 
-  this->quadrature_point_boundary_tag =
-      BoundaryTagView("specfem::compute::impl::boundaries::stacey::"
-                      "quadrature_point_boundary_tag",
-                      total_stacey_elements, ngllz, ngllx);
+  this->h_element_offset = Kokkos::create_mirror_view(element_offset);
 
-  this->h_quadrature_point_boundary_tag =
-      Kokkos::create_mirror_view(quadrature_point_boundary_tag);
+  std::vector<std::array<int, 3> > points;
+  std::vector<std::array<type_real, 2> > normals;
+  std::vector<type_real> weights;
 
-  this->edge_weight = EdgeWeightView("specfem::compute::impl::boundaries::"
-                                     "stacey::edge_weight",
-                                     total_stacey_elements, ngllz, ngllx);
-
-  this->edge_normal = EdgeNormalView("specfem::compute::impl::boundaries::"
-                                     "stacey::edge_normal",
-                                     total_stacey_elements, ngllz, ngllx, 2);
-
-  this->h_edge_weight = Kokkos::create_mirror_view(edge_weight);
-  this->h_edge_normal = Kokkos::create_mirror_view(edge_normal);
-
-  // -------------------------------------------------------------------
-
-  // Assign boundary values
+  // Index of every quadrature point of the current element within points.
+  // Only used during construction, the views store the boundary points alone
+  std::vector<int> element_points(ngllz * ngllx);
 
   for (auto &map : ispec_to_stacey) {
     const int ispec_compute = map.first;
@@ -192,16 +182,18 @@ specfem::compute::impl::boundaries::stacey::stacey(
     element_boundary_tags[ispec_compute] +=
         specfem::element::boundary_tag::stacey;
 
+    this->h_element_offset(local_index) = points.size();
+
+    std::fill(element_points.begin(), element_points.end(), -1);
+
     for (int i : indices) {
       for (int iz = 0; iz < ngllz; ++iz) {
         for (int ix = 0; ix < ngllx; ++ix) {
           if (is_on_boundary(stacey.type(i), iz, ix, ngllz, ngllx)) {
-            this->h_quadrature_point_boundary_tag(local_index, iz, ix) +=
-                specfem::element::boundary_tag::stacey;
-
             // Compute edge normal and edge weight
-            std::array<type_real, 2> weights = { quadrature.gll.h_weights(ix),
-                                                 quadrature.gll.h_weights(iz) };
+            std::array<type_real, 2> gll_weights = {
+              quadrature.gll.h_weights(ix), quadrature.gll.h_weights(iz)
+            };
             specfem::point::index<specfem::dimension::type::dim2> index(
                 ispec_compute, iz, ix);
             specfem::point::partial_derivatives<specfem::dimension::type::dim2,
@@ -211,19 +203,63 @@ specfem::compute::impl::boundaries::stacey::stacey(
                                            point_partial_derivatives);
 
             auto [edge_normal, edge_weight] = get_boundary_edge_and_weight(
-                stacey.type(i), weights, point_partial_derivatives);
+                stacey.type(i), gll_weights, point_partial_derivatives);
 
             // ------------------- Assign edge normal and edge weight
 
-            this->h_edge_weight(local_index, iz, ix) = edge_weight;
-            this->h_edge_normal(local_index, iz, ix, 0) = edge_normal[0];
-            this->h_edge_normal(local_index, iz, ix, 1) = edge_normal[1];
+            int &ipoint = element_points[iz * ngllx + ix];
+            if (ipoint == -1) {
+              ipoint = points.size();
+              points.push_back({ ispec_compute, iz, ix });
+              normals.push_back(edge_normal);
+              weights.push_back(edge_weight);
+            } else {
+              normals[ipoint] = edge_normal;
+              weights[ipoint] = edge_weight;
+            }
           }
         }
       }
     }
   }
 
+  this->npoints = points.size();
+  this->h_element_offset(total_stacey_elements) = npoints;
+
+  // -------------------------------------------------------------------
+
+  // Initialize views
+
+  this->point_ispec = IndexView(
+      "specfem::compute::impl::boundaries::stacey::point_ispec", npoints);
+  this->point_iz = IndexView(
+      "specfem::compute::impl::boundaries::stacey::point_iz", npoints);
+  this->point_ix = IndexView(
+      "specfem::compute::impl::boundaries::stacey::point_ix", npoints);
+
+  this->edge_weight = EdgeWeightView("specfem::compute::impl::boundaries::"
+                                     "stacey::edge_weight",
+                                     npoints);
+
+  this->edge_normal = EdgeNormalView("specfem::compute::impl::boundaries::"
+                                     "stacey::edge_normal",
+                                     npoints);
+
+  this->h_point_ispec = Kokkos::create_mirror_view(point_ispec);
+  this->h_point_iz = Kokkos::create_mirror_view(point_iz);
+  this->h_point_ix = Kokkos::create_mirror_view(point_ix);
+  this->h_edge_weight = Kokkos::create_mirror_view(edge_weight);
+  this->h_edge_normal = Kokkos::create_mirror_view(edge_normal);
+
+  for (int ipoint = 0; ipoint < npoints; ++ipoint) {
+    this->h_point_ispec(ipoint) = points[ipoint][0];
+    this->h_point_iz(ipoint) = points[ipoint][1];
+    this->h_point_ix(ipoint) = points[ipoint][2];
+    this->h_edge_weight(ipoint) = weights[ipoint];
+    this->h_edge_normal(ipoint, 0) = normals[ipoint][0];
+    this->h_edge_normal(ipoint, 1) = normals[ipoint][1];
+  }
+
   // // ------------------- Sort ispec_absorbing_boundary -------------------
   // // There might be better way of doing this but for now I am sorting
   // const int nelements = stacey.nelements;
@@ -345,8 +381,10 @@ specfem::compute::impl::boundaries::stacey::stacey(
   //   }
   // }
 
-  Kokkos::deep_copy(quadrature_point_boundary_tag,
-                    h_quadrature_point_boundary_tag);
+  Kokkos::deep_copy(element_offset, h_element_offset);
+  Kokkos::deep_copy(point_ispec, h_point_ispec);
+  Kokkos::deep_copy(point_iz, h_point_iz);
+  Kokkos::deep_copy(point_ix, h_point_ix);
   Kokkos::deep_copy(edge_weight, h_edge_weight);
   Kokkos::deep_copy(edge_normal, h_edge_normal);
 }
@@ -0,0 +1,241 @@
+#include "compute/cfl/cfl.hpp"
+#include "enumerations/material_definitions.hpp"
+#include "kokkos_abstractions.h"
+#include "point/coordinates.hpp"
+#include "point/properties.hpp"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+// Maximum wave speed at a quadrature point
+KOKKOS_INLINE_FUNCTION type_real max_velocity(
+    const specfem::point::properties<
+        specfem::dimension::type::dim2, specfem::element::medium_tag::elastic,
+        specfem::element::property_tag::isotropic, false> &properties) {
+  return Kokkos::sqrt(properties.lambdaplus2mu / properties.rho);
+}
+
+// Largest eigenvalue of a symmetric 3x3 matrix (a00, a01, a02, a11, a12,
+// a22), using the trigonometric solution of the characteristic polynomial
+KOKKOS_INLINE_FUNCTION type_real
+max_eigenvalue(const type_real a00, const type_real a01, const type_real a02,
+               const type_real a11, const type_real a12, const type_real a22) {
+  const type_real q = (a00 + a11 + a22) / 3.0;
+  const type_real off_diagonal = a01 * a01 + a02 * a02 + a12 * a12;
+  const type_real b00 = a00 - q;
+  const type_real b11 = a11 - q;
+  const type_real b22 = a22 - q;
+  const type_real p2 =
+      (b00 * b00 + b11 * b11 + b22 * b22 + 2.0 * off_diagonal) / 6.0;
+
+  if (p2 <= 0.0) {
+    return q;
+  }
+
+  const type_real p = Kokkos::sqrt(p2);
+  const type_real det = b00 * (b11 * b22 - a12 * a12) -
+                        a01 * (a01 * b22 - a12 * a02) +
+                        a02 * (a01 * a12 - b11 * a02);
+  type_real r = det / (2.0 * p2 * p);
+  r = (r < -1.0) ? -1.0 : ((r > 1.0) ? 1.0 : r);
+
+  return q + 2.0 * p * Kokkos::cos(Kokkos::acos(r) / 3.0);
+}
+
+// For a unit propagation direction n and polarization p the wave speed
+// satisfies rho v^2 = sym(p n) : C : sym(p n), and |sym(p n)| <= 1. The
+// largest eigenvalue of the stiffness tensor, acting on symmetric strains
+// (Mandel notation), therefore bounds the speed of every wave.
+KOKKOS_INLINE_FUNCTION type_real max_velocity(
+    const specfem::point::properties<
+        specfem::dimension::type::dim2, specfem::element::medium_tag::elastic,
+        specfem::element::property_tag::anisotropic, false> &properties) {
+  constexpr type_real sqrt2 = 1.4142135623730951;
+  const type_real c_max = max_eigenvalue(
+      properties.c11, properties.c13, sqrt2 * properties.c15, properties.c33,
+      sqrt2 * properties.c35, 2.0 * properties.c55);
+  return Kokkos::sqrt(c_max / properties.rho);
+}
+
+KOKKOS_INLINE_FUNCTION type_real max_velocity(
+    const specfem::point::properties<
+        specfem::dimension::type::dim2, specfem::element::medium_tag::acoustic,
+        specfem::element::property_tag::isotropic, false> &properties) {
+  return Kokkos::sqrt(properties.kappa * properties.rho_inverse);
+}
+
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+void compute_max_velocity(
+    const specfem::compute::element_types &element_types,
+    const specfem::compute::properties &properties, const int ngllz,
+    const int ngllx,
+    const specfem::kokkos::DeviceView1d<type_real> element_velocity) {
+
+  const auto elements =
+      element_types.get_elements_on_device(MediumTag, PropertyTag);
+  const int nelements = elements.extent(0);
+
+  if (nelements == 0) {
+    return;
+  }
+
+  using PointPropertiesType =
+      specfem::point::properties<specfem::dimension::type::dim2, MediumTag,
+                                 PropertyTag, false>;
+
+  Kokkos::parallel_for(
+      "specfem::compute::cfl::compute_max_velocity",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, nelements),
+      KOKKOS_LAMBDA(const int ielement) {
+        const int ispec = elements(ielement);
+        type_real velocity = 0.0;
+        for (int iz = 0; iz < ngllz; ++iz) {
+          for (int ix = 0; ix < ngllx; ++ix) {
+            const specfem::point::index<specfem::dimension::type::dim2> index(
+                ispec, iz, ix);
+            PointPropertiesType point_properties;
+            specfem::compute::load_on_device(index, properties,
+                                             point_properties);
+            const type_real point_velocity = max_velocity(point_properties);
+            velocity = (point_velocity > velocity) ? point_velocity : velocity;
+          }
+        }
+        element_velocity(ispec) = velocity;
+      });
+}
+
+} // namespace
+
+specfem::compute::cfl::cfl(const specfem::compute::mesh &mesh,
+                           const specfem::compute::element_types &element_types,
+                           const specfem::compute::properties &properties,
+                           const type_real dt, const type_real target_courant,
+                           const int nworst)
+    : dt(dt), target_courant(target_courant) {
+
+  const int nspec = mesh.nspec;
+  const int ngllz = mesh.ngllz;
+  const int ngllx = mesh.ngllx;
+  const auto coord = mesh.points.coord;
+
+  specfem::kokkos::DeviceView1d<type_real> min_distance(
+      "specfem::compute::cfl::min_distance", nspec);
+  specfem::kokkos::DeviceView1d<type_real> velocity(
+      "specfem::compute::cfl::velocity", nspec);
+  specfem::kokkos::DeviceView2d<type_real> center(
+      "specfem::compute::cfl::center", nspec, 2);
+
+  // Minimum distance between neighbouring GLL points and element center
+  Kokkos::parallel_for(
+      "specfem::compute::cfl::min_distance",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, nspec),
+      KOKKOS_LAMBDA(const int ispec) {
+        type_real distance = Kokkos::Experimental::finite_max_v<type_real>;
+        type_real xc = 0.0;
+        type_real zc = 0.0;
+        for (int iz = 0; iz < ngllz; ++iz) {
+          for (int ix = 0; ix < ngllx; ++ix) {
+            const type_real x = coord(0, ispec, iz, ix);
+            const type_real z = coord(1, ispec, iz, ix);
+            xc += x;
+            zc += z;
+            if (ix + 1 < ngllx) {
+              const type_real dx = coord(0, ispec, iz, ix + 1) - x;
+              const type_real dz = coord(1, ispec, iz, ix + 1) - z;
+              const type_real d = Kokkos::sqrt(dx * dx + dz * dz);
+              distance = (d < distance) ? d : distance;
+            }
+            if (iz + 1 < ngllz) {
+              const type_real dx = coord(0, ispec, iz + 1, ix) - x;
+              const type_real dz = coord(1, ispec, iz + 1, ix) - z;
+              const type_real d = Kokkos::sqrt(dx * dx + dz * dz);
+              distance = (d < distance) ? d : distance;
+            }
+          }
+        }
+        min_distance(ispec) = distance;
+        center(ispec, 0) = xc / (ngllz * ngllx);
+        center(ispec, 1) = zc / (ngllz * ngllx);
+      });
+
+#define CALL_COMPUTE_MAX_VELOCITY(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG)     \
+  compute_max_velocity<GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG)>(            \
+      element_types, properties, ngllz, ngllx, velocity);
+
+  CALL_MACRO_FOR_ALL_MATERIAL_SYSTEMS(
+      CALL_COMPUTE_MAX_VELOCITY,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
+
+#undef CALL_COMPUTE_MAX_VELOCITY
+
+  Kokkos::fence();
+
+  const auto h_min_distance =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), min_distance);
+  const auto h_velocity =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), velocity);
+  const auto h_center =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), center);
+
+  std::vector<element> elements(nspec);
+  this->element_courant.resize(nspec);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    this->element_courant[ispec] =
+        h_velocity(ispec) * dt / h_min_distance(ispec);
+    elements[ispec] = { mesh.mapping.compute_to_mesh(ispec),
+                        this->element_courant[ispec],
+                        h_min_distance(ispec),
+                        h_velocity(ispec),
+                        h_center(ispec, 0),
+                        h_center(ispec, 1) };
+  }
+
+  const int nreport = std::min(nworst, nspec);
+  std::partial_sort(elements.begin(), elements.begin() + nreport,
+                    elements.end(), [](const element &a, const element &b) {
+                      return a.courant > b.courant;
+                    });
+
+  this->courant = (nspec > 0) ? elements[0].courant : 0.0;
+  this->recommended_dt =
+      (this->courant > 0.0) ? dt * target_courant / this->courant : dt;
+  this->worst_elements.assign(elements.begin(), elements.begin() + nreport);
+}
+
+std::string specfem::compute::cfl::print() const {
+  std::ostringstream message;
+
+  message << "CFL stability analysis:\n"
+          << "-------------------------------\n"
+          << "Time step : " << dt << "\n"
+          << "Maximum Courant number : " << courant
+          << " (target : " << target_courant << ")\n"
+          << "Recommended time step : " << recommended_dt << "\n";
+
+  if (courant > target_courant) {
+    message << "WARNING : The time step is larger than the recommended time "
+               "step. The simulation may be unstable.\n";
+  }
+
+  message << "\nElements with the largest Courant number:\n"
+          << std::setw(10) << "ispec" << std::setw(14) << "Courant"
+          << std::setw(14) << "min(dx)" << std::setw(14) << "max(v)"
+          << std::setw(14) << "x" << std::setw(14) << "z" << "\n";
+
+  for (const auto &element : worst_elements) {
+    message << std::setw(10) << element.ispec << std::setw(14)
+            << element.courant << std::setw(14) << element.min_gll_distance
+            << std::setw(14) << element.max_velocity << std::setw(14)
+            << element.x << std::setw(14) << element.z << "\n";
+  }
+
+  return message.str();
+}
@@ -6,6 +6,8 @@
 #include "quadrature/interface.hpp"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
+#include <sstream>
+#include <stdexcept>
 #include <tuple>
 #include <vector>
 
@@ -281,6 +283,36 @@ specfem::compute::mesh::mesh(
   this->points = this->assemble();
 }
 
+specfem::compute::mesh::mesh(
+    const specfem::mesh::tags<specfem::dimension::type::dim2> &tags,
+    const specfem::mesh::control_nodes<specfem::dimension::type::dim2>
+        &m_control_nodes,
+    const specfem::quadrature::quadratures &m_quadratures,
+    const specfem::compute::points &points) {
+
+  this->mapping = specfem::compute::mesh_to_compute_mapping(tags);
+  this->control_nodes =
+      specfem::compute::control_nodes(this->mapping, m_control_nodes);
+  this->quadratures =
+      specfem::compute::quadrature(m_quadratures, m_control_nodes);
+  this->nspec = this->control_nodes.nspec;
+  this->ngllx = this->quadratures.gll.N;
+  this->ngllz = this->quadratures.gll.N;
+
+  if ((points.nspec != this->nspec) || (points.ngllz != this->ngllz) ||
+      (points.ngllx != this->ngllx)) {
+    std::ostringstream message;
+    message << "Assembled points do not match the mesh : expected (nspec, "
+               "ngllz, ngllx) = ("
+            << this->nspec << ", " << this->ngllz << ", " << this->ngllx
+            << "), got (" << points.nspec << ", " << points.ngllz << ", "
+            << points.ngllx << ")";
+    throw std::runtime_error(message.str());
+  }
+
+  this->points = points;
+}
+
 specfem::compute::points specfem::compute::mesh::assemble() {
 
   const int ngnod = control_nodes.ngnod;
@@ -4,24 +4,25 @@
 #include "macros.hpp"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 
 specfem::compute::partial_derivatives::partial_derivatives(const int nspec,
                                                            const int ngllz,
                                                            const int ngllx)
     : nspec(nspec), ngllz(ngllz), ngllx(ngllx),
-      xix("specfem::compute::partial_derivatives::xix", nspec, ngllz, ngllx),
-      xiz("specfem::compute::partial_derivatives::xiz", nspec, ngllz, ngllx),
-      gammax("specfem::compute::partial_derivatives::gammax", nspec, ngllz,
-             ngllx),
-      gammaz("specfem::compute::partial_derivatives::gammaz", nspec, ngllz,
-             ngllx),
-      jacobian("specfem::compute::partial_derivatives::jacobian", nspec, ngllz,
+      h_xix("specfem::compute::partial_derivatives::h_xix", nspec, ngllz,
+            ngllx),
+      h_xiz("specfem::compute::partial_derivatives::h_xiz", nspec, ngllz,
+            ngllx),
+      h_gammax("specfem::compute::partial_derivatives::h_gammax", nspec, ngllz,
                ngllx),
-      h_xix(Kokkos::create_mirror_view(xix)),
-      h_xiz(Kokkos::create_mirror_view(xiz)),
-      h_gammax(Kokkos::create_mirror_view(gammax)),
-      h_gammaz(Kokkos::create_mirror_view(gammaz)),
-      h_jacobian(Kokkos::create_mirror_view(jacobian)) {
+      h_gammaz("specfem::compute::partial_derivatives::h_gammaz", nspec, ngllz,
+               ngllx),
+      h_jacobian("specfem::compute::partial_derivatives::h_jacobian", nspec,
+                 ngllz, ngllx) {
+  this->sync_views();
   return;
 };
 
@@ -29,19 +30,16 @@ specfem::compute::partial_derivatives::partial_derivatives(
     const specfem::compute::mesh &mesh)
     : nspec(mesh.control_nodes.nspec), ngllz(mesh.quadratures.gll.N),
       ngllx(mesh.quadratures.gll.N),
-      xix("specfem::compute::partial_derivatives::xix", nspec, ngllz, ngllx),
-      xiz("specfem::compute::partial_derivatives::xiz", nspec, ngllz, ngllx),
-      gammax("specfem::compute::partial_derivatives::gammax", nspec, ngllz,
-             ngllx),
-      gammaz("specfem::compute::partial_derivatives::gammaz", nspec, ngllz,
-             ngllx),
-      jacobian("specfem::compute::partial_derivatives::jacobian", nspec, ngllz,
+      h_xix("specfem::compute::partial_derivatives::h_xix", nspec, ngllz,
+            ngllx),
+      h_xiz("specfem::compute::partial_derivatives::h_xiz", nspec, ngllz,
+            ngllx),
+      h_gammax("specfem::compute::partial_derivatives::h_gammax", nspec, ngllz,
+               ngllx),
+      h_gammaz("specfem::compute::partial_derivatives::h_gammaz", nspec, ngllz,
                ngllx),
-      h_xix(Kokkos::create_mirror_view(xix)),
-      h_xiz(Kokkos::create_mirror_view(xiz)),
-      h_gammax(Kokkos::create_mirror_view(gammax)),
-      h_gammaz(Kokkos::create_mirror_view(gammaz)),
-      h_jacobian(Kokkos::create_mirror_view(jacobian)) {
+      h_jacobian("specfem::compute::partial_derivatives::h_jacobian", nspec,
+                 ngllz, ngllx) {
 
   const int ngnod = mesh.control_nodes.ngnod;
   const int ngllxz = ngllz * ngllx;
@@ -91,19 +89,124 @@ specfem::compute::partial_derivatives::partial_derivatives(
             });
       });
 
-  Kokkos::deep_copy(xix, h_xix);
-  Kokkos::deep_copy(xiz, h_xiz);
-  Kokkos::deep_copy(gammax, h_gammax);
-  Kokkos::deep_copy(gammaz, h_gammaz);
-  Kokkos::deep_copy(jacobian, h_jacobian);
+  this->sync_views();
 
   return;
 }
 
 void specfem::compute::partial_derivatives::sync_views() {
-  Kokkos::deep_copy(xix, h_xix);
-  Kokkos::deep_copy(xiz, h_xiz);
-  Kokkos::deep_copy(gammax, h_gammax);
-  Kokkos::deep_copy(gammaz, h_gammaz);
-  Kokkos::deep_copy(jacobian, h_jacobian);
+
+  // An element is affine if the partial derivatives are constant (to within
+  // round-off) at every quadrature point. Round-off is measured against the
+  // magnitude of the element's derivatives, since components such as xiz
+  // vanish on elements aligned with the axes.
+  const auto is_constant = [&](const ViewType::HostMirror &view,
+                               const int ispec, const type_real scale) {
+    const type_real reference = view(ispec, 0, 0);
+    const type_real tolerance =
+        1e3 * std::numeric_limits<type_real>::epsilon() *
+        std::max(scale, static_cast<type_real>(1e-30));
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        if (std::abs(view(ispec, iz, ix) - reference) > tolerance)
+          return false;
+      }
+    }
+    return true;
+  };
+
+  const auto max_abs = [&](const ViewType::HostMirror &view, const int ispec) {
+    type_real value = 0.0;
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        value = std::max(value, std::abs(view(ispec, iz, ix)));
+      }
+    }
+    return value;
+  };
+
+  this->element_index =
+      IndexViewType("specfem::compute::partial_derivatives::element_index",
+                    nspec);
+  this->h_element_index = Kokkos::create_mirror_view(this->element_index);
+
+  this->ncurved = 0;
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    const type_real scale =
+        std::max({ max_abs(h_xix, ispec), max_abs(h_xiz, ispec),
+                   max_abs(h_gammax, ispec), max_abs(h_gammaz, ispec) });
+    const bool affine =
+        is_constant(h_xix, ispec, scale) && is_constant(h_xiz, ispec, scale) &&
+        is_constant(h_gammax, ispec, scale) &&
+        is_constant(h_gammaz, ispec, scale) &&
+        is_constant(h_jacobian, ispec, max_abs(h_jacobian, ispec));
+    this->h_element_index(ispec) = affine ? -1 : this->ncurved++;
+  }
+
+  this->xix = ViewType("specfem::compute::partial_derivatives::xix", ncurved,
+                       ngllz, ngllx);
+  this->xiz = ViewType("specfem::compute::partial_derivatives::xiz", ncurved,
+                       ngllz, ngllx);
+  this->gammax = ViewType("specfem::compute::partial_derivatives::gammax",
+                          ncurved, ngllz, ngllx);
+  this->gammaz = ViewType("specfem::compute::partial_derivatives::gammaz",
+                          ncurved, ngllz, ngllx);
+  this->jacobian = ViewType("specfem::compute::partial_derivatives::jacobian",
+                            ncurved, ngllz, ngllx);
+
+  this->element_xix = ElementViewType(
+      "specfem::compute::partial_derivatives::element_xix", nspec);
+  this->element_xiz = ElementViewType(
+      "specfem::compute::partial_derivatives::element_xiz", nspec);
+  this->element_gammax = ElementViewType(
+      "specfem::compute::partial_derivatives::element_gammax", nspec);
+  this->element_gammaz = ElementViewType(
+      "specfem::compute::partial_derivatives::element_gammaz", nspec);
+  this->element_jacobian = ElementViewType(
+      "specfem::compute::partial_derivatives::element_jacobian", nspec);
+
+  const auto h_curved_xix = Kokkos::create_mirror_view(xix);
+  const auto h_curved_xiz = Kokkos::create_mirror_view(xiz);
+  const auto h_curved_gammax = Kokkos::create_mirror_view(gammax);
+  const auto h_curved_gammaz = Kokkos::create_mirror_view(gammaz);
+  const auto h_curved_jacobian = Kokkos::create_mirror_view(jacobian);
+
+  const auto h_element_xix = Kokkos::create_mirror_view(element_xix);
+  const auto h_element_xiz = Kokkos::create_mirror_view(element_xiz);
+  const auto h_element_gammax = Kokkos::create_mirror_view(element_gammax);
+  const auto h_element_gammaz = Kokkos::create_mirror_view(element_gammaz);
+  const auto h_element_jacobian = Kokkos::create_mirror_view(element_jacobian);
+
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    const int icurved = this->h_element_index(ispec);
+    if (icurved < 0) {
+      h_element_xix(ispec) = h_xix(ispec, 0, 0);
+      h_element_xiz(ispec) = h_xiz(ispec, 0, 0);
+      h_element_gammax(ispec) = h_gammax(ispec, 0, 0);
+      h_element_gammaz(ispec) = h_gammaz(ispec, 0, 0);
+      h_element_jacobian(ispec) = h_jacobian(ispec, 0, 0);
+      continue;
+    }
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        h_curved_xix(icurved, iz, ix) = h_xix(ispec, iz, ix);
+        h_curved_xiz(icurved, iz, ix) = h_xiz(ispec, iz, ix);
+        h_curved_gammax(icurved, iz, ix) = h_gammax(ispec, iz, ix);
+        h_curved_gammaz(icurved, iz, ix) = h_gammaz(ispec, iz, ix);
+        h_curved_jacobian(icurved, iz, ix) = h_jacobian(ispec, iz, ix);
+      }
+    }
+  }
+
+  Kokkos::deep_copy(element_index, h_element_index);
+  Kokkos::deep_copy(xix, h_curved_xix);
+  Kokkos::deep_copy(xiz, h_curved_xiz);
+  Kokkos::deep_copy(gammax, h_curved_gammax);
+  Kokkos::deep_copy(gammaz, h_curved_gammaz);
+  Kokkos::deep_copy(jacobian, h_curved_jacobian);
+  Kokkos::deep_copy(element_xix, h_element_xix);
+  Kokkos::deep_copy(element_xiz, h_element_xiz);
+  Kokkos::deep_copy(element_gammax, h_element_gammax);
+  Kokkos::deep_copy(element_gammaz, h_element_gammaz);
+  Kokkos::deep_copy(element_jacobian, h_element_jacobian);
 }
@@ -7,8 +7,57 @@
 #include "specfem_mpi/interface.hpp"
 #include "specfem_setup.hpp"
 #include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
+namespace {
+
+// Tolerance (in reference coordinates) within which a receiver is snapped
+// onto a GLL node. locate_point converges until the residual between the
+// mapped point and the receiver is at round-off, i.e. of order eps * |x|,
+// which maps to 2 eps |x| / h along xi and gamma for an element of size h.
+type_real node_tolerance(
+    const specfem::point::global_coordinates<specfem::dimension::type::dim2>
+        &gcoord,
+    const specfem::compute::mesh &mesh, const int ispec) {
+  const auto coord = mesh.points.h_coord;
+  const int n = mesh.quadratures.gll.N - 1;
+
+  // Shortest edge of the element
+  const int corners[5][2] = {
+    { 0, 0 }, { 0, n }, { n, n }, { n, 0 }, { 0, 0 }
+  };
+  type_real size = std::numeric_limits<type_real>::max();
+  for (int i = 0; i < 4; ++i) {
+    const auto [iz0, ix0] = corners[i];
+    const auto [iz1, ix1] = corners[i + 1];
+    const type_real dx = coord(0, ispec, iz1, ix1) - coord(0, ispec, iz0, ix0);
+    const type_real dz = coord(1, ispec, iz1, ix1) - coord(1, ispec, iz0, ix0);
+    size = std::min(size, std::hypot(dx, dz));
+  }
+
+  const type_real magnitude = std::max(std::abs(gcoord.x), std::abs(gcoord.z));
+  return 16 * std::numeric_limits<type_real>::epsilon() *
+         (1 + 2 * magnitude / size);
+}
+
+// GLL node on which a receiver lies along one direction, -1 if it lies
+// between nodes
+int gll_node(const type_real coordinate,
+             const specfem::kokkos::HostMirror1d<type_real> gll_points,
+             const int N, const type_real tolerance) {
+  for (int i = 0; i < N; ++i) {
+    if (std::abs(coordinate - gll_points(i)) < tolerance) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+} // namespace
+
 specfem::compute::receivers::receivers(
     const int nspec, const int ngllz, const int ngllx, const int max_sig_step,
     const type_real dt, const type_real t0, const int nsteps_between_samples,
@@ -19,9 +68,11 @@ specfem::compute::receivers::receivers(
     const specfem::mesh::tags<specfem::dimension::type::dim2> &tags,
     const specfem::compute::element_types &element_types)
     : nspec(nspec),
-      lagrange_interpolant("specfem::compute::receivers::lagrange_interpolant",
-                           receivers.size(), mesh.ngllz, mesh.ngllx),
-      h_lagrange_interpolant(Kokkos::create_mirror_view(lagrange_interpolant)),
+      lagrange_factors("specfem::compute::receivers::lagrange_factors",
+                       receivers.size(), mesh.quadratures.gll.N),
+      h_lagrange_factors(Kokkos::create_mirror_view(lagrange_factors)),
+      node_index("specfem::compute::receivers::node_index", receivers.size()),
+      h_node_index(Kokkos::create_mirror_view(node_index)),
       elements("specfem::compute::receivers::elements", receivers.size()),
       h_elements(Kokkos::create_mirror_view(elements)),
       element_types(element_types), impl::StationIterator(receivers.size(),
@@ -80,20 +131,31 @@ specfem::compute::receivers::receivers(
         specfem::quadrature::gll::Lagrange::compute_lagrange_interpolants(
             lcoord.gamma, mesh.quadratures.gll.N, gamma);
 
-    for (int iz = 0; iz < mesh.ngllz; ++iz) {
-      for (int ix = 0; ix < mesh.ngllx; ++ix) {
-        type_real hlagrange = hxi_receiver(ix) * hgamma_receiver(iz);
+    const int N = mesh.quadratures.gll.N;
 
-        h_lagrange_interpolant(ireceiver, iz, ix, 0) = hlagrange;
-        h_lagrange_interpolant(ireceiver, iz, ix, 1) = hlagrange;
+    // Along each direction store the 1D Lagrange factors and the GLL node on
+    // which the receiver lies. Receivers on a node have a single non-zero
+    // factor, which lets the seismogram kernel skip the other GLL lines.
+    const type_real tolerance = node_tolerance(gcoord, mesh, lcoord.ispec);
+    h_node_index(ireceiver, 0) = gll_node(lcoord.xi, xi, N, tolerance);
+    h_node_index(ireceiver, 1) = gll_node(lcoord.gamma, gamma, N, tolerance);
 
-        h_sine_receiver_angle(ireceiver) = std::sin(
-            Kokkos::numbers::pi_v<type_real> / 180 * receiver->get_angle());
-
-        h_cosine_receiver_angle(ireceiver) = std::cos(
-            Kokkos::numbers::pi_v<type_real> / 180 * receiver->get_angle());
-      }
+    for (int i = 0; i < N; ++i) {
+      h_lagrange_factors(ireceiver, i, 0) =
+          (h_node_index(ireceiver, 0) < 0)
+              ? hxi_receiver(i)
+              : static_cast<type_real>(i == h_node_index(ireceiver, 0));
+      h_lagrange_factors(ireceiver, i, 1) =
+          (h_node_index(ireceiver, 1) < 0)
+              ? hgamma_receiver(i)
+              : static_cast<type_real>(i == h_node_index(ireceiver, 1));
     }
+
+    h_sine_receiver_angle(ireceiver) = std::sin(
+        Kokkos::numbers::pi_v<type_real> / 180 * receiver->get_angle());
+
+    h_cosine_receiver_angle(ireceiver) = std::cos(
+        Kokkos::numbers::pi_v<type_real> / 180 * receiver->get_angle());
   }
 
 #define COUNT_RECEIVERS_PER_MATERIAL_SYSTEM(DIMENTION_TAG, MEDIUM_TAG,         \
@@ -190,7 +252,8 @@ specfem::compute::receivers::receivers(
 
 #undef ASSIGN_RECEIVERS_PER_MATERIAL_SYSTEM
 
-  Kokkos::deep_copy(lagrange_interpolant, h_lagrange_interpolant);
+  Kokkos::deep_copy(lagrange_factors, h_lagrange_factors);
+  Kokkos::deep_copy(node_index, h_node_index);
   Kokkos::deep_copy(elements, h_elements);
 
   return;
@@ -0,0 +1,186 @@
+#include "compute/stiffness_coefficients/stiffness_coefficients.hpp"
+#include "medium/compute_stress.hpp"
+#include "point/field_derivatives.hpp"
+#include "point/partial_derivatives.hpp"
+#include "point/properties.hpp"
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+specfem::medium::stiffness_coefficients_container<MediumTag, PropertyTag>
+compute_coefficients(
+    const Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace> elements,
+    const int ngllz, const int ngllx,
+    const specfem::compute::partial_derivatives &partial_derivatives,
+    const specfem::compute::properties &properties,
+    const specfem::kokkos::HostView1d<int> property_index_mapping) {
+
+  constexpr auto dimension = specfem::dimension::type::dim2;
+
+  using PointCoefficientsType =
+      specfem::point::stiffness_coefficients<dimension, MediumTag, PropertyTag,
+                                             false>;
+  using PointPartialDerivativesType =
+      specfem::point::partial_derivatives<dimension, false, false>;
+  using PointPropertiesType =
+      specfem::point::properties<dimension, MediumTag, PropertyTag, false>;
+  using PointFieldDerivativesType =
+      specfem::point::field_derivatives<dimension, MediumTag, false>;
+
+  constexpr int components = PointCoefficientsType::components;
+  constexpr int num_dimensions = PointCoefficientsType::num_dimensions;
+  constexpr int size = PointCoefficientsType::size;
+
+  const int nelements = elements.extent(0);
+
+  specfem::medium::stiffness_coefficients_container<MediumTag, PropertyTag>
+      container(nelements, ngllz, ngllx);
+
+  for (int i = 0; i < nelements; ++i) {
+    const int ispec = elements(i);
+    property_index_mapping(ispec) = i;
+
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        const specfem::point::index<dimension> index(ispec, iz, ix);
+
+        PointPartialDerivativesType point_partial_derivatives;
+        specfem::compute::load_on_host(index, partial_derivatives,
+                                       point_partial_derivatives);
+
+        PointPropertiesType point_properties;
+        specfem::compute::load_on_host(index, properties, point_properties);
+
+        // Row (a, c) of the coefficient matrix maps to F(a, c), column (b, j)
+        // to the reference gradient d u_j / d xi_b. The columns are obtained
+        // by evaluating the stress integrand for unit reference gradients.
+        type_real K[size][size];
+
+        for (int b = 0; b < num_dimensions; ++b) {
+          const type_real dxib_dx = (b == 0) ? point_partial_derivatives.xix
+                                             : point_partial_derivatives.gammax;
+          const type_real dxib_dz = (b == 0) ? point_partial_derivatives.xiz
+                                             : point_partial_derivatives.gammaz;
+          for (int j = 0; j < components; ++j) {
+            typename PointFieldDerivativesType::ViewType du(
+                static_cast<type_real>(0.0));
+            du(0, j) = dxib_dx;
+            du(1, j) = dxib_dz;
+
+            const PointFieldDerivativesType field_derivatives(du);
+
+            const auto point_stress = specfem::medium::compute_stress(
+                point_properties, field_derivatives);
+
+            const auto F = point_stress * point_partial_derivatives;
+
+            for (int a = 0; a < num_dimensions; ++a) {
+              for (int c = 0; c < components; ++c) {
+                K[a * components + c][b * components + j] = F(a, c);
+              }
+            }
+          }
+        }
+
+        type_real max_value = 0.0;
+        for (int row = 0; row < size; ++row) {
+          for (int col = 0; col < size; ++col) {
+            max_value = std::max(max_value, std::abs(K[row][col]));
+          }
+        }
+
+        const type_real tolerance =
+            static_cast<type_real>(1e-4) * max_value;
+
+        PointCoefficientsType point_coefficients;
+
+        for (int row = 0; row < size; ++row) {
+          for (int col = row; col < size; ++col) {
+            if (std::abs(K[row][col] - K[col][row]) > tolerance) {
+              std::ostringstream message;
+              message << "Error computing fused stiffness coefficients for "
+                      << specfem::element::to_string(MediumTag, PropertyTag)
+                      << " element " << ispec << " (iz = " << iz
+                      << ", ix = " << ix
+                      << "). The coefficient matrix is not symmetric. "
+                      << "Disable fused stiffness coefficients.";
+              throw std::runtime_error(message.str());
+            }
+            point_coefficients.coefficients[PointCoefficientsType::packed_index(
+                row, col)] = K[row][col];
+          }
+        }
+
+        const specfem::point::index<dimension> l_index(i, iz, ix);
+        container.assign(l_index, point_coefficients);
+      }
+    }
+  }
+
+  container.copy_to_device();
+
+  return container;
+}
+} // namespace
+
+specfem::compute::stiffness_coefficients::stiffness_coefficients(
+    const int nspec, const int ngllz, const int ngllx,
+    const specfem::compute::element_types &element_types,
+    const specfem::compute::partial_derivatives &partial_derivatives,
+    const specfem::compute::properties &properties) {
+
+  this->nspec = nspec;
+  this->ngllz = ngllz;
+  this->ngllx = ngllx;
+
+  this->property_index_mapping =
+      Kokkos::View<int *, Kokkos::DefaultExecutionSpace>(
+          "specfem::compute::stiffness_coefficients::property_index_mapping",
+          nspec);
+
+  this->h_property_index_mapping =
+      Kokkos::create_mirror_view(property_index_mapping);
+
+  const auto elastic_isotropic_elements = element_types.get_elements_on_host(
+      specfem::element::medium_tag::elastic,
+      specfem::element::property_tag::isotropic);
+
+  const auto elastic_anisotropic_elements = element_types.get_elements_on_host(
+      specfem::element::medium_tag::elastic,
+      specfem::element::property_tag::anisotropic);
+
+  const auto acoustic_elements = element_types.get_elements_on_host(
+      specfem::element::medium_tag::acoustic,
+      specfem::element::property_tag::isotropic);
+
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    h_property_index_mapping(ispec) = -1;
+  }
+
+  acoustic_isotropic =
+      compute_coefficients<specfem::element::medium_tag::acoustic,
+                           specfem::element::property_tag::isotropic>(
+          acoustic_elements, ngllz, ngllx, partial_derivatives, properties,
+          h_property_index_mapping);
+
+  elastic_isotropic =
+      compute_coefficients<specfem::element::medium_tag::elastic,
+                           specfem::element::property_tag::isotropic>(
+          elastic_isotropic_elements, ngllz, ngllx, partial_derivatives,
+          properties, h_property_index_mapping);
+
+  elastic_anisotropic =
+      compute_coefficients<specfem::element::medium_tag::elastic,
+                           specfem::element::property_tag::anisotropic>(
+          elastic_anisotropic_elements, ngllz, ngllx, partial_derivatives,
+          properties, h_property_index_mapping);
+
+  Kokkos::deep_copy(property_index_mapping, h_property_index_mapping);
+
+  this->enabled = true;
+
+  return;
+}
@@ -1,4 +1,22 @@
 #include "compute/element_types/element_types.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+// Boundary tag of the volume kernel used for elements of a given boundary tag
+specfem::element::boundary_tag
+volume_boundary_tag(const specfem::element::boundary_tag tag) {
+  switch (tag) {
+  case specfem::element::boundary_tag::stacey:
+    return specfem::element::boundary_tag::none;
+  case specfem::element::boundary_tag::composite_stacey_dirichlet:
+    return specfem::element::boundary_tag::acoustic_free_surface;
+  default:
+    return tag;
+  }
+}
+} // namespace
 
 specfem::compute::element_types::element_types(
     const int nspec, const int ngllz, const int ngllx,
@@ -232,6 +250,64 @@ specfem::compute::element_types::element_types(
               BOUNDARY_TAG_STACEY, BOUNDARY_TAG_COMPOSITE_STACEY_DIRICHLET))
 
 #undef ASSIGN_ELEMENT_TYPES_INDICES
+
+  // The volume kernel uses SIMD loads over consecutive spectral elements. The
+  // elements sharing a volume kernel need to be contiguous (see ELEMENT_TYPES)
+#define ASSIGN_VOLUME_ELEMENTS_INDICES(DIMENSION_TAG, MEDIUM_TAG,              \
+                                       PROPERTY_TAG, BOUNDARY_TAG)             \
+  {                                                                            \
+    std::vector<int> ispecs;                                                   \
+    for (int ispec = 0; ispec < nspec; ispec++) {                              \
+      if (medium_tags(ispec) == GET_TAG(MEDIUM_TAG) &&                         \
+          property_tags(ispec) == GET_TAG(PROPERTY_TAG) &&                     \
+          volume_boundary_tag(boundary_tags(ispec)) ==                         \
+              GET_TAG(BOUNDARY_TAG)) {                                         \
+        if (!ispecs.empty() && ispecs.back() != ispec - 1) {                   \
+          std::ostringstream message;                                          \
+          message << "Error: Elements of type "                                \
+                  << specfem::element::to_string(GET_TAG(MEDIUM_TAG),          \
+                                                 GET_TAG(PROPERTY_TAG),        \
+                                                 GET_TAG(BOUNDARY_TAG))        \
+                  << " are not contiguous";                                    \
+          throw std::runtime_error(message.str());                             \
+        }                                                                      \
+        ispecs.push_back(ispec);                                               \
+      }                                                                        \
+    }                                                                          \
+    this->CREATE_VARIABLE_NAME(volume_elements, GET_NAME(DIMENSION_TAG),       \
+                               GET_NAME(MEDIUM_TAG), GET_NAME(PROPERTY_TAG),   \
+                               GET_NAME(BOUNDARY_TAG)) =                       \
+        IndexViewType("specfem::compute::element_types::volume_elements",      \
+                      ispecs.size());                                          \
+    this->CREATE_VARIABLE_NAME(h_volume_elements, GET_NAME(DIMENSION_TAG),     \
+                               GET_NAME(MEDIUM_TAG), GET_NAME(PROPERTY_TAG),   \
+                               GET_NAME(BOUNDARY_TAG)) =                       \
+        Kokkos::create_mirror_view(this->CREATE_VARIABLE_NAME(                 \
+            volume_elements, GET_NAME(DIMENSION_TAG), GET_NAME(MEDIUM_TAG),    \
+            GET_NAME(PROPERTY_TAG), GET_NAME(BOUNDARY_TAG)));                  \
+    for (std::size_t i = 0; i < ispecs.size(); i++) {                          \
+      this->CREATE_VARIABLE_NAME(h_volume_elements, GET_NAME(DIMENSION_TAG),   \
+                                 GET_NAME(MEDIUM_TAG), GET_NAME(PROPERTY_TAG), \
+                                 GET_NAME(BOUNDARY_TAG))(i) = ispecs[i];       \
+    }                                                                          \
+    Kokkos::deep_copy(                                                         \
+        this->CREATE_VARIABLE_NAME(volume_elements, GET_NAME(DIMENSION_TAG),   \
+                                   GET_NAME(MEDIUM_TAG),                       \
+                                   GET_NAME(PROPERTY_TAG),                     \
+                                   GET_NAME(BOUNDARY_TAG)),                    \
+        this->CREATE_VARIABLE_NAME(h_volume_elements, GET_NAME(DIMENSION_TAG), \
+                                   GET_NAME(MEDIUM_TAG),                       \
+                                   GET_NAME(PROPERTY_TAG),                     \
+                                   GET_NAME(BOUNDARY_TAG)));                   \
+  }
+
+  CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+      ASSIGN_VOLUME_ELEMENTS_INDICES,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+              WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef ASSIGN_VOLUME_ELEMENTS_INDICES
 }
 
 Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace>
@@ -359,3 +435,55 @@ specfem::compute::element_types::get_elements_on_device(
 
 #undef RETURN_VARIABLE
 }
+
+Kokkos::View<int *, Kokkos::DefaultHostExecutionSpace>
+specfem::compute::element_types::get_volume_elements_on_host(
+    const specfem::element::medium_tag medium_tag,
+    const specfem::element::property_tag property_tag,
+    const specfem::element::boundary_tag boundary_tag) const {
+
+#define RETURN_VARIABLE(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG, BOUNDARY_TAG) \
+  if (GET_TAG(MEDIUM_TAG) == medium_tag &&                                     \
+      GET_TAG(PROPERTY_TAG) == property_tag &&                                 \
+      GET_TAG(BOUNDARY_TAG) == boundary_tag) {                                 \
+    return this->CREATE_VARIABLE_NAME(                                         \
+        h_volume_elements, GET_NAME(DIMENSION_TAG), GET_NAME(MEDIUM_TAG),      \
+        GET_NAME(PROPERTY_TAG), GET_NAME(BOUNDARY_TAG));                       \
+  }
+
+  CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+      RETURN_VARIABLE,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+              WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef RETURN_VARIABLE
+
+  return {};
+}
+
+Kokkos::View<int *, Kokkos::DefaultExecutionSpace>
+specfem::compute::element_types::get_volume_elements_on_device(
+    const specfem::element::medium_tag medium_tag,
+    const specfem::element::property_tag property_tag,
+    const specfem::element::boundary_tag boundary_tag) const {
+
+#define RETURN_VARIABLE(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG, BOUNDARY_TAG) \
+  if (GET_TAG(MEDIUM_TAG) == medium_tag &&                                     \
+      GET_TAG(PROPERTY_TAG) == property_tag &&                                 \
+      GET_TAG(BOUNDARY_TAG) == boundary_tag) {                                 \
+    return this->CREATE_VARIABLE_NAME(                                         \
+        volume_elements, GET_NAME(DIMENSION_TAG), GET_NAME(MEDIUM_TAG),        \
+        GET_NAME(PROPERTY_TAG), GET_NAME(BOUNDARY_TAG));                       \
+  }
+
+  CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+      RETURN_VARIABLE,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+              WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef RETURN_VARIABLE
+
+  return {};
+}
@@ -0,0 +1,43 @@
+#include "kokkos_kernels/impl/compute_combined_interaction.hpp"
+#include "enumerations/material_definitions.hpp"
+#include "kokkos_kernels/impl/compute_combined_interaction.tpp"
+
+#define STIFFNESS_INSTANTIATION_MACRO(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG, \
+                                      BOUNDARY_TAG)                            \
+  /** instantiation for NGLL = 5     */                                        \
+  template void                                                                \
+  specfem::kokkos_kernels::impl::compute_combined_stiffness_interaction<       \
+      GET_TAG(DIMENSION_TAG), 5, GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG),   \
+      GET_TAG(BOUNDARY_TAG)>(const specfem::compute::assembly &,               \
+                             const type_real &);                               \
+  /** instantiation for NGLL = 8     */                                        \
+  template void                                                                \
+  specfem::kokkos_kernels::impl::compute_combined_stiffness_interaction<       \
+      GET_TAG(DIMENSION_TAG), 8, GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG),   \
+      GET_TAG(BOUNDARY_TAG)>(const specfem::compute::assembly &,               \
+                             const type_real &);
+
+CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+    STIFFNESS_INSTANTIATION_MACRO,
+    WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+        WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+            WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef STIFFNESS_INSTANTIATION_MACRO
+
+#define INERTIAL_INSTANTIATION_MACRO(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG)  \
+  /** instantiation for NGLL = 5     */                                        \
+  template void specfem::kokkos_kernels::impl::compute_inertial_derivatives<   \
+      GET_TAG(DIMENSION_TAG), 5, GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG)>(  \
+      const specfem::compute::assembly &, const type_real &);                  \
+  /** instantiation for NGLL = 8     */                                        \
+  template void specfem::kokkos_kernels::impl::compute_inertial_derivatives<   \
+      GET_TAG(DIMENSION_TAG), 8, GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG)>(  \
+      const specfem::compute::assembly &, const type_real &);
+
+CALL_MACRO_FOR_ALL_MATERIAL_SYSTEMS(
+    INERTIAL_INSTANTIATION_MACRO,
+    WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+        WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
+
+#undef INERTIAL_INSTANTIATION_MACRO
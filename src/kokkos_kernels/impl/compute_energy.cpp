@@ -0,0 +1,43 @@
+#include "kokkos_kernels/impl/compute_energy.hpp"
+#include "kokkos_kernels/impl/compute_energy.tpp"
+
+#define FIELD_STATISTICS_INSTANTIATION(DIMENSION_TAG, MEDIUM_TAG)              \
+  template void specfem::kokkos_kernels::impl::compute_field_statistics<       \
+      GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::forward,   \
+      GET_TAG(MEDIUM_TAG)>(const specfem::compute::assembly &, type_real &,    \
+                           int &);                                             \
+  template void specfem::kokkos_kernels::impl::compute_field_statistics<       \
+      GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::backward,  \
+      GET_TAG(MEDIUM_TAG)>(const specfem::compute::assembly &, type_real &,    \
+                           int &);                                             \
+  template void specfem::kokkos_kernels::impl::compute_field_statistics<       \
+      GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::adjoint,   \
+      GET_TAG(MEDIUM_TAG)>(const specfem::compute::assembly &, type_real &,    \
+                           int &);
+
+CALL_MACRO_FOR_ALL_MEDIUM_TAGS(FIELD_STATISTICS_INSTANTIATION,
+                               WHERE(DIMENSION_TAG_DIM2)
+                                   WHERE(MEDIUM_TAG_ELASTIC,
+                                         MEDIUM_TAG_ACOUSTIC))
+
+#undef FIELD_STATISTICS_INSTANTIATION
+
+#define ENERGY_INSTANTIATION(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG,          \
+                             WAVEFIELD)                                        \
+  template void specfem::kokkos_kernels::impl::compute_energy<                 \
+      GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::WAVEFIELD, \
+      GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG)>(                             \
+      const specfem::compute::assembly &, type_real &, type_real &);
+
+#define INSTANTIATION_MACRO(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG)           \
+  ENERGY_INSTANTIATION(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG, forward)       \
+  ENERGY_INSTANTIATION(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG, backward)      \
+  ENERGY_INSTANTIATION(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG, adjoint)
+
+CALL_MACRO_FOR_ALL_MATERIAL_SYSTEMS(
+    INSTANTIATION_MACRO,
+    WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+        WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
+
+#undef INSTANTIATION_MACRO
+#undef ENERGY_INSTANTIATION
@@ -0,0 +1,26 @@
+#include "kokkos_kernels/impl/compute_stacey_interaction.hpp"
+#include "enumerations/material_definitions.hpp"
+#include "kokkos_kernels/impl/compute_stacey_interaction.tpp"
+
+#define INSTANTIATION_MACRO(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG,           \
+                            BOUNDARY_TAG)                                      \
+  template void specfem::kokkos_kernels::impl::compute_stacey_interaction<     \
+      GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::forward,   \
+      GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(      \
+      const specfem::compute::assembly &, const int &);                        \
+  template void specfem::kokkos_kernels::impl::compute_stacey_interaction<     \
+      GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::backward,  \
+      GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(      \
+      const specfem::compute::assembly &, const int &);                        \
+  template void specfem::kokkos_kernels::impl::compute_stacey_interaction<     \
+      GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::adjoint,   \
+      GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(      \
+      const specfem::compute::assembly &, const int &);
+
+CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+    INSTANTIATION_MACRO,
+    WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+        WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+            WHERE(BOUNDARY_TAG_STACEY, BOUNDARY_TAG_COMPOSITE_STACEY_DIRICHLET))
+
+#undef INSTANTIATION_MACRO
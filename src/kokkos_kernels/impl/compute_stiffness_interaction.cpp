@@ -29,14 +29,23 @@
   template void specfem::kokkos_kernels::impl::compute_stiffness_interaction<  \
       GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::adjoint,   \
       8, GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(   \
-      const specfem::compute::assembly &, const int &);
+      const specfem::compute::assembly &, const int &);                        \
+  /** instantiation on element subsets (local time stepping) */               \
+  template void specfem::kokkos_kernels::impl::compute_stiffness_interaction<  \
+      GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::buffer, 5, \
+      GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(      \
+      const specfem::compute::assembly &, const int &,                         \
+      const Kokkos::View<int *, Kokkos::DefaultExecutionSpace> &);             \
+  template void specfem::kokkos_kernels::impl::compute_stiffness_interaction<  \
+      GET_TAG(DIMENSION_TAG), specfem::wavefield::simulation_field::buffer, 8, \
+      GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(      \
+      const specfem::compute::assembly &, const int &,                         \
+      const Kokkos::View<int *, Kokkos::DefaultExecutionSpace> &);
 
 CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
     INSTANTIATION_MACRO,
     WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
         WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
-            WHERE(BOUNDARY_TAG_STACEY, BOUNDARY_TAG_NONE,
-                  BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE,
-                  BOUNDARY_TAG_COMPOSITE_STACEY_DIRICHLET))
+            WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
 
 #undef INSTANTIATION_MACRO
@@ -0,0 +1,86 @@
+#include "parameter_parser/checkpoint.hpp"
+#include "IO/checkpoint/checkpoint.hpp"
+#include "periodic_tasks/checkpoint.hpp"
+#include <boost/filesystem.hpp>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+specfem::runtime_configuration::checkpoint::checkpoint(
+    const YAML::Node &Node) {
+
+  const std::string directory = [&]() -> std::string {
+    if (Node["directory"]) {
+      return Node["directory"].as<std::string>();
+    } else {
+      return boost::filesystem::current_path().string();
+    }
+  }();
+
+  if (!boost::filesystem::is_directory(boost::filesystem::path(directory))) {
+    std::ostringstream message;
+    message << "Checkpoint folder : " << directory << " does not exist.";
+    throw std::runtime_error(message.str());
+  }
+
+  const int time_interval = [&]() -> int {
+    if (Node["time-interval"]) {
+      return Node["time-interval"].as<int>();
+    } else {
+      throw std::runtime_error(
+          "Time interval not specified in the checkpoint section");
+    }
+  }();
+
+  const bool restart = [&]() -> bool {
+    if (Node["restart"]) {
+      return Node["restart"].as<bool>();
+    } else {
+      return false;
+    }
+  }();
+
+  *this = specfem::runtime_configuration::checkpoint(directory, time_interval,
+                                                     restart);
+
+  return;
+}
+
+std::string specfem::runtime_configuration::checkpoint::get_filename() const {
+  return (boost::filesystem::path(directory) / "checkpoint.bin").string();
+}
+
+std::shared_ptr<specfem::periodic_tasks::periodic_task>
+specfem::runtime_configuration::checkpoint::instantiate_checkpoint(
+    const specfem::compute::assembly &assembly,
+    const std::shared_ptr<specfem::time_scheme::time_scheme> &time_scheme,
+    const specfem::simulation::type simulation,
+    const std::vector<specfem::IO::checkpoint::entry> &task_state) const {
+  return std::make_shared<specfem::periodic_tasks::checkpoint>(
+      assembly, time_scheme, simulation, time_interval, this->get_filename(),
+      task_state);
+}
+
+bool specfem::runtime_configuration::checkpoint::restore(
+    const specfem::compute::assembly &assembly,
+    specfem::time_scheme::time_scheme &time_scheme,
+    const specfem::simulation::type simulation,
+    const std::vector<specfem::IO::checkpoint::entry> &task_state) const {
+
+  const auto filename = this->get_filename();
+
+  if (!restart || !boost::filesystem::exists(filename)) {
+    return false;
+  }
+
+  const auto progress = specfem::IO::checkpoint::read(
+      filename, assembly, simulation, time_scheme.get_max_timestep(),
+      task_state);
+
+  time_scheme.resume(progress.nstep_completed, progress.seismogram_step);
+
+  std::cout << "Restarted from checkpoint " << filename << " after "
+            << progress.nstep_completed << " completed timesteps" << std::endl;
+
+  return true;
+}
@@ -5,8 +5,16 @@
 specfem::runtime_configuration::database_configuration::database_configuration(
     const YAML::Node &Node) {
   try {
+    const std::string assembly_cache = [&]() -> std::string {
+      if (Node["assembly-cache"]) {
+        return Node["assembly-cache"].as<std::string>();
+      } else {
+        return "";
+      }
+    }();
+
     *this = specfem::runtime_configuration::database_configuration(
-        Node["mesh-database"].as<std::string>());
+        Node["mesh-database"].as<std::string>(), assembly_cache);
 
   } catch (YAML::ParserException &e) {
 
@@ -0,0 +1,95 @@
+#include "parameter_parser/energy_monitor.hpp"
+#include <boost/filesystem.hpp>
+#include <sstream>
+#include <stdexcept>
+
+specfem::runtime_configuration::energy_monitor::energy_monitor(
+    const YAML::Node &Node) {
+
+  const std::string wavefield_type = [&]() -> std::string {
+    if (Node["simulation-field"]) {
+      return Node["simulation-field"].as<std::string>();
+    } else {
+      return "";
+    }
+  }();
+
+  const int time_interval = [&]() -> int {
+    if (Node["time-interval"]) {
+      return Node["time-interval"].as<int>();
+    } else {
+      throw std::runtime_error(
+          "Time interval not specified in the energy-monitor section");
+    }
+  }();
+
+  if (time_interval < 1) {
+    std::ostringstream message;
+    message << "Energy monitor time interval must be at least 1. Got "
+            << time_interval;
+    throw std::runtime_error(message.str());
+  }
+
+  const std::string filename = [&]() -> std::string {
+    if (Node["file"]) {
+      return Node["file"].as<std::string>();
+    } else {
+      return "";
+    }
+  }();
+
+  if (!filename.empty()) {
+    const auto folder = boost::filesystem::path(filename).parent_path();
+    if (!folder.empty() && !boost::filesystem::is_directory(folder)) {
+      std::ostringstream message;
+      message << "Energy log folder : " << folder.string()
+              << " does not exist.";
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  specfem::periodic_tasks::energy_monitor::limits abort_limits;
+  if (Node["max-field"]) {
+    abort_limits.max_field = Node["max-field"].as<type_real>();
+  }
+  if (Node["max-energy"]) {
+    abort_limits.max_energy = Node["max-energy"].as<type_real>();
+  }
+  if (Node["energy-growth"]) {
+    abort_limits.energy_growth = Node["energy-growth"].as<type_real>();
+  }
+
+  *this = specfem::runtime_configuration::energy_monitor(
+      wavefield_type, time_interval, filename, abort_limits);
+
+  return;
+}
+
+std::shared_ptr<specfem::periodic_tasks::periodic_task>
+specfem::runtime_configuration::energy_monitor::instantiate_energy_monitor(
+    const specfem::compute::assembly &assembly, const type_real dt,
+    const type_real t0, const specfem::simulation::type simulation,
+    specfem::MPI::MPI *mpi) const {
+
+  const auto wavefield = [&]() {
+    if (this->wavefield_type.empty()) {
+      // Monitor the wavefield that is propagated from the sources
+      return (simulation == specfem::simulation::type::forward)
+                 ? specfem::wavefield::simulation_field::forward
+                 : specfem::wavefield::simulation_field::adjoint;
+    } else if (this->wavefield_type == "forward") {
+      return specfem::wavefield::simulation_field::forward;
+    } else if (this->wavefield_type == "adjoint") {
+      return specfem::wavefield::simulation_field::adjoint;
+    } else if (this->wavefield_type == "backward") {
+      return specfem::wavefield::simulation_field::backward;
+    } else {
+      throw std::runtime_error(
+          "Unknown wavefield type in the energy-monitor section");
+    }
+  }();
+
+  return std::make_shared<specfem::periodic_tasks::energy_monitor>(
+      assembly, wavefield, time_interval, dt, t0, abort_limits, filename,
+      mpi);
+}
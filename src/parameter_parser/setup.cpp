@@ -160,6 +160,43 @@ specfem::runtime_configuration::setup::setup(const YAML::Node &parameter_dict,
           this->plot_wavefield = nullptr;
         }
 
+        if (const YAML::Node &n_snapshot = n_writer["snapshot"]) {
+          if ((n_snapshot["simulation-field"] &&
+               n_snapshot["simulation-field"].as<std::string>() !=
+                   "forward")) {
+            std::ostringstream message;
+            message << "Error: Writing snapshots of a "
+                    << n_snapshot["simulation-field"].as<std::string>()
+                    << " wavefield in forward simulation mode. \n";
+            throw std::runtime_error(message.str());
+          }
+
+          at_least_one_writer = true;
+          this->wavefield_snapshot = std::make_unique<
+              specfem::runtime_configuration::wavefield_snapshot>(n_snapshot);
+        } else {
+          this->wavefield_snapshot = nullptr;
+        }
+
+        if (const YAML::Node &n_ground_motion = n_writer["ground-motion"]) {
+          if ((n_ground_motion["simulation-field"] &&
+               n_ground_motion["simulation-field"].as<std::string>() !=
+                   "forward")) {
+            std::ostringstream message;
+            message << "Error: Computing ground motion maps of a "
+                    << n_ground_motion["simulation-field"].as<std::string>()
+                    << " wavefield in forward simulation mode. \n";
+            throw std::runtime_error(message.str());
+          }
+
+          at_least_one_writer = true;
+          this->ground_motion =
+              std::make_unique<specfem::runtime_configuration::ground_motion>(
+                  n_ground_motion);
+        } else {
+          this->ground_motion = nullptr;
+        }
+
         this->kernel = nullptr;
 
         if (!at_least_one_writer) {
@@ -241,6 +278,36 @@ specfem::runtime_configuration::setup::setup(const YAML::Node &parameter_dict,
         } else {
           this->plot_wavefield = nullptr;
         }
+
+        if (const YAML::Node &n_snapshot = n_writer["snapshot"]) {
+          if (n_snapshot["simulation-field"] &&
+              n_snapshot["simulation-field"].as<std::string>() == "forward") {
+            std::ostringstream message;
+            message << "Error: Writing snapshots of a forward wavefield in "
+                    << "combined simulation mode. \n";
+            throw std::runtime_error(message.str());
+          }
+          this->wavefield_snapshot = std::make_unique<
+              specfem::runtime_configuration::wavefield_snapshot>(n_snapshot);
+        } else {
+          this->wavefield_snapshot = nullptr;
+        }
+
+        if (const YAML::Node &n_ground_motion = n_writer["ground-motion"]) {
+          if (n_ground_motion["simulation-field"] &&
+              n_ground_motion["simulation-field"].as<std::string>() ==
+                  "forward") {
+            std::ostringstream message;
+            message << "Error: Computing ground motion maps of a forward "
+                    << "wavefield in combined simulation mode. \n";
+            throw std::runtime_error(message.str());
+          }
+          this->ground_motion =
+              std::make_unique<specfem::runtime_configuration::ground_motion>(
+                  n_ground_motion);
+        } else {
+          this->ground_motion = nullptr;
+        }
       }
     }
 
@@ -259,6 +326,39 @@ specfem::runtime_configuration::setup::setup(const YAML::Node &parameter_dict,
     this->time_scheme = std::make_unique<
         specfem::runtime_configuration::time_scheme::time_scheme>(n_timescheme,
                                                                   simulation);
+
+    if (const YAML::Node &n_cfl = n_time_marching["cfl"]) {
+      if (n_cfl["courant-number"]) {
+        this->target_courant = n_cfl["courant-number"].as<type_real>();
+      }
+      if (n_cfl["automatic-dt"]) {
+        this->automatic_dt = n_cfl["automatic-dt"].as<bool>();
+      }
+      if (this->target_courant <= 0.0) {
+        throw std::runtime_error(
+            "Error in configuration file: courant-number must be positive");
+      }
+    }
+
+    if (const YAML::Node &n_fused = n_solver["fused-stiffness-coefficients"]) {
+      this->fused_stiffness_coefficients = n_fused.as<bool>();
+    }
+
+    if (const YAML::Node &n_checkpoint = n_solver["checkpoint"]) {
+      this->checkpoint =
+          std::make_unique<specfem::runtime_configuration::checkpoint>(
+              n_checkpoint);
+    } else {
+      this->checkpoint = nullptr;
+    }
+
+    if (const YAML::Node &n_monitor = n_solver["energy-monitor"]) {
+      this->energy_monitor =
+          std::make_unique<specfem::runtime_configuration::energy_monitor>(
+              n_monitor);
+    } else {
+      this->energy_monitor = nullptr;
+    }
   } catch (YAML::InvalidNode &e) {
     std::ostringstream message;
     message << "Error reading specfem solver configuration. \n" << e.what();
@@ -1,15 +1,52 @@
 #include "parameter_parser/time_scheme/time_scheme.hpp"
+#include "timescheme/lddrk.hpp"
+#include "timescheme/lts_newmark.hpp"
 #include "timescheme/newmark.hpp"
+#include "timescheme/pefrl.hpp"
 #include "yaml-cpp/yaml.h"
 #include <memory>
 #include <ostream>
 
 std::shared_ptr<specfem::time_scheme::time_scheme>
 specfem::runtime_configuration::time_scheme::time_scheme::instantiate(
-    const int nstep_between_samples) {
+    const int nstep_between_samples, const type_real target_courant) {
 
   std::shared_ptr<specfem::time_scheme::time_scheme> it;
-  if (this->timescheme == "Newmark") {
+  if (this->timescheme == "LTS-Newmark") {
+    if (this->type == specfem::simulation::type::forward) {
+      it = std::make_shared<specfem::time_scheme::lts_newmark<
+          specfem::simulation::type::forward> >(
+          this->nstep, nstep_between_samples, this->dt, this->t0,
+          target_courant, this->max_levels);
+    } else {
+      std::ostringstream message;
+      message << "Error in time scheme instantiation. \n"
+              << "LTS-Newmark only supports forward simulations.";
+      throw std::runtime_error(message.str());
+    }
+  } else if (this->timescheme == "LDDRK4-6") {
+    if (this->type == specfem::simulation::type::forward) {
+      it = std::make_shared<
+          specfem::time_scheme::lddrk<specfem::simulation::type::forward> >(
+          this->nstep, nstep_between_samples, this->dt, this->t0);
+    } else {
+      std::ostringstream message;
+      message << "Error in time scheme instantiation. \n"
+              << "LDDRK4-6 only supports forward simulations.";
+      throw std::runtime_error(message.str());
+    }
+  } else if (this->timescheme == "PEFRL") {
+    if (this->type == specfem::simulation::type::forward) {
+      it = std::make_shared<
+          specfem::time_scheme::pefrl<specfem::simulation::type::forward> >(
+          this->nstep, nstep_between_samples, this->dt, this->t0);
+    } else {
+      std::ostringstream message;
+      message << "Error in time scheme instantiation. \n"
+              << "PEFRL only supports forward simulations.";
+      throw std::runtime_error(message.str());
+    }
+  } else if (this->timescheme == "Newmark") {
     if (this->type == specfem::simulation::type::forward) {
 
       it = std::make_shared<
@@ -53,6 +90,14 @@ specfem::runtime_configuration::time_scheme::time_scheme::time_scheme(
     *this = specfem::runtime_configuration::time_scheme::time_scheme(
         timescheme["type"].as<std::string>(), timescheme["dt"].as<type_real>(),
         timescheme["nstep"].as<int>(), t0, simulation);
+
+    if (timescheme["max-levels"]) {
+      this->max_levels = timescheme["max-levels"].as<int>();
+      if (this->max_levels < 1) {
+        throw std::runtime_error(
+            "Error in configuration file: max-levels must be at least 1");
+      }
+    }
   } catch (YAML::ParserException &e) {
     std::ostringstream message;
 
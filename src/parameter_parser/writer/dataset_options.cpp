@@ -0,0 +1,55 @@
+#include "parameter_parser/writer/dataset_options.hpp"
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+specfem::IO::dataset_options
+specfem::runtime_configuration::parse_dataset_options(const YAML::Node &Node) {
+
+  specfem::IO::dataset_options options;
+
+  if (!Node["compression"]) {
+    return options;
+  }
+
+  const YAML::Node &compression = Node["compression"];
+
+  using filter = specfem::IO::dataset_options::filter;
+
+  const std::string name = compression["filter"]
+                               ? compression["filter"].as<std::string>()
+                               : "shuffle-deflate";
+
+  if (name == "none") {
+    options.compression = filter::none;
+  } else if (name == "deflate") {
+    options.compression = filter::deflate;
+  } else if (name == "shuffle-deflate") {
+    options.compression = filter::shuffle_deflate;
+  } else {
+    std::ostringstream message;
+    message << "Unknown compression filter : " << name
+            << ". Expected none, deflate or shuffle-deflate";
+    throw std::runtime_error(message.str());
+  }
+
+  if (compression["level"]) {
+    options.level = compression["level"].as<int>();
+    if (options.level < 1 || options.level > 9) {
+      std::ostringstream message;
+      message << "Compression level must be between 1 and 9. Found "
+              << options.level;
+      throw std::runtime_error(message.str());
+    }
+  }
+
+  if (compression["chunk-size"]) {
+    options.chunked = true;
+    options.chunk_bytes = compression["chunk-size"].as<std::size_t>();
+    if (options.chunk_bytes == 0) {
+      throw std::runtime_error("Chunk size must be positive");
+    }
+  }
+
+  return options;
+}
@@ -0,0 +1,95 @@
+#include "parameter_parser/writer/ground_motion.hpp"
+#include "periodic_tasks/ground_motion.hpp"
+#include <boost/filesystem.hpp>
+
+specfem::runtime_configuration::ground_motion::ground_motion(
+    const YAML::Node &Node) {
+
+  const std::string output_format = [&]() -> std::string {
+    if (Node["format"]) {
+      return Node["format"].as<std::string>();
+    } else {
+      return "ASCII";
+    }
+  }();
+
+  const std::string output_folder = [&]() -> std::string {
+    if (Node["directory"]) {
+      return Node["directory"].as<std::string>();
+    } else {
+      return boost::filesystem::current_path().string();
+    }
+  }();
+
+  if (!boost::filesystem::is_directory(
+          boost::filesystem::path(output_folder))) {
+    std::ostringstream message;
+    message << "Output folder : " << output_folder << " does not exist.";
+    throw std::runtime_error(message.str());
+  }
+
+  const std::string wavefield_type = [&]() -> std::string {
+    if (Node["simulation-field"]) {
+      return Node["simulation-field"].as<std::string>();
+    } else {
+      throw std::runtime_error(
+          "Simulation field type not specified in the ground-motion section");
+    }
+  }();
+
+  const int time_interval = [&]() -> int {
+    if (Node["time-interval"]) {
+      return Node["time-interval"].as<int>();
+    } else {
+      return 1;
+    }
+  }();
+
+  if (time_interval < 1) {
+    std::ostringstream message;
+    message << "Time interval in the ground-motion section must be positive. "
+            << "Got " << time_interval;
+    throw std::runtime_error(message.str());
+  }
+
+  *this = specfem::runtime_configuration::ground_motion(
+      output_format, output_folder, wavefield_type, time_interval);
+
+  return;
+}
+
+std::shared_ptr<specfem::periodic_tasks::periodic_task>
+specfem::runtime_configuration::ground_motion::instantiate_ground_motion(
+    const specfem::compute::assembly &assembly, const type_real dt) const {
+
+  using format = specfem::periodic_tasks::ground_motion::format;
+
+  const auto output_format = [&]() {
+    if (this->output_format == "HDF5") {
+      return format::HDF5;
+    } else if (this->output_format == "ASCII") {
+      return format::ASCII;
+    } else if (this->output_format == "binary") {
+      return format::binary;
+    } else {
+      throw std::runtime_error("Unknown ground motion format");
+    }
+  }();
+
+  const auto wavefield = [&]() {
+    if (this->wavefield_type == "forward") {
+      return specfem::wavefield::simulation_field::forward;
+    } else if (this->wavefield_type == "adjoint") {
+      return specfem::wavefield::simulation_field::adjoint;
+    } else if (this->wavefield_type == "backward") {
+      return specfem::wavefield::simulation_field::backward;
+    } else {
+      throw std::runtime_error(
+          "Unknown wavefield type in the ground-motion section");
+    }
+  }();
+
+  return std::make_shared<specfem::periodic_tasks::ground_motion>(
+      assembly, wavefield, output_format, time_interval, dt,
+      this->output_folder);
+}
@@ -1,7 +1,9 @@
 #include "parameter_parser/writer/kernel.hpp"
 #include "IO/ASCII/ASCII.hpp"
 #include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
 #include "IO/kernel/writer.hpp"
+#include "parameter_parser/writer/dataset_options.hpp"
 #include <boost/filesystem.hpp>
 
 specfem::runtime_configuration::kernel::kernel(
@@ -30,8 +32,25 @@ specfem::runtime_configuration::kernel::kernel(
     throw std::runtime_error(message.str());
   }
 
-  *this = specfem::runtime_configuration::kernel(output_format, output_folder,
-                                                 type);
+  const int nstep_between_samples = [&]() -> int {
+    if (Node["nstep_between_samples"]) {
+      return Node["nstep_between_samples"].as<int>();
+    } else {
+      return 1;
+    }
+  }();
+
+  if (nstep_between_samples < 1) {
+    std::ostringstream message;
+    message << "Number of time steps between kernel updates ("
+            << nstep_between_samples << ") must be positive";
+    throw std::runtime_error(message.str());
+  }
+
+  *this = specfem::runtime_configuration::kernel(
+      output_format, output_folder, type,
+      specfem::runtime_configuration::parse_dataset_options(Node),
+      nstep_between_samples);
 
   return;
 }
@@ -45,11 +64,14 @@ specfem::runtime_configuration::kernel::instantiate_kernel_writer() const {
       if (this->output_format == "HDF5") {
         return std::make_shared<
             specfem::IO::kernel_writer<specfem::IO::HDF5<specfem::IO::write> > >(
-            this->output_folder);
+            this->output_folder, this->options);
       } else if (this->output_format == "ASCII") {
         return std::make_shared<
             specfem::IO::kernel_writer<specfem::IO::ASCII<specfem::IO::write> > >(
             this->output_folder);
+      } else if (this->output_format == "binary") {
+        return std::make_shared<specfem::IO::kernel_writer<
+            specfem::IO::binary<specfem::IO::write> > >(this->output_folder);
       } else {
         throw std::runtime_error("Unknown wavefield format");
       }
@@ -1,8 +1,10 @@
 #include "parameter_parser/writer/property.hpp"
 #include "IO/ASCII/ASCII.hpp"
 #include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
 #include "IO/property/reader.hpp"
 #include "IO/property/writer.hpp"
+#include "parameter_parser/writer/dataset_options.hpp"
 #include <boost/filesystem.hpp>
 
 specfem::runtime_configuration::property::property(const YAML::Node &Node,
@@ -31,8 +33,9 @@ specfem::runtime_configuration::property::property(const YAML::Node &Node,
     throw std::runtime_error(message.str());
   }
 
-  *this = specfem::runtime_configuration::property(output_format, output_folder,
-                                                   write_mode);
+  *this = specfem::runtime_configuration::property(
+      output_format, output_folder, write_mode,
+      specfem::runtime_configuration::parse_dataset_options(Node));
 
   return;
 }
@@ -48,11 +51,14 @@ specfem::runtime_configuration::property::instantiate_property_writer() const {
     if (this->output_format == "HDF5") {
       return std::make_shared<
           specfem::IO::property_writer<specfem::IO::HDF5<specfem::IO::write> > >(
-          this->output_folder);
+          this->output_folder, this->options);
     } else if (this->output_format == "ASCII") {
       return std::make_shared<
           specfem::IO::property_writer<specfem::IO::ASCII<specfem::IO::write> > >(
           this->output_folder);
+    } else if (this->output_format == "binary") {
+      return std::make_shared<specfem::IO::property_writer<
+          specfem::IO::binary<specfem::IO::write> > >(this->output_folder);
     } else {
       throw std::runtime_error("Unknown model format");
     }
@@ -77,6 +83,9 @@ specfem::runtime_configuration::property::instantiate_property_reader() const {
       return std::make_shared<
           specfem::IO::property_reader<specfem::IO::ASCII<specfem::IO::read> > >(
           this->output_folder);
+    } else if (this->output_format == "binary") {
+      return std::make_shared<specfem::IO::property_reader<
+          specfem::IO::binary<specfem::IO::read> > >(this->output_folder);
     } else {
       throw std::runtime_error("Unknown model format");
     }
@@ -43,12 +43,17 @@ specfem::runtime_configuration::seismogram::instantiate_seismogram_writer(
     const int nstep_between_samples) const {
 
   const auto type = [&]() {
-    if (this->output_format == "seismic_unix" || this->output_format == "su") {
-      throw std::runtime_error("Seismic Unix format not implemented yet");
+    if (this->output_format == "seismic_unix" || this->output_format == "su" ||
+        this->output_format == "SU") {
       return specfem::enums::seismogram::format::seismic_unix;
     } else if (this->output_format == "ASCII" ||
                this->output_format == "ascii") {
       return specfem::enums::seismogram::format::ascii;
+    } else if (this->output_format == "binary" ||
+               this->output_format == "BINARY") {
+      return specfem::enums::seismogram::format::binary;
+    } else if (this->output_format == "sac" || this->output_format == "SAC") {
+      return specfem::enums::seismogram::format::sac;
     } else {
       throw std::runtime_error("Unknown seismogram format");
     }
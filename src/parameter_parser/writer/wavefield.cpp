@@ -1,6 +1,7 @@
 #include "parameter_parser/writer/wavefield.hpp"
 #include "IO/ASCII/ASCII.hpp"
 #include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
 #include "IO/reader.hpp"
 #include "IO/wavefield/reader.hpp"
 #include "IO/wavefield/writer.hpp"
@@ -51,6 +52,9 @@ specfem::runtime_configuration::wavefield::instantiate_wavefield_writer()
       } else if (this->output_format == "ASCII") {
         return std::make_shared<specfem::IO::wavefield_writer<
             specfem::IO::ASCII<specfem::IO::write> > >(this->output_folder);
+      } else if (this->output_format == "binary") {
+        return std::make_shared<specfem::IO::wavefield_writer<
+            specfem::IO::binary<specfem::IO::write> > >(this->output_folder);
       } else {
         throw std::runtime_error("Unknown wavefield format");
       }
@@ -76,6 +80,9 @@ specfem::runtime_configuration::wavefield::instantiate_wavefield_reader()
       } else if (this->output_format == "ASCII") {
         return std::make_shared<specfem::IO::wavefield_reader<
             specfem::IO::ASCII<specfem::IO::read> > >(this->output_folder);
+      } else if (this->output_format == "binary") {
+        return std::make_shared<specfem::IO::wavefield_reader<
+            specfem::IO::binary<specfem::IO::read> > >(this->output_folder);
       } else {
         throw std::runtime_error("Unknown wavefield format");
       }
@@ -0,0 +1,98 @@
+#include "parameter_parser/writer/wavefield_snapshot.hpp"
+#include "parameter_parser/writer/dataset_options.hpp"
+#include "periodic_tasks/wavefield_snapshot.hpp"
+#include <boost/filesystem.hpp>
+
+specfem::runtime_configuration::wavefield_snapshot::wavefield_snapshot(
+    const YAML::Node &Node) {
+
+  const std::string output_format = [&]() -> std::string {
+    if (Node["format"]) {
+      return Node["format"].as<std::string>();
+    } else {
+      return "binary";
+    }
+  }();
+
+  const std::string output_folder = [&]() -> std::string {
+    if (Node["directory"]) {
+      return Node["directory"].as<std::string>();
+    } else {
+      return boost::filesystem::current_path().string();
+    }
+  }();
+
+  if (!boost::filesystem::is_directory(
+          boost::filesystem::path(output_folder))) {
+    std::ostringstream message;
+    message << "Output folder : " << output_folder << " does not exist.";
+    throw std::runtime_error(message.str());
+  }
+
+  const std::string wavefield_type = [&]() -> std::string {
+    if (Node["simulation-field"]) {
+      return Node["simulation-field"].as<std::string>();
+    } else {
+      throw std::runtime_error(
+          "Simulation field type not specified in the snapshot section");
+    }
+  }();
+
+  const int time_interval = [&]() -> int {
+    if (Node["time-interval"]) {
+      return Node["time-interval"].as<int>();
+    } else {
+      throw std::runtime_error(
+          "Time interval not specified in the snapshot section");
+    }
+  }();
+
+  const int nbuffers = [&]() -> int {
+    if (Node["buffers"]) {
+      return Node["buffers"].as<int>();
+    } else {
+      return 2;
+    }
+  }();
+
+  *this = specfem::runtime_configuration::wavefield_snapshot(
+      output_format, output_folder, wavefield_type, time_interval, nbuffers,
+      specfem::runtime_configuration::parse_dataset_options(Node));
+
+  return;
+}
+
+std::shared_ptr<specfem::periodic_tasks::periodic_task>
+specfem::runtime_configuration::wavefield_snapshot::
+    instantiate_wavefield_snapshot(
+        const specfem::compute::assembly &assembly) const {
+
+  using format = specfem::periodic_tasks::wavefield_snapshot::format;
+
+  const auto output_format = [&]() {
+    if (this->output_format == "HDF5") {
+      return format::HDF5;
+    } else if (this->output_format == "binary") {
+      return format::binary;
+    } else {
+      throw std::runtime_error("Unknown snapshot format");
+    }
+  }();
+
+  const auto wavefield = [&]() {
+    if (this->wavefield_type == "forward") {
+      return specfem::wavefield::simulation_field::forward;
+    } else if (this->wavefield_type == "adjoint") {
+      return specfem::wavefield::simulation_field::adjoint;
+    } else if (this->wavefield_type == "backward") {
+      return specfem::wavefield::simulation_field::backward;
+    } else {
+      throw std::runtime_error(
+          "Unknown wavefield type in the snapshot section");
+    }
+  }();
+
+  return std::make_shared<specfem::periodic_tasks::wavefield_snapshot>(
+      assembly, wavefield, output_format, time_interval, this->output_folder,
+      nbuffers, this->options);
+}
@@ -0,0 +1,125 @@
+#include "periodic_tasks/checkpoint.hpp"
+#include <iostream>
+#include <stdexcept>
+
+specfem::periodic_tasks::checkpoint::checkpoint(
+    const specfem::compute::assembly &assembly,
+    const std::shared_ptr<specfem::time_scheme::time_scheme> &time_scheme,
+    const specfem::simulation::type simulation, const int time_interval,
+    const boost::filesystem::path &filename,
+    const std::vector<specfem::IO::checkpoint::entry> &task_state)
+    : periodic_task(time_interval), time_scheme(time_scheme),
+      simulation(simulation), filename(filename),
+      state(specfem::IO::checkpoint::get_state(assembly, simulation,
+                                               task_state)) {
+
+  for (const auto &entry : state) {
+    staging.emplace_back("specfem::periodic_tasks::checkpoint::staging",
+                         entry.view.size());
+  }
+
+  writer = std::thread(&checkpoint::write_loop, this);
+}
+
+specfem::periodic_tasks::checkpoint::~checkpoint() {
+  try {
+    this->finalize();
+  } catch (const std::exception &e) {
+    std::cerr << "Error writing checkpoint: " << e.what() << std::endl;
+  }
+}
+
+void specfem::periodic_tasks::checkpoint::run() {
+  {
+    // Backpressure: wait until the previous checkpoint has been written
+    std::unique_lock<std::mutex> lock(mutex);
+    staging_free.wait(lock, [&] { return !pending || error; });
+    if (error) {
+      lock.unlock();
+      this->rethrow_error();
+    }
+  }
+
+  const Kokkos::DefaultExecutionSpace exec;
+  for (std::size_t i = 0; i < state.size(); ++i) {
+    Kokkos::deep_copy(exec, staging[i], state[i].view);
+  }
+  exec.fence();
+
+  const int nstep = time_scheme->get_max_timestep();
+
+  progress.simulation = simulation;
+  progress.nstep = nstep;
+  // Forward simulations march forward in time, combined simulations backward
+  progress.nstep_completed =
+      (simulation == specfem::simulation::type::forward)
+          ? this->m_istep + 1
+          : nstep - this->m_istep;
+  progress.seismogram_step = time_scheme->get_seismogram_step();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending = true;
+  }
+  staging_ready.notify_one();
+}
+
+void specfem::periodic_tasks::checkpoint::finalize() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+  }
+  staging_ready.notify_one();
+
+  if (writer.joinable()) {
+    writer.join();
+  }
+
+  this->rethrow_error();
+}
+
+void specfem::periodic_tasks::checkpoint::rethrow_error() {
+  std::exception_ptr e;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::swap(e, error);
+  }
+  if (e) {
+    std::rethrow_exception(e);
+  }
+}
+
+void specfem::periodic_tasks::checkpoint::write_loop() {
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      staging_ready.wait(lock, [&] { return pending || finished; });
+      // Write the staged copy before shutting down
+      if (!pending) {
+        return;
+      }
+    }
+
+    try {
+      std::vector<specfem::IO::checkpoint::buffer> buffers;
+      for (std::size_t i = 0; i < state.size(); ++i) {
+        buffers.push_back(
+            { state[i].name, staging[i].data(), staging[i].size() });
+      }
+      specfem::IO::checkpoint::write(filename.string(), progress, buffers);
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        error = std::current_exception();
+      }
+      staging_free.notify_one();
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      pending = false;
+    }
+    staging_free.notify_one();
+  }
+}
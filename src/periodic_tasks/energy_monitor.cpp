@@ -0,0 +1,149 @@
+#include "periodic_tasks/energy_monitor.hpp"
+#include "enumerations/material_definitions.hpp"
+#include "kokkos_kernels/impl/compute_energy.hpp"
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+specfem::periodic_tasks::energy_monitor::energy_monitor(
+    const specfem::compute::assembly &assembly,
+    const specfem::wavefield::simulation_field &wavefield,
+    const int &time_interval, const type_real &dt, const type_real &t0,
+    const limits &abort_limits, const boost::filesystem::path &filename,
+    specfem::MPI::MPI *mpi)
+    : periodic_task(time_interval), wavefield(wavefield), dt(dt), t0(t0),
+      abort_limits(abort_limits), assembly(assembly), mpi(mpi),
+      log(&std::cout) {
+
+  if (wavefield == specfem::wavefield::simulation_field::buffer) {
+    throw std::runtime_error("Unknown wavefield type for the energy monitor");
+  }
+
+  if (!filename.empty()) {
+    file.open(filename.string());
+    if (!file) {
+      std::ostringstream message;
+      message << "Could not open energy log " << filename.string();
+      throw std::runtime_error(message.str());
+    }
+    log = &file;
+  }
+
+  *log << "# istep time kinetic potential total max|u| max|chi|" << std::endl;
+}
+
+template <specfem::wavefield::simulation_field WavefieldType>
+specfem::periodic_tasks::energy_monitor::sample
+specfem::periodic_tasks::energy_monitor::compute() const {
+  sample energy;
+
+  int nonfinite;
+
+  specfem::kokkos_kernels::impl::compute_field_statistics<
+      specfem::dimension::type::dim2, WavefieldType,
+      specfem::element::medium_tag::elastic>(
+      assembly, energy.max_displacement, nonfinite);
+  energy.nonfinite += nonfinite;
+
+  specfem::kokkos_kernels::impl::compute_field_statistics<
+      specfem::dimension::type::dim2, WavefieldType,
+      specfem::element::medium_tag::acoustic>(assembly, energy.max_potential,
+                                              nonfinite);
+  energy.nonfinite += nonfinite;
+
+  // The mass energy is kinetic within elastic media and potential within
+  // acoustic media. The stiffness energy is the opposite
+#define CALL_COMPUTE_ENERGY(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG)           \
+  {                                                                            \
+    type_real mass_energy;                                                     \
+    type_real stiffness_energy;                                                \
+    specfem::kokkos_kernels::impl::compute_energy<                             \
+        GET_TAG(DIMENSION_TAG), WavefieldType, GET_TAG(MEDIUM_TAG),            \
+        GET_TAG(PROPERTY_TAG)>(assembly, mass_energy, stiffness_energy);       \
+    if constexpr (GET_TAG(MEDIUM_TAG) ==                                       \
+                  specfem::element::medium_tag::elastic) {                     \
+      energy.kinetic += mass_energy;                                           \
+      energy.potential += stiffness_energy;                                    \
+    } else {                                                                   \
+      energy.potential += mass_energy;                                         \
+      energy.kinetic += stiffness_energy;                                      \
+    }                                                                          \
+  }
+
+  CALL_MACRO_FOR_ALL_MATERIAL_SYSTEMS(
+      CALL_COMPUTE_ENERGY,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
+
+#undef CALL_COMPUTE_ENERGY
+
+  return energy;
+}
+
+specfem::periodic_tasks::energy_monitor::sample
+specfem::periodic_tasks::energy_monitor::compute() const {
+
+#define CALL_COMPUTE(WAVEFIELD)                                                \
+  if (wavefield == specfem::wavefield::simulation_field::WAVEFIELD) {          \
+    return this->compute<specfem::wavefield::simulation_field::WAVEFIELD>();   \
+  }
+
+  CALL_COMPUTE(forward)
+  CALL_COMPUTE(adjoint)
+  CALL_COMPUTE(backward)
+
+#undef CALL_COMPUTE
+
+  throw std::runtime_error("Unknown wavefield type for the energy monitor");
+}
+
+void specfem::periodic_tasks::energy_monitor::run() {
+  const auto energy = this->compute();
+  const type_real total = energy.kinetic + energy.potential;
+
+  *log << std::setw(8) << this->m_istep << std::scientific
+       << std::setprecision(6) << " " << t0 + this->m_istep * dt << " "
+       << energy.kinetic << " " << energy.potential << " " << total << " "
+       << energy.max_displacement << " " << energy.max_potential
+       << std::defaultfloat << "\n";
+
+  if (energy.nonfinite > 0) {
+    std::ostringstream reason;
+    reason << energy.nonfinite << " degrees of freedom are NaN or Inf";
+    this->abort(reason.str());
+  }
+
+  if (abort_limits.max_field > 0.0 &&
+      (energy.max_displacement > abort_limits.max_field ||
+       energy.max_potential > abort_limits.max_field)) {
+    std::ostringstream reason;
+    reason << "Maximum field magnitude exceeds " << abort_limits.max_field;
+    this->abort(reason.str());
+  }
+
+  if (abort_limits.max_energy > 0.0 && total > abort_limits.max_energy) {
+    std::ostringstream reason;
+    reason << "Total energy " << total << " exceeds "
+           << abort_limits.max_energy;
+    this->abort(reason.str());
+  }
+
+  if (abort_limits.energy_growth > 0.0 && previous_energy > 0.0 &&
+      total > abort_limits.energy_growth * previous_energy) {
+    std::ostringstream reason;
+    reason << "Total energy grew from " << previous_energy << " to " << total
+           << " since the previous check";
+    this->abort(reason.str());
+  }
+
+  previous_energy = total;
+}
+
+void specfem::periodic_tasks::energy_monitor::abort(
+    const std::string &reason) {
+  log->flush();
+  std::cerr << "Simulation is unstable at timestep " << this->m_istep << ": "
+            << reason << ". Aborting." << std::endl;
+  mpi->exit();
+}
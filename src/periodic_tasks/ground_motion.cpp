@@ -0,0 +1,230 @@
+#include "periodic_tasks/ground_motion.hpp"
+#include "IO/ASCII/ASCII.hpp"
+#include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+template <typename SimulationField>
+void get_fields(const SimulationField &field,
+                specfem::compute::impl::FieldViewType elastic[3],
+                specfem::compute::impl::FieldViewType acoustic[3]) {
+  elastic[0] = field.elastic.field;
+  elastic[1] = field.elastic.field_dot;
+  elastic[2] = field.elastic.field_dot_dot;
+  acoustic[0] = field.acoustic.field;
+  acoustic[1] = field.acoustic.field_dot;
+  acoustic[2] = field.acoustic.field_dot_dot;
+}
+
+// Update the maps at a single global point. The Arias integral is only
+// accumulated within elastic media
+template <bool Arias, typename FieldView, typename MapView>
+KOKKOS_INLINE_FUNCTION void
+update_maps(const int iglob, const FieldView &field, const FieldView &field_dot,
+            const FieldView &field_dot_dot, const MapView &maps,
+            const type_real weight) {
+  const int ncomponents = field.extent(1);
+
+  type_real displacement = 0.0;
+  type_real velocity = 0.0;
+  type_real acceleration = 0.0;
+  for (int icomp = 0; icomp < ncomponents; ++icomp) {
+    displacement += field(iglob, icomp) * field(iglob, icomp);
+    velocity += field_dot(iglob, icomp) * field_dot(iglob, icomp);
+    acceleration += field_dot_dot(iglob, icomp) * field_dot_dot(iglob, icomp);
+  }
+
+  // Peaks are stored squared until the maps are written
+  maps(iglob, 0) = Kokkos::max(maps(iglob, 0), displacement);
+  maps(iglob, 1) = Kokkos::max(maps(iglob, 1), velocity);
+  maps(iglob, 2) = Kokkos::max(maps(iglob, 2), acceleration);
+  if constexpr (Arias) {
+    maps(iglob, 3) += weight * acceleration;
+  }
+}
+} // namespace
+
+specfem::periodic_tasks::ground_motion::ground_motion(
+    const specfem::compute::assembly &assembly,
+    const specfem::wavefield::simulation_field &wavefield,
+    const format &output_format, const int &time_interval,
+    const type_real &dt, const boost::filesystem::path &output_folder)
+    : periodic_task(time_interval), output_format(output_format), dt(dt),
+      output_folder(output_folder), assembly(assembly) {
+
+#ifdef NO_HDF5
+  if (output_format == format::HDF5) {
+    throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
+  }
+#endif
+
+  if (wavefield == specfem::wavefield::simulation_field::forward) {
+    get_fields(assembly.fields.forward, elastic, acoustic);
+  } else if (wavefield == specfem::wavefield::simulation_field::adjoint) {
+    get_fields(assembly.fields.adjoint, elastic, acoustic);
+  } else if (wavefield == specfem::wavefield::simulation_field::backward) {
+    get_fields(assembly.fields.backward, elastic, acoustic);
+  } else {
+    throw std::runtime_error("Unknown wavefield type for ground motion maps");
+  }
+
+  // Maps are zero initialized
+  elastic_maps =
+      MapView("specfem::periodic_tasks::ground_motion::elastic_maps",
+              elastic[0].extent(0), nelastic_maps);
+  acoustic_maps =
+      MapView("specfem::periodic_tasks::ground_motion::acoustic_maps",
+              acoustic[0].extent(0), nacoustic_maps);
+}
+
+void specfem::periodic_tasks::ground_motion::run() {
+  const int nglob_elastic = elastic_maps.extent(0);
+  const int nglob_acoustic = acoustic_maps.extent(0);
+  const type_real weight = this->time_interval * dt;
+
+  const auto elastic_field = elastic[0];
+  const auto elastic_field_dot = elastic[1];
+  const auto elastic_field_dot_dot = elastic[2];
+  const auto acoustic_field = acoustic[0];
+  const auto acoustic_field_dot = acoustic[1];
+  const auto acoustic_field_dot_dot = acoustic[2];
+  const auto maps_elastic = this->elastic_maps;
+  const auto maps_acoustic = this->acoustic_maps;
+
+  // Both media are updated within a single kernel
+  Kokkos::parallel_for(
+      "specfem::periodic_tasks::ground_motion::update_maps",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(
+          0, nglob_elastic + nglob_acoustic),
+      KOKKOS_LAMBDA(const int i) {
+        if (i < nglob_elastic) {
+          update_maps<true>(i, elastic_field, elastic_field_dot,
+                            elastic_field_dot_dot, maps_elastic, weight);
+        } else {
+          update_maps<false>(i - nglob_elastic, acoustic_field,
+                             acoustic_field_dot, acoustic_field_dot_dot,
+                             maps_acoustic, weight);
+        }
+      });
+
+  Kokkos::fence();
+}
+
+void specfem::periodic_tasks::ground_motion::finalize() {
+  if (written) {
+    return;
+  }
+
+  if (output_format == format::HDF5) {
+    this->write<specfem::IO::HDF5<specfem::IO::write> >();
+  } else if (output_format == format::ASCII) {
+    this->write<specfem::IO::ASCII<specfem::IO::write> >();
+  } else {
+    this->write<specfem::IO::binary<specfem::IO::write> >();
+  }
+
+  written = true;
+}
+
+std::vector<specfem::IO::checkpoint::entry>
+specfem::periodic_tasks::ground_motion::get_checkpoint_state() const {
+  using EntryView = specfem::IO::checkpoint::entry::ViewType;
+  return { { "GroundMotion/Elastic",
+             EntryView(elastic_maps.data(), elastic_maps.span()) },
+           { "GroundMotion/Acoustic",
+             EntryView(acoustic_maps.data(), acoustic_maps.span()) } };
+}
+
+template <typename OutputLibrary>
+void specfem::periodic_tasks::ground_motion::write() const {
+  using HostMaps = specfem::kokkos::HostView2d<type_real, Kokkos::LayoutLeft>;
+  using HostMap = specfem::kokkos::HostView1d<type_real, Kokkos::LayoutLeft>;
+
+  const int nspec = assembly.mesh.nspec;
+  const int ngllz = assembly.mesh.ngllz;
+  const int ngllx = assembly.mesh.ngllx;
+  const auto &coord = assembly.mesh.points.h_coord;
+  const auto &medium_index_mapping =
+      assembly.fields.forward.h_medium_index_mapping;
+
+  // Arias intensity is pi / (2g) times the integral of the squared
+  // acceleration
+  constexpr type_real gravity = 9.81;
+  const type_real arias_factor =
+      Kokkos::numbers::pi_v<type_real> / (2.0 * gravity);
+
+  const auto filename = output_folder / "GroundMotion";
+  typename OutputLibrary::File file(filename.string());
+
+  const auto write_coordinates = [&](typename OutputLibrary::Group &group,
+                                     const specfem::element::medium_tag medium,
+                                     const int nglob) {
+    HostMaps coordinates("specfem::periodic_tasks::ground_motion::coordinates",
+                         nglob, 2);
+    for (int ispec = 0; ispec < nspec; ++ispec) {
+      for (int iz = 0; iz < ngllz; ++iz) {
+        for (int ix = 0; ix < ngllx; ++ix) {
+          const int iglob = medium_index_mapping(
+              static_cast<int>(medium), ispec, iz, ix);
+          if (iglob >= 0) {
+            coordinates(iglob, 0) = coord(0, ispec, iz, ix);
+            coordinates(iglob, 1) = coord(1, ispec, iz, ix);
+          }
+        }
+      }
+    }
+    group.createDataset("Coordinates", coordinates).write();
+  };
+
+  // Peaks are stored squared
+  const auto write_peak = [&](typename OutputLibrary::Group &group,
+                              const std::string &name,
+                              const auto &h_maps,
+                              const int imap) {
+    const int nglob = h_maps.extent(0);
+    HostMap peak("specfem::periodic_tasks::ground_motion::peak", nglob);
+    for (int iglob = 0; iglob < nglob; ++iglob) {
+      peak(iglob) = std::sqrt(h_maps(iglob, imap));
+    }
+    group.createDataset(name, peak).write();
+  };
+
+  {
+    const auto h_maps = Kokkos::create_mirror_view_and_copy(
+        specfem::kokkos::HostMemSpace(), elastic_maps);
+    const int nglob = h_maps.extent(0);
+
+    HostMap arias("specfem::periodic_tasks::ground_motion::arias", nglob);
+    for (int iglob = 0; iglob < nglob; ++iglob) {
+      arias(iglob) = arias_factor * h_maps(iglob, 3);
+    }
+
+    typename OutputLibrary::Group group = file.createGroup("/Elastic");
+    write_coordinates(group, specfem::element::medium_tag::elastic, nglob);
+    write_peak(group, "PGD", h_maps, 0);
+    write_peak(group, "PGV", h_maps, 1);
+    write_peak(group, "PGA", h_maps, 2);
+    group.createDataset("AriasIntensity", arias).write();
+  }
+
+  {
+    const auto h_maps = Kokkos::create_mirror_view_and_copy(
+        specfem::kokkos::HostMemSpace(), acoustic_maps);
+    const int nglob = h_maps.extent(0);
+
+    // Pressure is the negative second time derivative of the potential
+    typename OutputLibrary::Group group = file.createGroup("/Acoustic");
+    write_coordinates(group, specfem::element::medium_tag::acoustic, nglob);
+    write_peak(group, "PeakPotential", h_maps, 0);
+    write_peak(group, "PeakPotentialDot", h_maps, 1);
+    write_peak(group, "PeakPressure", h_maps, 2);
+  }
+
+  std::cout << "Ground motion maps written to " << filename.string()
+            << std::endl;
+}
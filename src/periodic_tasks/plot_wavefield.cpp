@@ -1,40 +1,38 @@
-
 #include "periodic_tasks/plot_wavefield.hpp"
 #include "compute/assembly/assembly.hpp"
 #include "enumerations/display.hpp"
-
-#ifdef NO_VTK
-
+#include <iostream>
 #include <sstream>
+#include <stdexcept>
 
-#else
+#ifndef NO_VTK
 
+#include "kokkos_abstractions.h"
+#include "medium/compute_stress.hpp"
+#include "point/field_derivatives.hpp"
+#include "point/partial_derivatives.hpp"
+#include "point/properties.hpp"
+#include <Kokkos_Core.hpp>
 #include <algorithm>
+#include <array>
 #include <boost/filesystem.hpp>
 #include <cmath>
+#include <string>
 #include <vtkActor.h>
 #include <vtkBiQuadraticQuad.h>
 #include <vtkCellData.h>
 #include <vtkDataSetMapper.h>
-#include <vtkExtractEdges.h>
 #include <vtkFloatArray.h>
 #include <vtkGraphicsFactory.h>
+#include <vtkImageWriter.h>
 #include <vtkJPEGWriter.h>
 #include <vtkLookupTable.h>
 #include <vtkNamedColors.h>
-#ifdef __APPLE__
-#include <vtkCocoaRenderWindow.h>
-#else
-#include <vtkOpenGLRenderWindow.h>
-#endif
 #include <vtkPNGWriter.h>
 #include <vtkPointData.h>
 #include <vtkPoints.h>
-#include <vtkPolyDataMapper.h>
-#include <vtkProperty.h>
 #include <vtkQuad.h>
 #include <vtkRenderWindow.h>
-#include <vtkRenderWindowInteractor.h>
 #include <vtkRenderer.h>
 #include <vtkSmartPointer.h>
 #include <vtkUnsignedCharArray.h>
@@ -45,6 +43,27 @@
 
 #ifdef NO_VTK
 
+struct specfem::periodic_tasks::plot_wavefield::pipeline {};
+struct specfem::periodic_tasks::plot_wavefield::frame {};
+
+specfem::periodic_tasks::plot_wavefield::plot_wavefield(
+    const specfem::compute::assembly &assembly,
+    const specfem::display::format &output_format,
+    const specfem::display::wavefield &component,
+    const specfem::wavefield::simulation_field &wavefield,
+    const int &time_interval, const boost::filesystem::path &output_folder,
+    const int nbuffers)
+    : plotter(time_interval), output_format(output_format),
+      component(component), output_folder(output_folder),
+      wavefield(wavefield), assembly(assembly) {
+  std::ostringstream message;
+  message << "Display section is not enabled, since SPECFEM++ was built "
+             "without VTK\n"
+          << "Please install VTK and rebuild SPECFEM++ with "
+             "-DVTK_DIR=/path/to/vtk";
+  throw std::runtime_error(message.str());
+}
+
 void specfem::periodic_tasks::plot_wavefield::run() {
   std::ostringstream message;
   message
@@ -54,6 +73,8 @@ void specfem::periodic_tasks::plot_wavefield::run() {
   throw std::runtime_error(message.str());
 }
 
+void specfem::periodic_tasks::plot_wavefield::render_loop() {}
+
 #else
 
 namespace {
@@ -134,73 +155,245 @@ map_materials_with_color(const specfem::compute::assembly &assembly) {
   return mapper;
 }
 
-vtkSmartPointer<vtkUnstructuredGrid> get_wavefield_on_vtk_grid(
-    specfem::compute::assembly &assembly,
-    const specfem::wavefield::simulation_field type,
-    const specfem::display::wavefield &display_component) {
-
-  const auto component = [&display_component]() {
-    if (display_component == specfem::display::wavefield::displacement) {
-      return specfem::wavefield::type::displacement;
-    } else if (display_component == specfem::display::wavefield::velocity) {
-      return specfem::wavefield::type::velocity;
-    } else if (display_component == specfem::display::wavefield::acceleration) {
-      return specfem::wavefield::type::acceleration;
-    } else if (display_component == specfem::display::wavefield::pressure) {
-      return specfem::wavefield::type::pressure;
+// Quadrature points of an element used as nodes of a VTK biquadratic quad
+constexpr int cell_points = 9;
+
+std::array<int, cell_points> get_z_index(const int ngllz) {
+  return { 0,
+           0,
+           ngllz - 1,
+           ngllz - 1,
+           0,
+           (ngllz - 1) / 2,
+           ngllz - 1,
+           (ngllz - 1) / 2,
+           (ngllz - 1) / 2 };
+}
+
+std::array<int, cell_points> get_x_index(const int ngllx) {
+  return { 0,
+           ngllx - 1,
+           ngllx - 1,
+           0,
+           (ngllx - 1) / 2,
+           ngllx - 1,
+           (ngllx - 1) / 2,
+           0,
+           (ngllx - 1) / 2 };
+}
+
+specfem::wavefield::type
+get_component(const specfem::display::wavefield &display_component) {
+  if (display_component == specfem::display::wavefield::displacement) {
+    return specfem::wavefield::type::displacement;
+  } else if (display_component == specfem::display::wavefield::velocity) {
+    return specfem::wavefield::type::velocity;
+  } else if (display_component == specfem::display::wavefield::acceleration) {
+    return specfem::wavefield::type::acceleration;
+  } else if (display_component == specfem::display::wavefield::pressure) {
+    return specfem::wavefield::type::pressure;
+  } else {
+    throw std::runtime_error("Unsupported component");
+  }
+}
+
+using HostFieldViewType =
+    Kokkos::View<type_real **, Kokkos::LayoutLeft, Kokkos::HostSpace>;
+using DeviceFieldViewType =
+    Kokkos::View<type_real **, Kokkos::LayoutLeft,
+                 specfem::kokkos::DevMemSpace>;
+
+// Calls function with the simulation field selected for plotting
+template <typename FunctionType>
+void apply_to_field(const specfem::compute::fields &fields,
+                    const specfem::wavefield::simulation_field wavefield,
+                    const FunctionType &function) {
+  if (wavefield == specfem::wavefield::simulation_field::forward) {
+    function(fields.forward);
+  } else if (wavefield == specfem::wavefield::simulation_field::adjoint) {
+    function(fields.adjoint);
+  } else if (wavefield == specfem::wavefield::simulation_field::backward) {
+    function(fields.backward);
+  } else {
+    throw std::runtime_error("Wavefield type not supported");
+  }
+}
+
+// Field of a medium from which the plotted component is computed. Pressure is
+// computed from the potential acceleration in acoustic media and from the
+// displacement in elastic media
+template <specfem::element::medium_tag MediumTag>
+specfem::compute::impl::FieldViewType
+get_field(const specfem::compute::impl::field_impl<
+              specfem::dimension::type::dim2, MediumTag> &field,
+          const specfem::wavefield::type component) {
+  if (component == specfem::wavefield::type::displacement) {
+    return field.field;
+  } else if (component == specfem::wavefield::type::velocity) {
+    return field.field_dot;
+  } else if (component == specfem::wavefield::type::acceleration) {
+    return field.field_dot_dot;
+  } else if (component == specfem::wavefield::type::pressure) {
+    if constexpr (MediumTag == specfem::element::medium_tag::acoustic) {
+      return field.field_dot_dot;
     } else {
-      throw std::runtime_error("Unsupported component");
+      return field.field;
     }
-  }();
+  } else {
+    throw std::runtime_error("Unsupported component");
+  }
+}
+
+// Magnitude of the plotted component at the plotting nodes of an element,
+// computed on the host from a copy of the field of its medium. Mirrors
+// specfem::medium::compute_wavefield without any Kokkos dispatch, such that
+// it can run on the render thread
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag, typename MappingViewType>
+void compute_magnitude(const specfem::compute::assembly &assembly,
+                       const MappingViewType &medium_index_mapping,
+                       const HostFieldViewType &field,
+                       const specfem::wavefield::type component,
+                       const int ispec, float *magnitude) {
+
+  constexpr auto dimension = specfem::dimension::type::dim2;
+  constexpr bool is_acoustic =
+      (MediumTag == specfem::element::medium_tag::acoustic);
+
+  using PointPropertyType =
+      specfem::point::properties<dimension, MediumTag, PropertyTag, false>;
+  using FieldDerivativesType =
+      specfem::point::field_derivatives<dimension, MediumTag, false>;
+  constexpr int components = FieldDerivativesType::components;
+
+  const int ngllz = assembly.mesh.ngllz;
+  const int ngllx = assembly.mesh.ngllx;
+  const auto &hprime = assembly.mesh.quadratures.gll.h_hprime;
+
+  const auto value = [&](const int iz, const int ix, const int icomponent) {
+    const int iglob = medium_index_mapping(static_cast<int>(MediumTag), ispec,
+                                           iz, ix);
+    return field(iglob, icomponent);
+  };
+
+  const auto compute_derivatives =
+      [&](const specfem::point::index<dimension> &index) {
+        type_real df_dxi[components] = { 0.0 };
+        type_real df_dgamma[components] = { 0.0 };
+        for (int icomponent = 0; icomponent < components; ++icomponent) {
+          for (int l = 0; l < ngllx; ++l) {
+            df_dxi[icomponent] +=
+                hprime(index.ix, l) * value(index.iz, l, icomponent);
+          }
+          for (int l = 0; l < ngllz; ++l) {
+            df_dgamma[icomponent] +=
+                hprime(index.iz, l) * value(l, index.ix, icomponent);
+          }
+        }
+
+        specfem::point::partial_derivatives<dimension, false, false>
+            point_partial_derivatives;
+        specfem::compute::load_on_host(index, assembly.partial_derivatives,
+                                       point_partial_derivatives);
+
+        typename FieldDerivativesType::ViewType du;
+        for (int icomponent = 0; icomponent < components; ++icomponent) {
+          du(0, icomponent) =
+              point_partial_derivatives.xix * df_dxi[icomponent] +
+              point_partial_derivatives.gammax * df_dgamma[icomponent];
+          du(1, icomponent) =
+              point_partial_derivatives.xiz * df_dxi[icomponent] +
+              point_partial_derivatives.gammaz * df_dgamma[icomponent];
+        }
+        return FieldDerivativesType(du);
+      };
+
+  const auto z_index = get_z_index(ngllz);
+  const auto x_index = get_x_index(ngllx);
+
+  for (int i = 0; i < cell_points; ++i) {
+    const specfem::point::index<dimension> index(ispec, z_index[i],
+                                                 x_index[i]);
+
+    if (component == specfem::wavefield::type::pressure && is_acoustic) {
+      // Pressure is the negative of the potential acceleration
+      magnitude[i] = std::abs(value(index.iz, index.ix, 0));
+      continue;
+    }
+
+    if (component != specfem::wavefield::type::pressure && !is_acoustic) {
+      const type_real ux = value(index.iz, index.ix, 0);
+      const type_real uz = value(index.iz, index.ix, 1);
+      magnitude[i] = std::sqrt(ux * ux + uz * uz);
+      continue;
+    }
+
+    PointPropertyType point_property;
+    specfem::compute::load_on_host(index, assembly.properties,
+                                   point_property);
+    const auto field_derivatives = compute_derivatives(index);
+
+    if constexpr (is_acoustic) {
+      // Displacement, velocity or acceleration is the gradient of the
+      // potential scaled by the inverse density
+      const auto stress =
+          specfem::medium::compute_stress(point_property, field_derivatives);
+      magnitude[i] = std::sqrt(stress.T(0, 0) * stress.T(0, 0) +
+                               stress.T(1, 0) * stress.T(1, 0));
+    } else if constexpr (PropertyTag ==
+                         specfem::element::property_tag::isotropic) {
+      const auto &du = field_derivatives.du;
+      magnitude[i] = std::abs(
+          (point_property.lambda + (2.0 / 3.0) * point_property.mu) *
+          (du(0, 0) + du(1, 1)));
+    } else {
+      // Pressure cannot be computed for an anisotropic material if c12 or
+      // c23 are zero
+      if (point_property.c12 < 1.e-7 || point_property.c23 < 1.e-7) {
+        throw std::runtime_error(
+            "C_12 or C_23 are zero, cannot compute pressure. Check your "
+            "material properties. Or, deactivate the pressure computation.");
+      }
+
+      // P_SV case
+      const auto &du = field_derivatives.du;
+      const auto sigma_xx = point_property.c11 * du(0, 0) +
+                            point_property.c13 * du(1, 1) +
+                            point_property.c15 * (du(1, 0) + du(0, 1));
+      const auto sigma_zz = point_property.c13 * du(0, 0) +
+                            point_property.c33 * du(1, 1) +
+                            point_property.c35 * (du(1, 0) + du(0, 1));
+      const auto sigma_yy = point_property.c12 * du(0, 0) +
+                            point_property.c23 * du(1, 1) +
+                            point_property.c25 * (du(1, 0) + du(0, 1));
+      magnitude[i] = std::abs((sigma_xx + sigma_zz + sigma_yy) / 3.0);
+    }
+  }
+}
+
+// Plotting grid with the geometry of the mesh. The point scalars are updated
+// for every frame
+vtkSmartPointer<vtkUnstructuredGrid>
+get_vtk_grid(const specfem::compute::assembly &assembly,
+             const vtkSmartPointer<vtkFloatArray> &scalars) {
 
-  const auto &wavefield =
-      assembly.generate_wavefield_on_entire_grid(type, component);
   const auto &coordinates = assembly.mesh.points.h_coord;
+  const int ncells = assembly.mesh.nspec;
 
-  const int ncells = wavefield.extent(0);
-  const int ngllz = wavefield.extent(1);
-  const int ngllx = wavefield.extent(2);
-
-  const int cell_points = 9;
-
-  const std::array<int, cell_points> z_index = { 0,
-                                                 0,
-                                                 ngllz - 1,
-                                                 ngllz - 1,
-                                                 0,
-                                                 (ngllz - 1) / 2,
-                                                 ngllz - 1,
-                                                 (ngllz - 1) / 2,
-                                                 (ngllz - 1) / 2 };
-  const std::array<int, cell_points> x_index = { 0,
-                                                 ngllx - 1,
-                                                 ngllx - 1,
-                                                 0,
-                                                 (ngllx - 1) / 2,
-                                                 ngllx - 1,
-                                                 (ngllx - 1) / 2,
-                                                 0,
-                                                 (ngllx - 1) / 2 };
+  const auto z_index = get_z_index(assembly.mesh.ngllz);
+  const auto x_index = get_x_index(assembly.mesh.ngllx);
 
   auto points = vtkSmartPointer<vtkPoints>::New();
   auto cells = vtkSmartPointer<vtkCellArray>::New();
-  auto scalars = vtkSmartPointer<vtkFloatArray>::New();
+
+  scalars->SetNumberOfValues(ncells * cell_points);
 
   for (int icell = 0; icell < ncells; ++icell) {
     for (int i = 0; i < cell_points; ++i) {
       points->InsertNextPoint(coordinates(0, icell, z_index[i], x_index[i]),
                               coordinates(1, icell, z_index[i], x_index[i]),
                               0.0);
-      if (component == specfem::wavefield::type::pressure) {
-        scalars->InsertNextValue(
-            std::abs(wavefield(icell, z_index[i], x_index[i], 0)));
-      } else {
-        scalars->InsertNextValue(
-            std::sqrt((wavefield(icell, z_index[i], x_index[i], 0) *
-                       wavefield(icell, z_index[i], x_index[i], 0)) +
-                      (wavefield(icell, z_index[i], x_index[i], 1) *
-                       wavefield(icell, z_index[i], x_index[i], 1))));
-      }
+      scalars->SetValue(icell * cell_points + i, 0.0);
     }
     auto quad = vtkSmartPointer<vtkBiQuadraticQuad>::New();
     for (int i = 0; i < cell_points; ++i) {
@@ -218,130 +411,313 @@ vtkSmartPointer<vtkUnstructuredGrid> get_wavefield_on_vtk_grid(
 }
 } // namespace
 
-void specfem::periodic_tasks::plot_wavefield::run() {
+struct specfem::periodic_tasks::plot_wavefield::pipeline {
+  vtkSmartPointer<vtkFloatArray> scalars;
+  vtkSmartPointer<vtkLookupTable> lut;
+  vtkSmartPointer<vtkDataSetMapper> mapper;
+  vtkSmartPointer<vtkRenderWindow> render_window;
+  vtkSmartPointer<vtkWindowToImageFilter> image_filter;
+  vtkSmartPointer<vtkImageWriter> writer;
 
-  auto colors = vtkSmartPointer<vtkNamedColors>::New();
+  pipeline(const specfem::compute::assembly &assembly,
+           const specfem::display::format output_format) {
 
-  if (this->output_format != specfem::display::format::on_screen) {
-    vtkSmartPointer<vtkGraphicsFactory> graphics_factory;
-    graphics_factory->SetOffScreenOnlyMode(1);
-    graphics_factory->SetUseMesaClasses(1);
-  }
+    auto colors = vtkSmartPointer<vtkNamedColors>::New();
 
-  auto material_mapper = map_materials_with_color(this->assembly);
+    vtkGraphicsFactory::SetOffScreenOnlyMode(1);
+    vtkGraphicsFactory::SetUseMesaClasses(1);
 
-  // Create an actor
-  auto material_actor = vtkSmartPointer<vtkActor>::New();
-  material_actor->SetMapper(material_mapper);
+    auto material_actor = vtkSmartPointer<vtkActor>::New();
+    material_actor->SetMapper(map_materials_with_color(assembly));
 
-  const auto unstructured_grid = get_wavefield_on_vtk_grid(
-      this->assembly, this->wavefield, this->component);
-  const int ncell = unstructured_grid->GetNumberOfCells();
+    scalars = vtkSmartPointer<vtkFloatArray>::New();
+    const auto unstructured_grid = get_vtk_grid(assembly, scalars);
 
-  double range[2];
+    // create a lookup table to map point data to colors. The range is updated
+    // for every frame
+    lut = vtkSmartPointer<vtkLookupTable>::New();
+    lut->SetNumberOfTableValues(256);
+    lut->Build();
 
-  unstructured_grid->GetPointData()->GetScalars()->GetRange(range);
+    // set color gradient from white to black
+    for (int i = 0; i < 256; ++i) {
+      double t = static_cast<double>(i) / 255.0;
+      double transparency = sigmoid(t);
+      lut->SetTableValue(i, 1.0 - t, 1.0 - t, 1.0 - t, transparency);
+    }
 
-  // create a lookup table to map cell data to colors. The range is from
-  // range[0] to range[1]
-  vtkSmartPointer<vtkLookupTable> lut = vtkSmartPointer<vtkLookupTable>::New();
-  lut->SetNumberOfTableValues(256);
-  lut->SetRange(range[0], range[1]);
-  lut->Build();
+    mapper = vtkSmartPointer<vtkDataSetMapper>::New();
+    mapper->SetInputData(unstructured_grid);
+    mapper->SetLookupTable(lut);
+    mapper->SetScalarModeToUsePointData();
+    mapper->SetColorModeToMapScalars();
+    mapper->SetScalarVisibility(1);
 
-  // set color gradient from white to black
-  for (int i = 0; i < 256; ++i) {
-    double t = static_cast<double>(i) / 255.0;
-    double transparency = sigmoid(t);
-    lut->SetTableValue(i, 1.0 - t, 1.0 - t, 1.0 - t, transparency);
-  }
+    auto actor = vtkSmartPointer<vtkActor>::New();
+    actor->SetMapper(mapper);
 
-  // Create a mapper
-  auto mapper = vtkSmartPointer<vtkDataSetMapper>::New();
-  mapper->SetInputData(unstructured_grid);
-  mapper->SetLookupTable(lut);
-  mapper->SetScalarRange(range[0], range[1]);
-  mapper->SetScalarModeToUsePointData();
-  mapper->SetColorModeToMapScalars();
-  mapper->SetScalarVisibility(1);
-
-  // Create an actor
-  auto actor = vtkSmartPointer<vtkActor>::New();
-  actor->SetMapper(mapper);
-
-  vtkSmartPointer<vtkExtractEdges> edges =
-      vtkSmartPointer<vtkExtractEdges>::New();
-  edges->SetInputData(unstructured_grid);
-  edges->Update();
-
-  vtkSmartPointer<vtkPolyDataMapper> outlineMapper =
-      vtkSmartPointer<vtkPolyDataMapper>::New();
-  outlineMapper->SetInputConnection(edges->GetOutputPort());
-  outlineMapper->ScalarVisibilityOff();
-
-  vtkSmartPointer<vtkActor> outlineActor = vtkSmartPointer<vtkActor>::New();
-  outlineActor->SetMapper(outlineMapper);
-  outlineActor->GetProperty()->SetColor(colors->GetColor3d("Black").GetData());
-  outlineActor->GetProperty()->SetLineWidth(0.5);
-
-  // Create a renderer
-  auto renderer = vtkSmartPointer<vtkRenderer>::New();
-  renderer->AddActor(material_actor);
-  // renderer->AddActor(outlineActor);
-  renderer->AddActor(actor);
-  renderer->SetBackground(colors->GetColor3d("White").GetData());
-  renderer->ResetCamera();
-
-  if (this->output_format != specfem::display::format::on_screen) {
-    // Create a render window
-    auto render_window = vtkSmartPointer<vtkRenderWindow>::New();
+    auto renderer = vtkSmartPointer<vtkRenderer>::New();
+    renderer->AddActor(material_actor);
+    renderer->AddActor(actor);
+    renderer->SetBackground(colors->GetColor3d("White").GetData());
+    renderer->ResetCamera();
+
+    render_window = vtkSmartPointer<vtkRenderWindow>::New();
     render_window->SetOffScreenRendering(1);
     render_window->AddRenderer(renderer);
     render_window->SetSize(2560, 2560);
     render_window->SetWindowName("Wavefield");
-    auto image_filter = vtkSmartPointer<vtkWindowToImageFilter>::New();
+
+    image_filter = vtkSmartPointer<vtkWindowToImageFilter>::New();
     image_filter->SetInput(render_window);
-    image_filter->Update();
-
-    // Save the plot
-    if (this->output_format == specfem::display::format::PNG) {
-      const auto filename =
-          this->output_folder /
-          ("wavefield" + to_zero_lead(this->m_istep, 6) + ".png");
-      auto writer = vtkSmartPointer<vtkPNGWriter>::New();
-      writer->SetFileName(filename.string().c_str());
-      writer->SetInputConnection(image_filter->GetOutputPort());
-      writer->Write();
-    } else if (this->output_format == specfem::display::format::JPG) {
-      const auto filename =
-          this->output_folder /
-          ("wavefield" + std::to_string(this->m_istep) + ".jpg");
-      auto writer = vtkSmartPointer<vtkJPEGWriter>::New();
-      writer->SetFileName(filename.string().c_str());
-      writer->SetInputConnection(image_filter->GetOutputPort());
-      writer->Write();
+
+    if (output_format == specfem::display::format::PNG) {
+      writer = vtkSmartPointer<vtkPNGWriter>::New();
+    } else if (output_format == specfem::display::format::JPG) {
+      writer = vtkSmartPointer<vtkJPEGWriter>::New();
     } else {
       throw std::runtime_error("Unsupported output format");
     }
-  } else {
-// Create a render window interactor
-#ifdef __APPLE__
-    auto render_window = vtkSmartPointer<vtkCocoaRenderWindow>::New();
-#else
-    auto render_window = vtkSmartPointer<vtkOpenGLRenderWindow>::New();
-#endif
-    render_window->AddRenderer(renderer);
-    render_window->SetSize(2560, 2560);
-    render_window->SetWindowName("Wavefield");
+    writer->SetInputConnection(image_filter->GetOutputPort());
+  }
+
+  void render(const std::vector<float> &values,
+              const boost::filesystem::path &filename) {
+    for (std::size_t i = 0; i < values.size(); ++i) {
+      scalars->SetValue(i, values[i]);
+    }
+    scalars->Modified();
 
-    auto render_window_interactor =
-        vtkSmartPointer<vtkRenderWindowInteractor>::New();
-    render_window_interactor->SetRenderWindow(render_window);
+    double range[2];
+    scalars->GetRange(range);
+    lut->SetRange(range[0], range[1]);
+    mapper->SetScalarRange(range[0], range[1]);
 
-    // Start the event loop
     render_window->Render();
-    render_window_interactor->Start();
+    image_filter->Modified();
+
+    writer->SetFileName(filename.string().c_str());
+    writer->Write();
+  }
+};
+
+struct specfem::periodic_tasks::plot_wavefield::frame {
+  HostFieldViewType elastic;  ///< Copy of the plotted elastic field
+  HostFieldViewType acoustic; ///< Copy of the plotted acoustic field
+  DeviceFieldViewType d_elastic;  ///< Device staging of the elastic copy.
+                                  ///< Aliases elastic on host builds
+  DeviceFieldViewType d_acoustic; ///< Device staging of the acoustic copy.
+                                  ///< Aliases acoustic on host builds
+  std::vector<float> scalars;     ///< Magnitude at the plotting nodes
+
+  template <typename SimulationFieldType>
+  frame(const SimulationFieldType &field, const std::size_t npoints)
+      : elastic("specfem::periodic_tasks::plot_wavefield::elastic",
+                field.elastic.field.extent(0),
+                field.elastic.field.extent(1)),
+        acoustic("specfem::periodic_tasks::plot_wavefield::acoustic",
+                 field.acoustic.field.extent(0),
+                 field.acoustic.field.extent(1)),
+        d_elastic(Kokkos::create_mirror_view(specfem::kokkos::DevMemSpace(),
+                                             elastic)),
+        d_acoustic(Kokkos::create_mirror_view(specfem::kokkos::DevMemSpace(),
+                                              acoustic)),
+        scalars(npoints) {}
+
+  // Copy the field used to compute the plotted component. The device copy
+  // packs the (possibly strided) field before the transfer to the host
+  template <typename SimulationFieldType>
+  void copy(const SimulationFieldType &field,
+            const specfem::wavefield::type component) {
+    Kokkos::deep_copy(d_elastic, get_field(field.elastic, component));
+    Kokkos::deep_copy(elastic, d_elastic);
+    Kokkos::deep_copy(d_acoustic, get_field(field.acoustic, component));
+    Kokkos::deep_copy(acoustic, d_acoustic);
+  }
+
+  // Compute the magnitude of the plotted component at the plotting nodes
+  template <typename SimulationFieldType>
+  void compute_scalars(const specfem::compute::assembly &assembly,
+                       const SimulationFieldType &field,
+                       const specfem::wavefield::type component) {
+    const auto &element_types = assembly.element_types;
+    const auto &mapping = field.h_medium_index_mapping;
+    const int nspec = assembly.mesh.nspec;
+
+    for (int ispec = 0; ispec < nspec; ++ispec) {
+      const auto medium = element_types.get_medium_tag(ispec);
+      const auto property = element_types.get_property_tag(ispec);
+      float *magnitude = scalars.data() + ispec * cell_points;
+
+      if (medium == specfem::element::medium_tag::elastic &&
+          property == specfem::element::property_tag::isotropic) {
+        compute_magnitude<specfem::element::medium_tag::elastic,
+                          specfem::element::property_tag::isotropic>(
+            assembly, mapping, elastic, component, ispec, magnitude);
+      } else if (medium == specfem::element::medium_tag::elastic &&
+                 property == specfem::element::property_tag::anisotropic) {
+        compute_magnitude<specfem::element::medium_tag::elastic,
+                          specfem::element::property_tag::anisotropic>(
+            assembly, mapping, elastic, component, ispec, magnitude);
+      } else if (medium == specfem::element::medium_tag::acoustic &&
+                 property == specfem::element::property_tag::isotropic) {
+        compute_magnitude<specfem::element::medium_tag::acoustic,
+                          specfem::element::property_tag::isotropic>(
+            assembly, mapping, acoustic, component, ispec, magnitude);
+      } else {
+        throw std::runtime_error("Element type not supported for plotting");
+      }
+    }
+  }
+};
+
+specfem::periodic_tasks::plot_wavefield::plot_wavefield(
+    const specfem::compute::assembly &assembly,
+    const specfem::display::format &output_format,
+    const specfem::display::wavefield &component,
+    const specfem::wavefield::simulation_field &wavefield,
+    const int &time_interval, const boost::filesystem::path &output_folder,
+    const int nbuffers)
+    : plotter(time_interval), output_format(output_format),
+      component(component), output_folder(output_folder),
+      wavefield(wavefield), assembly(assembly) {
+
+  // Frames are rendered off-screen on a background thread, which cannot host
+  // an interactive window
+  if (output_format == specfem::display::format::on_screen) {
+    throw std::runtime_error("On screen plotting not supported");
+  }
+
+  if (nbuffers < 1) {
+    std::ostringstream message;
+    message << "Number of frame buffers must be at least 1. Got " << nbuffers;
+    throw std::runtime_error(message.str());
+  }
+
+  // The pipeline is built here and only used by the render thread afterwards
+  vtk_pipeline = std::make_unique<pipeline>(this->assembly, output_format);
+
+  const std::size_t npoints = this->assembly.mesh.nspec * cell_points;
+  frames.reserve(nbuffers);
+  apply_to_field(this->assembly.fields, wavefield, [&](const auto &field) {
+    for (int iframe = 0; iframe < nbuffers; ++iframe) {
+      frames.emplace_back(field, npoints);
+    }
+  });
+  for (int iframe = 0; iframe < nbuffers; ++iframe) {
+    free_frames.push(iframe);
+  }
+
+  renderer = std::thread(&plot_wavefield::render_loop, this);
+}
+
+void specfem::periodic_tasks::plot_wavefield::run() {
+  int iframe;
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    frame_free.wait(lock, [&] { return !free_frames.empty() || error; });
+    if (error) {
+      lock.unlock();
+      this->rethrow_error();
+    }
+    iframe = free_frames.front();
+    free_frames.pop();
+  }
+
+  // Only copy the wavefield here. The plotted component is computed on the
+  // render thread
+  const auto component = get_component(this->component);
+  apply_to_field(assembly.fields, this->wavefield, [&](const auto &field) {
+    frames[iframe].copy(field, component);
+  });
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.emplace(this->m_istep, iframe);
+  }
+  frame_ready.notify_one();
+}
+
+void specfem::periodic_tasks::plot_wavefield::render_loop() {
+  while (true) {
+    std::pair<int, int> queued;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      frame_ready.wait(lock, [&] { return !pending.empty() || finished; });
+      // Render every queued frame before shutting down
+      if (pending.empty()) {
+        return;
+      }
+      queued = pending.front();
+      pending.pop();
+    }
+
+    const int istep = queued.first;
+    const auto filename = [&]() {
+      if (this->output_format == specfem::display::format::PNG) {
+        return this->output_folder /
+               ("wavefield" + to_zero_lead(istep, 6) + ".png");
+      } else {
+        return this->output_folder /
+               ("wavefield" + std::to_string(istep) + ".jpg");
+      }
+    }();
+
+    try {
+      auto &buffer = frames[queued.second];
+      const auto component = get_component(this->component);
+      apply_to_field(assembly.fields, this->wavefield, [&](const auto &field) {
+        buffer.compute_scalars(assembly, field, component);
+      });
+      vtk_pipeline->render(buffer.scalars, filename);
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        error = std::current_exception();
+      }
+      frame_free.notify_one();
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      free_frames.push(queued.second);
+    }
+    frame_free.notify_one();
   }
 }
 
 #endif // NO_VTK
+
+specfem::periodic_tasks::plot_wavefield::~plot_wavefield() {
+  try {
+    this->finalize();
+  } catch (const std::exception &e) {
+    std::cerr << "Error plotting wavefield: " << e.what() << std::endl;
+  }
+}
+
+void specfem::periodic_tasks::plot_wavefield::finalize() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+  }
+  frame_ready.notify_one();
+
+  if (renderer.joinable()) {
+    renderer.join();
+  }
+
+  this->rethrow_error();
+}
+
+void specfem::periodic_tasks::plot_wavefield::rethrow_error() {
+  std::exception_ptr e;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::swap(e, error);
+  }
+  if (e) {
+    std::rethrow_exception(e);
+  }
+}
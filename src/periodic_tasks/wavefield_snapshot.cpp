@@ -0,0 +1,239 @@
+#include "periodic_tasks/wavefield_snapshot.hpp"
+#include "IO/HDF5/HDF5.hpp"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+template <typename SimulationField>
+void get_fields(const SimulationField &field,
+                specfem::compute::impl::FieldViewType elastic[3],
+                specfem::compute::impl::FieldViewType acoustic[3]) {
+  elastic[0] = field.elastic.field;
+  elastic[1] = field.elastic.field_dot;
+  elastic[2] = field.elastic.field_dot_dot;
+  acoustic[0] = field.acoustic.field;
+  acoustic[1] = field.acoustic.field_dot;
+  acoustic[2] = field.acoustic.field_dot_dot;
+}
+
+// HDF5 datasets are written from host memory. Wrap the staging buffer in an
+// unmanaged host view
+template <typename ViewType> auto host_view(const ViewType &view) {
+  return Kokkos::View<type_real **, Kokkos::LayoutLeft,
+                      specfem::kokkos::HostMemSpace,
+                      Kokkos::MemoryTraits<Kokkos::Unmanaged> >(
+      view.data(), view.extent(0), view.extent(1));
+}
+} // namespace
+
+specfem::periodic_tasks::wavefield_snapshot::wavefield_snapshot(
+    const specfem::compute::assembly &assembly,
+    const specfem::wavefield::simulation_field &wavefield,
+    const format &output_format, const int &time_interval,
+    const boost::filesystem::path &output_folder, const int nbuffers,
+    const specfem::IO::dataset_options &options)
+    : periodic_task(time_interval), wavefield(wavefield),
+      output_format(output_format), output_folder(output_folder),
+      options(options) {
+
+  if (nbuffers < 1) {
+    std::ostringstream message;
+    message << "Number of snapshot buffers must be at least 1. Got "
+            << nbuffers;
+    throw std::runtime_error(message.str());
+  }
+
+#ifdef NO_HDF5
+  if (output_format == format::HDF5) {
+    throw std::runtime_error("SPECFEM++ was not compiled with HDF5 support");
+  }
+#endif
+
+  if (wavefield == specfem::wavefield::simulation_field::forward) {
+    get_fields(assembly.fields.forward, elastic, acoustic);
+  } else if (wavefield == specfem::wavefield::simulation_field::adjoint) {
+    get_fields(assembly.fields.adjoint, elastic, acoustic);
+  } else if (wavefield == specfem::wavefield::simulation_field::backward) {
+    get_fields(assembly.fields.backward, elastic, acoustic);
+  } else {
+    throw std::runtime_error("Unknown wavefield type for snapshots");
+  }
+
+  buffers.resize(nbuffers);
+  for (int ibuffer = 0; ibuffer < nbuffers; ++ibuffer) {
+    for (int ifield = 0; ifield < nfields; ++ifield) {
+      buffers[ibuffer].elastic[ifield] = StagingView(
+          "specfem::periodic_tasks::wavefield_snapshot::elastic",
+          elastic[ifield].extent(0), elastic[ifield].extent(1));
+      buffers[ibuffer].acoustic[ifield] = StagingView(
+          "specfem::periodic_tasks::wavefield_snapshot::acoustic",
+          acoustic[ifield].extent(0), acoustic[ifield].extent(1));
+    }
+    free_buffers.push(ibuffer);
+  }
+
+  writer = std::thread(&wavefield_snapshot::write_loop, this);
+}
+
+specfem::periodic_tasks::wavefield_snapshot::~wavefield_snapshot() {
+  try {
+    this->finalize();
+  } catch (const std::exception &e) {
+    std::cerr << "Error writing wavefield snapshots: " << e.what()
+              << std::endl;
+  }
+}
+
+void specfem::periodic_tasks::wavefield_snapshot::run() {
+  int ibuffer;
+  {
+    // Backpressure: wait until the writer has released a buffer
+    std::unique_lock<std::mutex> lock(mutex);
+    buffer_free.wait(lock, [&] { return !free_buffers.empty() || error; });
+    if (error) {
+      lock.unlock();
+      this->rethrow_error();
+    }
+    ibuffer = free_buffers.front();
+    free_buffers.pop();
+  }
+
+  const Kokkos::DefaultExecutionSpace exec;
+  auto &buffer = buffers[ibuffer];
+  for (int ifield = 0; ifield < nfields; ++ifield) {
+    Kokkos::deep_copy(exec, buffer.elastic[ifield], elastic[ifield]);
+    Kokkos::deep_copy(exec, buffer.acoustic[ifield], acoustic[ifield]);
+  }
+  exec.fence();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    pending.emplace(this->m_istep, ibuffer);
+  }
+  snapshot_ready.notify_one();
+}
+
+void specfem::periodic_tasks::wavefield_snapshot::finalize() {
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    finished = true;
+  }
+  snapshot_ready.notify_one();
+
+  if (writer.joinable()) {
+    writer.join();
+  }
+
+  this->rethrow_error();
+}
+
+void specfem::periodic_tasks::wavefield_snapshot::rethrow_error() {
+  std::exception_ptr e;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::swap(e, error);
+  }
+  if (e) {
+    std::rethrow_exception(e);
+  }
+}
+
+void specfem::periodic_tasks::wavefield_snapshot::write_loop() {
+  while (true) {
+    std::pair<int, int> snapshot;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      snapshot_ready.wait(lock, [&] { return !pending.empty() || finished; });
+      // Drain the queue before shutting down
+      if (pending.empty()) {
+        return;
+      }
+      snapshot = pending.front();
+      pending.pop();
+    }
+
+    try {
+      this->write(snapshot.first, buffers[snapshot.second]);
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        error = std::current_exception();
+      }
+      buffer_free.notify_one();
+      return;
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      free_buffers.push(snapshot.second);
+    }
+    buffer_free.notify_one();
+  }
+}
+
+void specfem::periodic_tasks::wavefield_snapshot::write(
+    const int istep, const staging_buffer &buffer) const {
+  if (output_format == format::HDF5) {
+    this->write_hdf5(istep, buffer);
+  } else {
+    this->write_binary(istep, buffer);
+  }
+}
+
+void specfem::periodic_tasks::wavefield_snapshot::write_hdf5(
+    const int istep, const staging_buffer &buffer) const {
+  using OutputLibrary = specfem::IO::HDF5<specfem::IO::write>;
+
+  const auto filename =
+      output_folder / ("Snapshot" + std::to_string(istep));
+
+  // Groups inherit the chunking and compression options of the file
+  typename OutputLibrary::File file(filename.string(), options);
+
+  typename OutputLibrary::Group elastic = file.createGroup("/Elastic");
+  typename OutputLibrary::Group acoustic = file.createGroup("/Acoustic");
+
+  elastic.createDataset("Displacement", host_view(buffer.elastic[0])).write();
+  elastic.createDataset("Velocity", host_view(buffer.elastic[1])).write();
+  elastic.createDataset("Acceleration", host_view(buffer.elastic[2])).write();
+
+  acoustic.createDataset("Potential", host_view(buffer.acoustic[0])).write();
+  acoustic.createDataset("PotentialDot", host_view(buffer.acoustic[1]))
+      .write();
+  acoustic.createDataset("PotentialDotDot", host_view(buffer.acoustic[2]))
+      .write();
+}
+
+void specfem::periodic_tasks::wavefield_snapshot::write_binary(
+    const int istep, const staging_buffer &buffer) const {
+  const auto filename =
+      output_folder / ("Snapshot" + std::to_string(istep) + ".bin");
+
+  std::ofstream file(filename.string(), std::ios::binary);
+  if (!file) {
+    std::ostringstream message;
+    message << "Could not open snapshot file " << filename.string();
+    throw std::runtime_error(message.str());
+  }
+
+  const auto write_view = [&](const StagingView &view) {
+    file.write(reinterpret_cast<const char *>(view.data()),
+               sizeof(type_real) * view.size());
+  };
+
+  for (int ifield = 0; ifield < nfields; ++ifield) {
+    write_view(buffer.elastic[ifield]);
+  }
+  for (int ifield = 0; ifield < nfields; ++ifield) {
+    write_view(buffer.acoustic[ifield]);
+  }
+
+  if (!file) {
+    std::ostringstream message;
+    message << "Error writing snapshot file " << filename.string();
+    throw std::runtime_error(message.str());
+  }
+}
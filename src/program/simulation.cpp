@@ -0,0 +1,443 @@
+#include "program/simulation.hpp"
+#include "IO/ASCII/ASCII.hpp"
+#include "IO/HDF5/HDF5.hpp"
+#include "IO/binary/binary.hpp"
+#include "IO/interface.hpp"
+#include "IO/property/reader.hpp"
+#include "solver/solver.hpp"
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+std::string
+print_end_message(std::chrono::time_point<std::chrono::system_clock> start_time,
+                  std::chrono::duration<double> solver_time) {
+  std::ostringstream message;
+  // current date/time based on current system
+  const auto now = std::chrono::system_clock::now();
+
+  std::time_t c_now = std::chrono::system_clock::to_time_t(now);
+
+  std::chrono::duration<double> diff = now - start_time;
+
+  message << "\n================================================\n"
+          << "             Finished simulation\n"
+          << "================================================\n\n"
+          << "Total simulation time : " << diff.count() << " secs\n"
+          << "Total solver time (time loop) : " << solver_time.count()
+          << " secs\n"
+          << "Simulation end time : " << ctime(&c_now)
+          << "------------------------------------------------\n";
+
+  return message.str();
+}
+} // namespace
+
+specfem::program::simulation::simulation(const YAML::Node &parameter_dict,
+                                         const YAML::Node &default_dict,
+                                         specfem::MPI::MPI *mpi)
+    : mpi(mpi), start_time(std::chrono::system_clock::now()),
+      setup(parameter_dict, default_dict),
+      quadratures(setup.instantiate_quadrature()) {
+
+  mpi->cout(setup.print_header(this->start_time));
+
+  // --------------------------------------------------------------
+  //                   Read mesh and materials
+  // --------------------------------------------------------------
+  this->mesh = specfem::IO::read_mesh(setup.get_databases(), mpi);
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Read Sources and Receivers
+  // --------------------------------------------------------------
+  const int nsteps = setup.get_nsteps();
+  const specfem::simulation::type simulation_type = setup.get_simulation_type();
+
+  auto [sources, t0] =
+      specfem::IO::read_sources(setup.get_sources(), nsteps, setup.get_t0(),
+                                setup.get_dt(), simulation_type);
+  setup.update_t0(t0);
+  this->sources = sources;
+
+  this->receivers = specfem::IO::read_receivers(setup.get_stations(),
+                                                setup.get_receiver_angle());
+
+  mpi->cout("Source Information:");
+  mpi->cout("-------------------------------");
+  if (mpi->main_proc()) {
+    std::cout << "Number of sources : " << this->sources.size() << "\n"
+              << std::endl;
+  }
+
+  for (auto &source : this->sources) {
+    mpi->cout(source->print());
+  }
+
+  mpi->cout("Receiver Information:");
+  mpi->cout("-------------------------------");
+
+  if (mpi->main_proc()) {
+    std::cout << "Number of receivers : " << this->receivers.size() << "\n"
+              << std::endl;
+  }
+
+  for (auto &receiver : this->receivers) {
+    mpi->cout(receiver->print());
+  }
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Instantiate Timescheme
+  // --------------------------------------------------------------
+  this->time_scheme = setup.instantiate_timescheme();
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Generate Assembly
+  // --------------------------------------------------------------
+  mpi->cout("Generating assembly:");
+  mpi->cout("-------------------------------");
+  const auto property_reader = setup.instantiate_property_reader();
+  const auto assembly_cache =
+      setup.instantiate_assembly_cache(this->quadratures);
+  if (assembly_cache) {
+    std::ostringstream message;
+    if (assembly_cache->is_valid()) {
+      message << "Reading mesh geometry from cache "
+              << assembly_cache->get_filename();
+    } else {
+      message << "Writing mesh geometry to cache "
+              << assembly_cache->get_filename();
+    }
+    mpi->cout(message.str());
+  }
+  this->assembly = { this->mesh,
+                     this->quadratures,
+                     this->sources,
+                     this->receivers,
+                     setup.get_seismogram_types(),
+                     setup.get_t0(),
+                     setup.get_dt(),
+                     nsteps,
+                     this->time_scheme->get_max_seismogram_step(),
+                     this->time_scheme->get_nstep_between_samples(),
+                     simulation_type,
+                     property_reader,
+                     assembly_cache };
+
+  if (property_reader) {
+    mpi->cout("Reading model files:");
+    mpi->cout("-------------------------------");
+    this->load_properties(*property_reader);
+  }
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Automatic time step
+  // --------------------------------------------------------------
+  // The time step is computed from the material properties of the assembly.
+  // Sources, receivers and stored boundary values are discretized in time
+  // and are regenerated for the new time step
+  if (setup.get_automatic_dt()) {
+    const specfem::compute::cfl cfl(
+        this->assembly.mesh, this->assembly.element_types,
+        this->assembly.properties, setup.get_dt(), setup.get_target_courant());
+    setup.update_dt(cfl.recommended_dt);
+
+    auto [new_sources, new_t0] = specfem::IO::read_sources(
+        setup.get_sources(), setup.get_nsteps(), setup.get_t0(),
+        setup.get_dt(), simulation_type);
+    setup.update_t0(new_t0);
+    this->sources = new_sources;
+
+    this->time_scheme = setup.instantiate_timescheme();
+
+    this->assembly.sources = { this->sources,
+                               this->assembly.mesh,
+                               this->assembly.partial_derivatives,
+                               this->assembly.element_types,
+                               setup.get_t0(),
+                               setup.get_dt(),
+                               setup.get_nsteps() };
+    this->generate_receivers();
+    this->assembly.boundary_values = { setup.get_nsteps(),
+                                       this->assembly.mesh,
+                                       this->assembly.element_types,
+                                       this->assembly.boundaries };
+
+    std::ostringstream message;
+    message << "Automatic time step : dt = " << setup.get_dt()
+            << ", nstep = " << setup.get_nsteps() << "\n";
+    mpi->cout(message.str());
+  }
+
+  if (setup.get_fused_stiffness_coefficients()) {
+    this->assembly.compute_stiffness_coefficients();
+  }
+
+  // Time scheme holds shallow copies of the fields. Fields are never
+  // reallocated by this object, only reset in place.
+  this->time_scheme->link_assembly(this->assembly);
+
+  // Printed once linked, such that the details include the final time step
+  // and the local time stepping levels
+  if (mpi->main_proc())
+    std::cout << *this->time_scheme << std::endl;
+
+  const specfem::compute::cfl cfl(
+      this->assembly.mesh, this->assembly.element_types,
+      this->assembly.properties, setup.get_dt(), setup.get_target_courant());
+  mpi->cout(cfl.print());
+}
+
+void specfem::program::simulation::reset_fields() {
+  this->assembly.fields.reset();
+  this->assembly.receivers.reset_seismograms();
+  this->assembly.kernels.reset();
+  this->time_scheme->resume(0, 0);
+  this->dirty = false;
+}
+
+void specfem::program::simulation::set_sources(const YAML::Node &sources) {
+  const int nsteps = setup.get_nsteps();
+  const type_real dt = setup.get_dt();
+
+  auto [new_sources, t0] = specfem::IO::read_sources(
+      sources, nsteps, setup.get_t0(), dt, setup.get_simulation_type());
+
+  this->sources = new_sources;
+
+  this->assembly.sources = { this->sources,
+                             this->assembly.mesh,
+                             this->assembly.partial_derivatives,
+                             this->assembly.element_types,
+                             t0,
+                             dt,
+                             nsteps };
+
+  // Seismogram time axis depends on t0
+  if (t0 != setup.get_t0()) {
+    setup.update_t0(t0);
+    this->generate_receivers();
+  }
+}
+
+void specfem::program::simulation::set_receivers(const YAML::Node &stations) {
+  this->receivers =
+      specfem::IO::read_receivers(stations, setup.get_receiver_angle());
+  this->generate_receivers();
+}
+
+void specfem::program::simulation::generate_receivers() {
+  this->assembly.receivers = { this->assembly.mesh.nspec,
+                               this->assembly.mesh.ngllz,
+                               this->assembly.mesh.ngllx,
+                               this->time_scheme->get_max_seismogram_step(),
+                               setup.get_dt(),
+                               setup.get_t0(),
+                               this->time_scheme->get_nstep_between_samples(),
+                               this->receivers,
+                               setup.get_seismogram_types(),
+                               this->assembly.mesh,
+                               this->mesh.tags,
+                               this->assembly.element_types };
+}
+
+void specfem::program::simulation::update_properties(
+    const std::string &input_folder, const std::string &format) {
+
+  const std::shared_ptr<specfem::IO::reader> reader =
+      [&]() -> std::shared_ptr<specfem::IO::reader> {
+    if (format == "HDF5") {
+      return std::make_shared<
+          specfem::IO::property_reader<specfem::IO::HDF5<specfem::IO::read> > >(
+          input_folder);
+    } else if (format == "ASCII") {
+      return std::make_shared<
+          specfem::IO::property_reader<specfem::IO::ASCII<specfem::IO::read> > >(
+          input_folder);
+    } else if (format == "binary") {
+      return std::make_shared<specfem::IO::property_reader<
+          specfem::IO::binary<specfem::IO::read> > >(input_folder);
+    } else {
+      std::ostringstream message;
+      message << "Unknown model format : " << format;
+      throw std::runtime_error(message.str());
+    }
+  }();
+
+  this->load_properties(*reader);
+
+  // Fused coefficients depend on the material properties
+  if (this->assembly.stiffness_coefficients.enabled) {
+    this->assembly.compute_stiffness_coefficients();
+  }
+
+  // Local time stepping levels are computed from the material properties
+  this->time_scheme->link_assembly(this->assembly);
+}
+
+void specfem::program::simulation::load_properties(
+    specfem::IO::reader &reader) {
+  reader.read(this->assembly);
+
+  // Absorbing boundaries are computed from material properties
+  this->assembly.boundaries = { this->assembly.mesh.nspec,
+                                this->assembly.mesh.ngllz,
+                                this->assembly.mesh.ngllx,
+                                this->mesh,
+                                this->assembly.mesh.mapping,
+                                this->assembly.mesh.quadratures,
+                                this->assembly.properties,
+                                this->assembly.partial_derivatives };
+}
+
+void specfem::program::simulation::run(
+    std::vector<std::shared_ptr<specfem::periodic_tasks::periodic_task> >
+        tasks) {
+
+  // --------------------------------------------------------------
+  //                Write properties
+  // --------------------------------------------------------------
+  // Writing the model replaces the time loop
+  const auto property_writer = setup.instantiate_property_writer();
+  if (property_writer) {
+    mpi->cout("Writing model files:");
+    mpi->cout("-------------------------------");
+
+    property_writer->write(this->assembly);
+    return;
+  }
+  // --------------------------------------------------------------
+
+  if (this->dirty) {
+    this->reset_fields();
+  }
+
+  // --------------------------------------------------------------
+  //                   Read wavefields
+  // --------------------------------------------------------------
+  const auto wavefield_reader = setup.instantiate_wavefield_reader();
+  if (wavefield_reader) {
+    mpi->cout("Reading wavefield files:");
+    mpi->cout("-------------------------------");
+
+    wavefield_reader->read(this->assembly);
+    // Transfer the buffer field to device
+    this->assembly.fields.buffer.copy_to_device();
+  }
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Instantiate energy monitor
+  // --------------------------------------------------------------
+  // Checked before the other tasks so that unstable states are not written
+  const auto energy_monitor =
+      setup.instantiate_energy_monitor(this->assembly, mpi);
+  tasks.push_back(energy_monitor);
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Restart from checkpoint
+  // --------------------------------------------------------------
+  // Tasks that accumulate state over the time loop are created first, so that
+  // their state is stored in and restored from the checkpoint
+  const auto ground_motion = setup.instantiate_ground_motion(this->assembly);
+
+  std::vector<specfem::IO::checkpoint::entry> task_state;
+  for (const auto &task : { ground_motion }) {
+    if (task) {
+      const auto state = task->get_checkpoint_state();
+      task_state.insert(task_state.end(), state.begin(), state.end());
+    }
+  }
+
+  // A checkpoint is only restored by the first run. Subsequent runs start
+  // from reset fields
+  if (this->first_run && setup.restore_checkpoint(this->assembly,
+                                                  *this->time_scheme,
+                                                  task_state)) {
+    mpi->cout("Restarted from checkpoint");
+    mpi->cout("-------------------------------");
+  }
+  this->first_run = false;
+
+  const auto checkpoint = setup.instantiate_checkpoint(
+      this->assembly, this->time_scheme, task_state);
+  tasks.push_back(checkpoint);
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Instantiate plotter and solver
+  // --------------------------------------------------------------
+  // Solvers hold copies of the assembly. They are cheap to create and are
+  // instantiated for every run to pick up updated sources and receivers
+  const auto wavefield_plotter =
+      setup.instantiate_wavefield_plotter(this->assembly);
+  tasks.push_back(wavefield_plotter);
+
+  const auto wavefield_snapshot =
+      setup.instantiate_wavefield_snapshot(this->assembly);
+  tasks.push_back(wavefield_snapshot);
+
+  tasks.push_back(ground_motion);
+
+  std::shared_ptr<specfem::solver::solver> solver =
+      setup.instantiate_solver<5>(setup.get_dt(), this->assembly,
+                                  this->time_scheme, tasks);
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Execute Solver
+  // --------------------------------------------------------------
+  mpi->cout("Executing time loop:");
+  mpi->cout("-------------------------------");
+
+  this->dirty = true;
+  const auto solver_start_time = std::chrono::system_clock::now();
+  solver->run();
+  const auto solver_end_time = std::chrono::system_clock::now();
+
+  std::chrono::duration<double> solver_time =
+      solver_end_time - solver_start_time;
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Write outputs
+  // --------------------------------------------------------------
+  const auto seismogram_writer = setup.instantiate_seismogram_writer();
+  if (seismogram_writer) {
+    mpi->cout("Writing seismogram files:");
+    mpi->cout("-------------------------------");
+
+    seismogram_writer->write(this->assembly);
+  }
+
+  const auto wavefield_writer = setup.instantiate_wavefield_writer();
+  if (wavefield_writer) {
+    mpi->cout("Writing wavefield files:");
+    mpi->cout("-------------------------------");
+
+    wavefield_writer->write(this->assembly);
+  }
+
+  const auto kernel_writer = setup.instantiate_kernel_writer();
+  if (kernel_writer) {
+    mpi->cout("Writing kernel files:");
+    mpi->cout("-------------------------------");
+
+    kernel_writer->write(this->assembly);
+  }
+  // --------------------------------------------------------------
+
+  // --------------------------------------------------------------
+  //                   Print End Message
+  // --------------------------------------------------------------
+  mpi->cout(print_end_message(this->start_time, solver_time));
+  // --------------------------------------------------------------
+
+  return;
+}
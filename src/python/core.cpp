@@ -4,6 +4,7 @@
 #define STRINGIFY(x) #x
 #define MACRO_STRINGIFY(x) STRINGIFY(x)
 #include "periodic_tasks/check_signal.hpp"
+#include "program/simulation.hpp"
 
 namespace py = pybind11;
 
@@ -58,6 +59,53 @@ bool _execute(const std::string &parameter_string,
   return true;
 }
 
+/**
+ * @brief Persistent simulation exposed to Python
+ *
+ * Keeps the assembly alive between runs. Parameters are passed as YAML
+ * strings to be consistent with _execute.
+ */
+class _Simulation {
+public:
+  _Simulation(const std::string &parameter_string,
+              const std::string &default_string) {
+    if (_py_mpi == NULL) {
+      throw std::runtime_error("SPECFEM++ has not been initialized");
+    }
+    const YAML::Node parameter_dict = YAML::Load(parameter_string);
+    const YAML::Node default_dict = YAML::Load(default_string);
+    simulation = std::make_unique<specfem::program::simulation>(
+        parameter_dict, default_dict, _py_mpi);
+  }
+
+  void run() {
+    std::vector<std::shared_ptr<specfem::periodic_tasks::periodic_task> >
+        tasks;
+    const auto signal_task =
+        std::make_shared<specfem::periodic_tasks::check_signal>(10);
+    tasks.push_back(signal_task);
+    simulation->run(tasks);
+  }
+
+  void reset_fields() { simulation->reset_fields(); }
+
+  void set_sources(const std::string &sources_string) {
+    simulation->set_sources(YAML::Load(sources_string));
+  }
+
+  void set_receivers(const std::string &stations_string) {
+    simulation->set_receivers(YAML::Load(stations_string));
+  }
+
+  void update_properties(const std::string &input_folder,
+                         const std::string &format) {
+    simulation->update_properties(input_folder, format);
+  }
+
+private:
+  std::unique_ptr<specfem::program::simulation> simulation;
+};
+
 bool _finalize() {
   if (_py_mpi != NULL) {
     // Finalize Kokkos
@@ -95,6 +143,31 @@ PYBIND11_MODULE(_core, m) {
         Finalize SPECFEM++.
     )pbdoc");
 
+    py::class_<_Simulation>(m, "_Simulation", R"pbdoc(
+        Persistent SPECFEM++ simulation. The mesh is read and assembled once
+        and reused between runs.
+    )pbdoc")
+        .def(py::init<const std::string &, const std::string &>(),
+             py::arg("parameter_string"), py::arg("default_string"))
+        .def("run", &_Simulation::run, R"pbdoc(
+        Run the time loop. Fields from a previous run are reset.
+    )pbdoc")
+        .def("reset_fields", &_Simulation::reset_fields, R"pbdoc(
+        Zero out wavefields, seismograms and kernels in place.
+    )pbdoc")
+        .def("set_sources", &_Simulation::set_sources, py::arg("sources"),
+             R"pbdoc(
+        Replace sources. Sources are passed as a YAML string.
+    )pbdoc")
+        .def("set_receivers", &_Simulation::set_receivers,
+             py::arg("stations"), R"pbdoc(
+        Replace receivers. Stations are passed as a YAML string.
+    )pbdoc")
+        .def("update_properties", &_Simulation::update_properties,
+             py::arg("input_folder"), py::arg("format"), R"pbdoc(
+        Update material properties in place from a model on disk.
+    )pbdoc");
+
     m.attr("_default_file_path") = __default_file__;
 
 #ifdef VERSION_INFO
@@ -2,6 +2,7 @@
 #include "enumerations/specfem_enums.hpp"
 #include "kokkos_abstractions.h"
 #include "IO/seismogram/reader.hpp"
+#include "IO/seismogram/trace_container.hpp"
 #include <fstream>
 #include <tuple>
 #include <vector>
@@ -11,12 +12,21 @@ specfem::forcing_function::external::external(const YAML::Node &external,
                                               const type_real dt)
     : __nsteps(nsteps), __dt(dt) {
 
-  if ((external["format"].as<std::string>() == "ascii") ||
-      (external["format"].as<std::string>() == "ASCII") ||
-      !external["format"]) {
+  const std::string format =
+      (external["format"]) ? external["format"].as<std::string>() : "ascii";
+
+  if ((format == "ascii") || (format == "ASCII")) {
     this->type = specfem::enums::seismogram::format::ascii;
+  } else if ((format == "binary") || (format == "BINARY")) {
+    this->type = specfem::enums::seismogram::format::binary;
+    if (!external["file"]) {
+      throw std::runtime_error("Error: External source time function in "
+                               "binary format requires a trace container "
+                               "file");
+    }
+    this->container = external["file"].as<std::string>();
   } else {
-    throw std::runtime_error("Only ASCII format is supported");
+    throw std::runtime_error("Only ASCII and binary formats are supported");
   }
 
   // Get the components from the file
@@ -40,6 +50,14 @@ specfem::forcing_function::external::external(const YAML::Node &external,
                              "at least one component");
   }
 
+  // Get t0 and dt from the header of the container
+  if (this->type == specfem::enums::seismogram::format::binary) {
+    const auto header = specfem::IO::trace_container::read_header(container);
+    this->__t0 = header.t0;
+    this->__dt = header.dt;
+    return;
+  }
+
   // Get t0 and dt from the file
   const std::string filename = [&]() -> std::string {
     if (this->ncomponents == 2) {
@@ -102,13 +120,57 @@ void specfem::forcing_function::external::compute_source_time_function(
         "function does not match the simulation time step");
   }
 
-  std::vector<std::string> filename =
-      (ncomponents == 2)
-          ? std::vector<std::string>{ this->x_component, this->z_component }
-          : std::vector<std::string>{ this->y_component };
+  // set source time function to 0
+  for (int i = 0; i < nsteps; i++) {
+    for (int icomp = 0; icomp < ncomponents; ++icomp) {
+      source_time_function(i, icomp) = 0.0;
+    }
+  }
+
+  const std::vector<std::string> filename = this->get_components();
+
+  // Traces are read ahead when loading many sources
+  if (this->traces.extent(0) > 0) {
+    if (this->traces.extent(0) < nsteps ||
+        this->traces.extent(1) != filename.size()) {
+      throw std::runtime_error("The traces of the external source time "
+                               "function do not match the number of steps");
+    }
+    for (int i = 0; i < nsteps; i++) {
+      for (int icomp = 0; icomp < filename.size(); ++icomp) {
+        source_time_function(i, icomp) = this->traces(i, icomp);
+      }
+    }
+    return;
+  }
+
+  if (this->type == specfem::enums::seismogram::format::binary) {
+    specfem::IO::trace_container file(this->container);
+    std::vector<std::string> names;
+    for (const auto &name : filename) {
+      if (!name.empty())
+        names.push_back(name);
+    }
+    if (file.get_nsteps() != nsteps) {
+      throw std::runtime_error("The traces of the external source time "
+                               "function do not match the number of steps");
+    }
+    specfem::kokkos::HostView2d<type_real> data("external", names.size(),
+                                                file.get_nsteps());
+    file.read(names, data);
+    for (int icomp = 0, itrace = 0; icomp < filename.size(); ++icomp) {
+      if (filename[icomp].empty())
+        continue;
+      for (int i = 0; i < nsteps; i++) {
+        source_time_function(i, icomp) = data(itrace, i);
+      }
+      itrace++;
+    }
+    return;
+  }
 
   // Check if files exist
-  for (int icomp = 0; icomp < ncomponents; ++icomp) {
+  for (int icomp = 0; icomp < filename.size(); ++icomp) {
     // Skip empty filenames
     if (filename[icomp].empty())
       continue;
@@ -120,14 +182,7 @@ void specfem::forcing_function::external::compute_source_time_function(
     }
   }
 
-  // set source time function to 0
-  for (int i = 0; i < nsteps; i++) {
-    for (int icomp = 0; icomp < ncomponents; ++icomp) {
-      source_time_function(i, icomp) = 0.0;
-    }
-  }
-
-  for (int icomp = 0; icomp < ncomponents; ++icomp) {
+  for (int icomp = 0; icomp < filename.size(); ++icomp) {
     if (filename[icomp].empty())
       continue;
 
@@ -141,3 +196,12 @@ void specfem::forcing_function::external::compute_source_time_function(
   }
   return;
 }
+
+std::vector<std::string>
+specfem::forcing_function::external::get_components() const {
+  if (this->ncomponents == 2) {
+    return { this->x_component, this->z_component };
+  } else {
+    return { this->y_component };
+  }
+}
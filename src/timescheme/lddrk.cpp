@@ -0,0 +1,140 @@
+#include "timescheme/lddrk.hpp"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <ostream>
+
+namespace {
+
+// Coefficients of the LDDRK4-6 scheme (Berland et al., 2006)
+constexpr type_real alpha_lddrk[6] = { 0.0,
+                                       -0.737101392796,
+                                       -1.634740794341,
+                                       -0.744739003780,
+                                       -1.469897351522,
+                                       -2.813971388035 };
+constexpr type_real beta_lddrk[6] = { 0.032918605146, 0.823256998200,
+                                      0.381530948900, 0.200092213184,
+                                      1.718581042715, 0.27 };
+constexpr type_real c_lddrk[6] = { 0.0,
+                                   0.032918605146,
+                                   0.249351723343,
+                                   0.466911705055,
+                                   0.582030414044,
+                                   0.847252983783 };
+
+using RegisterView =
+    specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>;
+
+template <specfem::element::medium_tag MediumTag>
+void corrector_phase_impl(
+    const specfem::compute::impl::field_impl<specfem::dimension::type::dim2,
+                                             MediumTag> &field,
+    const RegisterView &displacement_register,
+    const RegisterView &velocity_register, const type_real alpha,
+    const type_real beta, const type_real deltat) {
+
+  constexpr int components = specfem::element::attributes<
+      specfem::dimension::type::dim2, MediumTag>::components();
+  const int nglob = field.nglob;
+
+  const auto displacement = field.field;
+  const auto velocity = field.field_dot;
+  const auto acceleration = field.field_dot_dot;
+
+  Kokkos::parallel_for(
+      "specfem::TimeScheme::LDDRK::corrector_phase_impl",
+      specfem::kokkos::DeviceRange(0, nglob), KOKKOS_LAMBDA(const int iglob) {
+        for (int icomp = 0; icomp < components; ++icomp) {
+          displacement_register(iglob, icomp) =
+              alpha * displacement_register(iglob, icomp) +
+              deltat * velocity(iglob, icomp);
+          velocity_register(iglob, icomp) =
+              alpha * velocity_register(iglob, icomp) +
+              deltat * acceleration(iglob, icomp);
+          displacement(iglob, icomp) +=
+              beta * displacement_register(iglob, icomp);
+          velocity(iglob, icomp) += beta * velocity_register(iglob, icomp);
+        }
+      });
+}
+
+} // namespace
+
+void specfem::time_scheme::lddrk<specfem::simulation::type::forward>::
+    link_assembly(const specfem::compute::assembly &assembly) {
+  field = assembly.fields.forward;
+
+  constexpr int elastic_components =
+      specfem::element::attributes<specfem::dimension::type::dim2,
+                                   specfem::element::medium_tag::elastic>::
+          components();
+  constexpr int acoustic_components =
+      specfem::element::attributes<specfem::dimension::type::dim2,
+                                   specfem::element::medium_tag::acoustic>::
+          components();
+
+  elastic_displacement =
+      RegisterView("specfem::TimeScheme::LDDRK::elastic_displacement",
+                   field.elastic.nglob, elastic_components);
+  elastic_velocity =
+      RegisterView("specfem::TimeScheme::LDDRK::elastic_velocity",
+                   field.elastic.nglob, elastic_components);
+  acoustic_displacement =
+      RegisterView("specfem::TimeScheme::LDDRK::acoustic_displacement",
+                   field.acoustic.nglob, acoustic_components);
+  acoustic_velocity =
+      RegisterView("specfem::TimeScheme::LDDRK::acoustic_velocity",
+                   field.acoustic.nglob, acoustic_components);
+}
+
+type_real specfem::time_scheme::lddrk<
+    specfem::simulation::type::forward>::get_stage_offset() const {
+  // The wavefield at the end of a time step corresponds to the current time
+  // step, consistent with the Newmark scheme
+  return c_lddrk[istage] - 1.0;
+}
+
+void specfem::time_scheme::lddrk<specfem::simulation::type::forward>::
+    apply_predictor_phase_forward(const specfem::element::medium_tag tag) {
+
+  if (tag == specfem::element::medium_tag::elastic) {
+    Kokkos::deep_copy(field.elastic.field_dot_dot, 0.0);
+  } else if (tag == specfem::element::medium_tag::acoustic) {
+    Kokkos::deep_copy(field.acoustic.field_dot_dot, 0.0);
+  } else {
+    static_assert("medium type not supported");
+  }
+
+  return;
+}
+
+void specfem::time_scheme::lddrk<specfem::simulation::type::forward>::
+    apply_corrector_phase_forward(const specfem::element::medium_tag tag) {
+
+  constexpr auto elastic = specfem::element::medium_tag::elastic;
+  constexpr auto acoustic = specfem::element::medium_tag::acoustic;
+
+  if (tag == elastic) {
+    corrector_phase_impl<elastic>(field.elastic, elastic_displacement,
+                                  elastic_velocity, alpha_lddrk[istage],
+                                  beta_lddrk[istage], deltat);
+  } else if (tag == acoustic) {
+    corrector_phase_impl<acoustic>(field.acoustic, acoustic_displacement,
+                                   acoustic_velocity, alpha_lddrk[istage],
+                                   beta_lddrk[istage], deltat);
+  } else {
+    static_assert("medium type not supported");
+  }
+
+  return;
+}
+
+void specfem::time_scheme::lddrk<specfem::simulation::type::forward>::print(
+    std::ostream &message) const {
+  message << "  Time Scheme:\n"
+          << "------------------------------\n"
+          << "- LDDRK4-6\n"
+          << "    simulation type = forward\n"
+          << "    dt = " << this->deltat << "\n"
+          << "    Start time = " << this->t0 << "\n";
+}
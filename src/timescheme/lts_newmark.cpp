@@ -0,0 +1,618 @@
+#include "timescheme/lts_newmark.hpp"
+#include "compute/cfl/cfl.hpp"
+#include "enumerations/material_definitions.hpp"
+#include "kokkos_kernels/impl/compute_stiffness_interaction.hpp"
+#include <Kokkos_Core.hpp>
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+template <specfem::element::medium_tag MediumTag, typename FieldType>
+specfem::compute::impl::field_impl<specfem::dimension::type::dim2, MediumTag>
+get_medium_field(const FieldType &field) {
+  if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
+    return field.elastic;
+  } else if constexpr (MediumTag == specfem::element::medium_tag::acoustic) {
+    return field.acoustic;
+  } else {
+    static_assert("medium type not supported");
+  }
+}
+
+using WavefieldView = specfem::compute::impl::FieldViewType;
+using FieldView = specfem::kokkos::DeviceView2d<type_real, Kokkos::LayoutLeft>;
+using IndexView = Kokkos::View<int *, Kokkos::DefaultExecutionSpace>;
+
+IndexView create_index_view(const std::vector<int> &indices) {
+  IndexView view("specfem::time_scheme::lts_newmark::indices", indices.size());
+  const auto h_view = Kokkos::create_mirror_view(view);
+  for (int i = 0; i < indices.size(); ++i) {
+    h_view(i) = indices[i];
+  }
+  Kokkos::deep_copy(view, h_view);
+  return view;
+}
+
+// global(active(dofs(i))) = local(dofs(i))
+void scatter(const WavefieldView &global, const IndexView &active,
+             const IndexView &dofs, const FieldView &local) {
+  const int components = global.extent(1);
+
+  Kokkos::parallel_for(
+      "specfem::time_scheme::lts_newmark::scatter",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, dofs.extent(0)),
+      KOKKOS_LAMBDA(const int i) {
+        const int index = dofs(i);
+        const int iglob = active(index);
+        for (int icomp = 0; icomp < components; ++icomp) {
+          global(iglob, icomp) = local(index, icomp);
+        }
+      });
+}
+
+// global(active(dofs(i))) = 0
+void clear(const WavefieldView &global, const IndexView &active,
+           const IndexView &dofs) {
+  const int components = global.extent(1);
+
+  Kokkos::parallel_for(
+      "specfem::time_scheme::lts_newmark::clear",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, dofs.extent(0)),
+      KOKKOS_LAMBDA(const int i) {
+        const int iglob = active(dofs(i));
+        for (int icomp = 0; icomp < components; ++icomp) {
+          global(iglob, icomp) = 0.0;
+        }
+      });
+}
+
+// local(i) = global(active(i))
+void gather(const FieldView &local, const IndexView &active,
+            const WavefieldView &global) {
+  const int components = global.extent(1);
+
+  Kokkos::parallel_for(
+      "specfem::time_scheme::lts_newmark::gather",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, active.extent(0)),
+      KOKKOS_LAMBDA(const int i) {
+        const int iglob = active(i);
+        for (int icomp = 0; icomp < components; ++icomp) {
+          local(i, icomp) = global(iglob, icomp);
+        }
+      });
+}
+
+// forcing(i) = field_dot_dot(iglob) - M^{-1} acceleration(iglob), with
+// iglob = active(i). The acceleration is reset to zero
+void remove_stiffness(const FieldView &forcing, const IndexView &active,
+                      const WavefieldView &field_dot_dot,
+                      const WavefieldView &acceleration,
+                      const WavefieldView &mass_inverse) {
+  const int components = field_dot_dot.extent(1);
+
+  Kokkos::parallel_for(
+      "specfem::time_scheme::lts_newmark::remove_stiffness",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, active.extent(0)),
+      KOKKOS_LAMBDA(const int i) {
+        const int iglob = active(i);
+        for (int icomp = 0; icomp < components; ++icomp) {
+          forcing(i, icomp) =
+              field_dot_dot(iglob, icomp) -
+              acceleration(iglob, icomp) * mass_inverse(iglob, icomp);
+          acceleration(iglob, icomp) = 0.0;
+        }
+      });
+}
+
+// Inputs of the next level:
+// next_displacement(i) = displacement(parent(i))
+// next_forcing(i) = forcing(parent(i)) + M^{-1} acceleration(iglob)
+void restrict_level(const FieldView &next_displacement,
+                    const FieldView &next_forcing, const IndexView &parent,
+                    const FieldView &displacement, const FieldView &forcing,
+                    const IndexView &active, const WavefieldView &acceleration,
+                    const WavefieldView &mass_inverse) {
+  const int components = displacement.extent(1);
+
+  Kokkos::parallel_for(
+      "specfem::time_scheme::lts_newmark::restrict_level",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, parent.extent(0)),
+      KOKKOS_LAMBDA(const int i) {
+        const int index = parent(i);
+        const int iglob = active(index);
+        for (int icomp = 0; icomp < components; ++icomp) {
+          next_displacement(i, icomp) = displacement(index, icomp);
+          next_forcing(i, icomp) =
+              forcing(index, icomp) +
+              acceleration(iglob, icomp) * mass_inverse(iglob, icomp);
+        }
+      });
+}
+
+// deviation(i) = alpha * M^{-1} acceleration(active(i))
+// The acceleration is reset to zero
+void accumulate(const FieldView &deviation, const type_real alpha,
+                const IndexView &active, const WavefieldView &acceleration,
+                const WavefieldView &mass_inverse) {
+  const int components = deviation.extent(1);
+
+  Kokkos::parallel_for(
+      "specfem::time_scheme::lts_newmark::accumulate",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, active.extent(0)),
+      KOKKOS_LAMBDA(const int i) {
+        const int iglob = active(i);
+        for (int icomp = 0; icomp < components; ++icomp) {
+          deviation(i, icomp) = alpha * acceleration(iglob, icomp) *
+                                mass_inverse(iglob, icomp);
+          acceleration(iglob, icomp) = 0.0;
+        }
+      });
+}
+
+// displacement += alpha * forcing + deviation
+void advance(const FieldView &displacement, const type_real alpha,
+             const FieldView &forcing, const FieldView &deviation) {
+  const int ndofs = displacement.extent(0);
+  const int components = displacement.extent(1);
+
+  Kokkos::parallel_for(
+      "specfem::time_scheme::lts_newmark::advance",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, ndofs),
+      KOKKOS_LAMBDA(const int i) {
+        for (int icomp = 0; icomp < components; ++icomp) {
+          displacement(i, icomp) +=
+              alpha * forcing(i, icomp) + deviation(i, icomp);
+        }
+      });
+}
+
+// deviation(parent(i)) += 2 * (first(i) + second(i))
+void prolong(const FieldView &deviation, const IndexView &parent,
+             const FieldView &first, const FieldView &second) {
+  const int components = deviation.extent(1);
+
+  Kokkos::parallel_for(
+      "specfem::time_scheme::lts_newmark::prolong",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, parent.extent(0)),
+      KOKKOS_LAMBDA(const int i) {
+        const int index = parent(i);
+        for (int icomp = 0; icomp < components; ++icomp) {
+          deviation(index, icomp) += 2.0 * (first(i, icomp) + second(i, icomp));
+        }
+      });
+}
+
+// field_dot_dot(active(i)) = forcing(i) + alpha * (first(i) + second(i))
+void update(const WavefieldView &field_dot_dot, const IndexView &active,
+            const FieldView &forcing, const type_real alpha,
+            const FieldView &first, const FieldView &second) {
+  const int components = field_dot_dot.extent(1);
+
+  Kokkos::parallel_for(
+      "specfem::time_scheme::lts_newmark::update",
+      Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(0, active.extent(0)),
+      KOKKOS_LAMBDA(const int i) {
+        const int iglob = active(i);
+        for (int icomp = 0; icomp < components; ++icomp) {
+          field_dot_dot(iglob, icomp) =
+              forcing(i, icomp) + alpha * (first(i, icomp) + second(i, icomp));
+        }
+      });
+}
+
+} // namespace
+
+void specfem::time_scheme::lts_newmark<specfem::simulation::type::forward>::
+    link_assembly(const specfem::compute::assembly &assembly) {
+
+  newmark::link_assembly(assembly);
+  this->assembly = assembly;
+
+  const int nspec = assembly.mesh.nspec;
+  this->ngll = assembly.mesh.ngllx;
+
+  if (assembly.mesh.ngllz != this->ngll ||
+      (this->ngll != 5 && this->ngll != 8)) {
+    throw std::runtime_error("Number of quadrature points not supported");
+  }
+
+  // Assign every element to the coarsest level at which it is stable
+  const specfem::compute::cfl cfl(assembly.mesh, assembly.element_types,
+                                  assembly.properties, this->get_timestep(),
+                                  target_courant, 0);
+
+  std::vector<int> element_level(nspec, 0);
+  this->nlevels = 0;
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    int level = 0;
+    type_real courant = cfl.element_courant[ispec];
+    while (courant > target_courant && level <= max_levels) {
+      courant /= 2;
+      level++;
+    }
+    if (level > max_levels) {
+      std::ostringstream message;
+      message << "Error in local time stepping: element "
+              << assembly.mesh.mapping.compute_to_mesh(ispec)
+              << " requires more than " << max_levels
+              << " refinement levels. Reduce the time step or increase "
+                 "max-levels.";
+      throw std::runtime_error(message.str());
+    }
+    element_level[ispec] = level;
+    this->nlevels = std::max(this->nlevels, level);
+  }
+
+  this->nelements_per_level.assign(this->nlevels + 1, 0);
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    this->nelements_per_level[element_level[ispec]]++;
+  }
+
+  this->assign_levels<specfem::element::medium_tag::elastic>(element_level,
+                                                             this->elastic);
+  this->assign_levels<specfem::element::medium_tag::acoustic>(element_level,
+                                                              this->acoustic);
+
+  // Number of element evaluations of the stiffness interaction per time step
+  // relative to a Newmark scheme at the finest time step
+  type_real work = nspec;
+  for (const auto *levels : { &this->elastic, &this->acoustic }) {
+    for (int set = 0; set < static_cast<int>(levels->elements.size());
+         ++set) {
+      const int evaluations = (set == 0) ? 1 : (1 << set);
+      for (const auto &[tags, elements] : levels->elements[set]) {
+        work += evaluations * elements.extent(0);
+      }
+    }
+  }
+
+  this->relative_cost = work / (nspec * (1 << this->nlevels));
+
+  return;
+}
+
+template <specfem::element::medium_tag MediumTag>
+void specfem::time_scheme::lts_newmark<specfem::simulation::type::forward>::
+    assign_levels(const std::vector<int> &element_level,
+                  medium_levels &levels) {
+
+  const auto &field = this->assembly.fields.forward;
+  const int nglob = field.template get_nglob<MediumTag>();
+  const int ngllz = this->assembly.mesh.ngllz;
+  const int ngllx = this->assembly.mesh.ngllx;
+
+  levels = medium_levels();
+  levels.nglob = nglob;
+
+  if (nglob == 0 || this->nlevels == 0) {
+    return;
+  }
+
+  const auto medium_elements =
+      this->assembly.element_types.get_elements_on_host(MediumTag);
+  const int nelements = medium_elements.extent(0);
+
+  const auto iglob = [&](const int ispec, const int iz, const int ix) {
+    return field.h_medium_index_mapping(
+        static_cast<int>(MediumTag), ispec, iz, ix);
+  };
+
+  // A degree of freedom belongs to the finest level of the elements sharing it
+  std::vector<int> dof_level(nglob, 0);
+  for (int ielement = 0; ielement < nelements; ++ielement) {
+    const int ispec = medium_elements(ielement);
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        int &level = dof_level[iglob(ispec, iz, ix)];
+        level = std::max(level, element_level[ispec]);
+      }
+    }
+  }
+
+  levels.refined = std::any_of(dof_level.begin(), dof_level.end(),
+                               [](const int level) { return level > 0; });
+
+  if (!levels.refined) {
+    return;
+  }
+
+  // Finest level of the degrees of freedom within every element
+  std::vector<int> max_dof_level(element_level.size(), 0);
+  for (int ielement = 0; ielement < nelements; ++ielement) {
+    const int ispec = medium_elements(ielement);
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        max_dof_level[ispec] =
+            std::max(max_dof_level[ispec], dof_level[iglob(ispec, iz, ix)]);
+      }
+    }
+  }
+
+  // Set 0 contains the elements that share degrees of freedom with any
+  // refined level. Set k contains the elements that share degrees of freedom
+  // with level k, including the coarser elements at the interface
+  levels.elements.resize(this->nlevels + 1);
+  for (int set = 0; set <= this->nlevels; ++set) {
+    const int lo = (set == 0) ? 1 : set;
+    const int hi = (set == 0) ? this->nlevels : set;
+
+#define SELECT_ELEMENTS(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG, BOUNDARY_TAG) \
+  if constexpr (GET_TAG(MEDIUM_TAG) == MediumTag) {                            \
+    const auto volume_elements =                                               \
+        this->assembly.element_types.get_volume_elements_on_host(              \
+            GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG),                        \
+            GET_TAG(BOUNDARY_TAG));                                            \
+    std::vector<int> selected;                                                 \
+    for (int i = 0; i < volume_elements.extent(0); ++i) {                      \
+      const int ispec = volume_elements(i);                                    \
+      if (element_level[ispec] <= hi && max_dof_level[ispec] >= lo) {          \
+        selected.push_back(ispec);                                             \
+      }                                                                        \
+    }                                                                          \
+    levels.elements[set][std::make_tuple(GET_TAG(PROPERTY_TAG),                \
+                                         GET_TAG(BOUNDARY_TAG))] =             \
+        create_index_view(selected);                                           \
+  }
+
+    CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+        SELECT_ELEMENTS,
+        WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+            WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+                WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef SELECT_ELEMENTS
+  }
+
+  // The degrees of freedom updated within level k belong to the elements of
+  // levels k to nlevels. The finest such level of an element is the finest
+  // level of its degrees of freedom
+  std::vector<int> active_level(nglob, 0);
+  for (int ielement = 0; ielement < nelements; ++ielement) {
+    const int ispec = medium_elements(ielement);
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        int &level = active_level[iglob(ispec, iz, ix)];
+        level = std::max(level, max_dof_level[ispec]);
+      }
+    }
+  }
+
+  constexpr int components =
+      specfem::element::attributes<specfem::dimension::type::dim2,
+                                   MediumTag>::components();
+
+  levels.active.resize(this->nlevels + 1);
+  levels.level_dofs.resize(this->nlevels + 1);
+  levels.parent.resize(this->nlevels + 1);
+  levels.displacement.resize(this->nlevels + 1);
+  levels.forcing.resize(this->nlevels + 1);
+  levels.first.resize(this->nlevels + 1);
+  levels.second.resize(this->nlevels + 1);
+
+  // Position of the degrees of freedom within the active degrees of freedom
+  // of the previous level
+  std::vector<int> parent_position(nglob, -1);
+  for (int level = 1; level <= this->nlevels; ++level) {
+    std::vector<int> active;
+    std::vector<int> level_dofs;
+    std::vector<int> refined_dofs;
+    std::vector<int> parent;
+    std::vector<int> position(nglob, -1);
+    for (int i = 0; i < nglob; ++i) {
+      if (active_level[i] < level) {
+        continue;
+      }
+      position[i] = active.size();
+      if (dof_level[i] == level) {
+        level_dofs.push_back(position[i]);
+      }
+      if (dof_level[i] > 0) {
+        refined_dofs.push_back(position[i]);
+      }
+      parent.push_back(parent_position[i]);
+      active.push_back(i);
+    }
+    parent_position = position;
+
+    const int nactive = active.size();
+    levels.active[level] = create_index_view(active);
+    levels.level_dofs[level] = create_index_view(level_dofs);
+    if (level == 1) {
+      levels.active[0] = levels.active[1];
+      levels.level_dofs[0] = create_index_view(refined_dofs);
+    } else {
+      levels.parent[level] = create_index_view(parent);
+    }
+
+    levels.displacement[level] =
+        FieldView("specfem::time_scheme::lts_newmark::displacement", nactive,
+                  components);
+    levels.forcing[level] = FieldView(
+        "specfem::time_scheme::lts_newmark::forcing", nactive, components);
+    levels.first[level] = FieldView("specfem::time_scheme::lts_newmark::first",
+                                    nactive, components);
+    levels.second[level] = FieldView(
+        "specfem::time_scheme::lts_newmark::second", nactive, components);
+  }
+
+  return;
+}
+
+template <specfem::element::medium_tag MediumTag>
+void specfem::time_scheme::lts_newmark<specfem::simulation::type::forward>::
+    compute_stiffness(const int set, const medium_levels &levels,
+                      const FieldView &displacement) {
+
+  // The stiffness interaction is evaluated on the buffer field, with the
+  // displacement of the degrees of freedom of the set. The remaining buffer
+  // displacement and the buffer acceleration are zero
+  const auto buffer =
+      get_medium_field<MediumTag>(this->assembly.fields.buffer).field;
+  scatter(buffer, levels.active[set], levels.level_dofs[set], displacement);
+
+  constexpr auto buffer_tag = specfem::wavefield::simulation_field::buffer;
+
+#define CALL_STIFFNESS_INTERACTION(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG,    \
+                                   BOUNDARY_TAG)                               \
+  if constexpr (GET_TAG(MEDIUM_TAG) == MediumTag) {                            \
+    const auto &elements = levels.elements[set].at(                            \
+        std::make_tuple(GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)));        \
+    if (elements.extent(0) > 0) {                                              \
+      if (this->ngll == 5) {                                                   \
+        specfem::kokkos_kernels::impl::compute_stiffness_interaction<          \
+            GET_TAG(DIMENSION_TAG), buffer_tag, 5, GET_TAG(MEDIUM_TAG),        \
+            GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(this->assembly, 0,   \
+                                                          elements);           \
+      } else {                                                                 \
+        specfem::kokkos_kernels::impl::compute_stiffness_interaction<          \
+            GET_TAG(DIMENSION_TAG), buffer_tag, 8, GET_TAG(MEDIUM_TAG),        \
+            GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(this->assembly, 0,   \
+                                                          elements);           \
+      }                                                                        \
+    }                                                                          \
+  }
+
+  CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+      CALL_STIFFNESS_INTERACTION,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+              WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef CALL_STIFFNESS_INTERACTION
+
+  clear(buffer, levels.active[set], levels.level_dofs[set]);
+
+  return;
+}
+
+template <specfem::element::medium_tag MediumTag>
+void specfem::time_scheme::lts_newmark<specfem::simulation::type::forward>::
+    compute_deviation(const int level, medium_levels &levels,
+                      const FieldView &deviation) {
+
+  // The increment of the displacement over half a local time step, starting
+  // at rest and holding the coarser levels fixed, is dt^2 / 2 times the
+  // forcing plus the deviation computed here
+  const type_real dt = this->get_timestep() / (1 << level);
+  const auto mass_inverse =
+      get_medium_field<MediumTag>(this->assembly.fields.forward).mass_inverse;
+  const auto acceleration =
+      get_medium_field<MediumTag>(this->assembly.fields.buffer).field_dot_dot;
+  const auto &active = levels.active[level];
+
+  this->compute_stiffness<MediumTag>(level, levels,
+                                     levels.displacement[level]);
+
+  if (level < this->nlevels) {
+    restrict_level(levels.displacement[level + 1], levels.forcing[level + 1],
+                   levels.parent[level + 1], levels.displacement[level],
+                   levels.forcing[level], active, acceleration, mass_inverse);
+  }
+
+  accumulate(deviation, dt * dt / 2, active, acceleration, mass_inverse);
+
+  if (level == this->nlevels) {
+    return;
+  }
+
+  // Two sub-steps of the next level
+  const type_real next_dt = dt / 2;
+  this->compute_deviation<MediumTag>(level + 1, levels,
+                                     levels.first[level + 1]);
+  advance(levels.displacement[level + 1], next_dt * next_dt / 2,
+          levels.forcing[level + 1], levels.first[level + 1]);
+  this->compute_deviation<MediumTag>(level + 1, levels,
+                                     levels.second[level + 1]);
+  prolong(deviation, levels.parent[level + 1], levels.first[level + 1],
+          levels.second[level + 1]);
+
+  return;
+}
+
+template <specfem::element::medium_tag MediumTag>
+void specfem::time_scheme::lts_newmark<specfem::simulation::type::forward>::
+    compute_effective_acceleration(medium_levels &levels) {
+
+  const auto field = get_medium_field<MediumTag>(this->assembly.fields.forward);
+  const auto buffer = get_medium_field<MediumTag>(this->assembly.fields.buffer);
+  const type_real dt = this->get_timestep();
+  const type_real next_dt = dt / 2;
+  const auto &active = levels.active[1];
+
+  // The sub-steps keep the buffer zero outside of the degrees of freedom
+  // they update
+  Kokkos::deep_copy(buffer.field, 0.0);
+  Kokkos::deep_copy(buffer.field_dot_dot, 0.0);
+
+  // The domain kernels computed the acceleration of the full domain. Remove
+  // the contribution of the refined levels, which are sub-stepped below
+  gather(levels.displacement[1], active, field.field);
+  this->compute_stiffness<MediumTag>(0, levels, levels.displacement[1]);
+  remove_stiffness(levels.forcing[1], active, field.field_dot_dot,
+                   buffer.field_dot_dot, field.mass_inverse);
+
+  this->compute_deviation<MediumTag>(1, levels, levels.first[1]);
+  advance(levels.displacement[1], next_dt * next_dt / 2, levels.forcing[1],
+          levels.first[1]);
+  this->compute_deviation<MediumTag>(1, levels, levels.second[1]);
+
+  // The increment over the time step is dt^2 / 2 times the forcing plus
+  // 2 * (first + second). The effective acceleration reproduces this
+  // increment within the Newmark update
+  update(field.field_dot_dot, active, levels.forcing[1], 4.0 / (dt * dt),
+         levels.first[1], levels.second[1]);
+
+  Kokkos::fence();
+
+  return;
+}
+
+void specfem::time_scheme::lts_newmark<specfem::simulation::type::forward>::
+    apply_corrector_phase_forward(const specfem::element::medium_tag tag) {
+
+  constexpr auto elastic = specfem::element::medium_tag::elastic;
+  constexpr auto acoustic = specfem::element::medium_tag::acoustic;
+
+  if (tag == elastic) {
+    if (this->elastic.refined) {
+      this->compute_effective_acceleration<elastic>(this->elastic);
+    }
+  } else if (tag == acoustic) {
+    if (this->acoustic.refined) {
+      this->compute_effective_acceleration<acoustic>(this->acoustic);
+    }
+  } else {
+    static_assert("medium type not supported");
+  }
+
+  newmark::apply_corrector_phase_forward(tag);
+
+  return;
+}
+
+void specfem::time_scheme::lts_newmark<specfem::simulation::type::forward>::
+    print(std::ostream &message) const {
+  message << "  Time Scheme:\n"
+          << "------------------------------\n"
+          << "- Newmark with local time stepping\n"
+          << "    simulation type = forward\n"
+          << "    dt = " << this->get_timestep() << "\n"
+          << "    target Courant number = " << this->target_courant << "\n"
+          << "    maximum number of levels = " << this->max_levels << "\n"
+          << "    Start time = " << this->t0 << "\n";
+
+  // Levels are assigned when the assembly is linked
+  if (this->nelements_per_level.empty()) {
+    return;
+  }
+
+  for (int level = 0; level <= this->nlevels; ++level) {
+    message << "    level " << level << " : dt = "
+            << this->get_timestep() / (1 << level) << ", "
+            << this->nelements_per_level[level] << " elements\n";
+  }
+  message << "    relative cost of the stiffness interaction = "
+          << this->relative_cost << "\n";
+}
@@ -0,0 +1,123 @@
+#include "timescheme/pefrl.hpp"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <ostream>
+
+namespace {
+
+// Coefficients of the PEFRL scheme (Omelyan et al., 2002)
+constexpr type_real xi = 0.1786178958448091;
+constexpr type_real lambda = -0.2123418310626054;
+constexpr type_real chi = -0.06626458266981849;
+
+// Drift before the wavefield update of every stage
+constexpr type_real drift[4] = { xi, chi, 1.0 - 2.0 * (chi + xi), chi };
+// Kick after the wavefield update of every stage
+constexpr type_real kick[4] = { (1.0 - 2.0 * lambda) / 2.0, lambda, lambda,
+                                (1.0 - 2.0 * lambda) / 2.0 };
+// Time of the wavefield update of every stage within the time step
+constexpr type_real offset[4] = { xi, xi + chi, 1.0 - (xi + chi), 1.0 - xi };
+
+template <specfem::element::medium_tag MediumTag>
+void drift_impl(
+    const specfem::compute::impl::field_impl<specfem::dimension::type::dim2,
+                                             MediumTag> &field,
+    const type_real deltat) {
+
+  constexpr int components = specfem::element::attributes<
+      specfem::dimension::type::dim2, MediumTag>::components();
+  const int nglob = field.nglob;
+
+  const auto displacement = field.field;
+  const auto velocity = field.field_dot;
+  const auto acceleration = field.field_dot_dot;
+
+  Kokkos::parallel_for(
+      "specfem::TimeScheme::PEFRL::drift_impl",
+      specfem::kokkos::DeviceRange(0, nglob), KOKKOS_LAMBDA(const int iglob) {
+        for (int icomp = 0; icomp < components; ++icomp) {
+          displacement(iglob, icomp) += deltat * velocity(iglob, icomp);
+          acceleration(iglob, icomp) = 0.0;
+        }
+      });
+}
+
+template <specfem::element::medium_tag MediumTag>
+void kick_impl(
+    const specfem::compute::impl::field_impl<specfem::dimension::type::dim2,
+                                             MediumTag> &field,
+    const type_real deltat, const type_real final_drift) {
+
+  constexpr int components = specfem::element::attributes<
+      specfem::dimension::type::dim2, MediumTag>::components();
+  const int nglob = field.nglob;
+
+  const auto displacement = field.field;
+  const auto velocity = field.field_dot;
+  const auto acceleration = field.field_dot_dot;
+
+  Kokkos::parallel_for(
+      "specfem::TimeScheme::PEFRL::kick_impl",
+      specfem::kokkos::DeviceRange(0, nglob), KOKKOS_LAMBDA(const int iglob) {
+        for (int icomp = 0; icomp < components; ++icomp) {
+          velocity(iglob, icomp) += deltat * acceleration(iglob, icomp);
+          displacement(iglob, icomp) += final_drift * velocity(iglob, icomp);
+        }
+      });
+}
+
+} // namespace
+
+type_real specfem::time_scheme::pefrl<
+    specfem::simulation::type::forward>::get_stage_offset() const {
+  // The wavefield at the end of a time step corresponds to the current time
+  // step, consistent with the Newmark scheme
+  return offset[istage] - 1.0;
+}
+
+void specfem::time_scheme::pefrl<specfem::simulation::type::forward>::
+    apply_predictor_phase_forward(const specfem::element::medium_tag tag) {
+
+  constexpr auto elastic = specfem::element::medium_tag::elastic;
+  constexpr auto acoustic = specfem::element::medium_tag::acoustic;
+
+  if (tag == elastic) {
+    drift_impl<elastic>(field.elastic, drift[istage] * deltat);
+  } else if (tag == acoustic) {
+    drift_impl<acoustic>(field.acoustic, drift[istage] * deltat);
+  } else {
+    static_assert("medium type not supported");
+  }
+
+  return;
+}
+
+void specfem::time_scheme::pefrl<specfem::simulation::type::forward>::
+    apply_corrector_phase_forward(const specfem::element::medium_tag tag) {
+
+  constexpr auto elastic = specfem::element::medium_tag::elastic;
+  constexpr auto acoustic = specfem::element::medium_tag::acoustic;
+
+  // The last stage is followed by a drift of xi * dt
+  const type_real final_drift = (istage == nstages - 1) ? xi * deltat : 0.0;
+
+  if (tag == elastic) {
+    kick_impl<elastic>(field.elastic, kick[istage] * deltat, final_drift);
+  } else if (tag == acoustic) {
+    kick_impl<acoustic>(field.acoustic, kick[istage] * deltat, final_drift);
+  } else {
+    static_assert("medium type not supported");
+  }
+
+  return;
+}
+
+void specfem::time_scheme::pefrl<specfem::simulation::type::forward>::print(
+    std::ostream &message) const {
+  message << "  Time Scheme:\n"
+          << "------------------------------\n"
+          << "- PEFRL\n"
+          << "    simulation type = forward\n"
+          << "    dt = " << this->deltat << "\n"
+          << "    Start time = " << this->t0 << "\n";
+}
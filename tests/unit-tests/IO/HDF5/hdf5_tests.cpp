@@ -0,0 +1,231 @@
+#include "../../Kokkos_Environment.hpp"
+#include "IO/HDF5/HDF5.hpp"
+#include "IO/dataset_options.hpp"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+#ifndef NO_HDF5
+
+namespace {
+
+using OutputLibrary = specfem::IO::HDF5<specfem::IO::write>;
+using InputLibrary = specfem::IO::HDF5<specfem::IO::read>;
+using HostView =
+    Kokkos::View<type_real **, Kokkos::LayoutLeft, Kokkos::HostSpace>;
+using filter = specfem::IO::dataset_options::filter;
+
+constexpr int nrows = 1000;
+constexpr int ncols = 3;
+
+// Slowly varying values, such that the data compresses well
+type_real get_value(const int irow, const int icol) {
+  return icol + 0.5 * (irow / 50);
+}
+
+HostView create_view(const int n) {
+  HostView view("view", n, ncols);
+  for (int irow = 0; irow < n; ++irow) {
+    for (int icol = 0; icol < ncols; ++icol) {
+      view(irow, icol) = get_value(irow, icol);
+    }
+  }
+  return view;
+}
+
+// Read the dataset back and compare it to the values written
+void check_dataset(const std::string &filename, const std::string &name,
+                   const int n) {
+  HostView view("view", n, ncols);
+  InputLibrary::File file(filename);
+  file.openDataset(name, view).read();
+  for (int irow = 0; irow < n; ++irow) {
+    for (int icol = 0; icol < ncols; ++icol) {
+      ASSERT_EQ(view(irow, icol), get_value(irow, icol))
+          << name << " at (" << irow << ", " << icol << ")";
+    }
+  }
+}
+
+// Filters of a dataset, in the order they are applied
+std::vector<H5Z_filter_t> get_filters(const H5::DSetCreatPropList &plist,
+                                      std::vector<unsigned int> &levels) {
+  std::vector<H5Z_filter_t> filters;
+  levels.clear();
+  for (int i = 0; i < plist.getNfilters(); ++i) {
+    unsigned int flags;
+    unsigned int config;
+    unsigned int values[8];
+    std::size_t nvalues = 8;
+    char name[64];
+    filters.push_back(
+        plist.getFilter(i, flags, nvalues, values, sizeof(name), name, config));
+    levels.push_back((nvalues > 0) ? values[0] : 0);
+  }
+  return filters;
+}
+
+// Temporary file name, without the .h5 extension added by the library
+boost::filesystem::path create_filename() {
+  return boost::filesystem::temp_directory_path() /
+         boost::filesystem::unique_path("specfem-hdf5-%%%%-%%%%");
+}
+
+} // namespace
+
+// Chunks span the fastest varying dimension and are split along the slowest
+// one to stay within the chunk size. Groups inherit the options of the file
+// and datasets can override them
+TEST(IO_HDF5, chunked) {
+  const auto filename = create_filename();
+  const auto view = create_view(nrows);
+
+  specfem::IO::dataset_options options;
+  options.chunked = true;
+  options.chunk_bytes = 4096;
+
+  {
+    OutputLibrary::File file(filename.string(), options);
+    file.createDataset("/Chunked", view).write();
+    file.createGroup("/Group").createDataset("Chunked", view).write();
+    file.createDataset("/Contiguous", view, specfem::IO::dataset_options{})
+        .write();
+  }
+
+  check_dataset(filename.string(), "/Chunked", nrows);
+  check_dataset(filename.string(), "/Group/Chunked", nrows);
+  check_dataset(filename.string(), "/Contiguous", nrows);
+
+  const hsize_t expected[2] = { options.chunk_bytes /
+                                    (sizeof(type_real) * ncols),
+                                ncols };
+
+  H5::H5File file(filename.string() + ".h5", H5F_ACC_RDONLY);
+  for (const std::string name : { "/Chunked", "/Group/Chunked" }) {
+    const auto plist = file.openDataSet(name).getCreatePlist();
+    ASSERT_EQ(plist.getLayout(), H5D_CHUNKED) << name;
+    hsize_t chunk[2];
+    ASSERT_EQ(plist.getChunk(2, chunk), 2) << name;
+    EXPECT_EQ(chunk[0], expected[0]) << name;
+    EXPECT_EQ(chunk[1], expected[1]) << name;
+    EXPECT_EQ(plist.getNfilters(), 0) << name;
+  }
+
+  const auto plist = file.openDataSet("/Contiguous").getCreatePlist();
+  EXPECT_EQ(plist.getLayout(), H5D_CONTIGUOUS);
+
+  file.close();
+  boost::filesystem::remove(filename.string() + ".h5");
+}
+
+// Deflate implies chunked storage and reduces the size of the dataset
+TEST(IO_HDF5, deflate) {
+  const auto filename = create_filename();
+  const auto view = create_view(nrows);
+
+  specfem::IO::dataset_options options;
+  options.compression = filter::deflate;
+  options.level = 6;
+
+  {
+    OutputLibrary::File file(filename.string(), options);
+    file.createDataset("/Deflate", view).write();
+  }
+
+  check_dataset(filename.string(), "/Deflate", nrows);
+
+  H5::H5File file(filename.string() + ".h5", H5F_ACC_RDONLY);
+  const auto dataset = file.openDataSet("/Deflate");
+  const auto plist = dataset.getCreatePlist();
+  EXPECT_EQ(plist.getLayout(), H5D_CHUNKED);
+
+  std::vector<unsigned int> levels;
+  const auto filters = get_filters(plist, levels);
+  ASSERT_EQ(filters.size(), 1);
+  EXPECT_EQ(filters[0], H5Z_FILTER_DEFLATE);
+  EXPECT_EQ(levels[0], static_cast<unsigned int>(options.level));
+
+  EXPECT_LT(dataset.getStorageSize(), sizeof(type_real) * view.size());
+
+  file.close();
+  boost::filesystem::remove(filename.string() + ".h5");
+}
+
+// The shuffle filter is applied before deflate
+TEST(IO_HDF5, shuffle_deflate) {
+  const auto filename = create_filename();
+  const auto view = create_view(nrows);
+
+  specfem::IO::dataset_options options;
+  options.compression = filter::shuffle_deflate;
+
+  {
+    OutputLibrary::File file(filename.string(), options);
+    file.createDataset("/ShuffleDeflate", view).write();
+  }
+
+  check_dataset(filename.string(), "/ShuffleDeflate", nrows);
+
+  H5::H5File file(filename.string() + ".h5", H5F_ACC_RDONLY);
+  const auto dataset = file.openDataSet("/ShuffleDeflate");
+  const auto plist = dataset.getCreatePlist();
+  EXPECT_EQ(plist.getLayout(), H5D_CHUNKED);
+
+  std::vector<unsigned int> levels;
+  const auto filters = get_filters(plist, levels);
+  ASSERT_EQ(filters.size(), 2);
+  EXPECT_EQ(filters[0], H5Z_FILTER_SHUFFLE);
+  EXPECT_EQ(filters[1], H5Z_FILTER_DEFLATE);
+  EXPECT_EQ(levels[1], static_cast<unsigned int>(options.level));
+
+  EXPECT_LT(dataset.getStorageSize(), sizeof(type_real) * view.size());
+
+  file.close();
+  boost::filesystem::remove(filename.string() + ".h5");
+}
+
+// Datasets without any element cannot be chunked. They are stored
+// contiguously, whatever the options
+TEST(IO_HDF5, zero_extent) {
+  const auto filename = create_filename();
+  const auto view = create_view(0);
+
+  specfem::IO::dataset_options options;
+  options.compression = filter::shuffle_deflate;
+
+  {
+    OutputLibrary::File file(filename.string(), options);
+    EXPECT_NO_THROW(file.createDataset("/Empty", view).write());
+  }
+
+  {
+    // Opening the dataset checks its dimensions against the view
+    InputLibrary::File file(filename.string());
+    EXPECT_NO_THROW(file.openDataset("/Empty", view));
+  }
+
+  H5::H5File file(filename.string() + ".h5", H5F_ACC_RDONLY);
+  const auto dataset = file.openDataSet("/Empty");
+  const auto plist = dataset.getCreatePlist();
+  EXPECT_EQ(plist.getLayout(), H5D_CONTIGUOUS);
+  EXPECT_EQ(plist.getNfilters(), 0);
+
+  hsize_t dims[2];
+  ASSERT_EQ(dataset.getSpace().getSimpleExtentDims(dims), 2);
+  EXPECT_EQ(dims[0], 0);
+  EXPECT_EQ(dims[1], ncols);
+
+  file.close();
+  boost::filesystem::remove(filename.string() + ".h5");
+}
+
+#endif
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,178 @@
+#include "../../Kokkos_Environment.hpp"
+#include "IO/binary/binary.hpp"
+#include "specfem_setup.hpp"
+#include "yaml-cpp/yaml.h"
+#include <Kokkos_Core.hpp>
+#include <boost/filesystem.hpp>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using OutputLibrary = specfem::IO::binary<specfem::IO::write>;
+using InputLibrary = specfem::IO::binary<specfem::IO::read>;
+
+using HostView =
+    Kokkos::View<type_real **, Kokkos::LayoutLeft, Kokkos::HostSpace>;
+using DeviceView =
+    Kokkos::View<int ***, Kokkos::LayoutLeft, Kokkos::DefaultExecutionSpace>;
+
+constexpr int n0 = 7;
+constexpr int n1 = 5;
+constexpr int n2 = 3;
+
+// Temporary folder name. The folder is created by the library
+boost::filesystem::path create_filename() {
+  return boost::filesystem::temp_directory_path() /
+         boost::filesystem::unique_path("specfem-binary-%%%%-%%%%");
+}
+
+HostView create_host_view() {
+  HostView view("host", n0, n1);
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      view(i, j) = 0.5 * i + 0.25 * j;
+    }
+  }
+  return view;
+}
+
+DeviceView create_device_view() {
+  DeviceView view("device", n0, n1, n2);
+  const auto h_view = Kokkos::create_mirror_view(view);
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      for (int k = 0; k < n2; ++k) {
+        h_view(i, j, k) = 100 * i + 10 * j + k;
+      }
+    }
+  }
+  Kokkos::deep_copy(view, h_view);
+  return view;
+}
+
+// Write a host dataset in the file and a device dataset in a group
+void write_file(const boost::filesystem::path &filename) {
+  OutputLibrary::File file(filename.string());
+  file.createDataset("Host", create_host_view()).write();
+  file.createGroup("Group").createDataset("Device", create_device_view())
+      .write();
+}
+
+} // namespace
+
+// Host views are written with a header recording their type and dimensions,
+// and read back to the same values
+TEST(IO_BINARY, host_round_trip) {
+  const auto filename = create_filename();
+  write_file(filename);
+
+  const auto header = YAML::LoadFile((filename / "Host.yaml").string());
+  EXPECT_EQ(header["type"].as<std::string>(),
+            "float" + std::to_string(8 * sizeof(type_real)));
+  EXPECT_EQ(header["rank"].as<int>(), 2);
+  EXPECT_EQ(header["dims"].as<std::vector<std::size_t> >(),
+            (std::vector<std::size_t>{ n0, n1 }));
+  EXPECT_EQ(boost::filesystem::file_size(filename / "Host.bin"),
+            sizeof(type_real) * n0 * n1);
+
+  const auto expected = create_host_view();
+  HostView view("view", n0, n1);
+  InputLibrary::File file(filename.string());
+  file.openDataset("Host", view).read();
+
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      EXPECT_EQ(view(i, j), expected(i, j)) << "(" << i << ", " << j << ")";
+    }
+  }
+
+  boost::filesystem::remove_all(filename);
+}
+
+// Device views are staged on the host when written and copied from the
+// mapped file when read
+TEST(IO_BINARY, device_round_trip) {
+  const auto filename = create_filename();
+  write_file(filename);
+
+  DeviceView view("view", n0, n1, n2);
+  InputLibrary::File file(filename.string());
+  file.openGroup("Group").openDataset("Device", view).read();
+
+  const auto expected =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                          create_device_view());
+  const auto h_view =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), view);
+
+  for (int i = 0; i < n0; ++i) {
+    for (int j = 0; j < n1; ++j) {
+      for (int k = 0; k < n2; ++k) {
+        EXPECT_EQ(h_view(i, j, k), expected(i, j, k))
+            << "(" << i << ", " << j << ", " << k << ")";
+      }
+    }
+  }
+
+  boost::filesystem::remove_all(filename);
+}
+
+// Views which do not match the rank, dimensions or type of the dataset are
+// rejected when the dataset is opened
+TEST(IO_BINARY, mismatch) {
+  const auto filename = create_filename();
+  write_file(filename);
+
+  InputLibrary::File file(filename.string());
+
+  // Rank
+  Kokkos::View<type_real *, Kokkos::LayoutLeft, Kokkos::HostSpace> rank_view(
+      "rank", n0 * n1);
+  EXPECT_THROW(file.openDataset("Host", rank_view), std::runtime_error);
+
+  // Dimensions
+  HostView dims_view("dims", n1, n0);
+  EXPECT_THROW(file.openDataset("Host", dims_view), std::runtime_error);
+
+  // Type
+  Kokkos::View<int **, Kokkos::LayoutLeft, Kokkos::HostSpace> type_view(
+      "type", n0, n1);
+  EXPECT_THROW(file.openDataset("Host", type_view), std::runtime_error);
+
+  // Missing dataset
+  HostView view("view", n0, n1);
+  EXPECT_THROW(file.openDataset("Missing", view), std::runtime_error);
+
+  // Truncated data
+  boost::filesystem::resize_file(filename / "Host.bin",
+                                 sizeof(type_real) * (n0 * n1 - 1));
+  EXPECT_THROW(file.openDataset("Host", view).read(), std::runtime_error);
+
+  boost::filesystem::remove_all(filename);
+}
+
+// Creating a dataset twice within a file does not overwrite the first one
+TEST(IO_BINARY, duplicate_dataset) {
+  const auto filename = create_filename();
+
+  {
+    OutputLibrary::File file(filename.string());
+    file.createDataset("Host", create_host_view()).write();
+    EXPECT_THROW(file.createDataset("Host", create_host_view()),
+                 std::runtime_error);
+  }
+
+  EXPECT_EQ(boost::filesystem::file_size(filename / "Host.bin"),
+            sizeof(type_real) * n0 * n1);
+
+  boost::filesystem::remove_all(filename);
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,202 @@
+#include "../../Kokkos_Environment.hpp"
+#include "IO/seismogram/impl/sac.hpp"
+#include "IO/seismogram/impl/seismic_unix.hpp"
+#include "IO/seismogram/reader.hpp"
+#include "IO/seismogram/trace_container.hpp"
+#include "kokkos_abstractions.h"
+#include <Kokkos_Core.hpp>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+namespace {
+
+type_real value(const int itrace, const int istep) {
+  return std::sin(0.1 * istep + itrace) * (itrace + 1);
+}
+
+boost::filesystem::path temporary_directory() {
+  const auto path = boost::filesystem::temp_directory_path() /
+                    boost::filesystem::unique_path();
+  boost::filesystem::create_directories(path);
+  return path;
+}
+
+} // namespace
+
+TEST(SEISMOGRAM_READER, trace_container) {
+  const int ntraces = 5;
+  const int nsteps = 200;
+  const type_real t0 = -1.5;
+  const type_real dt = 0.01;
+
+  const auto directory = temporary_directory();
+  const std::string filename = (directory / "traces.bin").string();
+
+  std::vector<std::string> names;
+  specfem::kokkos::HostView2d<type_real> traces("traces", ntraces, nsteps);
+  for (int itrace = 0; itrace < ntraces; ++itrace) {
+    names.push_back("AA.S000" + std::to_string(itrace) + ".BXX");
+    for (int istep = 0; istep < nsteps; ++istep) {
+      traces(itrace, istep) = value(itrace, istep);
+    }
+  }
+
+  specfem::IO::trace_container::write(filename, names, t0, dt, traces);
+
+  const auto header = specfem::IO::trace_container::read_header(filename);
+  EXPECT_EQ(header.ntraces, ntraces);
+  EXPECT_EQ(header.nsteps, nsteps);
+  EXPECT_NEAR(header.t0, t0, 1e-6);
+  EXPECT_NEAR(header.dt, dt, 1e-6);
+
+  const specfem::IO::trace_container container(filename);
+  EXPECT_TRUE(container.contains("AA.S0003.BXX"));
+  EXPECT_FALSE(container.contains("AA.S0003.BXZ"));
+
+  // Read a subset out of order
+  const std::vector<std::string> subset = { names[3], names[0], names[4] };
+  const std::vector<int> expected = { 3, 0, 4 };
+  specfem::kokkos::HostView2d<type_real> read("read", subset.size(), nsteps);
+  container.read(subset, read);
+
+  for (int i = 0; i < subset.size(); ++i) {
+    for (int istep = 0; istep < nsteps; ++istep) {
+      EXPECT_NEAR(read(i, istep), value(expected[i], istep), 1e-6);
+    }
+  }
+
+  EXPECT_THROW(container.read({ "AA.S0003.BXZ" },
+                              specfem::kokkos::HostView2d<type_real>(
+                                  "missing", 1, nsteps)),
+               std::runtime_error);
+
+  boost::filesystem::remove_all(directory);
+}
+
+TEST(SEISMOGRAM_READER, ascii_traces) {
+  const int ntraces = 16;
+  const int nsteps = 100;
+  const type_real dt = 0.01;
+
+  const auto directory = temporary_directory();
+
+  std::vector<std::string> filenames;
+  for (int itrace = 0; itrace < ntraces; ++itrace) {
+    const std::string filename =
+        (directory / ("trace" + std::to_string(itrace) + ".txt")).string();
+    std::ofstream file(filename);
+    file << std::scientific << std::setprecision(10);
+    for (int istep = 0; istep < nsteps; ++istep) {
+      file << istep * dt << " " << value(itrace, istep) << "\n";
+    }
+    filenames.push_back(filename);
+  }
+
+  specfem::kokkos::HostView2d<type_real> traces("traces", ntraces, nsteps);
+  specfem::IO::read_ascii_traces(filenames, traces);
+
+  for (int itrace = 0; itrace < ntraces; ++itrace) {
+    for (int istep = 0; istep < nsteps; ++istep) {
+      EXPECT_NEAR(traces(itrace, istep), value(itrace, istep), 1e-6);
+    }
+  }
+
+  // Trace with a missing value
+  {
+    std::ofstream file(filenames[5]);
+    for (int istep = 0; istep < nsteps; ++istep) {
+      file << istep * dt;
+      if (istep != 10) {
+        file << " " << value(5, istep);
+      }
+      file << "\n";
+    }
+  }
+
+  EXPECT_THROW(specfem::IO::read_ascii_traces(filenames, traces),
+               std::runtime_error);
+
+  // Trace with the wrong number of steps
+  {
+    std::ofstream file(filenames[5]);
+    for (int istep = 0; istep < nsteps - 1; ++istep) {
+      file << istep * dt << " " << value(5, istep) << "\n";
+    }
+  }
+
+  EXPECT_THROW(specfem::IO::read_ascii_traces(filenames, traces),
+               std::runtime_error);
+
+  boost::filesystem::remove_all(directory);
+}
+
+TEST(SEISMOGRAM_READER, binary_formats) {
+  const int ntraces = 3;
+  const int nsteps = 150;
+  const type_real t0 = -0.5;
+  const type_real dt = 0.002;
+
+  const auto directory = temporary_directory();
+
+  std::vector<std::string> names;
+  specfem::kokkos::HostView2d<type_real> traces("traces", ntraces, nsteps);
+  for (int itrace = 0; itrace < ntraces; ++itrace) {
+    names.push_back("AA.S000" + std::to_string(itrace) + ".S2.BXZ.semd");
+    for (int istep = 0; istep < nsteps; ++istep) {
+      traces(itrace, istep) = value(itrace, istep);
+    }
+  }
+
+  const std::string bundle = (directory / "seismograms.bin").string();
+  const std::string gather = (directory / "Uz_file_single_d.su").string();
+  const std::string sac = (directory / (names[1] + ".sac")).string();
+
+  specfem::IO::trace_container::write(
+      bundle, names, t0, dt, traces,
+      specfem::IO::trace_container::precision::float32);
+  specfem::IO::impl::write_seismic_unix(gather, t0, dt, traces);
+  specfem::IO::impl::write_sac(sac, "S0001", "AA", "BXZ",
+                               specfem::wavefield::type::displacement, t0, dt,
+                               Kokkos::subview(traces, 1, Kokkos::ALL));
+
+  const auto check = [&](const std::string &filename,
+                         const specfem::enums::seismogram::format format,
+                         const int itrace) {
+    specfem::kokkos::HostView2d<type_real> seismogram("seismogram", nsteps,
+                                                      2);
+    specfem::IO::seismogram_reader reader(filename, format, seismogram,
+                                          itrace);
+    reader.read();
+    for (int istep = 0; istep < nsteps; ++istep) {
+      EXPECT_NEAR(seismogram(istep, 0), t0 + istep * dt, 1e-5)
+          << filename << " step " << istep;
+      EXPECT_NEAR(seismogram(istep, 1), value(itrace, istep), 1e-5)
+          << filename << " step " << istep;
+    }
+  };
+
+  check(bundle, specfem::enums::seismogram::format::binary, 2);
+  check(gather, specfem::enums::seismogram::format::seismic_unix, 0);
+  check(gather, specfem::enums::seismogram::format::seismic_unix, 2);
+  check(sac, specfem::enums::seismogram::format::sac, 1);
+
+  // Wrong number of steps
+  specfem::kokkos::HostView2d<type_real> seismogram("seismogram", nsteps - 1,
+                                                    2);
+  specfem::IO::seismogram_reader reader(
+      sac, specfem::enums::seismogram::format::sac, seismogram);
+  EXPECT_THROW(reader.read(), std::runtime_error);
+
+  boost::filesystem::remove_all(directory);
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
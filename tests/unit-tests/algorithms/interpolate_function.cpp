@@ -4,11 +4,18 @@
 #include "algorithms/interpolate.hpp"
 #include "algorithms/locate_point.hpp"
 #include "compute/compute_mesh.hpp"
+#include "compute/interface.hpp"
+#include "datatypes/simd.hpp"
 #include "kokkos_abstractions.h"
 #include "mesh/mesh.hpp"
+#include "parallel_configuration/chunk_config.hpp"
+#include "policies/chunk.hpp"
 #include "quadrature/gll/gll.hpp"
+#include "receiver/interface.hpp"
 #include <Kokkos_Core.hpp>
 #include <cmath>
+#include <memory>
+#include <vector>
 
 inline type_real function1(const type_real x, const type_real z) {
   return std::sqrt(x * x + z * z);
@@ -72,6 +79,224 @@ TEST(ALGORITHMS, interpolate_function) {
   EXPECT_NEAR(function_value, function_interpolated, 1e-3);
 }
 
+/**
+ * Seismograms interpolate the wavefield with separable 1D Lagrange factors
+ * and skip the GLL lines that do not carry the receiver. Receivers on a node,
+ * on an edge and inside an element must give the dense ngll^2 interpolant.
+ * Receivers are placed on the nodes through locate_point, so the node
+ * detection must absorb its round-off.
+ */
+TEST(ALGORITHMS, interpolate_function_separable) {
+
+  std::string database_file =
+      "../../../tests/unit-tests/algorithms/serial/database.bin";
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+  specfem::mesh::mesh mesh = specfem::IO::read_mesh(database_file, mpi);
+
+  constexpr int N = 5;
+  constexpr int ncomponents = 2;
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, N);
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::compute::mesh assembly(mesh.tags, mesh.control_nodes, quadratures);
+  specfem::compute::element_types element_types(
+      assembly.nspec, assembly.ngllz, assembly.ngllx, assembly.mapping,
+      mesh.tags);
+
+  using location = specfem::compute::receivers::location;
+
+  const auto xi = assembly.quadratures.gll.h_xi;
+  const int ispec_target = 1452;
+
+  struct test_point {
+    type_real xi;
+    type_real gamma;
+    location expected;
+  };
+
+  const std::vector<test_point> points = {
+    { xi(1), xi(3), location::node },     { xi(0), xi(4), location::node },
+    { xi(2), 0.15, location::edge },      { 0.3, xi(4), location::edge },
+    { 0.15, -0.4, location::interior },   { -0.7, 0.55, location::interior }
+  };
+
+  const int nreceivers = points.size();
+
+  std::vector<std::shared_ptr<specfem::receivers::receiver> > receivers;
+  for (int irec = 0; irec < nreceivers; ++irec) {
+    const specfem::point::local_coordinates<specfem::dimension::type::dim2>
+        lcoord = { ispec_target, points[irec].gamma, points[irec].xi };
+    const auto gcoord = specfem::algorithms::locate_point(lcoord, assembly);
+    receivers.push_back(std::make_shared<specfem::receivers::receiver>(
+        "AA", "S" + std::to_string(irec), gcoord.x, gcoord.z, 0.0));
+  }
+
+  specfem::compute::receivers compute_receivers(
+      assembly.nspec, N, N, 1, 1.0, 0.0, 1, receivers,
+      { specfem::enums::seismogram::type::displacement }, assembly, mesh.tags,
+      element_types);
+
+  for (int irec = 0; irec < nreceivers; ++irec) {
+    EXPECT_TRUE(compute_receivers.get_location(irec) == points[irec].expected)
+        << "Wrong location for receiver " << irec;
+  }
+
+  // Function sampled at the GLL points of the element holding each receiver
+  const auto coord = assembly.points.h_coord;
+  specfem::kokkos::HostView4d<type_real> h_function("function", nreceivers, N,
+                                                     N, ncomponents);
+  std::vector<int> receiver_elements(nreceivers);
+  for (int irec = 0; irec < nreceivers; ++irec) {
+    const specfem::point::global_coordinates<specfem::dimension::type::dim2>
+        gcoord = { receivers[irec]->get_x(), receivers[irec]->get_z() };
+    const auto lcoord = specfem::algorithms::locate_point(gcoord, assembly);
+    receiver_elements[irec] = lcoord.ispec;
+    for (int iz = 0; iz < N; ++iz) {
+      for (int ix = 0; ix < N; ++ix) {
+        const type_real x = coord(0, lcoord.ispec, iz, ix);
+        const type_real z = coord(1, lcoord.ispec, iz, ix);
+        h_function(irec, iz, ix, 0) = function1(x, z);
+        h_function(irec, iz, ix, 1) = std::hypot(x, 2 * z);
+      }
+    }
+  }
+
+  const auto medium = element_types.get_medium_tag(receiver_elements[0]);
+  const auto property = element_types.get_property_tag(receiver_elements[0]);
+  for (int irec = 1; irec < nreceivers; ++irec) {
+    ASSERT_TRUE(element_types.get_medium_tag(receiver_elements[irec]) ==
+                    medium &&
+                element_types.get_property_tag(receiver_elements[irec]) ==
+                    property);
+  }
+
+  const auto [elements, receiver_indices] =
+      compute_receivers.get_indices_on_device(medium, property);
+  ASSERT_EQ(static_cast<int>(receiver_indices.extent(0)), nreceivers);
+
+  const auto function = Kokkos::create_mirror_view_and_copy(
+      Kokkos::DefaultExecutionSpace(), h_function);
+  specfem::kokkos::DeviceView2d<type_real> separable("separable", nreceivers,
+                                                     ncomponents);
+
+  using simd = specfem::datatype::simd<type_real, false>;
+  using ParallelConfig =
+      specfem::parallel_config::chunk_config<specfem::dimension::type::dim2, 1,
+                                             1, 1, 1, simd,
+                                             Kokkos::DefaultExecutionSpace>;
+  using ChunkPolicy = specfem::policy::mapped_element_chunk<ParallelConfig>;
+  using ScratchView = Kokkos::MemoryTraits<Kokkos::Unmanaged>;
+  using FunctionViewType =
+      Kokkos::View<type_real[ParallelConfig::chunk_size][N][N][ncomponents],
+                   Kokkos::LayoutLeft, specfem::kokkos::DevScratchSpace,
+                   ScratchView>;
+  using LagrangeFactorViewType =
+      Kokkos::View<type_real[ParallelConfig::chunk_size][N][2],
+                   Kokkos::LayoutLeft, specfem::kokkos::DevScratchSpace,
+                   ScratchView>;
+  using NodeIndexViewType =
+      Kokkos::View<int[ParallelConfig::chunk_size][2], Kokkos::LayoutLeft,
+                   specfem::kokkos::DevScratchSpace, ScratchView>;
+  using ResultsViewType =
+      Kokkos::View<type_real[ParallelConfig::chunk_size][ncomponents],
+                   Kokkos::LayoutLeft, specfem::kokkos::DevScratchSpace,
+                   ScratchView>;
+
+  const int scratch_size =
+      FunctionViewType::shmem_size() + LagrangeFactorViewType::shmem_size() +
+      NodeIndexViewType::shmem_size() + ResultsViewType::shmem_size();
+
+  ChunkPolicy policy(elements, receiver_indices, N, N);
+
+  Kokkos::parallel_for(
+      "interpolate_function_separable",
+      policy.set_scratch_size(0, Kokkos::PerTeam(scratch_size)),
+      KOKKOS_LAMBDA(const typename ChunkPolicy::member_type &team_member) {
+        FunctionViewType element_function(team_member.team_scratch(0));
+        LagrangeFactorViewType lagrange_factors(team_member.team_scratch(0));
+        NodeIndexViewType node_index(team_member.team_scratch(0));
+        ResultsViewType results(team_member.team_scratch(0));
+
+        for (int tile = 0; tile < ChunkPolicy::tile_size;
+             tile += ChunkPolicy::chunk_size) {
+          const int starting_element_index =
+              team_member.league_rank() * ChunkPolicy::tile_size + tile;
+
+          if (starting_element_index >= nreceivers) {
+            break;
+          }
+
+          const auto iterator =
+              policy.mapped_league_iterator(starting_element_index);
+
+          Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team_member, iterator.chunk_size()),
+              [&](const int i) {
+                const auto iterator_index = iterator(i);
+                const auto index = iterator_index.index;
+                for (int icomp = 0; icomp < ncomponents; ++icomp) {
+                  element_function(iterator_index.ielement, index.iz,
+                                   index.ix, icomp) =
+                      function(iterator_index.imap, index.iz, index.ix,
+                               icomp);
+                }
+              });
+
+          specfem::compute::load_on_device(team_member, iterator,
+                                           compute_receivers, lagrange_factors,
+                                           node_index);
+
+          team_member.team_barrier();
+
+          specfem::algorithms::interpolate_function(
+              team_member, iterator, lagrange_factors, node_index,
+              element_function, results);
+
+          team_member.team_barrier();
+
+          Kokkos::parallel_for(
+              Kokkos::TeamThreadRange(team_member, iterator.chunk_size()),
+              [&](const int i) {
+                const auto iterator_index = iterator(i);
+                const auto index = iterator_index.index;
+                if (index.iz == 0 && index.ix == 0) {
+                  for (int icomp = 0; icomp < ncomponents; ++icomp) {
+                    separable(iterator_index.imap, icomp) =
+                        results(iterator_index.ielement, icomp);
+                  }
+                }
+              });
+
+          team_member.team_barrier();
+        }
+      });
+
+  Kokkos::fence();
+
+  const auto h_separable =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), separable);
+
+  // Dense interpolant computed from the located receiver
+  for (int irec = 0; irec < nreceivers; ++irec) {
+    specfem::kokkos::HostView3d<type_real> receiver_array("receiver_array", 2,
+                                                          N, N);
+    receivers[irec]->compute_receiver_array(assembly, receiver_array);
+
+    for (int icomp = 0; icomp < ncomponents; ++icomp) {
+      type_real dense = 0.0;
+      for (int iz = 0; iz < N; ++iz) {
+        for (int ix = 0; ix < N; ++ix) {
+          dense += receiver_array(0, iz, ix) * h_function(irec, iz, ix, icomp);
+        }
+      }
+      EXPECT_NEAR(h_separable(irec, icomp), dense, 1e-4 * std::abs(dense))
+          << "Receiver " << irec << ", component " << icomp;
+    }
+  }
+}
+
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
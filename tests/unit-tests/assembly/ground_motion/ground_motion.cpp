@@ -0,0 +1,157 @@
+#include "../test_fixture/test_fixture.hpp"
+#include "IO/binary/binary.hpp"
+#include "IO/checkpoint/checkpoint.hpp"
+#include "enumerations/wavefield.hpp"
+#include "kokkos_abstractions.h"
+#include "periodic_tasks/ground_motion.hpp"
+#include <Kokkos_Core.hpp>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+namespace {
+
+using HostMap = specfem::kokkos::HostView1d<type_real, Kokkos::LayoutLeft>;
+
+// Set every component of the fields to a constant
+template <typename FieldType>
+void set_fields(const FieldType &field, const type_real value,
+                const type_real value_dot, const type_real value_dot_dot) {
+  Kokkos::deep_copy(field.field, value);
+  Kokkos::deep_copy(field.field_dot, value_dot);
+  Kokkos::deep_copy(field.field_dot_dot, value_dot_dot);
+  Kokkos::fence();
+}
+
+void check_map(specfem::IO::binary<specfem::IO::read>::Group &group,
+               const std::string &name, const int nglob,
+               const type_real expected) {
+  HostMap map("map", nglob);
+  group.openDataset(name, map).read();
+
+  const type_real tolerance = 1e-5 * std::abs(expected);
+  for (int iglob = 0; iglob < nglob; ++iglob) {
+    if (std::abs(map(iglob) - expected) > tolerance) {
+      std::ostringstream message;
+      message << "Error in map " << name << " at iglob = " << iglob
+              << ". Expected " << expected << ", got " << map(iglob);
+      throw std::runtime_error(message.str());
+    }
+  }
+}
+
+/**
+ * Fields are held constant over two stages, the first with values twice as
+ * large as the second. Peaks must pick the first stage and the Arias
+ * intensity must integrate both.
+ */
+void test_ground_motion(specfem::compute::assembly &assembly) {
+  constexpr type_real dt = 0.5;
+  constexpr int time_interval = 2;
+  constexpr int nstep = 20;
+  constexpr type_real gravity = 9.81;
+
+  constexpr type_real displacement = 0.3;
+  constexpr type_real velocity = -1.5;
+  constexpr type_real acceleration = 4.0;
+
+  const auto folder = boost::filesystem::temp_directory_path() /
+                      boost::filesystem::unique_path();
+  boost::filesystem::create_directory(folder);
+
+  auto &forward = assembly.fields.forward;
+  const int nglob_elastic = forward.elastic.field.extent(0);
+  const int nglob_acoustic = forward.acoustic.field.extent(0);
+  const int ncomponents_elastic = forward.elastic.field.extent(1);
+
+  specfem::periodic_tasks::ground_motion ground_motion(
+      assembly, specfem::wavefield::simulation_field::forward,
+      specfem::periodic_tasks::ground_motion::format::binary, time_interval,
+      dt, folder);
+
+  const auto state = ground_motion.get_checkpoint_state();
+  if (state.size() != 2 ||
+      static_cast<int>(state[0].view.size()) != nglob_elastic * 4 ||
+      static_cast<int>(state[1].view.size()) != nglob_acoustic * 3) {
+    throw std::runtime_error("Unexpected checkpoint state of ground motion");
+  }
+
+  int nupdates_first = 0;
+  int nupdates_second = 0;
+  for (int istep = 0; istep < nstep; ++istep) {
+    const type_real scale = (istep < nstep / 2) ? 2.0 : 1.0;
+    set_fields(forward.elastic, scale * displacement, scale * velocity,
+               scale * acceleration);
+    set_fields(forward.acoustic, scale * displacement, scale * velocity,
+               scale * acceleration);
+    if (ground_motion.should_run(istep)) {
+      ground_motion.run();
+      if (istep < nstep / 2) {
+        ++nupdates_first;
+      } else {
+        ++nupdates_second;
+      }
+    }
+  }
+
+  ground_motion.finalize();
+
+  const auto filename = (folder / "GroundMotion").string();
+  specfem::IO::binary<specfem::IO::read>::File file(filename);
+
+  if (nglob_elastic > 0) {
+    const type_real norm = std::sqrt(ncomponents_elastic);
+    const type_real weight = time_interval * dt;
+    const type_real arias =
+        Kokkos::numbers::pi_v<type_real> / (2.0 * gravity) * weight *
+        ncomponents_elastic * acceleration * acceleration *
+        (4 * nupdates_first + nupdates_second);
+
+    auto group = file.openGroup("/Elastic");
+    check_map(group, "PGD", nglob_elastic, 2 * norm * std::abs(displacement));
+    check_map(group, "PGV", nglob_elastic, 2 * norm * std::abs(velocity));
+    check_map(group, "PGA", nglob_elastic, 2 * norm * std::abs(acceleration));
+    check_map(group, "AriasIntensity", nglob_elastic, arias);
+  }
+
+  if (nglob_acoustic > 0) {
+    auto group = file.openGroup("/Acoustic");
+    check_map(group, "PeakPotential", nglob_acoustic,
+              2 * std::abs(displacement));
+    check_map(group, "PeakPotentialDot", nglob_acoustic,
+              2 * std::abs(velocity));
+    check_map(group, "PeakPressure", nglob_acoustic,
+              2 * std::abs(acceleration));
+  }
+
+  boost::filesystem::remove_all(folder);
+}
+
+} // namespace
+
+TEST_F(ASSEMBLY, ground_motion) {
+  for (auto parameters : *this) {
+    const auto Test = std::get<0>(parameters);
+    specfem::compute::assembly assembly = std::get<4>(parameters);
+
+    try {
+      test_ground_motion(assembly);
+
+      std::cout << "-------------------------------------------------------\n"
+                << "\033[0;32m[PASSED]\033[0m " << Test.name << "\n"
+                << "-------------------------------------------------------\n\n"
+                << std::endl;
+    } catch (std::exception &e) {
+      std::cout << "-------------------------------------------------------\n"
+                << "\033[0;31m[FAILED]\033[0m \n"
+                << "-------------------------------------------------------\n"
+                << "- Test: " << Test.name << "\n"
+                << "- Error: " << e.what() << "\n"
+                << "-------------------------------------------------------\n\n"
+                << std::endl;
+      ADD_FAILURE();
+    }
+  }
+}
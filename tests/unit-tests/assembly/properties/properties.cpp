@@ -645,6 +645,82 @@ void check_load_on_device(specfem::compute::properties &properties,
   return;
 }
 
+// Load the properties at every quadrature point on the device and compare
+// them to the host values. Checks the device storage mode of the container
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+void check_device_storage(const specfem::compute::properties &properties,
+                          const specfem::compute::element_types &element_types,
+                          const bool per_element) {
+  const int ngllx = properties.ngllx;
+  const int ngllz = properties.ngllz;
+
+  const auto &container =
+      properties.get_container<MediumTag, PropertyTag>();
+
+  if (container.per_element != per_element) {
+    std::ostringstream message;
+    message << "\n \t Error in device storage of "
+            << specfem::element::to_string(MediumTag, PropertyTag);
+    message << "\n \t Expected per element storage: " << per_element;
+    message << "\n \t Got: " << container.per_element;
+    throw std::runtime_error(message.str());
+  }
+
+  const auto elements =
+      element_types.get_elements_on_device(MediumTag, PropertyTag);
+  const auto h_elements =
+      element_types.get_elements_on_host(MediumTag, PropertyTag);
+  const int nelements = elements.extent(0);
+
+  if (nelements == 0) {
+    return;
+  }
+
+  using PointType =
+      specfem::point::properties<specfem::dimension::type::dim2, MediumTag,
+                                 PropertyTag, false>;
+
+  Kokkos::View<PointType ***, Kokkos::DefaultExecutionSpace> point_properties(
+      "point_properties", nelements, ngllz, ngllx);
+  auto h_point_properties = Kokkos::create_mirror_view(point_properties);
+
+  Kokkos::parallel_for(
+      "check_device_storage",
+      Kokkos::MDRangePolicy<Kokkos::Rank<3> >({ 0, 0, 0 },
+                                              { nelements, ngllz, ngllx }),
+      KOKKOS_LAMBDA(const int &i, const int &iz, const int &ix) {
+        const specfem::point::index<specfem::dimension::type::dim2> index(
+            elements(i), iz, ix);
+        PointType point;
+        specfem::compute::load_on_device(index, properties, point);
+        point_properties(i, iz, ix) = point;
+      });
+
+  Kokkos::fence();
+  Kokkos::deep_copy(h_point_properties, point_properties);
+
+  for (int i = 0; i < nelements; i++) {
+    for (int iz = 0; iz < ngllz; iz++) {
+      for (int ix = 0; ix < ngllx; ix++) {
+        const specfem::point::index<specfem::dimension::type::dim2> index(
+            h_elements(i), iz, ix);
+        PointType expected;
+        specfem::compute::load_on_host(index, properties, expected);
+        if (h_point_properties(i, iz, ix) != expected) {
+          std::ostringstream message;
+          message << "\n \t Error in function load_on_device";
+          message << "\n \t Error at ispec = " << h_elements(i)
+                  << ", iz = " << iz << ", ix = " << ix;
+          message << get_error_message(expected, 0.0, 1);
+          message << get_error_message(h_point_properties(i, iz, ix), 0.0, 2);
+          throw std::runtime_error(message.str());
+        }
+      }
+    }
+  }
+}
+
 void test_properties(
     specfem::compute::assembly &assembly,
     const specfem::mesh::mesh<specfem::dimension::type::dim2> &mesh) {
@@ -662,6 +738,18 @@ void test_properties(
       WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
           WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
 
+  // Properties assigned from mesh::materials are stored once per element on
+  // the device and read back at every quadrature point
+#define TEST_DEVICE_STORAGE(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG)           \
+  check_device_storage<GET_TAG(MEDIUM_TAG), GET_TAG(PROPERTY_TAG)>(            \
+      properties, element_types, per_element);
+
+  bool per_element = true;
+  CALL_MACRO_FOR_ALL_MATERIAL_SYSTEMS(
+      TEST_DEVICE_STORAGE,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
+
   // stage 2: write properties
   specfem::IO::property_writer<specfem::IO::ASCII<specfem::IO::write> > writer(
       ".");
@@ -696,6 +784,14 @@ void test_properties(
       WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
           WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
 
+  // A model read from disk is stored at every quadrature point
+  per_element = false;
+  CALL_MACRO_FOR_ALL_MATERIAL_SYSTEMS(
+      TEST_DEVICE_STORAGE,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC))
+
+#undef TEST_DEVICE_STORAGE
 #undef TEST_COMPUTE_TO_MESH
   // check_compute_to_mesh<specfem::element::medium_tag::elastic,
   //                       specfem::element::property_tag::isotropic>(assembly,
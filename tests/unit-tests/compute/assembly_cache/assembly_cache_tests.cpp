@@ -0,0 +1,252 @@
+#include "../../Kokkos_Environment.hpp"
+#include "compute/assembly/cache.hpp"
+#include "compute/compute_mesh.hpp"
+#include "compute/compute_partial_derivatives.hpp"
+#include "quadrature/interface.hpp"
+#include "specfem_setup.hpp"
+#include <Kokkos_Core.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+constexpr int nspec = 4;
+constexpr int ngll = 5;
+
+// Temporary folder holding the mesh database and the cache of a test
+boost::filesystem::path create_folder() {
+  const auto folder =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("specfem-cache-%%%%-%%%%");
+  boost::filesystem::create_directories(folder);
+  return folder;
+}
+
+// The cache key only depends on the contents of the database, which does not
+// need to be a valid mesh
+void write_database(const boost::filesystem::path &filename,
+                    const std::string &contents) {
+  std::ofstream stream(filename.string(), std::ios::binary);
+  stream << contents;
+}
+
+// The first element is affine, the partial derivatives of the other elements
+// vary at every quadrature point
+type_real get_value(const int ivalue, const int ispec, const int iz,
+                    const int ix) {
+  if (ispec == 0) {
+    return 1000 * ivalue + 0.5;
+  }
+  return 1000 * ivalue + 100 * ispec + 10 * iz + ix + 0.5;
+}
+
+// Geometry with a distinct value at every quadrature point
+void create_geometry(specfem::compute::points &points,
+                     specfem::compute::partial_derivatives &derivatives) {
+  points = { nspec, ngll, ngll };
+  points.xmin = -1.0;
+  points.xmax = 2.0;
+  points.zmin = -3.0;
+  points.zmax = 4.0;
+
+  derivatives = { nspec, ngll, ngll };
+
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    for (int iz = 0; iz < ngll; ++iz) {
+      for (int ix = 0; ix < ngll; ++ix) {
+        points.h_index_mapping(ispec, iz, ix) =
+            (ispec * ngll + iz) * ngll + ix;
+        points.h_coord(0, ispec, iz, ix) = get_value(0, ispec, iz, ix);
+        points.h_coord(1, ispec, iz, ix) = get_value(1, ispec, iz, ix);
+        derivatives.h_xix(ispec, iz, ix) = get_value(2, ispec, iz, ix);
+        derivatives.h_xiz(ispec, iz, ix) = get_value(3, ispec, iz, ix);
+        derivatives.h_gammax(ispec, iz, ix) = get_value(4, ispec, iz, ix);
+        derivatives.h_gammaz(ispec, iz, ix) = get_value(5, ispec, iz, ix);
+        derivatives.h_jacobian(ispec, iz, ix) = get_value(6, ispec, iz, ix);
+      }
+    }
+  }
+}
+
+} // namespace
+
+// The geometry read from the cache matches the geometry written, on both the
+// host and the device
+TEST(ASSEMBLY_CACHE, round_trip) {
+  const auto folder = create_folder();
+  const auto database = folder / "database.bin";
+  const auto filename = folder / "assembly.cache";
+  write_database(database, "mesh database");
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, ngll);
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::compute::assembly_cache cache(filename.string(), database.string(),
+                                         quadratures);
+  EXPECT_FALSE(cache.is_valid());
+
+  specfem::compute::points points;
+  specfem::compute::partial_derivatives derivatives;
+  create_geometry(points, derivatives);
+  cache.write(points, derivatives);
+
+  EXPECT_TRUE(cache.is_valid());
+  EXPECT_FALSE(boost::filesystem::exists(filename.string() + ".tmp"));
+
+  specfem::compute::points cached_points;
+  specfem::compute::partial_derivatives cached_derivatives;
+  cache.read(cached_points, cached_derivatives);
+
+  ASSERT_EQ(cached_points.nspec, nspec);
+  ASSERT_EQ(cached_points.ngllz, ngll);
+  ASSERT_EQ(cached_points.ngllx, ngll);
+  EXPECT_EQ(cached_points.xmin, points.xmin);
+  EXPECT_EQ(cached_points.xmax, points.xmax);
+  EXPECT_EQ(cached_points.zmin, points.zmin);
+  EXPECT_EQ(cached_points.zmax, points.zmax);
+
+  // Device views are read back through new mirrors, such that the check does
+  // not rely on the host views read from the file
+  const auto index_mapping = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), cached_points.index_mapping);
+  const auto coord = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), cached_points.coord);
+  const auto xix = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), cached_derivatives.xix);
+  const auto jacobian = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), cached_derivatives.jacobian);
+  const auto element_xix = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), cached_derivatives.element_xix);
+  const auto element_jacobian = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), cached_derivatives.element_jacobian);
+
+  ASSERT_EQ(cached_derivatives.ncurved, nspec - 1);
+  EXPECT_EQ(cached_derivatives.h_element_index(0), -1);
+  EXPECT_EQ(element_xix(0), derivatives.h_xix(0, 0, 0));
+  EXPECT_EQ(element_jacobian(0), derivatives.h_jacobian(0, 0, 0));
+
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    for (int iz = 0; iz < ngll; ++iz) {
+      for (int ix = 0; ix < ngll; ++ix) {
+        EXPECT_EQ(cached_points.h_index_mapping(ispec, iz, ix),
+                  points.h_index_mapping(ispec, iz, ix));
+        EXPECT_EQ(cached_points.h_coord(0, ispec, iz, ix),
+                  points.h_coord(0, ispec, iz, ix));
+        EXPECT_EQ(cached_points.h_coord(1, ispec, iz, ix),
+                  points.h_coord(1, ispec, iz, ix));
+        EXPECT_EQ(cached_derivatives.h_xix(ispec, iz, ix),
+                  derivatives.h_xix(ispec, iz, ix));
+        EXPECT_EQ(cached_derivatives.h_xiz(ispec, iz, ix),
+                  derivatives.h_xiz(ispec, iz, ix));
+        EXPECT_EQ(cached_derivatives.h_gammax(ispec, iz, ix),
+                  derivatives.h_gammax(ispec, iz, ix));
+        EXPECT_EQ(cached_derivatives.h_gammaz(ispec, iz, ix),
+                  derivatives.h_gammaz(ispec, iz, ix));
+        EXPECT_EQ(cached_derivatives.h_jacobian(ispec, iz, ix),
+                  derivatives.h_jacobian(ispec, iz, ix));
+
+        EXPECT_EQ(index_mapping(ispec, iz, ix),
+                  points.h_index_mapping(ispec, iz, ix));
+        EXPECT_EQ(coord(0, ispec, iz, ix), points.h_coord(0, ispec, iz, ix));
+        EXPECT_EQ(coord(1, ispec, iz, ix), points.h_coord(1, ispec, iz, ix));
+
+        const int icurved = cached_derivatives.h_element_index(ispec);
+        if (icurved >= 0) {
+          EXPECT_EQ(xix(icurved, iz, ix), derivatives.h_xix(ispec, iz, ix));
+          EXPECT_EQ(jacobian(icurved, iz, ix),
+                    derivatives.h_jacobian(ispec, iz, ix));
+        }
+      }
+    }
+  }
+
+  boost::filesystem::remove_all(folder);
+}
+
+// A cache written for another database or quadrature is not valid and is
+// overwritten by the next write
+TEST(ASSEMBLY_CACHE, invalidation) {
+  const auto folder = create_folder();
+  const auto database = folder / "database.bin";
+  const auto filename = folder / "assembly.cache";
+  write_database(database, "mesh database");
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, ngll);
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::compute::points points;
+  specfem::compute::partial_derivatives derivatives;
+  create_geometry(points, derivatives);
+
+  {
+    specfem::compute::assembly_cache cache(filename.string(),
+                                           database.string(), quadratures);
+    cache.write(points, derivatives);
+    ASSERT_TRUE(cache.is_valid());
+  }
+
+  // Same inputs generate the same key
+  {
+    specfem::compute::assembly_cache cache(filename.string(),
+                                           database.string(), quadratures);
+    EXPECT_TRUE(cache.is_valid());
+  }
+
+  // Different quadrature
+  {
+    specfem::quadrature::gll::gll other_gll(0.0, 0.0, ngll + 1);
+    specfem::quadrature::quadratures other_quadratures(other_gll);
+    specfem::compute::assembly_cache cache(
+        filename.string(), database.string(), other_quadratures);
+    EXPECT_FALSE(cache.is_valid());
+  }
+
+  // Different database contents
+  write_database(database, "modified mesh database");
+  specfem::compute::assembly_cache cache(filename.string(), database.string(),
+                                         quadratures);
+  EXPECT_FALSE(cache.is_valid());
+
+  cache.write(points, derivatives);
+  EXPECT_TRUE(cache.is_valid());
+
+  boost::filesystem::remove_all(folder);
+}
+
+// A truncated cache file is rejected when read
+TEST(ASSEMBLY_CACHE, truncated) {
+  const auto folder = create_folder();
+  const auto database = folder / "database.bin";
+  const auto filename = folder / "assembly.cache";
+  write_database(database, "mesh database");
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, ngll);
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::compute::points points;
+  specfem::compute::partial_derivatives derivatives;
+  create_geometry(points, derivatives);
+
+  specfem::compute::assembly_cache cache(filename.string(), database.string(),
+                                         quadratures);
+  cache.write(points, derivatives);
+
+  boost::filesystem::resize_file(filename,
+                                 boost::filesystem::file_size(filename) -
+                                     sizeof(type_real));
+
+  // The header is intact, the data is not
+  EXPECT_TRUE(cache.is_valid());
+  EXPECT_THROW(cache.read(points, derivatives), std::runtime_error);
+
+  boost::filesystem::remove_all(folder);
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,326 @@
+#include "../../Kokkos_Environment.hpp"
+#include "../../MPI_environment.hpp"
+#include "IO/ASCII/ASCII.hpp"
+#include "IO/property/writer.hpp"
+#include "compute/cfl/cfl.hpp"
+#include "constants.hpp"
+#include "point/properties.hpp"
+#include "program/simulation.hpp"
+#include "yaml-cpp/yaml.h"
+#include <algorithm>
+#include <array>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+
+// ------------------------------------- //
+// ------- Test configuration ----------- //
+
+const std::string test_directory =
+    "../../../tests/unit-tests/displacement_tests/Newmark/serial/";
+
+// Homogeneous isotropic elastic domain
+const std::string isotropic_config =
+    test_directory + "test1/specfem_config.yaml";
+
+// Homogeneous anisotropic elastic domain
+const std::string anisotropic_config =
+    test_directory + "test9/specfem_config.yaml";
+
+constexpr type_real target_courant = 0.5;
+
+// ------------------------------------- //
+
+namespace {
+
+constexpr auto elastic = specfem::element::medium_tag::elastic;
+constexpr auto isotropic = specfem::element::property_tag::isotropic;
+constexpr auto anisotropic = specfem::element::property_tag::anisotropic;
+
+template <specfem::element::property_tag PropertyTag>
+using PointPropertiesType =
+    specfem::point::properties<specfem::dimension::type::dim2, elastic,
+                               PropertyTag, false>;
+
+const type_real tolerance = 1e3 * std::numeric_limits<type_real>::epsilon();
+
+// Largest eigenvalue of a symmetric positive definite 3x3 matrix by power
+// iteration
+type_real power_iteration(const std::array<std::array<double, 3>, 3> &a) {
+  std::array<double, 3> v = { 1.0, 1.0, 1.0 };
+  double eigenvalue = 0.0;
+  for (int iter = 0; iter < 500; ++iter) {
+    std::array<double, 3> w = { 0.0, 0.0, 0.0 };
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        w[i] += a[i][j] * v[j];
+      }
+    }
+    eigenvalue = std::sqrt(w[0] * w[0] + w[1] * w[1] + w[2] * w[2]);
+    for (int i = 0; i < 3; ++i) {
+      v[i] = w[i] / eigenvalue;
+    }
+  }
+  return eigenvalue;
+}
+
+// Largest speed of the plane waves travelling along the unit direction
+// (nx, nz), from the Christoffel equation
+type_real christoffel_speed(const PointPropertiesType<anisotropic> &p,
+                            const double nx, const double nz) {
+  const double g11 = p.c11 * nx * nx + 2.0 * p.c15 * nx * nz + p.c55 * nz * nz;
+  const double g33 = p.c55 * nx * nx + 2.0 * p.c35 * nx * nz + p.c33 * nz * nz;
+  const double g13 =
+      p.c15 * nx * nx + (p.c13 + p.c55) * nx * nz + p.c35 * nz * nz;
+  const double mean = 0.5 * (g11 + g33);
+  const double radius = std::sqrt(0.25 * (g11 - g33) * (g11 - g33) + g13 * g13);
+  return std::sqrt((mean + radius) / p.rho);
+}
+
+// Maximum over the quadrature points of an element of a function of the
+// point properties
+template <specfem::element::property_tag PropertyTag, typename FunctionType>
+type_real max_over_element(const specfem::compute::assembly &assembly,
+                           const int ispec, const FunctionType &function) {
+  type_real value = 0.0;
+  for (int iz = 0; iz < assembly.mesh.ngllz; ++iz) {
+    for (int ix = 0; ix < assembly.mesh.ngllx; ++ix) {
+      const specfem::point::index<specfem::dimension::type::dim2> index(
+          ispec, iz, ix);
+      PointPropertiesType<PropertyTag> point_properties;
+      specfem::compute::load_on_host(index, assembly.properties,
+                                     point_properties);
+      value = std::max(value, function(point_properties));
+    }
+  }
+  return value;
+}
+
+specfem::compute::cfl compute_cfl(const specfem::compute::assembly &assembly,
+                                  const type_real dt) {
+  return { assembly.mesh, assembly.element_types, assembly.properties, dt,
+           target_courant };
+}
+
+// Scale the elastic moduli of the (elastic isotropic) model. Wave speeds are
+// scaled by the square root of the factor
+void scale_moduli(specfem::compute::assembly &assembly,
+                  const type_real factor) {
+  auto &properties = assembly.properties;
+  properties.copy_to_host();
+
+  const auto &elastic = properties.elastic_isotropic;
+  for (const auto &view : { elastic.h_mu, elastic.h_lambdaplus2mu }) {
+    for (int i = 0; i < view.extent(0); ++i) {
+      for (int iz = 0; iz < view.extent(1); ++iz) {
+        for (int ix = 0; ix < view.extent(2); ++ix) {
+          view(i, iz, ix) *= factor;
+        }
+      }
+    }
+  }
+
+  properties.copy_to_device();
+}
+
+// Temporary folder for the outputs of a test
+boost::filesystem::path create_output_folder() {
+  const auto output_folder =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("specfem-cfl-%%%%-%%%%");
+  boost::filesystem::create_directories(output_folder);
+  return output_folder;
+}
+
+// Isotropic configuration with an automatic time step
+YAML::Node get_parameters(const boost::filesystem::path &output_folder) {
+  YAML::Node parameters = YAML::LoadFile(isotropic_config);
+  YAML::Node setup = parameters["parameters"]["simulation-setup"];
+  setup["simulation-mode"]["forward"]["writer"]["seismogram"]["directory"] =
+      output_folder.string();
+  setup["solver"]["time-marching"]["cfl"]["courant-number"] = target_courant;
+  setup["solver"]["time-marching"]["cfl"]["automatic-dt"] = true;
+  return parameters;
+}
+
+// Time between two samples of the seismograms
+type_real get_sampling_interval(specfem::program::simulation &simulation) {
+  auto seismograms = simulation.get_assembly().receivers;
+  for (auto [station_name, network_name, seismogram_type] :
+       seismograms.get_stations()) {
+    auto trace = seismograms.get_seismogram(station_name, network_name,
+                                            seismogram_type);
+    auto sample = trace.begin();
+    const type_real t0 = std::get<0>(*sample);
+    ++sample;
+    return std::get<0>(*sample) - t0;
+  }
+  return 0.0;
+}
+
+} // namespace
+
+// The Courant number of an element is v_max dt / dx_min, with v_max the
+// P-wave speed of the assembled properties
+TEST(COMPUTE, cfl_isotropic) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::program::simulation simulation(YAML::LoadFile(isotropic_config),
+                                          YAML::LoadFile(__default_file__),
+                                          mpi);
+  const auto &assembly = simulation.get_assembly();
+
+  const type_real dt = 1e-3;
+  const auto cfl = compute_cfl(assembly, dt);
+
+  ASSERT_EQ(cfl.element_courant.size(), assembly.mesh.nspec);
+  ASSERT_FALSE(cfl.worst_elements.empty());
+  EXPECT_GT(cfl.courant, 0.0);
+  EXPECT_NEAR(cfl.recommended_dt * cfl.courant, dt * target_courant,
+              tolerance * dt);
+
+  for (int i = 0; i < cfl.worst_elements.size(); ++i) {
+    const auto &element = cfl.worst_elements[i];
+    if (i > 0) {
+      EXPECT_LE(element.courant, cfl.worst_elements[i - 1].courant);
+    }
+
+    const int ispec = assembly.mesh.mapping.mesh_to_compute(element.ispec);
+    const type_real velocity = max_over_element<isotropic>(
+        assembly, ispec, [](const PointPropertiesType<isotropic> &p) {
+          return std::sqrt(p.lambdaplus2mu / p.rho);
+        });
+
+    EXPECT_NEAR(element.max_velocity, velocity, tolerance * velocity)
+        << "Element " << element.ispec;
+    EXPECT_NEAR(element.courant,
+                element.max_velocity * dt / element.min_gll_distance,
+                tolerance * element.courant)
+        << "Element " << element.ispec;
+    EXPECT_EQ(element.courant, cfl.element_courant[ispec]);
+  }
+
+  // The Courant number is linear in dt, the recommended time step is not
+  const auto cfl2 = compute_cfl(assembly, 2 * dt);
+  EXPECT_NEAR(cfl2.courant, 2 * cfl.courant, tolerance * cfl.courant);
+  EXPECT_NEAR(cfl2.recommended_dt, cfl.recommended_dt,
+              tolerance * cfl.recommended_dt);
+}
+
+// The analysis reads the properties of the assembly. Scaling the moduli by 4
+// doubles the wave speeds and halves the recommended time step
+TEST(COMPUTE, cfl_assembled_properties) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::program::simulation simulation(YAML::LoadFile(isotropic_config),
+                                          YAML::LoadFile(__default_file__),
+                                          mpi);
+  auto &assembly = simulation.get_assembly();
+
+  const type_real dt = 1e-3;
+  const auto reference = compute_cfl(assembly, dt);
+
+  scale_moduli(assembly, 4.0);
+  const auto cfl = compute_cfl(assembly, dt);
+
+  EXPECT_NEAR(cfl.courant, 2 * reference.courant,
+              tolerance * reference.courant);
+  EXPECT_NEAR(cfl.recommended_dt, 0.5 * reference.recommended_dt,
+              tolerance * reference.recommended_dt);
+}
+
+// In anisotropic media the speed of every plane wave is bounded by the
+// largest eigenvalue of the stiffness tensor acting on symmetric strains
+// (Mandel notation)
+TEST(COMPUTE, cfl_anisotropic) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::program::simulation simulation(YAML::LoadFile(anisotropic_config),
+                                          YAML::LoadFile(__default_file__),
+                                          mpi);
+  const auto &assembly = simulation.get_assembly();
+
+  ASSERT_GT(
+      assembly.element_types.get_elements_on_host(elastic, anisotropic)
+          .extent(0),
+      0);
+
+  const auto cfl = compute_cfl(assembly, 1e-3);
+  ASSERT_FALSE(cfl.worst_elements.empty());
+
+  const type_real sqrt2 = std::sqrt(2.0);
+  for (const auto &element : cfl.worst_elements) {
+    const int ispec = assembly.mesh.mapping.mesh_to_compute(element.ispec);
+
+    const type_real bound = max_over_element<anisotropic>(
+        assembly, ispec, [&](const PointPropertiesType<anisotropic> &p) {
+          const std::array<std::array<double, 3>, 3> mandel = {
+            { { p.c11, p.c13, sqrt2 * p.c15 },
+              { p.c13, p.c33, sqrt2 * p.c35 },
+              { sqrt2 * p.c15, sqrt2 * p.c35, 2.0 * p.c55 } }
+          };
+          return std::sqrt(power_iteration(mandel) / p.rho);
+        });
+
+    EXPECT_NEAR(element.max_velocity, bound, 1e-4 * bound)
+        << "Element " << element.ispec;
+
+    // Plane waves along any direction travel at most at the bound
+    const type_real speed = max_over_element<anisotropic>(
+        assembly, ispec, [](const PointPropertiesType<anisotropic> &p) {
+          type_real speed = 0.0;
+          for (int iangle = 0; iangle < 360; ++iangle) {
+            const double angle = iangle * M_PI / 180.0;
+            speed = std::max(
+                speed, christoffel_speed(p, std::cos(angle), std::sin(angle)));
+          }
+          return speed;
+        });
+
+    EXPECT_GE(element.max_velocity * (1 + tolerance), speed)
+        << "Element " << element.ispec;
+  }
+}
+
+// The automatic time step is computed after the model is read. A model with
+// moduli scaled by 4 halves the time step
+TEST(COMPUTE, cfl_automatic_dt) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  const auto output_folder = create_output_folder();
+  const YAML::Node defaults = YAML::LoadFile(__default_file__);
+
+  const type_real reference = [&]() {
+    specfem::program::simulation simulation(get_parameters(output_folder),
+                                            defaults, mpi);
+    auto &assembly = simulation.get_assembly();
+    scale_moduli(assembly, 4.0);
+    specfem::IO::property_writer<specfem::IO::ASCII<specfem::IO::write> >(
+        output_folder.string())
+        .write(assembly);
+    return get_sampling_interval(simulation);
+  }();
+
+  ASSERT_GT(reference, 0.0);
+
+  YAML::Node parameters = get_parameters(output_folder);
+  YAML::Node model = parameters["parameters"]["databases"]["reader"]
+                               ["properties"];
+  model["directory"] = output_folder.string();
+  model["format"] = "ASCII";
+
+  specfem::program::simulation simulation(parameters, defaults, mpi);
+  EXPECT_NEAR(get_sampling_interval(simulation), 0.5 * reference,
+              1e-4 * reference);
+
+  boost::filesystem::remove_all(output_folder);
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 using HostView1d = specfem::kokkos::HostView1d<int>;
@@ -128,6 +129,94 @@ TEST(COMPUTE_TESTS, compute_ibool) {
   return;
 }
 
+/**
+ *
+ * The medium index map used by field accesses keeps the medium as the slowest
+ * index. Within a medium the map is laid out like the per-point element data,
+ * so the indices gathered for one element (or, on the device, for a group of
+ * consecutive elements) are contiguous in memory.
+ *
+ */
+TEST(COMPUTE_TESTS, medium_index_mapping) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  std::string config_filename =
+      "../../../tests/unit-tests/compute/index/test_config.yml";
+  test_config test_config = get_test_config(config_filename, mpi);
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::mesh::mesh mesh =
+      specfem::IO::read_mesh(test_config.database_filename, mpi);
+
+  const specfem::compute::mesh assembly(mesh.tags, mesh.control_nodes,
+                                        quadratures);
+  const specfem::compute::element_types element_types(
+      assembly.nspec, assembly.ngllz, assembly.ngllx, assembly.mapping,
+      mesh.tags);
+
+  const specfem::compute::simulation_field<
+      specfem::wavefield::simulation_field::forward>
+      field(assembly, element_types);
+
+  const int nspec = field.nspec;
+  const int ngllz = field.ngllz;
+  const int ngllx = field.ngllx;
+  const int npoints = nspec * ngllz * ngllx;
+
+  const auto &map = field.h_medium_index_mapping;
+
+  // Every medium is a dense block of nspec * ngllz * ngllx indices
+  EXPECT_EQ(map.span(), specfem::element::ntypes * npoints);
+  EXPECT_EQ(map.stride(0), npoints);
+
+  // Within a medium, the strides match the per-point element layout
+  using ElementView =
+      Kokkos::View<int ***, specfem::kokkos::ElementLayout,
+                   Kokkos::DefaultHostExecutionSpace>;
+  const ElementView element_view("element_view", nspec, ngllz, ngllx);
+
+  for (int itype = 0; itype < specfem::element::ntypes; ++itype) {
+    const auto medium =
+        Kokkos::subview(map, itype, Kokkos::ALL, Kokkos::ALL, Kokkos::ALL);
+    EXPECT_EQ(medium.data(), map.data() + itype * npoints);
+    EXPECT_EQ(medium.stride(0), element_view.stride(0));
+    EXPECT_EQ(medium.stride(1), element_view.stride(1));
+    EXPECT_EQ(medium.stride(2), element_view.stride(2));
+  }
+
+  // Gathering the indices of an element reads unit-stride memory when
+  // elements are stored contiguously
+  if constexpr (std::is_same_v<specfem::kokkos::ElementLayout,
+                               Kokkos::LayoutRight>) {
+    for (int ispec = 0; ispec < nspec; ++ispec) {
+      const int *first = &map(0, ispec, 0, 0);
+      for (int iz = 0; iz < ngllz; ++iz) {
+        for (int ix = 0; ix < ngllx; ++ix) {
+          EXPECT_EQ(&map(0, ispec, iz, ix), first + iz * ngllx + ix);
+        }
+      }
+    }
+  }
+
+  // The map resolves both levels of indirection
+  for (int itype = 0; itype < specfem::element::ntypes; ++itype) {
+    for (int ispec = 0; ispec < nspec; ++ispec) {
+      for (int iz = 0; iz < ngllz; ++iz) {
+        for (int ix = 0; ix < ngllx; ++ix) {
+          EXPECT_EQ(map(itype, ispec, iz, ix),
+                    field.h_assembly_index_mapping(
+                        field.h_index_mapping(ispec, iz, ix), itype));
+        }
+      }
+    }
+  }
+
+  return;
+}
+
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
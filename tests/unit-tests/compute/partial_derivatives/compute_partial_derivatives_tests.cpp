@@ -5,8 +5,10 @@
 #include "compute/interface.hpp"
 #include "quadrature/interface.hpp"
 #include "yaml-cpp/yaml.h"
+#include <cmath>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
@@ -159,6 +161,163 @@ TEST(COMPUTE_TESTS, compute_partial_derivatives) {
   return;
 }
 
+namespace {
+/**
+ * Load the partial derivatives of every quadrature point on the device, where
+ * affine elements are stored compressed, and compare them point by point
+ * against the full values stored on the host
+ */
+void compare_compressed_partial_derivatives(
+    const specfem::compute::partial_derivatives &partial_derivatives) {
+
+  const int nspec = partial_derivatives.nspec;
+  const int ngllz = partial_derivatives.ngllz;
+  const int ngllx = partial_derivatives.ngllx;
+
+  Kokkos::View<type_real ****, Kokkos::DefaultExecutionSpace> values(
+      "values", nspec, ngllz, ngllx, 5);
+
+  Kokkos::parallel_for(
+      "compressed_partial_derivatives",
+      Kokkos::MDRangePolicy<Kokkos::DefaultExecutionSpace, Kokkos::Rank<3> >(
+          { 0, 0, 0 }, { nspec, ngllz, ngllx }),
+      KOKKOS_LAMBDA(const int ispec, const int iz, const int ix) {
+        const specfem::point::index<specfem::dimension::type::dim2> index(
+            ispec, iz, ix);
+        specfem::point::partial_derivatives<specfem::dimension::type::dim2,
+                                            true, false>
+            point_partial_derivatives;
+        specfem::compute::load_on_device(index, partial_derivatives,
+                                         point_partial_derivatives);
+        values(ispec, iz, ix, 0) = point_partial_derivatives.xix;
+        values(ispec, iz, ix, 1) = point_partial_derivatives.xiz;
+        values(ispec, iz, ix, 2) = point_partial_derivatives.gammax;
+        values(ispec, iz, ix, 3) = point_partial_derivatives.gammaz;
+        values(ispec, iz, ix, 4) = point_partial_derivatives.jacobian;
+      });
+
+  const auto h_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+
+  for (int ispec = 0; ispec < nspec; ++ispec) {
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        const type_real expected[5] = {
+          partial_derivatives.h_xix(ispec, iz, ix),
+          partial_derivatives.h_xiz(ispec, iz, ix),
+          partial_derivatives.h_gammax(ispec, iz, ix),
+          partial_derivatives.h_gammaz(ispec, iz, ix),
+          partial_derivatives.h_jacobian(ispec, iz, ix)
+        };
+        for (int i = 0; i < 5; ++i) {
+          EXPECT_NEAR(h_values(ispec, iz, ix, i), expected[i],
+                      1e-6 * std::abs(expected[i]) + 1e-12)
+              << "Element " << ispec << " ("
+              << (partial_derivatives.h_element_index(ispec) < 0 ? "affine"
+                                                                 : "curved")
+              << "), point (" << iz << ", " << ix << "), value " << i;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Number of affine elements. Curved elements must be numbered contiguously in
+ * element order
+ */
+int count_affine_elements(
+    const specfem::compute::partial_derivatives &partial_derivatives) {
+  int naffine = 0;
+  for (int ispec = 0; ispec < partial_derivatives.nspec; ++ispec) {
+    const int icurved = partial_derivatives.h_element_index(ispec);
+    if (icurved < 0) {
+      ++naffine;
+    } else {
+      EXPECT_EQ(icurved, ispec - naffine);
+    }
+  }
+  EXPECT_EQ(naffine, partial_derivatives.nspec - partial_derivatives.ncurved);
+  return naffine;
+}
+} // namespace
+
+/**
+ * Values loaded on the device must match the values stored at every
+ * quadrature point on the host. The test mesh is curved everywhere.
+ */
+TEST(COMPUTE_TESTS, compressed_partial_derivatives) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  std::string config_filename =
+      "../../../tests/unit-tests/compute/partial_derivatives/test_config.yml";
+  test_config test_config = get_test_config(config_filename, mpi);
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::mesh::mesh mesh =
+      specfem::IO::read_mesh(test_config.database_filename, mpi);
+
+  specfem::compute::mesh compute_mesh(mesh.tags, mesh.control_nodes,
+                                      quadratures);
+  specfem::compute::partial_derivatives partial_derivatives(compute_mesh);
+
+  // The test mesh is deformed everywhere: the partial derivatives of every
+  // element vary by more than 7e-4 (relative) across its quadrature points,
+  // so none of the 4800 elements is affine
+  constexpr int nspec_mesh = 4800;
+  constexpr int ncurved_mesh = 4800;
+  ASSERT_EQ(partial_derivatives.nspec, nspec_mesh);
+  EXPECT_EQ(partial_derivatives.ncurved, ncurved_mesh);
+  EXPECT_EQ(count_affine_elements(partial_derivatives),
+            nspec_mesh - ncurved_mesh);
+
+  compare_compressed_partial_derivatives(partial_derivatives);
+}
+
+/**
+ * Same comparison on a mesh of axis-aligned rectangular elements, where the
+ * partial derivatives are stored once per affine element
+ */
+TEST(COMPUTE_TESTS, compressed_partial_derivatives_affine) {
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  const std::string database_file = "../../../tests/unit-tests/"
+                                    "displacement_tests/Newmark/serial/test1/"
+                                    "database.bin";
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+  specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::mesh::mesh mesh = specfem::IO::read_mesh(database_file, mpi);
+
+  specfem::compute::mesh compute_mesh(mesh.tags, mesh.control_nodes,
+                                      quadratures);
+  specfem::compute::partial_derivatives partial_derivatives(compute_mesh);
+
+  const int naffine = count_affine_elements(partial_derivatives);
+  ASSERT_GT(naffine, 0) << "The mesh has no affine elements";
+
+  // Affine elements have the same Jacobian at every point, to round-off
+  for (int ispec = 0; ispec < partial_derivatives.nspec; ++ispec) {
+    if (partial_derivatives.h_element_index(ispec) >= 0)
+      continue;
+    const type_real reference = partial_derivatives.h_jacobian(ispec, 0, 0);
+    for (int iz = 0; iz < partial_derivatives.ngllz; ++iz) {
+      for (int ix = 0; ix < partial_derivatives.ngllx; ++ix) {
+        EXPECT_NEAR(partial_derivatives.h_jacobian(ispec, iz, ix), reference,
+                    1e3 * std::numeric_limits<type_real>::epsilon() *
+                        std::abs(reference));
+      }
+    }
+  }
+
+  compare_compressed_partial_derivatives(partial_derivatives);
+}
+
 int main(int argc, char *argv[]) {
   ::testing::InitGoogleTest(&argc, argv);
   ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
@@ -0,0 +1,212 @@
+#include "../../Kokkos_Environment.hpp"
+#include "../../MPI_environment.hpp"
+#include "IO/interface.hpp"
+#include "compute/interface.hpp"
+#include "constants.hpp"
+#include "mesh/mesh.hpp"
+#include "parameter_parser/interface.hpp"
+#include "quadrature/interface.hpp"
+#include "solver/solver.hpp"
+#include "timescheme/lts_newmark.hpp"
+#include "timescheme/timescheme.hpp"
+#include "yaml-cpp/yaml.h"
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ------------------------------------- //
+// ------- Test configuration ----------- //
+
+// Homogeneous elastic domain with Stacey BCs on all edges. Receivers S0001
+// and S0006 lie on the absorbing boundary
+const std::string parameter_file = "../../../tests/unit-tests/"
+                                   "displacement_tests/Newmark/serial/test7/"
+                                   "specfem_config.yaml";
+
+// Unstructured acoustic mesh where a part of the elements requires a smaller
+// time step than the rest of the mesh
+const std::string lts_parameter_file = "../../../tests/unit-tests/"
+                                       "displacement_tests/time_schemes/"
+                                       "lts_newmark/specfem_config.yaml";
+
+// ------------------------------------- //
+
+namespace {
+
+using traces_type = std::vector<std::vector<type_real> >;
+
+struct simulation {
+  traces_type traces; ///< Seismogram values for every station and component
+  std::shared_ptr<specfem::time_scheme::time_scheme> time_scheme; ///< Time
+                                                                  ///< scheme
+};
+
+/**
+ * @brief Run a test simulation and return the displacement seismograms
+ *
+ * @param parameter_file Parameter file of the simulation
+ * @param scheme Time scheme type (Newmark, LTS-Newmark, LDDRK4-6 or PEFRL)
+ * @param refinement Time step is divided by refinement, keeping the duration
+ * @return simulation Seismograms and time scheme of the simulation
+ */
+simulation run_simulation(const std::string &parameter_file,
+                          const std::string &scheme, const int refinement) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  YAML::Node parameters = YAML::LoadFile(parameter_file);
+  parameters["parameters"]["simulation-setup"]["solver"]["time-marching"]
+            ["time-scheme"]["type"] = scheme;
+
+  specfem::runtime_configuration::setup setup(parameters,
+                                              YAML::LoadFile(__default_file__));
+  setup.update_dt(setup.get_dt() / refinement);
+
+  const auto database_file = setup.get_databases();
+  const auto source_node = setup.get_sources();
+  const auto quadratures = setup.instantiate_quadrature();
+
+  specfem::mesh::mesh mesh = specfem::IO::read_mesh(database_file, mpi);
+  const type_real dt = setup.get_dt();
+  const int nsteps = setup.get_nsteps();
+
+  auto [sources, t0] = specfem::IO::read_sources(
+      source_node, nsteps, setup.get_t0(), dt, setup.get_simulation_type());
+  setup.update_t0(t0);
+
+  auto it = setup.instantiate_timescheme();
+
+  auto receivers = specfem::IO::read_receivers(setup.get_stations(),
+                                               setup.get_receiver_angle());
+
+  const int max_sig_step = it->get_max_seismogram_step();
+
+  specfem::compute::assembly assembly(
+      mesh, quadratures, sources, receivers, setup.get_seismogram_types(), t0,
+      dt, nsteps, max_sig_step, it->get_nstep_between_samples(),
+      setup.get_simulation_type(), nullptr);
+
+  it->link_assembly(assembly);
+
+  auto solver = setup.instantiate_solver<5>(dt, assembly, it, {});
+  solver->run();
+
+  auto seismograms = assembly.receivers;
+  seismograms.sync_seismograms();
+
+  traces_type traces;
+  for (auto [station_name, network_name, seismogram_type] :
+       seismograms.get_stations()) {
+    traces_type station_traces(2);
+    for (auto [time, value] : seismograms.get_seismogram(
+             station_name, network_name, seismogram_type)) {
+      for (int icomp = 0; icomp < 2; ++icomp) {
+        station_traces[icomp].push_back(value[icomp]);
+      }
+    }
+    traces.insert(traces.end(), station_traces.begin(), station_traces.end());
+  }
+
+  return { traces, it };
+}
+
+/**
+ * @brief L2 norm of the difference between two sets of traces, relative to
+ * the norm of the reference
+ *
+ * Sample @c isample of @p reference is compared with sample
+ * @c isample * stride of @p traces
+ */
+type_real relative_error(const traces_type &traces,
+                         const traces_type &reference, const int stride) {
+  type_real error = 0.0;
+  type_real norm = 0.0;
+  for (int itrace = 0; itrace < reference.size(); ++itrace) {
+    for (int isample = 0; isample < reference[itrace].size(); ++isample) {
+      const type_real difference =
+          traces[itrace][isample * stride] - reference[itrace][isample];
+      error += difference * difference;
+      norm += reference[itrace][isample] * reference[itrace][isample];
+    }
+  }
+  return std::sqrt(error / norm);
+}
+
+} // namespace
+
+class TIME_SCHEMES : public ::testing::TestWithParam<std::string> {};
+
+// Traces of the fourth order schemes match the Newmark traces, including the
+// receivers on the absorbing boundary
+TEST_P(TIME_SCHEMES, newmark_comparison) {
+  const auto scheme = GetParam();
+
+  const auto newmark = run_simulation(parameter_file, "Newmark", 1).traces;
+  const auto traces = run_simulation(parameter_file, scheme, 1).traces;
+
+  ASSERT_EQ(traces.size(), newmark.size());
+
+  const type_real error = relative_error(traces, newmark, 1);
+  EXPECT_LT(error, 1e-2)
+      << "--------------------------------------------------\n"
+      << "\033[0;31m[FAILED]\033[0m Test failed\n"
+      << " - Time scheme: " << scheme << "\n"
+      << " - Error relative to Newmark: " << error << "\n"
+      << "--------------------------------------------------\n";
+}
+
+// Halving the time step reduces the self-convergence error by 2^4
+TEST_P(TIME_SCHEMES, convergence) {
+  const auto scheme = GetParam();
+
+  const auto coarse = run_simulation(parameter_file, scheme, 1).traces;
+  const auto medium = run_simulation(parameter_file, scheme, 2).traces;
+  const auto fine = run_simulation(parameter_file, scheme, 4).traces;
+
+  const type_real coarse_error = relative_error(medium, coarse, 2);
+  const type_real fine_error = relative_error(fine, medium, 2);
+  const type_real order = std::log2(coarse_error / fine_error);
+
+  EXPECT_GT(order, 3.5)
+      << "--------------------------------------------------\n"
+      << "\033[0;31m[FAILED]\033[0m Test failed\n"
+      << " - Time scheme: " << scheme << "\n"
+      << " - Error (dt, dt / 2): " << coarse_error << "\n"
+      << " - Error (dt / 2, dt / 4): " << fine_error << "\n"
+      << " - Observed order: " << order << "\n"
+      << "--------------------------------------------------\n";
+}
+
+INSTANTIATE_TEST_SUITE_P(DISPLACEMENT_TESTS, TIME_SCHEMES,
+                         ::testing::Values("LDDRK4-6", "PEFRL"));
+
+// Local time stepping matches a global Newmark run at the time step of the
+// finest level
+TEST(DISPLACEMENT_TESTS, lts_newmark) {
+  const auto lts = run_simulation(lts_parameter_file, "LTS-Newmark", 1);
+  const auto newmark = run_simulation(lts_parameter_file, "Newmark", 2);
+
+  const auto time_scheme = std::dynamic_pointer_cast<
+      specfem::time_scheme::lts_newmark<specfem::simulation::type::forward> >(
+      lts.time_scheme);
+  ASSERT_NE(time_scheme, nullptr);
+  ASSERT_EQ(time_scheme->get_nlevels(), 1)
+      << "The test mesh should be refined by exactly one level";
+
+  ASSERT_EQ(lts.traces.size(), newmark.traces.size());
+
+  const type_real error = relative_error(newmark.traces, lts.traces, 2);
+  EXPECT_LT(error, 1e-2)
+      << "--------------------------------------------------\n"
+      << "\033[0;31m[FAILED]\033[0m Test failed\n"
+      << " - Time scheme: LTS-Newmark\n"
+      << " - Error relative to Newmark at dt / 2: " << error << "\n"
+      << "--------------------------------------------------\n";
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
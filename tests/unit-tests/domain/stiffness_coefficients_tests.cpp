@@ -0,0 +1,167 @@
+#include "../Kokkos_Environment.hpp"
+#include "../MPI_environment.hpp"
+#include "compute/assembly/assembly.hpp"
+#include "constants.hpp"
+#include "enumerations/material_definitions.hpp"
+#include "kokkos_kernels/impl/compute_stiffness_interaction.hpp"
+#include "program/simulation.hpp"
+#include "yaml-cpp/yaml.h"
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+#include <algorithm>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+
+// ------------------------------------- //
+// ------- Test configuration ----------- //
+
+const std::string test_directory =
+    "../../../tests/unit-tests/displacement_tests/Newmark/serial/";
+
+// Homogeneous isotropic elastic domain
+const std::string elastic_isotropic_config =
+    test_directory + "test1/specfem_config.yaml";
+
+// Homogeneous anisotropic elastic domain
+const std::string elastic_anisotropic_config =
+    test_directory + "test9/specfem_config.yaml";
+
+// Homogeneous acoustic domain
+const std::string acoustic_config =
+    test_directory + "test5/specfem_config.yaml";
+
+// ------------------------------------- //
+
+namespace {
+
+constexpr auto dimension = specfem::dimension::type::dim2;
+constexpr auto wavefield = specfem::wavefield::simulation_field::forward;
+constexpr int ngll = 5;
+
+template <specfem::element::medium_tag MediumTag>
+specfem::compute::impl::field_impl<dimension, MediumTag> &
+get_field(specfem::compute::assembly &assembly) {
+  if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
+    return assembly.fields.forward.elastic;
+  } else {
+    return assembly.fields.forward.acoustic;
+  }
+}
+
+// Acceleration of the forward wavefield computed from a single stiffness
+// interaction over the elements of a given medium and property
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+specfem::kokkos::HostView2d<type_real, Kokkos::LayoutLeft>
+compute_acceleration(specfem::compute::assembly &assembly) {
+  auto &field = get_field<MediumTag>(assembly);
+  Kokkos::deep_copy(field.field_dot_dot, 0.0);
+
+#define CALL_STIFFNESS_INTERACTION(DIMENSION_TAG, MEDIUM_TAG, PROPERTY_TAG,    \
+                                   BOUNDARY_TAG)                               \
+  if constexpr (MediumTag == GET_TAG(MEDIUM_TAG) &&                            \
+                PropertyTag == GET_TAG(PROPERTY_TAG)) {                        \
+    specfem::kokkos_kernels::impl::compute_stiffness_interaction<              \
+        dimension, wavefield, ngll, GET_TAG(MEDIUM_TAG),                       \
+        GET_TAG(PROPERTY_TAG), GET_TAG(BOUNDARY_TAG)>(assembly, 0);            \
+  }
+
+  CALL_MACRO_FOR_ALL_ELEMENT_TYPES(
+      CALL_STIFFNESS_INTERACTION,
+      WHERE(DIMENSION_TAG_DIM2) WHERE(MEDIUM_TAG_ELASTIC, MEDIUM_TAG_ACOUSTIC)
+          WHERE(PROPERTY_TAG_ISOTROPIC, PROPERTY_TAG_ANISOTROPIC)
+              WHERE(BOUNDARY_TAG_NONE, BOUNDARY_TAG_ACOUSTIC_FREE_SURFACE))
+
+#undef CALL_STIFFNESS_INTERACTION
+
+  Kokkos::fence();
+
+  field.template sync_fields<specfem::sync::kind::DeviceToHost>();
+  specfem::kokkos::HostView2d<type_real, Kokkos::LayoutLeft> result(
+      "result", field.field_dot_dot.extent(0), field.field_dot_dot.extent(1));
+  Kokkos::deep_copy(result, field.h_field_dot_dot);
+  return result;
+}
+
+// The fused coefficients fold the partial derivatives into the material
+// properties. The accelerations agree with the unfused kernel to round-off
+template <specfem::element::medium_tag MediumTag,
+          specfem::element::property_tag PropertyTag>
+void compare_fused_stiffness(const std::string &parameter_file) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::program::simulation simulation(
+      YAML::LoadFile(parameter_file), YAML::LoadFile(__default_file__), mpi);
+  auto &assembly = simulation.get_assembly();
+
+  const int nelements =
+      assembly.element_types.get_elements_on_host(MediumTag, PropertyTag)
+          .extent(0);
+  ASSERT_GT(nelements, 0) << "Mesh has no "
+                          << specfem::element::to_string(MediumTag,
+                                                         PropertyTag)
+                          << " elements";
+
+  // Random displacement field
+  auto &field = get_field<MediumTag>(assembly);
+  Kokkos::Random_XorShift64_Pool<Kokkos::DefaultExecutionSpace> pool(2024);
+  Kokkos::fill_random(field.field, pool, -1.0, 1.0);
+  Kokkos::fence();
+
+  assembly.stiffness_coefficients = {};
+  const auto reference =
+      compute_acceleration<MediumTag, PropertyTag>(assembly);
+
+  assembly.compute_stiffness_coefficients();
+  ASSERT_TRUE(assembly.stiffness_coefficients.enabled);
+  const auto fused = compute_acceleration<MediumTag, PropertyTag>(assembly);
+
+  ASSERT_EQ(reference.extent(0), fused.extent(0));
+  ASSERT_EQ(reference.extent(1), fused.extent(1));
+
+  type_real max_value = 0.0;
+  for (int iglob = 0; iglob < reference.extent(0); ++iglob) {
+    for (int icomp = 0; icomp < reference.extent(1); ++icomp) {
+      max_value = std::max(max_value, std::abs(reference(iglob, icomp)));
+    }
+  }
+  ASSERT_GT(max_value, 0.0) << "Acceleration is zero";
+
+  const type_real tolerance =
+      1e3 * std::numeric_limits<type_real>::epsilon() * max_value;
+  for (int iglob = 0; iglob < reference.extent(0); ++iglob) {
+    for (int icomp = 0; icomp < reference.extent(1); ++icomp) {
+      ASSERT_NEAR(fused(iglob, icomp), reference(iglob, icomp), tolerance)
+          << "Global point " << iglob << ", component " << icomp;
+    }
+  }
+}
+
+} // namespace
+
+TEST(DOMAIN, fused_stiffness_elastic_isotropic) {
+  compare_fused_stiffness<specfem::element::medium_tag::elastic,
+                          specfem::element::property_tag::isotropic>(
+      elastic_isotropic_config);
+}
+
+TEST(DOMAIN, fused_stiffness_elastic_anisotropic) {
+  compare_fused_stiffness<specfem::element::medium_tag::elastic,
+                          specfem::element::property_tag::anisotropic>(
+      elastic_anisotropic_config);
+}
+
+TEST(DOMAIN, fused_stiffness_acoustic_isotropic) {
+  compare_fused_stiffness<specfem::element::medium_tag::acoustic,
+                          specfem::element::property_tag::isotropic>(
+      acoustic_config);
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,281 @@
+#include "../Kokkos_Environment.hpp"
+#include "../MPI_environment.hpp"
+#include "compute/interface.hpp"
+#include "constants.hpp"
+#include "periodic_tasks/energy_monitor.hpp"
+#include "point/field.hpp"
+#include "point/partial_derivatives.hpp"
+#include "point/properties.hpp"
+#include "program/simulation.hpp"
+#include "yaml-cpp/yaml.h"
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// ------------------------------------- //
+// ------- Test configuration ----------- //
+
+const std::string test_directory =
+    "../../../tests/unit-tests/displacement_tests/Newmark/serial/";
+
+// Homogeneous elastic domain with free surfaces on all edges
+const std::string free_surface_config =
+    test_directory + "test1/specfem_config.yaml";
+
+// Homogeneous elastic domain with Stacey boundaries on all edges
+const std::string stacey_config = test_directory + "test7/specfem_config.yaml";
+
+// Dominant frequency of the test1 source
+constexpr type_real f0 = 10.0;
+
+// ------------------------------------- //
+
+namespace {
+
+constexpr auto dimension = specfem::dimension::type::dim2;
+constexpr auto elastic = specfem::element::medium_tag::elastic;
+constexpr auto isotropic = specfem::element::property_tag::isotropic;
+
+using PointFieldType =
+    specfem::point::field<dimension, elastic, true, true, false, false, false>;
+
+// One line of the energy log
+struct sample {
+  int istep;
+  type_real time;
+  type_real kinetic;
+  type_real potential;
+  type_real total;
+};
+
+std::vector<sample> read_log(const boost::filesystem::path &filename) {
+  std::ifstream file(filename.string());
+  std::vector<sample> samples;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream stream(line);
+    sample s;
+    stream >> s.istep >> s.time >> s.kinetic >> s.potential >> s.total;
+    samples.push_back(s);
+  }
+  return samples;
+}
+
+// Temporary folder for the outputs of a test
+boost::filesystem::path create_output_folder() {
+  const auto output_folder =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("specfem-energy-%%%%-%%%%");
+  boost::filesystem::create_directories(output_folder);
+  return output_folder;
+}
+
+// Set the forward elastic displacement and velocity at every quadrature point
+template <typename FunctionType>
+void set_field(specfem::compute::assembly &assembly,
+               const FunctionType &function) {
+  auto &field = assembly.fields.forward;
+  const auto &coord = assembly.mesh.points.h_coord;
+  const auto elements =
+      assembly.element_types.get_elements_on_host(elastic, isotropic);
+
+  for (int i = 0; i < elements.extent(0); ++i) {
+    const int ispec = elements(i);
+    for (int iz = 0; iz < assembly.mesh.ngllz; ++iz) {
+      for (int ix = 0; ix < assembly.mesh.ngllx; ++ix) {
+        const specfem::point::index<dimension> index(ispec, iz, ix);
+        const auto point_field = function(coord(0, ispec, iz, ix),
+                                          coord(1, ispec, iz, ix));
+        specfem::compute::store_on_host(index, point_field, field);
+      }
+    }
+  }
+
+  field.copy_to_device();
+}
+
+// Integral of rho and of lambda + 2 mu over the elastic isotropic elements
+std::pair<type_real, type_real>
+integrate_properties(const specfem::compute::assembly &assembly) {
+  const auto elements =
+      assembly.element_types.get_elements_on_host(elastic, isotropic);
+  const auto &weights = assembly.mesh.quadratures.gll.h_weights;
+
+  type_real mass = 0.0;
+  type_real modulus = 0.0;
+  for (int i = 0; i < elements.extent(0); ++i) {
+    for (int iz = 0; iz < assembly.mesh.ngllz; ++iz) {
+      for (int ix = 0; ix < assembly.mesh.ngllx; ++ix) {
+        const specfem::point::index<dimension> index(elements(i), iz, ix);
+
+        specfem::point::partial_derivatives<dimension, true, false>
+            point_partial_derivatives;
+        specfem::compute::load_on_host(index, assembly.partial_derivatives,
+                                       point_partial_derivatives);
+
+        specfem::point::properties<dimension, elastic, isotropic, false>
+            point_properties;
+        specfem::compute::load_on_host(index, assembly.properties,
+                                       point_properties);
+
+        const type_real volume =
+            point_partial_derivatives.jacobian * weights(ix) * weights(iz);
+        mass += point_properties.rho * volume;
+        modulus += point_properties.lambdaplus2mu * volume;
+      }
+    }
+  }
+
+  return { mass, modulus };
+}
+
+// Energy of the forward wavefield of the assembly, as logged by the monitor
+sample compute_energy(specfem::compute::assembly &assembly,
+                      const boost::filesystem::path &folder) {
+  const auto filename = folder / "energy.txt";
+  {
+    specfem::periodic_tasks::energy_monitor monitor(
+        assembly, specfem::wavefield::simulation_field::forward, 1, 1.0, 0.0,
+        {}, filename, MPIEnvironment::get_mpi());
+    EXPECT_TRUE(monitor.should_run(0));
+    monitor.run();
+  }
+  const auto samples = read_log(filename);
+  EXPECT_EQ(samples.size(), 1);
+  return samples.front();
+}
+
+// The energy log is written with 7 significant digits
+constexpr type_real tolerance = 1e-5;
+
+} // namespace
+
+// The kinetic energy of a uniform velocity is half the mass of the domain.
+// Absorbing boundaries do not contribute to the mass
+TEST(PERIODIC_TASKS, energy_monitor_kinetic) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::program::simulation simulation(
+      YAML::LoadFile(stacey_config), YAML::LoadFile(__default_file__), mpi);
+  auto &assembly = simulation.get_assembly();
+
+  // Compute the mass matrix, including the Stacey terms
+  simulation.run({});
+
+  const auto folder = create_output_folder();
+
+  set_field(assembly, [](const type_real, const type_real) {
+    PointFieldType point_field;
+    for (int icomp = 0; icomp < PointFieldType::components; ++icomp) {
+      point_field.displacement(icomp) = 0.0;
+      point_field.velocity(icomp) = 1.0;
+    }
+    return point_field;
+  });
+
+  const auto [mass, modulus] = integrate_properties(assembly);
+  const auto energy = compute_energy(assembly, folder);
+
+  // |v|^2 = 2
+  EXPECT_NEAR(energy.kinetic, mass, tolerance * mass);
+  EXPECT_NEAR(energy.potential, 0.0, tolerance * mass);
+
+  boost::filesystem::remove_all(folder);
+}
+
+// A uniform strain u = (a x, 0) stores the energy (lambda + 2 mu) a^2 / 2 per
+// unit area
+TEST(PERIODIC_TASKS, energy_monitor_potential) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::program::simulation simulation(YAML::LoadFile(free_surface_config),
+                                          YAML::LoadFile(__default_file__),
+                                          mpi);
+  auto &assembly = simulation.get_assembly();
+
+  const auto folder = create_output_folder();
+
+  constexpr type_real a = 1e-3;
+  set_field(assembly, [](const type_real x, const type_real) {
+    PointFieldType point_field;
+    point_field.displacement(0) = a * x;
+    point_field.displacement(1) = 0.0;
+    point_field.velocity(0) = 0.0;
+    point_field.velocity(1) = 0.0;
+    return point_field;
+  });
+
+  const auto [mass, modulus] = integrate_properties(assembly);
+  const auto energy = compute_energy(assembly, folder);
+  const type_real expected = 0.5 * modulus * a * a;
+
+  EXPECT_NEAR(energy.kinetic, 0.0, tolerance * expected);
+  EXPECT_NEAR(energy.potential, expected, tolerance * expected);
+
+  boost::filesystem::remove_all(folder);
+}
+
+// Once the source has stopped, the total energy of a domain closed by free
+// surfaces is conserved
+TEST(PERIODIC_TASKS, energy_monitor_conservation) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  const auto folder = create_output_folder();
+  const auto filename = folder / "energy.txt";
+
+  YAML::Node parameters = YAML::LoadFile(free_surface_config);
+  YAML::Node setup = parameters["parameters"]["simulation-setup"];
+  setup["simulation-mode"]["forward"]["writer"]["seismogram"]["directory"] =
+      folder.string();
+  setup["solver"]["time-marching"]["time-scheme"]["nstep"] = 600;
+  setup["solver"]["energy-monitor"]["time-interval"] = 10;
+  setup["solver"]["energy-monitor"]["file"] = filename.string();
+
+  {
+    specfem::program::simulation simulation(
+        parameters, YAML::LoadFile(__default_file__), mpi);
+    simulation.run({});
+  }
+
+  const auto samples = read_log(filename);
+  ASSERT_FALSE(samples.empty());
+
+  // The Ricker wavelet is negligible 1.5 periods after its center
+  type_real min_energy = std::numeric_limits<type_real>::max();
+  type_real max_energy = 0.0;
+  int nsamples = 0;
+  for (const auto &s : samples) {
+    if (s.time < 1.5 / f0) {
+      continue;
+    }
+    EXPECT_GT(s.kinetic, 0.0) << "Step " << s.istep;
+    EXPECT_GT(s.potential, 0.0) << "Step " << s.istep;
+    min_energy = std::min(min_energy, s.total);
+    max_energy = std::max(max_energy, s.total);
+    ++nsamples;
+  }
+
+  ASSERT_GT(nsamples, 10);
+
+  // The energy of the Newmark scheme fluctuates at the order of (omega dt)^2
+  EXPECT_LE(max_energy - min_energy, 2e-2 * max_energy)
+      << "Energy is not conserved: " << min_energy << " - " << max_energy;
+
+  boost::filesystem::remove_all(folder);
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
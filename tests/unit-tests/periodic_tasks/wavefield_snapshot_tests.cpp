@@ -0,0 +1,244 @@
+#include "../Kokkos_Environment.hpp"
+#include "../MPI_environment.hpp"
+#include "IO/HDF5/HDF5.hpp"
+#include "IO/dataset_options.hpp"
+#include "constants.hpp"
+#include "periodic_tasks/wavefield_snapshot.hpp"
+#include "program/simulation.hpp"
+#include "yaml-cpp/yaml.h"
+#include <Kokkos_Core.hpp>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// ------------------------------------- //
+// ------- Test configuration ----------- //
+
+// Coupled elastic-acoustic domain
+const std::string parameter_file = "../../../tests/unit-tests/"
+                                   "displacement_tests/Newmark/serial/test3/"
+                                   "specfem_config.yaml";
+
+// More snapshots than staging buffers, such that buffers are reused
+constexpr int nsnapshots = 7;
+constexpr int nbuffers = 2;
+
+// ------------------------------------- //
+
+namespace {
+
+using snapshot = specfem::periodic_tasks::wavefield_snapshot;
+using FieldView = specfem::compute::impl::FieldViewType;
+using HostFieldView =
+    Kokkos::View<type_real **, Kokkos::LayoutLeft, Kokkos::HostSpace>;
+
+constexpr int nfields = 3;
+
+// Value of a field entry at a given snapshot. Every snapshot, medium, field
+// and entry holds a different value
+type_real get_value(const int istep, const int imedium, const int ifield,
+                    const int iglob, const int icomp) {
+  return istep + 0.5 * imedium + 0.125 * ifield + 1e-3 * iglob +
+         1e-4 * icomp;
+}
+
+// Forward fields of the elastic (0) and acoustic (1) media
+std::vector<std::vector<FieldView> >
+get_fields(const specfem::compute::assembly &assembly) {
+  const auto &field = assembly.fields.forward;
+  return { { field.elastic.field, field.elastic.field_dot,
+             field.elastic.field_dot_dot },
+           { field.acoustic.field, field.acoustic.field_dot,
+             field.acoustic.field_dot_dot } };
+}
+
+void fill_fields(const specfem::compute::assembly &assembly,
+                 const int istep) {
+  const auto fields = get_fields(assembly);
+  for (int imedium = 0; imedium < 2; ++imedium) {
+    for (int ifield = 0; ifield < nfields; ++ifield) {
+      const auto &view = fields[imedium][ifield];
+      auto h_view = Kokkos::create_mirror_view(view);
+      for (int iglob = 0; iglob < view.extent(0); ++iglob) {
+        for (int icomp = 0; icomp < view.extent(1); ++icomp) {
+          h_view(iglob, icomp) =
+              get_value(istep, imedium, ifield, iglob, icomp);
+        }
+      }
+      Kokkos::deep_copy(view, h_view);
+    }
+  }
+  Kokkos::fence();
+}
+
+// Run the snapshot task at every step, overwriting the fields after every
+// call. The values written are the values of the fields when run() is called
+void run_snapshots(const specfem::compute::assembly &assembly,
+                   snapshot &task) {
+  for (int istep = 0; istep < nsnapshots; ++istep) {
+    fill_fields(assembly, istep);
+    ASSERT_TRUE(task.should_run(istep));
+    task.run();
+    fill_fields(assembly, -1);
+  }
+}
+
+void check_field(const HostFieldView &view, const int istep,
+                 const int imedium, const int ifield) {
+  for (int iglob = 0; iglob < view.extent(0); ++iglob) {
+    for (int icomp = 0; icomp < view.extent(1); ++icomp) {
+      ASSERT_EQ(view(iglob, icomp),
+                get_value(istep, imedium, ifield, iglob, icomp))
+          << "Snapshot " << istep << ", medium " << imedium << ", field "
+          << ifield << ", point " << iglob << ", component " << icomp;
+    }
+  }
+}
+
+// Temporary folder for the outputs of a test
+boost::filesystem::path create_output_folder() {
+  const auto output_folder =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("specfem-snapshot-%%%%-%%%%");
+  boost::filesystem::create_directories(output_folder);
+  return output_folder;
+}
+
+} // namespace
+
+// Every binary snapshot holds the fields at the step it was taken, even when
+// the staging buffers are reused. All snapshots are on disk once finalize()
+// returns
+TEST(PERIODIC_TASKS, wavefield_snapshot_binary) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::program::simulation simulation(
+      YAML::LoadFile(parameter_file), YAML::LoadFile(__default_file__), mpi);
+  const auto &assembly = simulation.get_assembly();
+  const auto fields = get_fields(assembly);
+  ASSERT_GT(fields[0][0].extent(0), 0);
+  ASSERT_GT(fields[1][0].extent(0), 0);
+
+  const auto output_folder = create_output_folder();
+
+  snapshot task(assembly, specfem::wavefield::simulation_field::forward,
+                snapshot::format::binary, 1, output_folder, nbuffers);
+  run_snapshots(assembly, task);
+  task.finalize();
+
+  for (int istep = 0; istep < nsnapshots; ++istep) {
+    const auto filename =
+        output_folder / ("Snapshot" + std::to_string(istep) + ".bin");
+    ASSERT_TRUE(boost::filesystem::exists(filename)) << filename.string();
+
+    std::ifstream file(filename.string(), std::ios::binary);
+    std::size_t nvalues = 0;
+    for (int imedium = 0; imedium < 2; ++imedium) {
+      for (int ifield = 0; ifield < nfields; ++ifield) {
+        const auto &field = fields[imedium][ifield];
+        HostFieldView view("view", field.extent(0), field.extent(1));
+        file.read(reinterpret_cast<char *>(view.data()),
+                  sizeof(type_real) * view.size());
+        ASSERT_TRUE(file) << "Snapshot " << istep << " is truncated";
+        check_field(view, istep, imedium, ifield);
+        nvalues += view.size();
+      }
+    }
+
+    EXPECT_EQ(boost::filesystem::file_size(filename),
+              sizeof(type_real) * nvalues);
+  }
+
+  // Finalizing again (as the destructor does) is a no-op
+  EXPECT_NO_THROW(task.finalize());
+
+  boost::filesystem::remove_all(output_folder);
+}
+
+// Errors raised by the writer thread are rethrown on the solver thread
+TEST(PERIODIC_TASKS, wavefield_snapshot_error) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::program::simulation simulation(
+      YAML::LoadFile(parameter_file), YAML::LoadFile(__default_file__), mpi);
+  const auto &assembly = simulation.get_assembly();
+
+  const auto output_folder = create_output_folder();
+  boost::filesystem::remove_all(output_folder);
+
+  snapshot task(assembly, specfem::wavefield::simulation_field::forward,
+                snapshot::format::binary, 1, output_folder, nbuffers);
+  ASSERT_TRUE(task.should_run(0));
+  task.run();
+  EXPECT_THROW(task.finalize(), std::runtime_error);
+}
+
+#ifndef NO_HDF5
+// HDF5 snapshots are chunked and compressed with the dataset options, and
+// read back to the values of the fields
+TEST(PERIODIC_TASKS, wavefield_snapshot_hdf5) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::program::simulation simulation(
+      YAML::LoadFile(parameter_file), YAML::LoadFile(__default_file__), mpi);
+  const auto &assembly = simulation.get_assembly();
+  const auto fields = get_fields(assembly);
+
+  const auto output_folder = create_output_folder();
+
+  specfem::IO::dataset_options options;
+  options.compression = specfem::IO::dataset_options::filter::shuffle_deflate;
+  options.chunk_bytes = 4096;
+
+  snapshot task(assembly, specfem::wavefield::simulation_field::forward,
+                snapshot::format::HDF5, 1, output_folder, nbuffers, options);
+  run_snapshots(assembly, task);
+  task.finalize();
+
+  const std::vector<std::vector<std::string> > names = {
+    { "/Elastic/Displacement", "/Elastic/Velocity", "/Elastic/Acceleration" },
+    { "/Acoustic/Potential", "/Acoustic/PotentialDot",
+      "/Acoustic/PotentialDotDot" }
+  };
+
+  using InputLibrary = specfem::IO::HDF5<specfem::IO::read>;
+
+  for (int istep = 0; istep < nsnapshots; ++istep) {
+    const auto filename = output_folder / ("Snapshot" + std::to_string(istep));
+
+    {
+      typename InputLibrary::File file(filename.string());
+      for (int imedium = 0; imedium < 2; ++imedium) {
+        for (int ifield = 0; ifield < nfields; ++ifield) {
+          const auto &field = fields[imedium][ifield];
+          HostFieldView view("view", field.extent(0), field.extent(1));
+          file.openDataset(names[imedium][ifield], view).read();
+          check_field(view, istep, imedium, ifield);
+        }
+      }
+    }
+
+    // Storage of the datasets
+    H5::H5File file(filename.string() + ".h5", H5F_ACC_RDONLY);
+    for (const auto &medium : names) {
+      for (const auto &name : medium) {
+        const auto plist = file.openDataSet(name).getCreatePlist();
+        EXPECT_EQ(plist.getLayout(), H5D_CHUNKED) << name;
+        EXPECT_EQ(plist.getNfilters(), 2) << name;
+      }
+    }
+  }
+
+  boost::filesystem::remove_all(output_folder);
+}
+#endif
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
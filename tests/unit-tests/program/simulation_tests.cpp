@@ -0,0 +1,290 @@
+#include "../Kokkos_Environment.hpp"
+#include "../MPI_environment.hpp"
+#include "IO/ASCII/ASCII.hpp"
+#include "IO/property/writer.hpp"
+#include "constants.hpp"
+#include "program/simulation.hpp"
+#include "yaml-cpp/yaml.h"
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+#include <vector>
+
+// ------------------------------------- //
+// ------- Test configuration ----------- //
+
+// Homogeneous elastic domain with no interfaces
+const std::string parameter_file = "../../../tests/unit-tests/"
+                                   "displacement_tests/Newmark/serial/test1/"
+                                   "specfem_config.yaml";
+
+const std::string sources_file = "../../../tests/unit-tests/"
+                                 "displacement_tests/Newmark/serial/test1/"
+                                 "sources.yaml";
+
+// ------------------------------------- //
+
+namespace {
+
+using traces_type = std::vector<std::vector<type_real> >;
+
+// Seismogram values for every station and component
+traces_type get_traces(specfem::program::simulation &simulation) {
+  auto seismograms = simulation.get_assembly().receivers;
+  seismograms.sync_seismograms();
+
+  traces_type traces;
+  for (auto [station_name, network_name, seismogram_type] :
+       seismograms.get_stations()) {
+    traces_type station_traces(2);
+    for (auto [time, value] : seismograms.get_seismogram(
+             station_name, network_name, seismogram_type)) {
+      for (int icomp = 0; icomp < 2; ++icomp) {
+        station_traces[icomp].push_back(value[icomp]);
+      }
+    }
+    traces.insert(traces.end(), station_traces.begin(), station_traces.end());
+  }
+
+  return traces;
+}
+
+// Traces agree to round-off. Atomic updates of the assembled fields may be
+// applied in a different order on parallel backends
+void compare_traces(const traces_type &reference, const traces_type &traces) {
+  ASSERT_EQ(reference.size(), traces.size());
+
+  type_real max_value = 0.0;
+  for (const auto &trace : reference) {
+    for (const auto value : trace) {
+      max_value = std::max(max_value, std::abs(value));
+    }
+  }
+  ASSERT_GT(max_value, 0.0) << "Reference seismograms are zero";
+
+  const type_real tolerance =
+      100 * std::numeric_limits<type_real>::epsilon() * max_value;
+  for (int itrace = 0; itrace < reference.size(); ++itrace) {
+    ASSERT_EQ(reference[itrace].size(), traces[itrace].size());
+    for (int isample = 0; isample < reference[itrace].size(); ++isample) {
+      ASSERT_NEAR(reference[itrace][isample], traces[itrace][isample],
+                  tolerance)
+          << "Trace " << itrace << ", sample " << isample;
+    }
+  }
+}
+
+// Traces multiplied by a factor
+traces_type scale_traces(traces_type traces, const type_real factor) {
+  for (auto &trace : traces) {
+    for (auto &value : trace) {
+      value *= factor;
+    }
+  }
+  return traces;
+}
+
+// Scale the density and elastic moduli of the (elastic isotropic) model.
+// The displacement is scaled by the inverse of the factor
+void scale_model(specfem::compute::assembly &assembly, const type_real factor) {
+  auto &properties = assembly.properties;
+  properties.copy_to_host();
+
+  const auto &elastic = properties.elastic_isotropic;
+  for (const auto &view :
+       { elastic.h_rho, elastic.h_mu, elastic.h_lambdaplus2mu }) {
+    for (int i = 0; i < view.extent(0); ++i) {
+      for (int iz = 0; iz < view.extent(1); ++iz) {
+        for (int ix = 0; ix < view.extent(2); ++ix) {
+          view(i, iz, ix) *= factor;
+        }
+      }
+    }
+  }
+
+  properties.copy_to_device();
+}
+
+// Temporary folder for the outputs of a test
+boost::filesystem::path create_output_folder() {
+  const auto output_folder =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("specfem-simulation-%%%%-%%%%");
+  boost::filesystem::create_directories(output_folder);
+  return output_folder;
+}
+
+// Test configuration writing seismograms to the output folder
+YAML::Node get_parameters(const boost::filesystem::path &output_folder) {
+  YAML::Node parameters = YAML::LoadFile(parameter_file);
+  parameters["parameters"]["simulation-setup"]["simulation-mode"]["forward"]
+            ["writer"]["seismogram"]["directory"] = output_folder.string();
+  return parameters;
+}
+
+} // namespace
+
+// Runs of a persistent simulation (as used by the Python bindings) start from
+// a reset state and reproduce the seismograms of the first run
+TEST(PROGRAM, simulation_reset_fields) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  const auto output_folder = create_output_folder();
+
+  specfem::program::simulation simulation(
+      get_parameters(output_folder), YAML::LoadFile(__default_file__), mpi);
+
+  simulation.run({});
+  const auto reference = get_traces(simulation);
+
+  // Fields are reset automatically by a subsequent run
+  simulation.run({});
+  compare_traces(reference, get_traces(simulation));
+
+  // Explicit reset
+  simulation.reset_fields();
+  simulation.run({});
+  compare_traces(reference, get_traces(simulation));
+
+  boost::filesystem::remove_all(output_folder);
+}
+
+// Resuming from a checkpoint reproduces the seismograms of an uninterrupted
+// run. The mass matrix restored along with the fields (interleaved layout) is
+// recomputed
+TEST(PROGRAM, checkpoint_restart) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  const auto output_folder = create_output_folder();
+  const YAML::Node defaults = YAML::LoadFile(__default_file__);
+
+  const auto reference = [&]() {
+    specfem::program::simulation simulation(get_parameters(output_folder),
+                                            defaults, mpi);
+    simulation.run({});
+    return get_traces(simulation);
+  }();
+
+  const auto get_checkpoint_parameters = [&](const bool restart) {
+    YAML::Node parameters = get_parameters(output_folder);
+    YAML::Node checkpoint =
+        parameters["parameters"]["simulation-setup"]["solver"]["checkpoint"];
+    checkpoint["directory"] = output_folder.string();
+    checkpoint["time-interval"] = 125;
+    checkpoint["restart"] = restart;
+    return parameters;
+  };
+
+  // The last checkpoint is written after 251 of the 300 timesteps
+  {
+    specfem::program::simulation simulation(get_checkpoint_parameters(false),
+                                            defaults, mpi);
+    simulation.run({});
+  }
+  ASSERT_TRUE(boost::filesystem::exists(output_folder / "checkpoint.bin"));
+
+  specfem::program::simulation simulation(get_checkpoint_parameters(true),
+                                          defaults, mpi);
+  simulation.run({});
+  compare_traces(reference, get_traces(simulation));
+
+  boost::filesystem::remove_all(output_folder);
+}
+
+// Sources are replaced in place. Doubling the source amplitude doubles the
+// seismograms
+TEST(PROGRAM, simulation_set_sources) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  const auto output_folder = create_output_folder();
+
+  specfem::program::simulation simulation(
+      get_parameters(output_folder), YAML::LoadFile(__default_file__), mpi);
+
+  simulation.run({});
+  const auto reference = get_traces(simulation);
+
+  YAML::Node sources = YAML::LoadFile(sources_file);
+  YAML::Node ricker = sources["sources"][0]["force"]["Ricker"];
+  ricker["factor"] = 2 * ricker["factor"].as<type_real>();
+
+  simulation.set_sources(sources);
+  simulation.run({});
+  compare_traces(scale_traces(reference, 2.0), get_traces(simulation));
+
+  boost::filesystem::remove_all(output_folder);
+}
+
+// Receivers are replaced in place. A subset of the stations reproduces the
+// corresponding seismograms
+TEST(PROGRAM, simulation_set_receivers) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  const auto output_folder = create_output_folder();
+
+  specfem::program::simulation simulation(
+      get_parameters(output_folder), YAML::LoadFile(__default_file__), mpi);
+
+  simulation.run({});
+  const auto reference = get_traces(simulation);
+
+  // Second station of the STATIONS file
+  YAML::Node station;
+  station["network"] = "AA";
+  station["station"] = "S0002";
+  station["x"] = 2250.0;
+  station["z"] = 3000.0;
+  YAML::Node stations;
+  stations["stations"].push_back(station);
+
+  simulation.set_receivers(stations);
+  simulation.run({});
+
+  const auto traces = get_traces(simulation);
+  ASSERT_EQ(traces.size(), 2u);
+  compare_traces({ reference[2], reference[3] }, traces);
+
+  boost::filesystem::remove_all(output_folder);
+}
+
+// Properties are updated in place from a model written by the property
+// writer. Scaling the density and moduli by 2 halves the seismograms
+TEST(PROGRAM, simulation_update_properties) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  const auto output_folder = create_output_folder();
+  const YAML::Node defaults = YAML::LoadFile(__default_file__);
+
+  // Write the scaled model
+  {
+    specfem::program::simulation simulation(get_parameters(output_folder),
+                                            defaults, mpi);
+    auto &assembly = simulation.get_assembly();
+    scale_model(assembly, 2.0);
+    specfem::IO::property_writer<specfem::IO::ASCII<specfem::IO::write> >(
+        output_folder.string())
+        .write(assembly);
+  }
+
+  specfem::program::simulation simulation(get_parameters(output_folder),
+                                          defaults, mpi);
+
+  simulation.run({});
+  const auto reference = get_traces(simulation);
+
+  simulation.update_properties(output_folder.string(), "ASCII");
+  simulation.run({});
+  compare_traces(scale_traces(reference, 0.5), get_traces(simulation));
+
+  boost::filesystem::remove_all(output_folder);
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,209 @@
+#include "../Kokkos_Environment.hpp"
+#include "../MPI_environment.hpp"
+#include "IO/interface.hpp"
+#include "compute/interface.hpp"
+#include "enumerations/interface.hpp"
+#include "kokkos_kernels/domain_kernels.hpp"
+#include "mesh/mesh.hpp"
+#include "point/kernels.hpp"
+#include "quadrature/interface.hpp"
+#include "solver/time_marching.hpp"
+#include "timescheme/newmark.hpp"
+#include "yaml-cpp/yaml.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// ------------------------------------- //
+// ------- Test configuration ----------- //
+
+// Coupled acoustic-elastic domain with a horizontal interface
+const std::string database_file = "../../../tests/unit-tests/"
+                                  "displacement_tests/Newmark/serial/test3/"
+                                  "database.bin";
+const std::string stations_file = "../../../tests/unit-tests/"
+                                  "displacement_tests/Newmark/serial/test3/"
+                                  "STATIONS";
+
+constexpr type_real dt = 0.85e-3;
+constexpr int nsteps = 600;
+
+// The force source drives the backward wavefield within the acoustic domain.
+// The adjoint source is located at station S0001 within the elastic domain
+const std::string sources = R"(
+number-of-sources: 2
+sources:
+  - force:
+      x : 1575.0
+      z : 2900.0
+      source_surf: false
+      angle : 0.0
+      vx : 0.0
+      vz : 0.0
+      Ricker:
+        factor: 1e9
+        tshift: 0.0
+        f0: 10.0
+  - adjoint-source:
+      station_name: S0001
+      network_name: AA
+      x : 1450.0
+      z : 2200.0
+      source_surf: false
+      angle : 0.0
+      vx : 0.0
+      vz : 0.0
+      Ricker:
+        factor: 1e9
+        tshift: 0.0
+        f0: 10.0
+)";
+
+// ------------------------------------- //
+
+namespace {
+
+using kernels_type = std::map<std::string, std::vector<type_real> >;
+
+/**
+ * @brief Copy the Frechet kernels of every element of a given medium to the
+ * host, one vector per kernel name
+ */
+template <specfem::element::medium_tag MediumTag>
+void get_kernels(const specfem::compute::assembly &assembly,
+                 kernels_type &kernels) {
+  constexpr auto isotropic = specfem::element::property_tag::isotropic;
+  using PointKernelType =
+      specfem::point::kernels<specfem::dimension::type::dim2, MediumTag,
+                              isotropic, false>;
+
+  const auto elements =
+      assembly.element_types.get_elements_on_host(MediumTag, isotropic);
+  const int ngllz = assembly.mesh.ngllz;
+  const int ngllx = assembly.mesh.ngllx;
+
+  for (int i = 0; i < elements.extent(0); ++i) {
+    for (int iz = 0; iz < ngllz; ++iz) {
+      for (int ix = 0; ix < ngllx; ++ix) {
+        const specfem::point::index<specfem::dimension::type::dim2> index(
+            elements(i), iz, ix);
+        PointKernelType point_kernels;
+        specfem::compute::load_on_host(index, assembly.kernels,
+                                       point_kernels);
+
+        if constexpr (MediumTag == specfem::element::medium_tag::elastic) {
+          kernels["elastic/rho"].push_back(point_kernels.rho);
+          kernels["elastic/mu"].push_back(point_kernels.mu);
+          kernels["elastic/kappa"].push_back(point_kernels.kappa);
+        } else {
+          kernels["acoustic/rho"].push_back(point_kernels.rho);
+          kernels["acoustic/kappa"].push_back(point_kernels.kappa);
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief Run a combined simulation and return the Frechet kernels
+ *
+ * The buffer wavefield is zero, so the backward wavefield is driven by the
+ * force source alone after the first backward step.
+ *
+ * @param fuse_kernels Fuse the stiffness and Frechet derivative sweeps
+ * @return kernels_type Frechet kernels within the elastic and acoustic media
+ */
+kernels_type run_simulation(const bool fuse_kernels) {
+  constexpr auto combined = specfem::simulation::type::combined;
+  constexpr auto dim2 = specfem::dimension::type::dim2;
+
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  specfem::quadrature::gll::gll gll(0.0, 0.0, 5);
+  const specfem::quadrature::quadratures quadratures(gll);
+
+  specfem::mesh::mesh mesh = specfem::IO::read_mesh(database_file, mpi);
+
+  auto [source_vector, t0] = specfem::IO::read_sources(
+      YAML::Load(sources), nsteps, 0.0, dt, combined);
+
+  auto receivers = specfem::IO::read_receivers(stations_file, 0.0);
+
+  auto it = std::make_shared<specfem::time_scheme::newmark<combined> >(
+      nsteps, 1, dt, t0);
+
+  specfem::compute::assembly assembly(
+      mesh, quadratures, source_vector, receivers,
+      { specfem::enums::seismogram::type::displacement }, t0, dt, nsteps,
+      it->get_max_seismogram_step(), it->get_nstep_between_samples(),
+      combined, nullptr);
+
+  it->link_assembly(assembly);
+
+  const specfem::kokkos_kernels::domain_kernels<
+      specfem::wavefield::simulation_field::adjoint, dim2, 5>
+      adjoint_kernels(assembly);
+  const specfem::kokkos_kernels::domain_kernels<
+      specfem::wavefield::simulation_field::backward, dim2, 5>
+      backward_kernels(assembly);
+
+  specfem::solver::time_marching<combined, dim2, 5> solver(
+      assembly, adjoint_kernels, backward_kernels, it, {}, 1, fuse_kernels);
+  solver.run();
+
+  assembly.kernels.copy_to_host();
+
+  kernels_type kernels;
+  get_kernels<specfem::element::medium_tag::elastic>(assembly, kernels);
+  get_kernels<specfem::element::medium_tag::acoustic>(assembly, kernels);
+
+  return kernels;
+}
+
+} // namespace
+
+// The fused sweep only reorders floating point operations, so the Frechet
+// kernels agree with the unfused sweeps to round-off
+TEST(SOLVER, fused_combined_kernels) {
+  const auto fused = run_simulation(true);
+  const auto unfused = run_simulation(false);
+
+  ASSERT_EQ(fused.size(), unfused.size());
+
+  const type_real tolerance =
+      1e3 * std::numeric_limits<type_real>::epsilon();
+
+  for (const auto &[name, reference] : unfused) {
+    const auto &values = fused.at(name);
+    ASSERT_EQ(values.size(), reference.size());
+
+    type_real max_value = 0.0;
+    type_real max_difference = 0.0;
+    for (int i = 0; i < reference.size(); ++i) {
+      max_value = std::max(max_value, std::abs(reference[i]));
+      max_difference =
+          std::max(max_difference, std::abs(values[i] - reference[i]));
+    }
+
+    ASSERT_GT(max_value, 0.0) << "Kernel " << name << " is zero";
+
+    EXPECT_LE(max_difference, tolerance * max_value)
+        << "--------------------------------------------------\n"
+        << "\033[0;31m[FAILED]\033[0m Test failed\n"
+        << " - Kernel: " << name << "\n"
+        << " - Maximum value: " << max_value << "\n"
+        << " - Maximum difference: " << max_difference << "\n"
+        << "--------------------------------------------------\n";
+  }
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,90 @@
+#include "solver/kernel_sampling.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+
+namespace {
+
+// Adjoint and backward traces at a point: windowed harmonics with a dominant
+// period of 1 s, overlapping in time
+double adjoint(const double t) {
+  return std::sin(2.0 * M_PI * t) * std::exp(-std::pow((t - 8.0) / 3.0, 2));
+}
+
+double backward(const double t) {
+  return std::cos(2.0 * M_PI * t + 0.3) *
+         std::exp(-std::pow((t - 11.0) / 3.0, 2));
+}
+
+// Accumulate the kernel integrand over the backward time loop
+double accumulate(const int nstep, const type_real dt,
+                  const int nstep_between_kernels) {
+  const specfem::solver::kernel_sampling sampling(nstep,
+                                                  nstep_between_kernels);
+  double kernel = 0.0;
+  for (int istep = nstep - 1; istep >= 0; --istep) {
+    if (sampling.sample(istep)) {
+      const double t = istep * dt;
+      kernel += sampling.weight(istep, dt) * adjoint(t) * backward(t);
+    }
+  }
+  return kernel;
+}
+
+} // namespace
+
+TEST(KERNEL_SAMPLING, schedule) {
+  const type_real dt = 0.01;
+  for (const int nstep : { 1, 7, 100, 1001 }) {
+    for (const int nstep_between_kernels : { 1, 2, 3, 10, 2000 }) {
+      const specfem::solver::kernel_sampling sampling(nstep,
+                                                      nstep_between_kernels);
+
+      // The first backward step is always sampled
+      EXPECT_TRUE(sampling.sample(nstep - 1));
+
+      int nsamples = 0;
+      double total = 0.0;
+      for (int istep = nstep - 1; istep >= 0; --istep) {
+        if (sampling.sample(istep)) {
+          ++nsamples;
+          total += sampling.weight(istep, dt);
+        }
+      }
+
+      // Samples cover the whole simulation exactly once
+      EXPECT_EQ(nsamples,
+                (nstep + nstep_between_kernels - 1) / nstep_between_kernels);
+      EXPECT_NEAR(total, nstep * dt, 1e-4 * nstep * dt)
+          << "nstep = " << nstep
+          << ", nstep_between_kernels = " << nstep_between_kernels;
+    }
+  }
+
+  EXPECT_THROW(specfem::solver::kernel_sampling(100, 0), std::runtime_error);
+}
+
+// Accuracy trade-off of subsampled kernels. The integrand is the product of
+// two wavefields with a dominant period of 1 s, which oscillates with a
+// period of 0.5 s. The reference kernel is accumulated at every step (200
+// steps per period).
+//
+// - Sampling intervals up to a quarter of the dominant period reproduce the
+//   reference kernel to within the floating point error.
+// - Sampling every half period aliases the integrand and the kernel is wrong.
+TEST(KERNEL_SAMPLING, accuracy) {
+  const int nstep = 4000;
+  const type_real dt = 0.005;
+
+  const double reference = accumulate(nstep, dt, 1);
+  ASSERT_GT(std::abs(reference), 0.1);
+
+  for (const int nstep_between_kernels : { 2, 5, 10, 20, 25, 50 }) {
+    const double kernel = accumulate(nstep, dt, nstep_between_kernels);
+    EXPECT_NEAR(kernel, reference, 1e-4 * std::abs(reference))
+        << "nstep_between_kernels = " << nstep_between_kernels
+        << " (sampling interval = " << nstep_between_kernels * dt << " s)";
+  }
+
+  const double aliased = accumulate(nstep, dt, 100);
+  EXPECT_GT(std::abs(aliased - reference), 0.1 * std::abs(reference));
+}
@@ -0,0 +1,205 @@
+#include "../Kokkos_Environment.hpp"
+#include "../MPI_environment.hpp"
+#include "compute/interface.hpp"
+#include "constants.hpp"
+#include "enumerations/interface.hpp"
+#include "point/kernels.hpp"
+#include "program/simulation.hpp"
+#include "yaml-cpp/yaml.h"
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+// ------------------------------------- //
+// ------- Test configuration ----------- //
+
+// Homogeneous elastic domain with Stacey boundaries on all edges
+const std::string parameter_file = "../../../tests/unit-tests/"
+                                   "displacement_tests/Newmark/serial/test7/"
+                                   "specfem_config.yaml";
+
+const std::string sources_file = "../../../tests/unit-tests/"
+                                 "displacement_tests/Newmark/serial/test7/"
+                                 "sources.yaml";
+
+// The adjoint source drives the adjoint wavefield from station S0035
+const std::string adjoint_source = R"(
+adjoint-source:
+  station_name: S0035
+  network_name: AA
+  x : 500.0
+  z : 2200.0
+  source_surf: false
+  angle : 0.0
+  vx : 0.0
+  vz : 0.0
+  Ricker:
+    factor: 1e10
+    tshift: 0.0
+    f0: 10.0
+)";
+
+// Relative L2 misfit between the reconstructed and the forward seismograms
+constexpr type_real tolerance = 1e-2;
+
+// ------------------------------------- //
+
+namespace {
+
+using traces_type = std::vector<std::vector<type_real> >;
+
+// Seismogram values for every station and component
+traces_type get_traces(specfem::program::simulation &simulation) {
+  auto seismograms = simulation.get_assembly().receivers;
+  seismograms.sync_seismograms();
+
+  traces_type traces;
+  for (auto [station_name, network_name, seismogram_type] :
+       seismograms.get_stations()) {
+    traces_type station_traces(2);
+    for (auto [time, value] : seismograms.get_seismogram(
+             station_name, network_name, seismogram_type)) {
+      for (int icomp = 0; icomp < 2; ++icomp) {
+        station_traces[icomp].push_back(value[icomp]);
+      }
+    }
+    traces.insert(traces.end(), station_traces.begin(), station_traces.end());
+  }
+
+  return traces;
+}
+
+// Temporary folder for the outputs of a test
+boost::filesystem::path create_output_folder() {
+  const auto output_folder =
+      boost::filesystem::temp_directory_path() /
+      boost::filesystem::unique_path("specfem-stacey-%%%%-%%%%");
+  boost::filesystem::create_directories(output_folder);
+  return output_folder;
+}
+
+// Forward simulation storing the final wavefield and the Stacey traction
+YAML::Node get_forward_parameters(const boost::filesystem::path &folder) {
+  YAML::Node parameters = YAML::LoadFile(parameter_file);
+  YAML::Node writer =
+      parameters["parameters"]["simulation-setup"]["simulation-mode"]
+                ["forward"]["writer"];
+  writer["seismogram"]["directory"] = folder.string();
+  writer["wavefield"]["directory"] = folder.string();
+  writer["wavefield"]["format"] = "ASCII";
+  return parameters;
+}
+
+// Combined simulation reading the forward wavefield. The backward wavefield
+// is driven by the forward sources, the adjoint wavefield by the adjoint
+// source
+YAML::Node get_combined_parameters(const boost::filesystem::path &folder) {
+  YAML::Node parameters = YAML::LoadFile(parameter_file);
+  YAML::Node mode = parameters["parameters"]["simulation-setup"]
+                              ["simulation-mode"];
+  mode.remove("forward");
+
+  YAML::Node combined = mode["combined"];
+  combined["reader"]["wavefield"]["directory"] = folder.string();
+  combined["reader"]["wavefield"]["format"] = "ASCII";
+  combined["writer"]["kernels"]["directory"] = folder.string();
+  combined["writer"]["kernels"]["format"] = "ASCII";
+
+  YAML::Node sources = YAML::LoadFile(sources_file);
+  sources["sources"].push_back(YAML::Load(adjoint_source));
+  sources["number-of-sources"] = sources["sources"].size();
+  parameters["parameters"]["sources"] = sources;
+
+  return parameters;
+}
+
+} // namespace
+
+// The backward wavefield of a combined simulation is reconstructed from the
+// final forward wavefield and the Stacey traction stored on the absorbing
+// edges. Its seismograms retrace the forward seismograms in reverse time, and
+// the Frechet kernels built from it are finite and non-zero
+TEST(SOLVER, stacey_reconstruction) {
+  specfem::MPI::MPI *mpi = MPIEnvironment::get_mpi();
+
+  const auto output_folder = create_output_folder();
+  const YAML::Node defaults = YAML::LoadFile(__default_file__);
+
+  const auto forward = [&]() {
+    specfem::program::simulation simulation(
+        get_forward_parameters(output_folder), defaults, mpi);
+    simulation.run({});
+    return get_traces(simulation);
+  }();
+
+  specfem::program::simulation simulation(
+      get_combined_parameters(output_folder), defaults, mpi);
+  simulation.run({});
+  const auto backward = get_traces(simulation);
+
+  // Backward sample k is recorded at forward step nstep - 1 - k
+  ASSERT_EQ(forward.size(), backward.size());
+  type_real norm = 0.0;
+  type_real misfit = 0.0;
+  for (int itrace = 0; itrace < forward.size(); ++itrace) {
+    const int nsamples = forward[itrace].size();
+    ASSERT_EQ(nsamples, backward[itrace].size());
+    for (int isample = 0; isample < nsamples; ++isample) {
+      const type_real reference = forward[itrace][nsamples - 1 - isample];
+      const type_real value = backward[itrace][isample];
+      norm += reference * reference;
+      misfit += (value - reference) * (value - reference);
+    }
+  }
+
+  ASSERT_GT(norm, 0.0) << "Forward seismograms are zero";
+  EXPECT_LE(std::sqrt(misfit / norm), tolerance)
+      << "Backward wavefield does not reconstruct the forward wavefield";
+
+  // Frechet kernels within the elastic domain
+  auto &assembly = simulation.get_assembly();
+  assembly.kernels.copy_to_host();
+
+  constexpr auto elastic = specfem::element::medium_tag::elastic;
+  constexpr auto isotropic = specfem::element::property_tag::isotropic;
+  using PointKernelType =
+      specfem::point::kernels<specfem::dimension::type::dim2, elastic,
+                              isotropic, false>;
+
+  const auto elements =
+      assembly.element_types.get_elements_on_host(elastic, isotropic);
+  ASSERT_GT(elements.extent(0), 0);
+
+  type_real max_kernel = 0.0;
+  for (int i = 0; i < elements.extent(0); ++i) {
+    for (int iz = 0; iz < assembly.mesh.ngllz; ++iz) {
+      for (int ix = 0; ix < assembly.mesh.ngllx; ++ix) {
+        const specfem::point::index<specfem::dimension::type::dim2> index(
+            elements(i), iz, ix);
+        PointKernelType point_kernels;
+        specfem::compute::load_on_host(index, assembly.kernels,
+                                       point_kernels);
+        for (const auto value :
+             { point_kernels.rho, point_kernels.mu, point_kernels.kappa }) {
+          ASSERT_TRUE(std::isfinite(value))
+              << "Kernel is not finite in element " << elements(i);
+          max_kernel = std::max(max_kernel, std::abs(value));
+        }
+      }
+    }
+  }
+
+  EXPECT_GT(max_kernel, 0.0) << "Frechet kernels are zero";
+
+  boost::filesystem::remove_all(output_folder);
+}
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  ::testing::AddGlobalTestEnvironment(new MPIEnvironment);
+  ::testing::AddGlobalTestEnvironment(new KokkosEnvironment);
+  return RUN_ALL_TESTS();
+}